@@ -14,6 +14,7 @@
 #include "Trace.h"
 #include "index/Serialization.h"
 #include "clang/Basic/Version.h"
+#include "llvm/Support/Allocator.h"
 #include "llvm/Support/CommandLine.h"
 #include "llvm/Support/FileSystem.h"
 #include "llvm/Support/Path.h"
@@ -185,6 +186,18 @@ static llvm::cl::opt<bool> EnableFunctionArgSnippets(
                    "placeholders for method parameters."),
     llvm::cl::init(clangd::CodeCompleteOptions().EnableFunctionArgSnippets));
 
+static llvm::cl::opt<unsigned> SlabCacheMB(
+    "slab-cache-mb",
+    llvm::cl::desc("Keep up to this many megabytes of allocator slabs from "
+                   "discarded ASTs for reuse by the next parse. 0 disables "
+                   "the cache."),
+    llvm::cl::init(0), llvm::cl::Hidden);
+
+static llvm::cl::opt<bool> SlabHugePages(
+    "slab-huge-pages",
+    llvm::cl::desc("Back large allocator slabs with transparent huge pages."),
+    llvm::cl::init(false), llvm::cl::Hidden);
+
 int main(int argc, char *argv[]) {
   llvm::sys::PrintStackTraceOnErrorSignal(argv[0]);
   llvm::cl::SetVersionPrinter([](llvm::raw_ostream &OS) {
@@ -203,6 +216,11 @@ int main(int argc, char *argv[]) {
     PrettyPrint = true;
   }
 
+  // Preambles and ASTs are rebuilt on every edit; optionally recycle their
+  // slabs instead of returning them to malloc each time.
+  llvm::SlabCache::setCapacity(size_t(SlabCacheMB) * 1024 * 1024);
+  llvm::SlabCache::setUseHugePages(SlabHugePages);
+
   if (!RunSynchronously && WorkerThreadsCount == 0) {
     llvm::errs() << "A number of worker threads cannot be 0. Did you mean to "
                     "specify -run-synchronously?";
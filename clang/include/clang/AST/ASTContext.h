@@ -689,6 +689,12 @@ public:
     return BumpAlloc.getTotalMemory();
   }
 
+  /// Return slab and byte counts for the allocator backing the AST, and the
+  /// state of the process-wide slab cache.
+  llvm::AllocatorStatistics getASTAllocatorStatistics() const {
+    return BumpAlloc.getStatistics().withSlabCache();
+  }
+
   /// Return the total memory used for various side tables.
   size_t getSideTableAllocatedMemory() const;
 
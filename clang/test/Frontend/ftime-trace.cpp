@@ -0,0 +1,21 @@
+// REQUIRES: x86-registered-target
+// RUN: rm -rf %t && mkdir -p %t
+// RUN: %clang_cc1 -triple x86_64-unknown-unknown -S -ftime-trace -mllvm -time-trace-granularity=0 -o %t/out.s %s
+// RUN: FileCheck %s < %t/out.json
+// RUN: cd %t && %clang_cc1 -triple x86_64-unknown-unknown -S -ftime-trace -x c++ -o %t/stdin.s - < %s
+// RUN: FileCheck %s --check-prefix=STDIN < %t/stdin.json
+
+// CHECK: "traceEvents": [
+// CHECK-DAG: "name":"InstantiateFunction", "args":{ "detail":"twice<int>" }
+// CHECK-DAG: "name":"ParseTemplate", "args":{ "detail":"twice" }
+// CHECK-DAG: "name":"PerformPendingInstantiations"
+// CHECK-DAG: "name":"Frontend"
+// CHECK-DAG: "name":"CodeGenPasses"
+// CHECK-DAG: "name":"Total ExecuteCompiler"
+// CHECK: "name":"process_name"
+
+// STDIN: "traceEvents": [
+
+template <typename T> T twice(T X) { return X + X; }
+
+int f() { return twice(21); }
@@ -34,8 +34,10 @@
 #include "llvm/Support/Compiler.h"
 #include "llvm/Support/ErrorHandling.h"
 #include "llvm/Support/ManagedStatic.h"
+#include "llvm/Support/Path.h"
 #include "llvm/Support/Signals.h"
 #include "llvm/Support/TargetSelect.h"
+#include "llvm/Support/TimeProfiler.h"
 #include "llvm/Support/Timer.h"
 #include "llvm/Support/raw_ostream.h"
 #include <cstdio>
@@ -214,13 +216,46 @@ int cc1_main(ArrayRef<const char *> Argv, const char *Argv0, void *MainAddr) {
   if (!Success)
     return 1;
 
+  if (Clang->getFrontendOpts().TimeTrace)
+    llvm::timeTraceProfilerInitialize();
+
   // Execute the frontend actions.
-  Success = ExecuteCompilerInvocation(Clang.get());
+  {
+    llvm::TimeTraceScope TimeScope("ExecuteCompiler", StringRef(""));
+    Success = ExecuteCompilerInvocation(Clang.get());
+  }
 
   // If any timers were active but haven't been destroyed yet, print their
   // results now.  This happens in -disable-free mode.
   llvm::TimerGroup::printAll(llvm::errs());
 
+  if (llvm::timeTraceProfilerEnabled()) {
+    // Write the trace next to the main output, e.g. foo.o -> foo.json, or
+    // next to the input when the output goes to stdout. There is nowhere to
+    // put it when both the input and the output are standard streams.
+    const FrontendOptions &FEOpts = Clang->getFrontendOpts();
+    SmallString<128> Path(FEOpts.OutputFile);
+    if (Path.empty() || Path == "-") {
+      Path.clear();
+      if (!FEOpts.Inputs.empty() && FEOpts.Inputs[0].isFile() &&
+          FEOpts.Inputs[0].getFile() != "-")
+        Path = llvm::sys::path::filename(FEOpts.Inputs[0].getFile());
+    }
+    if (!Path.empty()) {
+      llvm::sys::path::replace_extension(Path, "json");
+      // Not a CompilerInstance output file, which would have to be cleared
+      // before the CompilerInstance is destroyed.
+      std::error_code EC;
+      llvm::raw_fd_ostream ProfilerOS(Path, EC, llvm::sys::fs::F_Text);
+      if (EC)
+        Clang->getDiagnostics().Report(diag::err_fe_unable_to_open_output)
+            << Path << EC.message();
+      else
+        llvm::timeTraceProfilerWrite(ProfilerOS);
+    }
+    llvm::timeTraceProfilerCleanup();
+  }
+
   // Our error handler depends on the Diagnostics object, which we're
   // potentially about to delete. Uninstall the handler now so that any
   // later errors use the default handling behavior instead.
@@ -0,0 +1,60 @@
+//===- unittests/AST/ASTContextTest.cpp --- ASTContext tests --------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// Unit tests for the ASTContext allocator statistics.
+//
+//===----------------------------------------------------------------------===//
+
+#include "clang/AST/ASTContext.h"
+#include "clang/Basic/Builtins.h"
+#include "llvm/Support/Allocator.h"
+#include "gtest/gtest.h"
+
+using namespace clang;
+
+namespace {
+class ASTContextTest : public ::testing::Test {
+protected:
+  ASTContextTest()
+      : FileMgr(FileMgrOpts), DiagID(new DiagnosticIDs()),
+        Diags(DiagID, new DiagnosticOptions, new IgnoringDiagConsumer()),
+        SourceMgr(Diags, FileMgr), Idents(LangOpts, nullptr),
+        Ctxt(LangOpts, SourceMgr, Idents, Sels, Builtins) {}
+
+  FileSystemOptions FileMgrOpts;
+  FileManager FileMgr;
+  IntrusiveRefCntPtr<DiagnosticIDs> DiagID;
+  DiagnosticsEngine Diags;
+  SourceManager SourceMgr;
+  LangOptions LangOpts;
+  IdentifierTable Idents;
+  SelectorTable Sels;
+  Builtin::Context Builtins;
+  ASTContext Ctxt;
+};
+} // unnamed namespace
+
+TEST_F(ASTContextTest, AllocatorStatistics) {
+  llvm::AllocatorStatistics Before = Ctxt.getASTAllocatorStatistics();
+
+  Ctxt.Allocate(100);
+  Ctxt.Allocate(28);
+  llvm::AllocatorStatistics After = Ctxt.getASTAllocatorStatistics();
+  EXPECT_EQ(Before.BytesAllocated + 128, After.BytesAllocated);
+  EXPECT_LE(1u, After.NumSlabs);
+  EXPECT_LE(After.BytesAllocated, After.TotalMemory);
+  EXPECT_EQ(Ctxt.getASTAllocatedMemory(), After.TotalMemory);
+
+  // Larger than a slab: it gets a slab of its own.
+  Before = After;
+  Ctxt.Allocate(10000);
+  After = Ctxt.getASTAllocatorStatistics();
+  EXPECT_EQ(Before.BytesAllocated + 10000, After.BytesAllocated);
+  EXPECT_EQ(Before.NumSlabs + 1, After.NumSlabs);
+}
@@ -133,9 +133,15 @@ struct AsanChunk: ChunkBase {
   }
 };
 
+// With common_flags()->allocator_per_cpu_cache the threads share these caches
+// instead of using the ones in their AsanThreadLocalMallocStorage.
+static PerCPUAllocatorCache<AllocatorCache> per_cpu_cache;
+typedef PerCPUAllocatorCache<AllocatorCache>::ScopedLock PerCPUCacheLock;
+
 struct QuarantineCallback {
+  // The thread's own cache is ignored in the per-CPU cache mode.
   QuarantineCallback(AllocatorCache *cache, BufferedStackTrace *stack)
-      : cache_(cache),
+      : cache_(per_cpu_cache.enabled() ? nullptr : cache),
         stack_(stack) {
   }
 
@@ -162,11 +168,17 @@ struct QuarantineCallback {
     thread_stats.real_frees++;
     thread_stats.really_freed += m->UsedSize();
 
-    get_allocator().Deallocate(cache_, p);
+    Deallocate(p);
   }
 
   void *Allocate(uptr size) {
-    void *res = get_allocator().Allocate(cache_, size, 1);
+    void *res;
+    if (cache_) {
+      res = get_allocator().Allocate(cache_, size, 1);
+    } else {
+      PerCPUCacheLock l(&per_cpu_cache);
+      res = get_allocator().Allocate(l.cache(), size, 1);
+    }
     // TODO(alekseys): Consider making quarantine OOM-friendly.
     if (UNLIKELY(!res))
       ReportOutOfMemory(size, stack_);
@@ -174,7 +186,12 @@ struct QuarantineCallback {
   }
 
   void Deallocate(void *p) {
-    get_allocator().Deallocate(cache_, p);
+    if (cache_) {
+      get_allocator().Deallocate(cache_, p);
+      return;
+    }
+    PerCPUCacheLock l(&per_cpu_cache);
+    get_allocator().Deallocate(l.cache(), p);
   }
 
  private:
@@ -280,6 +297,8 @@ struct Allocator {
   void InitLinkerInitialized(const AllocatorOptions &options) {
     SetAllocatorMayReturnNull(options.may_return_null);
     allocator.InitLinkerInitialized(options.release_to_os_interval_ms);
+    if (common_flags()->allocator_per_cpu_cache)
+      per_cpu_cache.Init(&allocator);
     SharedInitCode(options);
   }
 
@@ -448,7 +467,10 @@ struct Allocator {
 
     AsanThread *t = GetCurrentThread();
     void *allocated;
-    if (t) {
+    if (per_cpu_cache.enabled()) {
+      PerCPUCacheLock l(&per_cpu_cache);
+      allocated = allocator.Allocate(l.cache(), needed_size, 8);
+    } else if (t) {
       AllocatorCache *cache = GetAllocatorCache(&t->malloc_storage());
       allocated = allocator.Allocate(cache, needed_size, 8);
     } else {
@@ -771,15 +793,24 @@ struct Allocator {
                                                     stack));
     }
 
+    per_cpu_cache.Drain(&allocator);
     allocator.ForceReleaseToOS();
   }
 
   void PrintStats() {
     allocator.PrintStats();
     quarantine.PrintStats();
+    if (per_cpu_cache.enabled()) {
+      PerCPUAllocatorCacheStats stats;
+      per_cpu_cache.GetStats(&stats);
+      Printf("Stats: per-CPU caches: %zd caches, %zdK mapped, %zdK cached, "
+             "%zd contended\n", stats.n_caches, stats.mapped >> 10,
+             stats.cached >> 10, stats.n_contended);
+    }
   }
 
   void ForceLock() {
+    per_cpu_cache.LockAll();
     allocator.ForceLock();
     fallback_mutex.Lock();
   }
@@ -787,6 +818,7 @@ struct Allocator {
   void ForceUnlock() {
     fallback_mutex.Unlock();
     allocator.ForceUnlock();
+    per_cpu_cache.UnlockAll();
   }
 };
 
@@ -126,8 +126,12 @@ static void PrintAccumulatedStats() {
   BlockingMutexLock lock(&print_lock);
   stats.Print();
   StackDepotStats *stack_depot_stats = StackDepotGetStats();
-  Printf("Stats: StackDepot: %zd ids; %zdM allocated\n",
-         stack_depot_stats->n_uniq_ids, stack_depot_stats->allocated >> 20);
+  Printf("Stats: StackDepot: %zd ids; %zdM allocated; %zdM mapped\n",
+         stack_depot_stats->n_uniq_ids, stack_depot_stats->allocated >> 20,
+         stack_depot_stats->mapped >> 20);
+  Printf("Stats: StackDepot: %zd buckets; %zd collisions; longest %zd\n",
+         stack_depot_stats->n_buckets, stack_depot_stats->n_collisions,
+         stack_depot_stats->max_bucket_size);
   PrintInternalAllocatorStats();
 }
 
@@ -79,6 +79,61 @@ TEST(AddressSanitizer, FakeStackBenchmark) {
     Ident(&FunctionWithLargeStack)();
 }
 
+// Array kernels in the style of STREAM and of the loops found in SPEC.
+// The checks of their accesses can be moved before the inner loops, compare
+// the instrumentation with and without -mllvm -asan-opt-loops.
+__attribute__((noinline))
+static void StreamTriadFunc(double *a, const double *b, const double *c,
+                            size_t n_elements, size_t n_iter) {
+  for (size_t iter = 0; iter < n_iter; iter++) {
+    break_optimization(a);
+    for (size_t i = 0; i < n_elements; i++)
+      a[i] = b[i] + 3.0 * c[i];
+  }
+}
+
+__attribute__((noinline))
+static void StencilFunc(float *out, const float *in, size_t n_elements,
+                        size_t n_iter) {
+  for (size_t iter = 0; iter < n_iter; iter++) {
+    break_optimization(out);
+    for (size_t i = 1; i < n_elements - 1; i++)
+      out[i] = 0.25f * in[i - 1] + 0.5f * in[i] + 0.25f * in[i + 1];
+  }
+}
+
+__attribute__((noinline))
+static long ReverseSumFunc(const int *x, size_t n_elements, size_t n_iter) {
+  long sum = 0;
+  for (size_t iter = 0; iter < n_iter; iter++) {
+    break_optimization(&sum);
+    for (size_t i = n_elements; i > 0; i--)
+      sum += x[i - 1];
+  }
+  return sum;
+}
+
+TEST(AddressSanitizer, LoopKernelsBenchmark) {
+  const size_t kLen = 4096;
+  const size_t kIter = 1 << 16;
+  double *a = new double[kLen], *b = new double[kLen], *c = new double[kLen];
+  float *in = new float[kLen], *out = new float[kLen];
+  int *x = new int[kLen];
+  for (size_t i = 0; i < kLen; i++) {
+    b[i] = c[i] = in[i] = i;
+    x[i] = i;
+  }
+  StreamTriadFunc(a, b, c, kLen, kIter);
+  StencilFunc(out, in, kLen, kIter);
+  Ident(ReverseSumFunc(x, kLen, kIter));
+  delete [] a;
+  delete [] b;
+  delete [] c;
+  delete [] in;
+  delete [] out;
+  delete [] x;
+}
+
 int main(int argc, char **argv) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -0,0 +1,364 @@
+//===- FuzzerFork.cpp - run fuzzing in separate subprocesses --------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+// Spawn and orchestrate separate fuzzing processes.
+//
+// The main process never runs the target. It owns the merged corpus and the
+// merged feature set and hands out short fuzzing jobs, each working on a
+// random subset of the corpus in a temporary directory. When a job finishes,
+// the inputs it found are merged into the main corpus (in a crash-resistant
+// merge subprocess) and a new job is started in its place. A job that
+// crashes, times out or runs out of memory only loses its own work.
+//===----------------------------------------------------------------------===//
+
+#include "FuzzerCommand.h"
+#include "FuzzerFork.h"
+#include "FuzzerIO.h"
+#include "FuzzerInternal.h"
+#include "FuzzerMerge.h"
+#include "FuzzerSHA1.h"
+#include "FuzzerUtil.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <sstream>
+#include <thread>
+
+namespace fuzzer {
+
+struct Stats {
+  size_t number_of_executed_units = 0;
+  size_t peak_rss_mb = 0;
+  size_t average_exec_per_sec = 0;
+};
+
+// Reads the stat:: lines that -print_final_stats=1 adds to a job's log.
+static Stats ParseFinalStatsFromLog(const std::string &LogPath) {
+  std::ifstream In(LogPath);
+  std::string Line;
+  Stats Res;
+  struct {
+    const char *Name;
+    size_t *Var;
+  } NameVarPairs[] = {
+      {"stat::number_of_executed_units:", &Res.number_of_executed_units},
+      {"stat::peak_rss_mb:", &Res.peak_rss_mb},
+      {"stat::average_exec_per_sec:", &Res.average_exec_per_sec},
+      {nullptr, nullptr},
+  };
+  while (std::getline(In, Line, '\n')) {
+    if (Line.find("stat::") != 0) continue;
+    std::istringstream ISS(Line);
+    std::string Name;
+    size_t Val;
+    ISS >> Name >> Val;
+    for (size_t i = 0; NameVarPairs[i].Name; i++)
+      if (Name == NameVarPairs[i].Name)
+        *NameVarPairs[i].Var = Val;
+  }
+  return Res;
+}
+
+struct FuzzJob {
+  // Inputs.
+  Command Cmd;
+  std::string CorpusDir;  // The job writes the inputs it finds here.
+  std::string SeedDir;    // The corpus subset the job starts from.
+  std::string LogPath;
+  std::string CFPath;
+  size_t JobId;
+
+  // Fuzzing Outputs.
+  int ExitCode;
+  size_t ExecPerSec = 0;
+  size_t NumNewFiles = 0;
+
+  ~FuzzJob() {
+    RemoveFile(CFPath);
+    RemoveFile(LogPath);
+    RmDirRecursive(CorpusDir);
+    RmDirRecursive(SeedDir);
+  }
+};
+
+struct GlobalEnv {
+  Vector<std::string> Args;
+  Vector<std::string> CorpusDirs;
+  std::string MainCorpusDir;
+  std::string TempDir;
+  Set<uint32_t> Features;
+  Vector<std::string> Files;
+  Random *Rand;
+  std::chrono::system_clock::time_point ProcessStartTime;
+  int MaxTotalTimeSec = 0;
+  int Verbosity = 0;
+
+  size_t NumTimeouts = 0;
+  size_t NumOOMs = 0;
+  size_t NumCrashes = 0;
+
+  size_t NumRuns = 0;
+
+  size_t secondsSinceProcessStartUp() const {
+    return std::chrono::duration_cast<std::chrono::seconds>(
+               std::chrono::system_clock::now() - ProcessStartTime)
+        .count();
+  }
+
+  FuzzJob *CreateNewJob(size_t JobId) {
+    Command Cmd(Args);
+    Cmd.removeFlag("fork");
+    Cmd.removeFlag("runs");
+    Cmd.removeFlag("max_total_time");
+    Cmd.removeFlag("print_final_stats");
+    for (auto &C : CorpusDirs) // Remove all corpora from the args.
+      Cmd.removeArgument(C);
+    Cmd.addFlag("reload", "0");  // working in an isolated dir, no reload.
+    Cmd.addFlag("print_final_stats", "1");
+
+    // Start with very short jobs so that the first inputs reach the main
+    // corpus quickly, then let them grow to a few minutes each. Never let a
+    // job outlive the total time budget by much.
+    size_t JobTimeSec = std::min((size_t)300, JobId);
+    if (MaxTotalTimeSec > 0) {
+      size_t Elapsed = secondsSinceProcessStartUp();
+      size_t Left = (size_t)MaxTotalTimeSec > Elapsed
+                        ? (size_t)MaxTotalTimeSec - Elapsed
+                        : 1;
+      JobTimeSec = std::max((size_t)1, std::min(JobTimeSec, Left));
+    }
+    Cmd.addFlag("max_total_time", std::to_string(JobTimeSec));
+
+    auto Job = new FuzzJob;
+    Job->JobId = JobId;
+    std::string Id = std::to_string(JobId);
+    Job->CorpusDir = DirPlusFile(TempDir, "C" + Id);
+    Job->SeedDir = DirPlusFile(TempDir, "S" + Id);
+    Job->LogPath = DirPlusFile(TempDir, Id + ".log");
+    Job->CFPath = DirPlusFile(TempDir, Id + ".merge");
+    MkDir(Job->CorpusDir);
+    MkDir(Job->SeedDir);
+
+    // Copy a random subset of the corpus into the job's seed dir. The job
+    // rediscovers the coverage of these inputs on its own, so a small subset
+    // keeps its startup cheap, and different subsets make different jobs
+    // explore different parts of the target.
+    size_t CorpusSubsetSize =
+        std::min(Files.size(), (size_t)std::sqrt(Files.size() + 2));
+    for (size_t i = 0; i < CorpusSubsetSize; i++) {
+      auto &Path = Files[(*Rand)(Files.size())];
+      WriteToFile(FileToVector(Path),
+                  DirPlusFile(Job->SeedDir, Basename(Path)));
+    }
+
+    Cmd.addArgument(Job->CorpusDir);
+    Cmd.addArgument(Job->SeedDir);
+    Cmd.setOutputFile(Job->LogPath);
+    Cmd.combineOutAndErr();
+    Job->Cmd = Cmd;
+
+    if (Verbosity >= 2)
+      Printf("Job %zd/%p Created: %s\n", JobId, Job,
+             Job->Cmd.toString().c_str());
+    return Job;
+  }
+
+  // Merges the inputs that the job found into the main corpus, keeping only
+  // those that add features we have not seen in any job before.
+  void RunOneMergeJob(FuzzJob *Job) {
+    auto Stats = ParseFinalStatsFromLog(Job->LogPath);
+    NumRuns += Stats.number_of_executed_units;
+    Job->ExecPerSec = Stats.average_exec_per_sec;
+
+    Vector<SizedFile> MergeCandidates;
+    GetSizedFilesFromDir(Job->CorpusDir, &MergeCandidates);
+    Vector<std::string> FilesToAdd;
+    Set<uint32_t> NewFeatures;
+    CrashResistantMerge(Args, {}, MergeCandidates, &FilesToAdd, Features,
+                        &NewFeatures, Job->CFPath, false);
+    for (auto &Path : FilesToAdd) {
+      auto U = FileToVector(Path);
+      auto NewPath = DirPlusFile(MainCorpusDir, Hash(U));
+      WriteToFile(U, NewPath);
+      Files.push_back(NewPath);
+    }
+    Features.insert(NewFeatures.begin(), NewFeatures.end());
+    Job->NumNewFiles = FilesToAdd.size();
+  }
+
+  void PrintStatus(const FuzzJob *Job) const {
+    Printf("#%zd: ft: %zd corp: %zd exec/s %zd "
+           "oom/timeout/crash: %zd/%zd/%zd time: %zds job: %zd\n",
+           NumRuns, Features.size(), Files.size(), Job->ExecPerSec, NumOOMs,
+           NumTimeouts, NumCrashes, secondsSinceProcessStartUp(), Job->JobId);
+  }
+};
+
+struct JobQueue {
+  std::queue<FuzzJob *> Qu;
+  std::mutex Mu;
+  std::condition_variable Cv;
+
+  void Push(FuzzJob *Job) {
+    {
+      std::lock_guard<std::mutex> Lock(Mu);
+      Qu.push(Job);
+    }
+    Cv.notify_one();
+  }
+  FuzzJob *Pop() {
+    std::unique_lock<std::mutex> Lk(Mu);
+    Cv.wait(Lk, [&] { return !Qu.empty(); });
+    auto Job = Qu.front();
+    Qu.pop();
+    return Job;
+  }
+};
+
+// Runs jobs until it pops a null job.
+static void WorkerThread(JobQueue *FuzzQ, JobQueue *MergeQ) {
+  while (auto Job = FuzzQ->Pop()) {
+    Job->ExitCode = ExecuteCommand(Job->Cmd);
+    MergeQ->Push(Job);
+  }
+}
+
+void FuzzWithFork(Random &Rand, const FuzzingOptions &Options,
+                  const Vector<std::string> &Args,
+                  const Vector<std::string> &CorpusDirs, int NumJobs) {
+  Printf("INFO: -fork=%d: fuzzing in separate process(s)\n", NumJobs);
+
+  GlobalEnv Env;
+  Env.Args = Args;
+  Env.CorpusDirs = CorpusDirs;
+  Env.Rand = &Rand;
+  Env.Verbosity = Options.Verbosity;
+  Env.MaxTotalTimeSec = Options.MaxTotalTimeSec;
+  Env.ProcessStartTime = std::chrono::system_clock::now();
+
+  Vector<SizedFile> SeedFiles;
+  for (auto &Dir : CorpusDirs)
+    GetSizedFilesFromDir(Dir, &SeedFiles);
+  std::sort(SeedFiles.begin(), SeedFiles.end());
+  Env.TempDir = TempPath(".dir");
+  RmDirRecursive(Env.TempDir);  // in case there is a leftover from old runs.
+  MkDir(Env.TempDir);
+
+  if (CorpusDirs.empty())
+    MkDir(Env.MainCorpusDir = DirPlusFile(Env.TempDir, "C"));
+  else
+    Env.MainCorpusDir = CorpusDirs[0];
+
+  // Minimize the seed corpus and learn its features before the first job.
+  auto CFPath = DirPlusFile(Env.TempDir, "merge.txt");
+  CrashResistantMerge(Env.Args, {}, SeedFiles, &Env.Files, {}, &Env.Features,
+                      CFPath, false);
+  RemoveFile(CFPath);
+  Printf("INFO: -fork=%d: %zd seed inputs, starting to fuzz in %s\n", NumJobs,
+         Env.Files.size(), Env.TempDir.c_str());
+
+  int ExitCode = 0;
+
+  JobQueue FuzzQ, MergeQ;
+  size_t JobId = 1;
+  Vector<std::thread> Threads;
+  for (int t = 0; t < NumJobs; t++) {
+    Threads.push_back(std::thread(WorkerThread, &FuzzQ, &MergeQ));
+    FuzzQ.Push(Env.CreateNewJob(JobId++));
+  }
+
+  size_t NumRunningJobs = NumJobs;
+  bool Stop = false;
+  bool Crashed = false;
+  while (NumRunningJobs) {
+    std::unique_ptr<FuzzJob> Job(MergeQ.Pop());
+    NumRunningJobs--;
+    Fuzzer::MaybeExitGracefully();
+
+    // Inputs found before a crash are as good as any other, so merge them
+    // first.
+    Env.RunOneMergeJob(Job.get());
+
+    // Continue if our crash is one of the ignored ones.
+    if (Job->ExitCode == 0) {
+      // The job ran out of its time budget.
+    } else if (Options.IgnoreTimeouts &&
+               Job->ExitCode == Options.TimeoutExitCode) {
+      Env.NumTimeouts++;
+    } else if (Options.IgnoreOOMs && Job->ExitCode == Options.OOMExitCode) {
+      Env.NumOOMs++;
+    } else {
+      Env.NumCrashes++;
+      if (Options.IgnoreCrashes) {
+        std::ifstream In(Job->LogPath);
+        std::string Line;
+        while (std::getline(In, Line, '\n'))
+          if (Line.find("ERROR:") != Line.npos ||
+              Line.find("runtime error:") != Line.npos)
+            Printf("%s\n", Line.c_str());
+      } else {
+        // And exit if we don't ignore this crash.
+        Printf("INFO: log from the inner process:\n%s",
+               FileToString(Job->LogPath).c_str());
+        ExitCode = Job->ExitCode;
+        Stop = Crashed = true;
+      }
+    }
+
+    if (Job->NumNewFiles || Job->ExitCode != 0)
+      Env.PrintStatus(Job.get());
+
+    // Stop if we are over the time budget.
+    // This is not precise, since other threads are still running
+    // and we will wait while joining them.
+    // We also don't stop instantly: other jobs need to finish.
+    if (Options.MaxTotalTimeSec > 0 && !Stop &&
+        Env.secondsSinceProcessStartUp() >= (size_t)Options.MaxTotalTimeSec) {
+      Printf("INFO: fuzzed for %zd seconds, wrapping up soon\n",
+             Env.secondsSinceProcessStartUp());
+      Stop = true;
+    }
+    if (!Stop && Env.NumRuns >= Options.MaxNumberOfRuns) {
+      Printf("INFO: fuzzed for %zd iterations, wrapping up soon\n",
+             Env.NumRuns);
+      Stop = true;
+    }
+
+    if (Crashed)
+      break;
+    if (!Stop) {
+      FuzzQ.Push(Env.CreateNewJob(JobId++));
+      NumRunningJobs++;
+    }
+  }
+
+  // Wait for the jobs that are still running, even after a crash: they write
+  // into Env.TempDir, which must not be removed under them. Their results
+  // are not merged any more.
+  for (size_t i = 0; i < Threads.size(); i++)
+    FuzzQ.Push(nullptr);
+  for (auto &T : Threads)
+    T.join();
+  while (NumRunningJobs) {
+    delete MergeQ.Pop();
+    NumRunningJobs--;
+  }
+  RmDirRecursive(Env.TempDir);
+
+  Printf("INFO: exiting: %d time: %zds\n", ExitCode,
+         Env.secondsSinceProcessStartUp());
+  exit(ExitCode);
+}
+
+} // namespace fuzzer
@@ -40,6 +40,10 @@ std::string DirName(const std::string &FileName);
 // Returns path to a TmpDir.
 std::string TmpDir();
 
+// Returns a path in TmpDir that is unique to this process, e.g.
+// "/tmp/libFuzzerTemp.1234.dir" for Extension ".dir".
+std::string TempPath(const char *Extension);
+
 bool IsInterestingCoverageFile(const std::string &FileName);
 
 void DupAndCloseStderr();
@@ -78,6 +82,14 @@ int DuplicateFile(int Fd);
 
 void RemoveFile(const std::string &Path);
 
+void MkDir(const std::string &Path);
+
+// Removes Dir together with all files and directories inside it.
+void RmDirRecursive(const std::string &Dir);
+
+// Returns the name of the null device, e.g. for Command::setOutputFile.
+const std::string &getDevNull();
+
 void DiscardOutput(int Fd);
 
 intptr_t GetHandleFromFd(int fd);
@@ -99,6 +99,32 @@ void RemoveFile(const std::string &Path) {
   unlink(Path.c_str());
 }
 
+void MkDir(const std::string &Path) {
+  mkdir(Path.c_str(), 0700);
+}
+
+void RmDirRecursive(const std::string &Dir) {
+  if (DIR *D = opendir(Dir.c_str())) {
+    while (auto E = readdir(D)) {
+      if (!strcmp(E->d_name, ".") || !strcmp(E->d_name, ".."))
+        continue;
+      std::string Path = DirPlusFile(Dir, E->d_name);
+      if (E->d_type == DT_DIR ||
+          (E->d_type == DT_UNKNOWN && IsDirectory(Path)))
+        RmDirRecursive(Path);
+      else
+        unlink(Path.c_str());
+    }
+    closedir(D);
+  }
+  rmdir(Dir.c_str());
+}
+
+const std::string &getDevNull() {
+  static const std::string DevNull = "/dev/null";
+  return DevNull;
+}
+
 void DiscardOutput(int Fd) {
   FILE* Temp = fopen("/dev/null", "w");
   if (!Temp)
@@ -15,6 +15,7 @@
 #include "FuzzerIO.h"
 #include <cstdarg>
 #include <cstdio>
+#include <direct.h>
 #include <fstream>
 #include <io.h>
 #include <iterator>
@@ -161,6 +162,38 @@ void RemoveFile(const std::string &Path) {
   _unlink(Path.c_str());
 }
 
+void MkDir(const std::string &Path) {
+  _mkdir(Path.c_str());
+}
+
+void RmDirRecursive(const std::string &Dir) {
+  std::string Pattern(Dir);
+  if (!Pattern.empty() && Pattern.back() != '\\')
+    Pattern.push_back('\\');
+  Pattern.push_back('*');
+
+  WIN32_FIND_DATAA FindInfo;
+  HANDLE FindHandle(FindFirstFileA(Pattern.c_str(), &FindInfo));
+  if (FindHandle != INVALID_HANDLE_VALUE) {
+    do {
+      if (!strcmp(FindInfo.cFileName, ".") || !strcmp(FindInfo.cFileName, ".."))
+        continue;
+      std::string Path = DirPlusFile(Dir, FindInfo.cFileName);
+      if (FindInfo.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+        RmDirRecursive(Path);
+      else
+        _unlink(Path.c_str());
+    } while (FindNextFileA(FindHandle, &FindInfo));
+    FindClose(FindHandle);
+  }
+  _rmdir(Dir.c_str());
+}
+
+const std::string &getDevNull() {
+  static const std::string DevNull = "NUL";
+  return DevNull;
+}
+
 void DiscardOutput(int Fd) {
   FILE* Temp = fopen("nul", "w");
   if (!Temp)
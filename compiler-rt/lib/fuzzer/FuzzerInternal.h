@@ -85,6 +85,8 @@ public:
   void SetMaxMutationLen(size_t MaxMutationLen);
   void RssLimitCallback();
 
+  static void MaybeExitGracefully();
+
   bool InFuzzingThread() const { return IsMyThread; }
   size_t GetCurrentUnitInFuzzingThead(const uint8_t **Data) const;
   void TryDetectingAMemoryLeak(const uint8_t *Data, size_t Size,
@@ -97,7 +99,6 @@ private:
   void AlarmCallback();
   void CrashCallback();
   void ExitCallback();
-  void MaybeExitGracefully();
   void CrashOnOverwrittenData();
   void InterruptCallback();
   void MutateAndTestOne();
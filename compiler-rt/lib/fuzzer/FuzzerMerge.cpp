@@ -124,8 +124,10 @@ size_t Merger::ApproximateMemoryConsumption() const  {
 // Decides which files need to be merged (add thost to NewFiles).
 // Returns the number of new features added.
 size_t Merger::Merge(const Set<uint32_t> &InitialFeatures,
+                     Set<uint32_t> *NewFeatures,
                      Vector<std::string> *NewFiles) {
   NewFiles->clear();
+  NewFeatures->clear();
   assert(NumFilesInFirstCorpus <= Files.size());
   Set<uint32_t> AllFeatures(InitialFeatures);
 
@@ -162,7 +164,9 @@ size_t Merger::Merge(const Set<uint32_t> &InitialFeatures,
     // Printf("%s -> sz %zd ft %zd\n", Files[i].Name.c_str(),
     //       Files[i].Size, Cur.size());
     size_t OldSize = AllFeatures.size();
-    AllFeatures.insert(Cur.begin(), Cur.end());
+    for (auto Feature : Cur)
+      if (AllFeatures.insert(Feature).second)
+        NewFeatures->insert(Feature);
     if (AllFeatures.size() > OldSize)
       NewFiles->push_back(Files[i].Name);
   }
@@ -275,6 +279,69 @@ static void WriteNewControlFile(const std::string &CFPath,
   }
 }
 
+// Runs '-merge_inner' processes on the control file until one of them gets
+// through the remaining inputs. Every inner process handles at least one
+// input, so NumAttempts restarts are enough to get past all crashing ones.
+static bool RunInnerMerge(const Vector<std::string> &Args,
+                          const std::string &CFPath, size_t NumAttempts,
+                          bool Verbose) {
+  Command BaseCmd(Args);
+  BaseCmd.removeFlag("merge");
+  BaseCmd.removeFlag("fork");
+  for (size_t Attempt = 1; Attempt <= NumAttempts; Attempt++) {
+    Fuzzer::MaybeExitGracefully();
+    if (Verbose)
+      Printf("MERGE-OUTER: attempt %zd\n", Attempt);
+    Command Cmd(BaseCmd);
+    Cmd.addFlag("merge_control_file", CFPath);
+    Cmd.addFlag("merge_inner", "1");
+    if (!Verbose) {
+      Cmd.setOutputFile(getDevNull());
+      Cmd.combineOutAndErr();
+    }
+    auto ExitCode = ExecuteCommand(Cmd);
+    if (!ExitCode) {
+      if (Verbose)
+        Printf("MERGE-OUTER: succesfull in %zd attempt(s)\n", Attempt);
+      return true;
+    }
+  }
+  return false;
+}
+
+void CrashResistantMerge(const Vector<std::string> &Args,
+                         const Vector<SizedFile> &OldCorpus,
+                         const Vector<SizedFile> &NewCorpus,
+                         Vector<std::string> *NewFiles,
+                         const Set<uint32_t> &InitialFeatures,
+                         Set<uint32_t> *NewFeatures,
+                         const std::string &CFPath, bool Verbose) {
+  NewFiles->clear();
+  NewFeatures->clear();
+  if (NewCorpus.empty())
+    return;
+
+  Vector<SizedFile> AllFiles(OldCorpus);
+  std::sort(AllFiles.begin(), AllFiles.end());
+  AllFiles.insert(AllFiles.end(), NewCorpus.begin(), NewCorpus.end());
+  std::sort(AllFiles.begin() + OldCorpus.size(), AllFiles.end());
+  WriteNewControlFile(CFPath, AllFiles, OldCorpus.size());
+
+  if (!RunInnerMerge(Args, CFPath, AllFiles.size(), Verbose)) {
+    Printf("MERGE-OUTER: zero succesfull attempts, exiting\n");
+    exit(1);
+  }
+
+  Merger M;
+  std::ifstream IF(CFPath);
+  M.ParseOrExit(IF, true);
+  IF.close();
+  M.Merge(InitialFeatures, NewFeatures, NewFiles);
+  if (Verbose)
+    Printf("MERGE-OUTER: %zd new files with %zd new features added\n",
+           NewFiles->size(), NewFeatures->size());
+}
+
 // Outer process. Does not call the target code and thus sohuld not fail.
 void Fuzzer::CrashResistantMerge(const Vector<std::string> &Args,
                                  const Vector<std::string> &Corpora,
@@ -331,25 +398,7 @@ void Fuzzer::CrashResistantMerge(const Vector<std::string> &Args,
     NumAttempts = AllFiles.size();
   }
 
-  // Execute the inner process until it passes.
-  // Every inner process should execute at least one input.
-  Command BaseCmd(Args);
-  BaseCmd.removeFlag("merge");
-  bool Success = false;
-  for (size_t Attempt = 1; Attempt <= NumAttempts; Attempt++) {
-    MaybeExitGracefully();
-    Printf("MERGE-OUTER: attempt %zd\n", Attempt);
-    Command Cmd(BaseCmd);
-    Cmd.addFlag("merge_control_file", CFPath);
-    Cmd.addFlag("merge_inner", "1");
-    auto ExitCode = ExecuteCommand(Cmd);
-    if (!ExitCode) {
-      Printf("MERGE-OUTER: succesfull in %zd attempt(s)\n", Attempt);
-      Success = true;
-      break;
-    }
-  }
-  if (!Success) {
+  if (!RunInnerMerge(Args, CFPath, NumAttempts, /*Verbose=*/true)) {
     Printf("MERGE-OUTER: zero succesfull attempts, exiting\n");
     exit(1);
   }
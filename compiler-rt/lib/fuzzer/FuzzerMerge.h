@@ -41,6 +41,7 @@
 #define LLVM_FUZZER_MERGE_H
 
 #include "FuzzerDefs.h"
+#include "FuzzerIO.h"
 
 #include <istream>
 #include <ostream>
@@ -66,8 +67,13 @@ struct Merger {
   void ParseOrExit(std::istream &IS, bool ParseCoverage);
   void PrintSummary(std::ostream &OS);
   Set<uint32_t> ParseSummary(std::istream &IS);
-  size_t Merge(const Set<uint32_t> &InitialFeatures,
+  size_t Merge(const Set<uint32_t> &InitialFeatures, Set<uint32_t> *NewFeatures,
                Vector<std::string> *NewFiles);
+  size_t Merge(const Set<uint32_t> &InitialFeatures,
+               Vector<std::string> *NewFiles) {
+    Set<uint32_t> NewFeatures;
+    return Merge(InitialFeatures, &NewFeatures, NewFiles);
+  }
   size_t Merge(Vector<std::string> *NewFiles) {
     return Merge(Set<uint32_t>{}, NewFiles);
   }
@@ -75,6 +81,18 @@ struct Merger {
   Set<uint32_t> AllFeatures() const;
 };
 
+// Merges NewCorpus on top of OldCorpus and InitialFeatures by running the
+// target in one or more '-merge_inner' subprocesses, so that a crash in the
+// target only costs a restart. The files from NewCorpus that add coverage go
+// to NewFiles and the coverage they add goes to NewFeatures.
+void CrashResistantMerge(const Vector<std::string> &Args,
+                         const Vector<SizedFile> &OldCorpus,
+                         const Vector<SizedFile> &NewCorpus,
+                         Vector<std::string> *NewFiles,
+                         const Set<uint32_t> &InitialFeatures,
+                         Set<uint32_t> *NewFeatures,
+                         const std::string &CFPath, bool Verbose);
+
 }  // namespace fuzzer
 
 #endif  // LLVM_FUZZER_MERGE_H
@@ -154,6 +154,8 @@ int ExecuteCommand(const Command &Cmd) {
         ProcessStatus = -1;
     }
   }
+  if (ProcessStatus != -1 && WIFEXITED(ProcessStatus))
+    return WEXITSTATUS(ProcessStatus);
   return ProcessStatus;
 }
 
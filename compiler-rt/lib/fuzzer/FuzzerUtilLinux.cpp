@@ -14,12 +14,19 @@
 #include "FuzzerCommand.h"
 
 #include <stdlib.h>
+#include <sys/types.h>
+#include <sys/wait.h>
 
 namespace fuzzer {
 
 int ExecuteCommand(const Command &Cmd) {
   std::string CmdLine = Cmd.toString();
-  return system(CmdLine.c_str());
+  int ExitCode = system(CmdLine.c_str());
+  // Callers compare against -error_exitcode and friends, so hand them the
+  // status the child exited with rather than the raw wait status.
+  if (WIFEXITED(ExitCode))
+    return WEXITSTATUS(ExitCode);
+  return ExitCode;
 }
 
 } // namespace fuzzer
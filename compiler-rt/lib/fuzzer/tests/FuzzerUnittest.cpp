@@ -608,6 +608,80 @@ TEST(Corpus, Distribution) {
   }
 }
 
+TEST(Entropic, UpdateFrequency) {
+  const size_t One = 1, Two = 2;
+  const size_t FeatIdx1 = 0, FeatIdx2 = 42, FeatIdx3 = 12, FeatIdx4 = 26;
+  size_t Index;
+  EntropicOptions Entropic;
+  Entropic.Enabled = true;
+  std::unique_ptr<InputCorpus> C(new InputCorpus("", Entropic));
+  std::unique_ptr<InputInfo> II(new InputInfo());
+
+  C->AddRareFeature(FeatIdx1);
+  C->UpdateFeatureFrequency(II.get(), FeatIdx1);
+  EXPECT_EQ(II->FeatureFreqs.size(), One);
+  C->AddRareFeature(FeatIdx2);
+  C->UpdateFeatureFrequency(II.get(), FeatIdx1);
+  C->UpdateFeatureFrequency(II.get(), FeatIdx2);
+  EXPECT_EQ(II->FeatureFreqs.size(), Two);
+  EXPECT_EQ(II->FeatureFreqs[0].second, 2);
+  EXPECT_EQ(II->FeatureFreqs[1].second, 1);
+
+  C->AddRareFeature(FeatIdx3);
+  C->AddRareFeature(FeatIdx4);
+  C->UpdateFeatureFrequency(II.get(), FeatIdx3);
+  C->UpdateFeatureFrequency(II.get(), FeatIdx3);
+  C->UpdateFeatureFrequency(II.get(), FeatIdx3);
+  C->UpdateFeatureFrequency(II.get(), FeatIdx4);
+
+  for (Index = 1; Index < II->FeatureFreqs.size(); Index++)
+    EXPECT_LT(II->FeatureFreqs[Index - 1].first, II->FeatureFreqs[Index].first);
+
+  II->DeleteFeatureFreq(FeatIdx3);
+  for (Index = 1; Index < II->FeatureFreqs.size(); Index++)
+    EXPECT_LT(II->FeatureFreqs[Index - 1].first, II->FeatureFreqs[Index].first);
+}
+
+TEST(Entropic, ComputeEnergy) {
+  const double Precision = 0.01;
+  std::unique_ptr<InputInfo> II(new InputInfo());
+  Vector<std::pair<uint32_t, uint16_t>> FeatureFreqs = {{1, 3}, {2, 3}, {3, 3}};
+  II->FeatureFreqs = FeatureFreqs;
+  II->NumExecutedMutations = 0;
+  II->UpdateEnergy(4);
+  EXPECT_NEAR(II->Energy, 1.450805, Precision);
+
+  II->NumExecutedMutations = 9;
+  II->UpdateEnergy(5);
+  EXPECT_NEAR(II->Energy, 1.525496, Precision);
+
+  II->FeatureFreqs[0].second++;
+  II->FeatureFreqs.push_back(std::pair<uint32_t, uint16_t>(42, 6));
+  II->NumExecutedMutations = 20;
+  II->UpdateEnergy(10);
+  EXPECT_NEAR(II->Energy, 1.792831, Precision);
+}
+
+TEST(Entropic, Distribution) {
+  DataFlowTrace DFT;
+  Random Rand(0);
+  EntropicOptions Entropic;
+  Entropic.Enabled = true;
+  std::unique_ptr<InputCorpus> C(new InputCorpus("", Entropic));
+  size_t N = 10;
+  size_t TriesPerUnit = 1<<16;
+  for (size_t i = 0; i < N; i++)
+    C->AddToCorpus(Unit{static_cast<uint8_t>(i)}, 1, false, false, {}, DFT,
+                   nullptr);
+
+  Vector<size_t> Hist(N);
+  for (size_t i = 0; i < N * TriesPerUnit; i++)
+    Hist[C->ChooseUnitIdxToMutate(Rand)]++;
+  // Fresh inputs all get the same maximal energy.
+  for (size_t i = 0; i < N; i++)
+    EXPECT_GT(Hist[i], TriesPerUnit / 2);
+}
+
 TEST(Merge, Bad) {
   const char *kInvalidInputs[] = {
     "",
@@ -731,6 +805,17 @@ TEST(Merge, Good) {
   InitialFeatures.insert(3);
   EXPECT_EQ(3U, M.Merge(InitialFeatures, &NewFiles));
   EQ(NewFiles, {"B"});
+
+  // The features that the merged files add are reported too.
+  EXPECT_TRUE(M.Parse("3\n0\nA\nB\nC\n"
+                        "STARTED 0 1000\nDONE 0 2 7\n"
+                        "STARTED 1 1001\nDONE 1 4 5\n"
+                        "STARTED 2 1002\nDONE 2 1 8\n"
+                        "", true));
+  Set<uint32_t> NewFeatures;
+  EXPECT_EQ(4U, M.Merge(InitialFeatures, &NewFeatures, &NewFiles));
+  EQ(NewFiles, {"A", "B", "C"});
+  EXPECT_EQ(NewFeatures, Set<uint32_t>({4, 5, 7, 8}));
 }
 
 TEST(Merge, Merge) {
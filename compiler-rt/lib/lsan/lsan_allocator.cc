@@ -39,11 +39,33 @@ typedef CombinedAllocator<PrimaryAllocator, AllocatorCache,
           SecondaryAllocator> Allocator;
 
 static Allocator allocator;
+static PerCPUAllocatorCache<AllocatorCache> per_cpu_cache;
+
+// Holds the allocator cache the calling thread should use: its own one, or a
+// locked per-CPU cache with common_flags()->allocator_per_cpu_cache.
+class ScopedAllocatorCache {
+ public:
+  ScopedAllocatorCache() : per_cpu_(per_cpu_cache.enabled()) {
+    cache_ = per_cpu_ ? per_cpu_cache.Lock(&slot_) : GetAllocatorCache();
+  }
+  ~ScopedAllocatorCache() {
+    if (per_cpu_)
+      per_cpu_cache.Unlock(slot_);
+  }
+  AllocatorCache *get() const { return cache_; }
+
+ private:
+  bool per_cpu_;
+  AllocatorCache *cache_;
+  uptr slot_;
+};
 
 void InitializeAllocator() {
   SetAllocatorMayReturnNull(common_flags()->allocator_may_return_null);
   allocator.InitLinkerInitialized(
       common_flags()->allocator_release_to_os_interval_ms);
+  if (common_flags()->allocator_per_cpu_cache)
+    per_cpu_cache.Init(&allocator);
 }
 
 void AllocatorThreadFinish() {
@@ -85,7 +107,11 @@ void *Allocate(const StackTrace &stack, uptr size, uptr alignment,
     size = 1;
   if (size > kMaxAllowedMallocSize)
     return ReportAllocationSizeTooBig(size, stack);
-  void *p = allocator.Allocate(GetAllocatorCache(), size, alignment);
+  void *p;
+  {
+    ScopedAllocatorCache cache;
+    p = allocator.Allocate(cache.get(), size, alignment);
+  }
   if (UNLIKELY(!p)) {
     SetAllocatorOutOfMemory();
     if (AllocatorMayReturnNull())
@@ -115,17 +141,24 @@ void Deallocate(void *p) {
   if (&__sanitizer_free_hook) __sanitizer_free_hook(p);
   RunFreeHooks(p);
   RegisterDeallocation(p);
-  allocator.Deallocate(GetAllocatorCache(), p);
+  ScopedAllocatorCache cache;
+  allocator.Deallocate(cache.get(), p);
 }
 
 void *Reallocate(const StackTrace &stack, void *p, uptr new_size,
                  uptr alignment) {
   RegisterDeallocation(p);
   if (new_size > kMaxAllowedMallocSize) {
-    allocator.Deallocate(GetAllocatorCache(), p);
+    {
+      ScopedAllocatorCache cache;
+      allocator.Deallocate(cache.get(), p);
+    }
     return ReportAllocationSizeTooBig(new_size, stack);
   }
-  p = allocator.Reallocate(GetAllocatorCache(), p, new_size, alignment);
+  {
+    ScopedAllocatorCache cache;
+    p = allocator.Reallocate(cache.get(), p, new_size, alignment);
+  }
   RegisterAllocation(stack, p, new_size);
   return p;
 }
@@ -218,11 +251,13 @@ uptr lsan_mz_size(const void *p) {
 ///// Interface to the common LSan module. /////
 
 void LockAllocator() {
+  per_cpu_cache.LockAll();
   allocator.ForceLock();
 }
 
 void UnlockAllocator() {
   allocator.ForceUnlock();
+  per_cpu_cache.UnlockAll();
 }
 
 void GetAllocatorGlobalRange(uptr *begin, uptr *end) {
@@ -38,17 +38,9 @@ struct ChainedOriginDepotNode {
   }
 
   /* This is murmur2 hash for the 64->32 bit case.
-     It does not behave all that well because the keys have a very biased
-     distribution (I've seen 7-element buckets with the table only 14% full).
-
-     here_id is built of
-     * (1 bits) Reserved, zero.
-     * (8 bits) Part id = bits 13..20 of the hash value of here_id's key.
-     * (23 bits) Sequential number (each part has each own sequence).
-
-     prev_id has either the same distribution as here_id (but with 3:8:21)
-     split, or one of two reserved values (-1) or (-2). Either case can
-     dominate depending on the workload.
+     here_id and prev_id are depot ids, which are handed out sequentially;
+     prev_id can also be one of two reserved values (-1) or (-2). Either case
+     can dominate depending on the workload.
   */
   static u32 hash(const args_type &args) {
     const u32 m = 0x5bd1e995;
@@ -85,6 +77,8 @@ struct ChainedOriginDepotNode {
     return ret;
   }
 
+  u32 stored_hash() const { return hash(load()); }
+
   struct Handle {
     ChainedOriginDepotNode *node_;
     Handle() : node_(nullptr) {}
@@ -100,7 +94,7 @@ struct ChainedOriginDepotNode {
   typedef Handle handle_type;
 };
 
-static StackDepotBase<ChainedOriginDepotNode, 4, 20> chainedOriginDepot;
+static StackDepotBase<ChainedOriginDepotNode, 4, 16> chainedOriginDepot;
 
 StackDepotStats *ChainedOriginDepotGetStats() {
   return chainedOriginDepot.GetStats();
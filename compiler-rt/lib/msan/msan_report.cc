@@ -128,6 +128,9 @@ void ReportStats() {
     // FIXME: but only with verbosity=1 or something
     Printf("Unique heap origins: %zu\n", stack_depot_stats->n_uniq_ids);
     Printf("Stack depot allocated bytes: %zu\n", stack_depot_stats->allocated);
+    Printf("Stack depot mapped bytes: %zu\n", stack_depot_stats->mapped);
+    Printf("Stack depot collisions: %zu in %zu buckets\n",
+           stack_depot_stats->n_collisions, stack_depot_stats->n_buckets);
 
     StackDepotStats *chained_origin_depot_stats = ChainedOriginDepotGetStats();
     Printf("Unique origin histories: %zu\n",
@@ -36,6 +36,48 @@ COMPILER_RT_VISIBILITY void lprofSetProfileDumped() {
   ProfileDumped = 1;
 }
 
+/* Defined (as 0) in the objects compiled with runtime counter relocation. */
+#ifndef _MSC_VER
+COMPILER_RT_VISIBILITY extern intptr_t INSTR_PROF_PROFILE_COUNTER_BIAS_VAR
+    COMPILER_RT_WEAK;
+#endif
+
+static int ContinuousModeEnabled = 0;
+
+COMPILER_RT_VISIBILITY void (*FoldCounterShardsHook)(void) = NULL;
+COMPILER_RT_VISIBILITY void (*ResetCounterShardsHook)(void) = NULL;
+
+COMPILER_RT_VISIBILITY int lprofHasCounterBias(void) {
+#ifndef _MSC_VER
+  return &INSTR_PROF_PROFILE_COUNTER_BIAS_VAR != 0;
+#else
+  return 0;
+#endif
+}
+
+COMPILER_RT_VISIBILITY intptr_t lprofGetCounterBias(void) {
+#ifndef _MSC_VER
+  if (&INSTR_PROF_PROFILE_COUNTER_BIAS_VAR)
+    return INSTR_PROF_PROFILE_COUNTER_BIAS_VAR;
+#endif
+  return 0;
+}
+
+COMPILER_RT_VISIBILITY int lprofSetCounterBias(intptr_t Bias) {
+#ifndef _MSC_VER
+  if (&INSTR_PROF_PROFILE_COUNTER_BIAS_VAR) {
+    INSTR_PROF_PROFILE_COUNTER_BIAS_VAR = Bias;
+    ContinuousModeEnabled = 1;
+    return 0;
+  }
+#endif
+  return -1;
+}
+
+COMPILER_RT_VISIBILITY int __llvm_profile_is_continuous_mode_enabled(void) {
+  return ContinuousModeEnabled;
+}
+
 /* Return the number of bytes needed to add to SizeInBytes to make it
  *   the result a multiple of 8.
  */
@@ -49,10 +91,15 @@ COMPILER_RT_VISIBILITY uint64_t __llvm_profile_get_version(void) {
 }
 
 COMPILER_RT_VISIBILITY void __llvm_profile_reset_counters(void) {
-  uint64_t *I = __llvm_profile_begin_counters();
-  uint64_t *E = __llvm_profile_end_counters();
+  /* In continuous mode the counters in use live in the profile file. */
+  uint64_t *I = (uint64_t *)((char *)__llvm_profile_begin_counters() +
+                             lprofGetCounterBias());
+  uint64_t *E = (uint64_t *)((char *)__llvm_profile_end_counters() +
+                             lprofGetCounterBias());
 
   memset(I, 0, sizeof(uint64_t) * (E - I));
+  if (ResetCounterShardsHook)
+    ResetCounterShardsHook();
 
   const __llvm_profile_data *DataBegin = __llvm_profile_begin_data();
   const __llvm_profile_data *DataEnd = __llvm_profile_end_data();
@@ -160,6 +160,18 @@ int __llvm_profile_register_write_file_atexit(void);
 /*! \brief Initialize file handling. */
 void __llvm_profile_initialize_file(void);
 
+/*!
+ * \brief Return 1 if the profile is in continuous mode, 0 otherwise.
+ *
+ * The continuous mode is requested with the \c %c specifier in the profile
+ * filename, and needs code compiled with \c -runtime-counter-relocation. The
+ * counters are then updated in a shared memory mapping of the profile file,
+ * so the profile survives the process being killed, and nothing is written
+ * at exit. Combined with \c %m, all the processes map the same file and their
+ * counters are merged as they run. Value profile data is not collected.
+ */
+int __llvm_profile_is_continuous_mode_enabled(void);
+
 /*!
  * \brief Return path prefix (excluding the base filename) of the profile data.
  * This is useful for users using \c -fprofile-generate=./path_prefix who do
@@ -84,11 +84,14 @@ typedef struct lprofFilename {
    * 2 profile data files. %1m is equivalent to %m. Also %m specifier
    * can only appear once at the end of the name pattern. */
   unsigned MergePoolSize;
+  /* Set if the %c specifier requests the continuous mode, in which the
+   * counters are kept in a memory mapping of the profile file. */
+  unsigned ContinuousMode;
   ProfileNameSpecifier PNS;
 } lprofFilename;
 
-COMPILER_RT_WEAK lprofFilename lprofCurFilename = {0,   0, 0, 0, {0},
-                                                   {0}, 0, 0, 0, PNS_unknown};
+COMPILER_RT_WEAK lprofFilename lprofCurFilename = {
+    0, 0, 0, 0, {0}, {0}, 0, 0, 0, 0, PNS_unknown};
 
 static int getCurFilenameLength();
 static const char *getCurFilename(char *FilenameBuf, int ForceUseBuf);
@@ -236,6 +239,79 @@ static FILE *openFileForMerging(const char *ProfileFileName, int *MergeDone) {
   return ProfileFile;
 }
 
+/* Set up the continuous mode: write the profile to \c Filename, unless it
+ * already holds a compatible profile, and make the instrumented code update
+ * the counters in a shared memory mapping of the file from now on. If the
+ * file is reused, the counts of the process so far are added to it, so with
+ * %m all the processes merge their counters in place. */
+static void initializeProfileForContinuousMode(const char *Filename) {
+  const uint64_t *CountersBegin = __llvm_profile_begin_counters();
+  const uint64_t *CountersEnd = __llvm_profile_end_counters();
+  const uint64_t DataSize = __llvm_profile_get_data_size(
+      __llvm_profile_begin_data(), __llvm_profile_end_data());
+  const uint64_t ProfileSize = __llvm_profile_get_size_for_buffer();
+  const uint64_t CountersOffset =
+      sizeof(__llvm_profile_header) + DataSize * sizeof(__llvm_profile_data);
+  uint64_t FileSize, I;
+  int Reuse = 0;
+  char *Profile;
+  uint64_t *FileCounters;
+  FILE *File;
+
+  if (!DataSize || __llvm_profile_is_continuous_mode_enabled())
+    return;
+  if (!lprofHasCounterBias()) {
+    PROF_WARN("Continuous mode needs code compiled with %s; the profile will "
+              "be written at exit.\n",
+              "-mllvm -runtime-counter-relocation");
+    return;
+  }
+
+  createProfileDir(Filename);
+  /* The file is locked until it is closed. */
+  File = lprofOpenFileEx(Filename);
+  if (!File)
+    goto failed;
+
+  if (fseek(File, 0L, SEEK_END) == -1)
+    goto failed_close;
+  FileSize = ftell(File);
+  if (FileSize >= ProfileSize) {
+    Profile = mmap(NULL, FileSize, PROT_READ, MAP_SHARED | MAP_FILE,
+                   fileno(File), 0);
+    if (Profile == MAP_FAILED)
+      goto failed_close;
+    Reuse = !__llvm_profile_check_compatibility(Profile, FileSize);
+    (void)munmap(Profile, FileSize);
+  }
+  if (!Reuse) {
+    ProfDataWriter FileWriter;
+    if (COMPILER_RT_FTRUNCATE(File, 0L) || fseek(File, 0L, SEEK_SET) == -1)
+      goto failed_close;
+    initFileWriter(&FileWriter, File);
+    if (lprofWriteData(&FileWriter, 0, 0) || fflush(File))
+      goto failed_close;
+  }
+
+  Profile = mmap(NULL, ProfileSize, PROT_READ | PROT_WRITE,
+                 MAP_SHARED | MAP_FILE, fileno(File), 0);
+  if (Profile == MAP_FAILED)
+    goto failed_close;
+  FileCounters = (uint64_t *)(Profile + CountersOffset);
+  if (Reuse)
+    for (I = 0; I < (uint64_t)(CountersEnd - CountersBegin); I++)
+      FileCounters[I] += CountersBegin[I];
+  lprofSetCounterBias((intptr_t)FileCounters - (intptr_t)CountersBegin);
+  fclose(File);
+  return;
+
+failed_close:
+  fclose(File);
+failed:
+  PROF_ERR("Unable to map profile file \"%s\" for continuous mode: %s\n",
+           Filename, strerror(errno));
+}
+
 /* Write profile data to file \c OutputName.  */
 static int writeFile(const char *OutputName) {
   int RetVal;
@@ -352,6 +428,8 @@ static int parseFilenamePattern(const char *FilenamePat,
                       FilenamePat);
             return -1;
           }
+      } else if (FilenamePat[I] == 'c') {
+        lprofCurFilename.ContinuousMode = 1;
       } else if (containsMergeSpecifier(FilenamePat, I)) {
         if (MergingEnabled) {
           PROF_WARN("%%m specifier can only be specified once in %s.\n",
@@ -408,6 +486,14 @@ static void parseAndSetFilename(const char *FilenamePat,
   }
 
   truncateCurrentFile();
+
+  if (lprofCurFilename.ContinuousMode) {
+    int Length = getCurFilenameLength();
+    char *FilenameBuf = (char *)COMPILER_RT_ALLOCA(Length + 1);
+    const char *Filename = getCurFilename(FilenameBuf, 0);
+    if (Filename)
+      initializeProfileForContinuousMode(Filename);
+  }
 }
 
 /* Return buffer length that is required to store the current profile
@@ -420,7 +506,7 @@ static int getCurFilenameLength() {
     return 0;
 
   if (!(lprofCurFilename.NumPids || lprofCurFilename.NumHosts ||
-        lprofCurFilename.MergePoolSize))
+        lprofCurFilename.MergePoolSize || lprofCurFilename.ContinuousMode))
     return strlen(lprofCurFilename.FilenamePat);
 
   Len = strlen(lprofCurFilename.FilenamePat) +
@@ -444,7 +530,7 @@ static const char *getCurFilename(char *FilenameBuf, int ForceUseBuf) {
     return 0;
 
   if (!(lprofCurFilename.NumPids || lprofCurFilename.NumHosts ||
-        lprofCurFilename.MergePoolSize)) {
+        lprofCurFilename.MergePoolSize || lprofCurFilename.ContinuousMode)) {
     if (!ForceUseBuf)
       return lprofCurFilename.FilenamePat;
 
@@ -478,7 +564,7 @@ static const char *getCurFilename(char *FilenameBuf, int ForceUseBuf) {
         if (FilenamePat[I] != 'm')
           I++;
       }
-      /* Drop any unknown substitutions. */
+      /* Drop %c and any unknown substitutions. */
     } else
       FilenameBuf[J++] = FilenamePat[I];
   FilenameBuf[J] = 0;
@@ -583,6 +669,12 @@ void __llvm_profile_initialize_file(void) {
  */
 COMPILER_RT_VISIBILITY
 void __llvm_profile_set_filename(const char *FilenamePat) {
+  if (__llvm_profile_is_continuous_mode_enabled()) {
+    PROF_WARN("Profile file name cannot be changed in continuous mode, "
+              "keeping %s.\n",
+              __llvm_profile_get_filename());
+    return;
+  }
   parseAndSetFilename(FilenamePat, PNS_runtime_api, 1);
 }
 
@@ -603,6 +695,10 @@ int __llvm_profile_write_file(void) {
     return 0;
   }
 
+  /* The counters are already in the file. */
+  if (__llvm_profile_is_continuous_mode_enabled())
+    return 0;
+
   Length = getCurFilenameLength();
   FilenameBuf = (char *)COMPILER_RT_ALLOCA(Length + 1);
   Filename = getCurFilename(FilenameBuf, 0);
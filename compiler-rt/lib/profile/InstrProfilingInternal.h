@@ -164,6 +164,11 @@ VPDataReaderType *lprofGetVPDataReader();
 void lprofSetMaxValsPerSite(uint32_t MaxVals);
 void lprofSetupValueProfiler();
 
+/* Record only one value profiling call out of every \p Period on average,
+ * with a count scaled by the number of calls it stands for. The period can
+ * also be set with the LLVM_VP_SAMPLING_PERIOD environment variable. */
+void lprofSetValueSamplingPeriod(uint32_t Period);
+
 /* Return the profile header 'signature' value associated with the current
  * executable or shared library. The signature value can be used to for
  * a profile name that is unique to this load module so that it does not
@@ -178,6 +183,22 @@ uint64_t lprofGetLoadModuleSignature();
 unsigned lprofProfileDumped();
 void lprofSetProfileDumped();
 
+/* Return 1 if code compiled with runtime counter relocation is linked in. */
+int lprofHasCounterBias(void);
+/* Return the offset that code compiled with runtime counter relocation adds
+ * to the address of every counter, 0 if there is no such code. */
+intptr_t lprofGetCounterBias(void);
+/* Set the counter bias and mark the continuous mode as enabled. Returns -1
+ * if the instrumented code does not read the bias. */
+int lprofSetCounterBias(intptr_t Bias);
+
+/* Set when the first per-thread copy of the counters is created, so that
+ * programs not using them do not link InstrProfilingShard.c. The first hook
+ * adds the per-thread copies to the counters in use and clears them, the
+ * second clears them. */
+COMPILER_RT_VISIBILITY extern void (*FoldCounterShardsHook)(void);
+COMPILER_RT_VISIBILITY extern void (*ResetCounterShardsHook)(void);
+
 COMPILER_RT_VISIBILITY extern void (*FreeHook)(void *);
 COMPILER_RT_VISIBILITY extern uint8_t *DynamicBufferIOBuffer;
 COMPILER_RT_VISIBILITY extern uint32_t VPBufferSize;
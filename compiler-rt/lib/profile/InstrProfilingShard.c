@@ -0,0 +1,140 @@
+/*===- InstrProfilingShard.c - Per-thread copies of the profile counters --===*\
+|*
+|*                     The LLVM Compiler Infrastructure
+|*
+|* This file is distributed under the University of Illinois Open Source
+|* License. See LICENSE.TXT for details.
+|*
+\*===----------------------------------------------------------------------===*/
+
+/* Code compiled with -mllvm -instrprof-per-thread-counters does not update
+ * the counter section but a copy of it owned by the current thread (a shard),
+ * located INSTR_PROF_PROFILE_COUNTER_SHARD_VAR bytes away. The increments
+ * need neither atomics nor exclusive cache lines. The shards are added to the
+ * counter section when the profile is written and when their thread exits,
+ * after which they are reused by new threads. Increments racing with the
+ * writing of the profile, by threads that are still running, can be lost.
+ * The instrumentation is rejected for Windows targets. */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "InstrProfiling.h"
+#include "InstrProfilingInternal.h"
+#include "InstrProfilingUtil.h"
+
+#if !defined(_WIN32)
+
+#include <pthread.h>
+
+/* Without libpthread there is only one thread, whose shard is folded when
+ * the profile is written. */
+#pragma weak pthread_key_create
+#pragma weak pthread_setspecific
+
+typedef struct CounterShard {
+  struct CounterShard *Next;
+  uint64_t Counters[];
+} CounterShard;
+
+/* 0 until the first call to INSTR_PROF_PROFILE_COUNTER_SHARD_INIT_FUNC on
+ * the thread. */
+COMPILER_RT_VISIBILITY __thread intptr_t INSTR_PROF_PROFILE_COUNTER_SHARD_VAR;
+
+/* The shards owned by threads and the shards of exited threads, which are
+ * zero. Both lists are protected by ShardLock. */
+static CounterShard *LiveShards;
+static CounterShard *FreeShards;
+static void *ShardLock;
+static pthread_key_t ShardKey;
+static int ShardKeyCreated;
+
+static void lockShards(void) {
+  while (!COMPILER_RT_BOOL_CMPXCHG(&ShardLock, 0, &ShardLock))
+    ;
+}
+
+static void unlockShards(void) {
+  COMPILER_RT_BOOL_CMPXCHG(&ShardLock, &ShardLock, 0);
+}
+
+static uint64_t getNumCounters(void) {
+  return __llvm_profile_end_counters() - __llvm_profile_begin_counters();
+}
+
+/* Add the counts of \c Shard to the counters in use and clear it. Must be
+ * called with ShardLock held. */
+static void foldShard(CounterShard *Shard) {
+  uint64_t *Counters = (uint64_t *)((char *)__llvm_profile_begin_counters() +
+                                    lprofGetCounterBias());
+  uint64_t I, N = getNumCounters();
+  for (I = 0; I < N; I++)
+    Counters[I] += Shard->Counters[I];
+  memset(Shard->Counters, 0, N * sizeof(uint64_t));
+}
+
+static void releaseShard(void *Arg) {
+  CounterShard *Shard = (CounterShard *)Arg;
+  CounterShard **P;
+  /* Instrumented code running later in the thread's exit gets a new shard. */
+  INSTR_PROF_PROFILE_COUNTER_SHARD_VAR = 0;
+  lockShards();
+  for (P = &LiveShards; *P != Shard; P = &(*P)->Next)
+    ;
+  *P = Shard->Next;
+  foldShard(Shard);
+  Shard->Next = FreeShards;
+  FreeShards = Shard;
+  unlockShards();
+}
+
+static void foldCounterShards(void) {
+  CounterShard *Shard;
+  lockShards();
+  for (Shard = LiveShards; Shard; Shard = Shard->Next)
+    foldShard(Shard);
+  unlockShards();
+}
+
+static void resetCounterShards(void) {
+  CounterShard *Shard;
+  lockShards();
+  for (Shard = LiveShards; Shard; Shard = Shard->Next)
+    memset(Shard->Counters, 0, getNumCounters() * sizeof(uint64_t));
+  unlockShards();
+}
+
+COMPILER_RT_VISIBILITY intptr_t
+INSTR_PROF_PROFILE_COUNTER_SHARD_INIT_FUNC(void) {
+  CounterShard *Shard;
+  lockShards();
+  Shard = FreeShards;
+  if (Shard)
+    FreeShards = Shard->Next;
+  unlockShards();
+
+  if (!Shard) {
+    Shard = (CounterShard *)calloc(
+        1, sizeof(CounterShard) + getNumCounters() * sizeof(uint64_t));
+    /* Keep updating the counter section, at the cost of lost counts. */
+    if (!Shard)
+      return 0;
+  }
+
+  lockShards();
+  Shard->Next = LiveShards;
+  LiveShards = Shard;
+  FoldCounterShardsHook = foldCounterShards;
+  ResetCounterShardsHook = resetCounterShards;
+  if (!ShardKeyCreated && pthread_key_create)
+    ShardKeyCreated = !pthread_key_create(&ShardKey, releaseShard);
+  unlockShards();
+  if (ShardKeyCreated)
+    pthread_setspecific(ShardKey, Shard);
+
+  INSTR_PROF_PROFILE_COUNTER_SHARD_VAR =
+      (intptr_t)Shard->Counters - (intptr_t)__llvm_profile_begin_counters();
+  return INSTR_PROF_PROFILE_COUNTER_SHARD_VAR;
+}
+
+#endif
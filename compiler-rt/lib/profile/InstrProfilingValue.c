@@ -26,6 +26,7 @@ static int hasNonDefaultValsPerSite = 0;
 #define INSTR_PROF_MAX_VP_WARNS 10
 #define INSTR_PROF_DEFAULT_NUM_VAL_PER_SITE 16
 #define INSTR_PROF_VNODE_POOL_SIZE 1024
+#define INSTR_PROF_MAX_VP_SAMPLING_PERIOD (1U << 24)
 
 #ifndef _MSC_VER
 /* A shared static pool in addition to the vnodes statically
@@ -38,6 +39,16 @@ COMPILER_RT_VISIBILITY ValueProfNode
 COMPILER_RT_VISIBILITY uint32_t VPMaxNumValsPerSite =
     INSTR_PROF_DEFAULT_NUM_VAL_PER_SITE;
 
+/* Only record one value out of every VPSamplingPeriod on average. */
+COMPILER_RT_VISIBILITY uint32_t VPSamplingPeriod = 1;
+
+/* The number of value profiling calls on this thread until the next one that
+ * is recorded (included), the number of calls it stands for, and the state of
+ * the random number generator that picks that number. */
+static COMPILER_RT_THREAD_LOCAL uint32_t VPSampleCountdown;
+static COMPILER_RT_THREAD_LOCAL uint32_t VPSampleInterval;
+static COMPILER_RT_THREAD_LOCAL uint32_t VPSampleRandom;
+
 COMPILER_RT_VISIBILITY void lprofSetupValueProfiler() {
   const char *Str = 0;
   Str = getenv("LLVM_VP_MAX_NUM_VALS_PER_SITE");
@@ -47,6 +58,9 @@ COMPILER_RT_VISIBILITY void lprofSetupValueProfiler() {
   }
   if (VPMaxNumValsPerSite > INSTR_PROF_MAX_NUM_VAL_PER_SITE)
     VPMaxNumValsPerSite = INSTR_PROF_MAX_NUM_VAL_PER_SITE;
+  Str = getenv("LLVM_VP_SAMPLING_PERIOD");
+  if (Str && Str[0])
+    lprofSetValueSamplingPeriod(atoi(Str));
 }
 
 COMPILER_RT_VISIBILITY void lprofSetMaxValsPerSite(uint32_t MaxVals) {
@@ -54,6 +68,40 @@ COMPILER_RT_VISIBILITY void lprofSetMaxValsPerSite(uint32_t MaxVals) {
   hasNonDefaultValsPerSite = 1;
 }
 
+COMPILER_RT_VISIBILITY void lprofSetValueSamplingPeriod(uint32_t Period) {
+  if (Period < 1)
+    Period = 1;
+  if (Period > INSTR_PROF_MAX_VP_SAMPLING_PERIOD)
+    Period = INSTR_PROF_MAX_VP_SAMPLING_PERIOD;
+  VPSamplingPeriod = Period;
+}
+
+/* Return 0 if the current value profiling call is not sampled, otherwise the
+ * number of calls on the thread since the previous sampled one, which its
+ * value stands for. The distance between samples is random, with a mean of
+ * VPSamplingPeriod, so that the samples do not follow the call pattern. The
+ * recorded counts are thus unbiased estimates of the real ones, and sampled
+ * profiles merge with each other and with complete ones as they are. */
+static COMPILER_RT_ALWAYS_INLINE uint32_t sampleValue(void) {
+  uint32_t Weight, X;
+  if (VPSamplingPeriod <= 1)
+    return 1;
+  if (VPSampleCountdown > 1) {
+    VPSampleCountdown--;
+    return 0;
+  }
+  Weight = VPSampleInterval ? VPSampleInterval : 1;
+  /* xorshift32, seeded from the address of the thread's state. */
+  X = VPSampleRandom ? VPSampleRandom
+                     : (uint32_t)(uintptr_t)&VPSampleRandom | 1;
+  X ^= X << 13;
+  X ^= X >> 17;
+  X ^= X << 5;
+  VPSampleRandom = X;
+  VPSampleInterval = VPSampleCountdown = 1 + X % (2 * VPSamplingPeriod - 1);
+  return Weight;
+}
+
 /* This method is only used in value profiler mock testing.  */
 COMPILER_RT_VISIBILITY void
 __llvm_profile_set_num_value_sites(__llvm_profile_data *Data,
@@ -87,8 +135,9 @@ static int allocateValueProfileCounters(__llvm_profile_data *Data) {
      statically at compile time.  */
   hasStaticCounters = 0;
   /* When dynamic allocation is enabled, allow tracking the max number of
-   * values allowd.  */
-  if (!hasNonDefaultValsPerSite)
+   * values allowd. Sampling only finds the hot values, so it keeps the
+   * default number to bound the memory used.  */
+  if (!hasNonDefaultValsPerSite && VPSamplingPeriod <= 1)
     VPMaxNumValsPerSite = INSTR_PROF_MAX_NUM_VAL_PER_SITE;
 
   for (VKI = IPVK_First; VKI <= IPVK_Last; ++VKI)
@@ -136,10 +185,14 @@ static COMPILER_RT_ALWAYS_INLINE void
 instrumentTargetValueImpl(uint64_t TargetValue, void *Data,
                           uint32_t CounterIndex, uint64_t CountValue) {
   __llvm_profile_data *PData = (__llvm_profile_data *)Data;
+  uint32_t Weight = sampleValue();
+  if (!Weight)
+    return;
   if (!PData)
     return;
   if (!CountValue)
     return;
+  CountValue *= Weight;
   if (!PData->Values) {
     if (!allocateValueProfileCounters(PData))
       return;
@@ -77,6 +77,14 @@ struct SizeClassAllocator64LocalCache {
     }
   }
 
+  // Returns the number of bytes held in the cache, ready to be handed out.
+  uptr CachedBytes() const {
+    uptr res = 0;
+    for (uptr i = 1; i < kNumClasses; i++)
+      res += per_class_[i].count * per_class_[i].class_size;
+    return res;
+  }
+
  private:
   typedef typename Allocator::SizeClassMapT SizeClassMap;
   static const uptr kNumClasses = SizeClassMap::kNumClasses;
@@ -193,6 +201,14 @@ struct SizeClassAllocator32LocalCache {
     }
   }
 
+  // Returns the number of bytes held in the cache, ready to be handed out.
+  uptr CachedBytes() const {
+    uptr res = 0;
+    for (uptr i = 1; i < kNumClasses; i++)
+      res += per_class_[i].count * per_class_[i].class_size;
+    return res;
+  }
+
  private:
   typedef typename Allocator::SizeClassMapT SizeClassMap;
   static const uptr kBatchClassID = SizeClassMap::kBatchClassID;
@@ -0,0 +1,142 @@
+//===-- sanitizer_allocator_per_cpu_cache.h ---------------------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// Part of the Sanitizer Allocator.
+//
+//===----------------------------------------------------------------------===//
+#ifndef SANITIZER_ALLOCATOR_H
+#error This file must be included inside sanitizer_allocator.h
+#endif
+
+struct PerCPUAllocatorCacheStats {
+  uptr n_caches;
+  // Bytes of free chunks held in the caches.
+  uptr cached;
+  // Bytes of the caches themselves.
+  uptr mapped;
+  // Number of times the cache of the current CPU was busy.
+  uptr n_contended;
+};
+
+// A set of allocator caches, one per CPU, shared by all the threads running on
+// that CPU. A thread locks the cache of the CPU it runs on (or, when that one
+// is busy, of another CPU) for the duration of an allocator call.
+//
+// Compared to one cache per thread, the memory held in the caches is bounded
+// by the number of CPUs rather than by the number of threads, and thread exit
+// has nothing to drain. The price is an uncontended lock and a getcpu call
+// per operation.
+//
+// Objects of this type are expected to be linker initialized; the caches are
+// only mapped by Init().
+template <class AllocatorCache>
+class PerCPUAllocatorCache {
+  struct ALIGNED(SANITIZER_CACHE_LINE_SIZE) Slot {
+    StaticSpinMutex mtx;
+    AllocatorCache cache;
+  };
+
+ public:
+  template <class Allocator>
+  void Init(Allocator *allocator) {
+    CHECK(!slots_);
+    n_slots_ = Max(1U, GetNumberOfCPUsCached());
+    Slot *slots = (Slot *)MmapOrDie(n_slots_ * sizeof(Slot),
+                                    "PerCPUAllocatorCache");
+    for (uptr i = 0; i < n_slots_; i++) {
+      slots[i].mtx.Init();
+      allocator->InitCache(&slots[i].cache);
+    }
+    slots_ = slots;
+  }
+
+  bool enabled() const { return slots_ != nullptr; }
+
+  // Locks and returns a cache for the calling thread. The index to pass to
+  // Unlock() is stored in *slot.
+  AllocatorCache *Lock(uptr *slot) {
+    DCHECK(enabled());
+    uptr start = CurrentSlot();
+    // Rather than waiting for a preempted thread, try a couple of neighbours.
+    for (uptr i = 0; i < Min(kMaxProbes, n_slots_); i++) {
+      uptr idx = (start + i) % n_slots_;
+      if (slots_[idx].mtx.TryLock()) {
+        *slot = idx;
+        return &slots_[idx].cache;
+      }
+      atomic_fetch_add(&n_contended_, 1, memory_order_relaxed);
+    }
+    slots_[start].mtx.Lock();
+    *slot = start;
+    return &slots_[start].cache;
+  }
+
+  void Unlock(uptr slot) { slots_[slot].mtx.Unlock(); }
+
+  // Returns the free chunks in all caches to the allocator.
+  template <class Allocator>
+  void Drain(Allocator *allocator) {
+    for (uptr i = 0; enabled() && i < n_slots_; i++) {
+      SpinMutexLock l(&slots_[i].mtx);
+      allocator->SwallowCache(&slots_[i].cache);
+    }
+  }
+
+  void LockAll() {
+    for (uptr i = 0; enabled() && i < n_slots_; i++)
+      slots_[i].mtx.Lock();
+  }
+
+  void UnlockAll() {
+    for (uptr i = 0; enabled() && i < n_slots_; i++)
+      slots_[i].mtx.Unlock();
+  }
+
+  // The numbers are collected without locking and are approximate.
+  void GetStats(PerCPUAllocatorCacheStats *stats) const {
+    internal_memset(stats, 0, sizeof(*stats));
+    if (!enabled())
+      return;
+    stats->n_caches = n_slots_;
+    stats->mapped = RoundUpTo(n_slots_ * sizeof(Slot), GetPageSizeCached());
+    for (uptr i = 0; i < n_slots_; i++)
+      stats->cached += slots_[i].cache.CachedBytes();
+    stats->n_contended = atomic_load(&n_contended_, memory_order_relaxed);
+  }
+
+  // Locks the cache for the lifetime of the object.
+  class ScopedLock {
+   public:
+    explicit ScopedLock(PerCPUAllocatorCache *c) : c_(c) {
+      cache_ = c_->Lock(&slot_);
+    }
+    ~ScopedLock() { c_->Unlock(slot_); }
+    AllocatorCache *cache() const { return cache_; }
+
+   private:
+    PerCPUAllocatorCache *c_;
+    AllocatorCache *cache_;
+    uptr slot_;
+  };
+
+ private:
+  static const uptr kMaxProbes = 4;
+
+  uptr CurrentSlot() const {
+    int cpu = GetCurrentCPU();
+    if (LIKELY(cpu >= 0))
+      return (uptr)cpu % n_slots_;
+    // Without a CPU number, spread the threads by their stacks.
+    return (GET_CURRENT_FRAME() >> 16) % n_slots_;
+  }
+
+  Slot *slots_;
+  uptr n_slots_;
+  atomic_uintptr_t n_contended_;
+};
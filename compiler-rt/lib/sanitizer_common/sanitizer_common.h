@@ -928,7 +928,11 @@ INLINE void AvoidCVE_2016_2143() {}
 
 struct StackDepotStats {
   uptr n_uniq_ids;
-  uptr allocated;
+  uptr allocated;        // Bytes used by the stored values.
+  uptr mapped;           // Bytes mapped for the hash table and the id map.
+  uptr n_buckets;
+  uptr n_collisions;     // Values inserted into an occupied bucket.
+  uptr max_bucket_size;
 };
 
 // The default value for allocator_release_to_os_interval_ms common flag to
@@ -950,6 +954,10 @@ INLINE u32 GetNumberOfCPUsCached() {
   return NumberOfCPUsCached;
 }
 
+// Returns the CPU the calling thread is running on, or -1 if the platform
+// can't tell. The thread may have migrated by the time the caller looks.
+int GetCurrentCPU();
+
 }  // namespace __sanitizer
 
 inline void *operator new(__sanitizer::operator_new_size_type size,
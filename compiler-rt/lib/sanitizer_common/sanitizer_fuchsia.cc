@@ -488,6 +488,10 @@ u32 GetNumberOfCPUs() {
   return zx_system_get_num_cpus();
 }
 
+int GetCurrentCPU() {
+  return -1;
+}
+
 uptr GetRSS() { UNIMPLEMENTED(); }
 
 }  // namespace __sanitizer
@@ -702,6 +702,15 @@ u32 GetNumberOfCPUs() {
 #endif
 }
 
+int GetCurrentCPU() {
+#if SANITIZER_LINUX
+  // Goes through the vDSO on the platforms that have one.
+  return sched_getcpu();
+#else
+  return -1;
+#endif
+}
+
 #if SANITIZER_LINUX
 
 # if SANITIZER_ANDROID
@@ -1088,6 +1088,10 @@ u32 GetNumberOfCPUs() {
   return (u32)sysconf(_SC_NPROCESSORS_ONLN);
 }
 
+int GetCurrentCPU() {
+  return -1;
+}
+
 }  // namespace __sanitizer
 
 #endif  // SANITIZER_MAC
@@ -73,6 +73,8 @@ COMPILER_CHECK(sizeof(QuarantineBatch) <= (1 << 13));  // 8Kb.
 // void Callback::Recycle(Node *ptr);
 // void *cb.Allocate(uptr size);
 // void cb.Deallocate(void *ptr);
+// Optionally, a callback can recycle all the chunks of a batch at once with:
+// void cb.RecycleBatch(Node **ptrs, uptr count);
 template<typename Callback, typename Node>
 class Quarantine {
  public:
@@ -183,18 +185,30 @@ class Quarantine {
 
   void NOINLINE DoRecycle(Cache *c, Callback cb) {
     while (QuarantineBatch *b = c->DequeueBatch()) {
-      const uptr kPrefetch = 16;
-      CHECK(kPrefetch <= ARRAY_SIZE(b->batch));
-      for (uptr i = 0; i < kPrefetch; i++)
-        PREFETCH(b->batch[i]);
-      for (uptr i = 0, count = b->count; i < count; i++) {
-        if (i + kPrefetch < count)
-          PREFETCH(b->batch[i + kPrefetch]);
-        cb.Recycle((Node*)b->batch[i]);
-      }
+      RecycleChunks(&cb, b, 0);
       cb.Deallocate(b);
     }
   }
+
+  // Picked over the generic version below if the callback has RecycleBatch.
+  template <typename CB>
+  static auto RecycleChunks(CB *cb, QuarantineBatch *b, int)
+      -> decltype(cb->RecycleBatch((Node **)b->batch, b->count)) {
+    return cb->RecycleBatch((Node **)b->batch, b->count);
+  }
+
+  template <typename CB>
+  static void RecycleChunks(CB *cb, QuarantineBatch *b, long) {
+    const uptr kPrefetch = 16;
+    CHECK(kPrefetch <= ARRAY_SIZE(b->batch));
+    for (uptr i = 0; i < kPrefetch; i++)
+      PREFETCH(b->batch[i]);
+    for (uptr i = 0, count = b->count; i < count; i++) {
+      if (i + kPrefetch < count)
+        PREFETCH(b->batch[i + kPrefetch]);
+      cb->Recycle((Node*)b->batch[i]);
+    }
+  }
 };
 
 // Per-thread cache of memory blocks.
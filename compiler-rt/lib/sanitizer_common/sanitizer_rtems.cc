@@ -241,6 +241,8 @@ bool IsAccessibleMemoryRange(uptr beg, uptr size) {
 
 char **GetArgv() { return nullptr; }
 
+int GetCurrentCPU() { return -1; }
+
 const char *GetEnv(const char *name) {
   return getenv(name);
 }
@@ -14,72 +14,147 @@
 #include "sanitizer_stackdepot.h"
 
 #include "sanitizer_common.h"
+#include "sanitizer_flags.h"
 #include "sanitizer_stackdepotbase.h"
 
 namespace __sanitizer {
 
+// Frames of one stack share most of their high bits, so a frame is packed as
+// the zigzag LEB128 encoding of its distance from the previous frame.
+static uptr PackedFrameSize(uptr prev, uptr pc) {
+  sptr d = (sptr)(pc - prev);
+  uptr z = ((uptr)d << 1) ^ (uptr)(d >> (SANITIZER_WORDSIZE - 1));
+  uptr n = 1;
+  for (; z >= 0x80; z >>= 7) n++;
+  return n;
+}
+
+static u8 *PackFrame(u8 *p, uptr prev, uptr pc) {
+  sptr d = (sptr)(pc - prev);
+  uptr z = ((uptr)d << 1) ^ (uptr)(d >> (SANITIZER_WORDSIZE - 1));
+  for (; z >= 0x80; z >>= 7) *p++ = (u8)(z | 0x80);
+  *p++ = (u8)z;
+  return p;
+}
+
+static const u8 *UnpackFrame(const u8 *p, uptr *pc) {
+  uptr z = 0;
+  for (uptr shift = 0;; shift += 7) {
+    u8 b = *p++;
+    z |= (uptr)(b & 0x7f) << shift;
+    if (!(b & 0x80)) break;
+  }
+  *pc += (z >> 1) ^ (0 - (z & 1));
+  return p;
+}
+
 struct StackDepotNode {
   StackDepotNode *link;
   u32 id;
-  atomic_uint32_t hash_and_use_count; // hash_bits : 12; use_count : 20;
+  u32 stack_hash;
+  atomic_uint32_t use_count;
   u32 size;
   u32 tag;
+  // Number of bytes of packed frames in stack, 0 if the frames are stored
+  // as is.
+  u32 packed_size;
+  // Frames of a packed node, unpacked by the first load().
+  mutable atomic_uintptr_t unpacked;
   uptr stack[1];  // [size]
 
-  static const u32 kTabSizeLog = 20;
-  // Lower kTabSizeLog bits are equal for all items in one bucket.
-  // We use these bits to store the per-stack use counter.
-  static const u32 kUseCountBits = kTabSizeLog;
-  static const u32 kMaxUseCount = 1 << kUseCountBits;
-  static const u32 kUseCountMask = (1 << kUseCountBits) - 1;
-  static const u32 kHashMask = ~kUseCountMask;
+  // Initial hash table size, the table grows on demand.
+  static const u32 kTabSizeLog = 16;
+  static const u32 kMaxUseCount = 1 << 20;
 
   typedef StackTrace args_type;
   bool eq(u32 hash, const args_type &args) const {
-    u32 hash_bits =
-        atomic_load(&hash_and_use_count, memory_order_relaxed) & kHashMask;
-    if ((hash & kHashMask) != hash_bits || args.size != size || args.tag != tag)
+    if (hash != stack_hash || args.size != size || args.tag != tag)
       return false;
-    uptr i = 0;
-    for (; i < size; i++) {
-      if (stack[i] != args.trace[i]) return false;
+    if (!packed_size) {
+      for (uptr i = 0; i < size; i++) {
+        if (stack[i] != args.trace[i]) return false;
+      }
+      return true;
+    }
+    const u8 *p = (const u8 *)stack;
+    uptr pc = 0;
+    for (uptr i = 0; i < size; i++) {
+      p = UnpackFrame(p, &pc);
+      if (pc != args.trace[i]) return false;
     }
     return true;
   }
+  static uptr packed_size_of(const args_type &args) {
+    if (!common_flags()->compress_stack_depot)
+      return 0;
+    uptr n = 0, prev = 0;
+    for (uptr i = 0; i < args.size; i++) {
+      n += PackedFrameSize(prev, args.trace[i]);
+      prev = args.trace[i];
+    }
+    return n < args.size * sizeof(uptr) ? n : 0;
+  }
   static uptr storage_size(const args_type &args) {
-    return sizeof(StackDepotNode) + (args.size - 1) * sizeof(uptr);
+    uptr packed = packed_size_of(args);
+    uptr frames = packed ? packed : args.size * sizeof(uptr);
+    return RoundUpTo(sizeof(StackDepotNode) - sizeof(uptr) + frames,
+                     sizeof(uptr));
   }
   static u32 hash(const args_type &args) {
-    // murmur2
-    const u32 m = 0x5bd1e995;
-    const u32 seed = 0x9747b28c;
-    const u32 r = 24;
-    u32 h = seed ^ (args.size * sizeof(uptr));
+    // One multiply per frame; the finalizer (from MurmurHash3) spreads the
+    // bits that differ between frames over the whole value.
+    const u64 m = 0x9e3779b97f4a7c15ULL;
+    u64 h = (args.size * m) ^ args.tag;
     for (uptr i = 0; i < args.size; i++) {
-      u32 k = args.trace[i];
-      k *= m;
-      k ^= k >> r;
-      k *= m;
-      h *= m;
-      h ^= k;
+      h = (h ^ args.trace[i]) * m;
+      h ^= h >> 29;
     }
-    h ^= h >> 13;
-    h *= m;
-    h ^= h >> 15;
-    return h;
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    return (u32)h;
   }
   static bool is_valid(const args_type &args) {
     return args.size > 0 && args.trace;
   }
   void store(const args_type &args, u32 hash) {
-    atomic_store(&hash_and_use_count, hash & kHashMask, memory_order_relaxed);
+    stack_hash = hash;
+    atomic_store(&use_count, 0, memory_order_relaxed);
     size = args.size;
     tag = args.tag;
-    internal_memcpy(stack, args.trace, size * sizeof(uptr));
+    packed_size = packed_size_of(args);
+    atomic_store(&unpacked, 0, memory_order_relaxed);
+    if (!packed_size) {
+      internal_memcpy(stack, args.trace, size * sizeof(uptr));
+      return;
+    }
+    u8 *p = (u8 *)stack;
+    uptr prev = 0;
+    for (uptr i = 0; i < size; i++) {
+      p = PackFrame(p, prev, args.trace[i]);
+      prev = args.trace[i];
+    }
   }
   args_type load() const {
-    return args_type(&stack[0], size, tag);
+    if (!packed_size)
+      return args_type(&stack[0], size, tag);
+    uptr frames = atomic_load(&unpacked, memory_order_acquire);
+    if (!frames) {
+      uptr *trace = (uptr *)PersistentAlloc(size * sizeof(uptr));
+      const u8 *p = (const u8 *)stack;
+      uptr pc = 0;
+      for (uptr i = 0; i < size; i++) {
+        p = UnpackFrame(p, &pc);
+        trace[i] = pc;
+      }
+      // Concurrent loads may race to unpack; the loser's copy is leaked.
+      if (atomic_compare_exchange_strong(&unpacked, &frames, (uptr)trace,
+                                         memory_order_acq_rel))
+        frames = (uptr)trace;
+    }
+    return args_type((uptr *)frames, size, tag);
   }
+  u32 stored_hash() const { return stack_hash; }
   StackDepotHandle get_handle() { return StackDepotHandle(this); }
 
   typedef StackDepotHandle handle_type;
@@ -89,13 +164,10 @@ COMPILER_CHECK(StackDepotNode::kMaxUseCount == (u32)kStackDepotMaxUseCount);
 
 u32 StackDepotHandle::id() { return node_->id; }
 int StackDepotHandle::use_count() {
-  return atomic_load(&node_->hash_and_use_count, memory_order_relaxed) &
-         StackDepotNode::kUseCountMask;
+  return atomic_load(&node_->use_count, memory_order_relaxed);
 }
 void StackDepotHandle::inc_use_count_unsafe() {
-  u32 prev =
-      atomic_fetch_add(&node_->hash_and_use_count, 1, memory_order_relaxed) &
-      StackDepotNode::kUseCountMask;
+  u32 prev = atomic_fetch_add(&node_->use_count, 1, memory_order_relaxed);
   CHECK_LT(prev + 1, StackDepotNode::kMaxUseCount);
 }
 
@@ -136,17 +208,16 @@ bool StackDepotReverseMap::IdDescPair::IdComparator(
 }
 
 StackDepotReverseMap::StackDepotReverseMap() {
-  map_.reserve(StackDepotGetStats()->n_uniq_ids + 100);
-  for (int idx = 0; idx < StackDepot::kTabSize; idx++) {
-    atomic_uintptr_t *p = &theDepot.tab[idx];
-    uptr v = atomic_load(p, memory_order_consume);
-    StackDepotNode *s = (StackDepotNode*)(v & ~1);
-    for (; s; s = s->link) {
-      IdDescPair pair = {s->id, s};
-      map_.push_back(pair);
-    }
+  // Ids are sequential, so walking the id map yields a sorted snapshot.
+  u32 n = StackDepotGetStats()->n_uniq_ids;
+  map_.reserve(n + 100);
+  for (u32 id = 1; id <= n; id++) {
+    StackDepotNode *s = theDepot.GetNode(id);
+    if (!s)
+      continue;
+    IdDescPair pair = {id, s};
+    map_.push_back(pair);
   }
-  Sort(map_.data(), map_.size(), &IdDescPair::IdComparator);
 }
 
 StackTrace StackDepotReverseMap::Get(u32 id) {
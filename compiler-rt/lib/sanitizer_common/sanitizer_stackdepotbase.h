@@ -17,10 +17,28 @@
 #include "sanitizer_internal_defs.h"
 #include "sanitizer_mutex.h"
 #include "sanitizer_atomic.h"
+#include "sanitizer_common.h"
 #include "sanitizer_persistent_allocator.h"
 
 namespace __sanitizer {
 
+// Node must provide:
+//   Node *link;
+//   u32 id;
+//   bool eq(u32 hash, const args_type &args) const;
+//   static uptr storage_size(const args_type &args);
+//   static u32 hash(const args_type &args);
+//   static bool is_valid(const args_type &args);
+//   void store(const args_type &args, u32 hash);
+//   args_type load() const;
+//   u32 stored_hash() const;  // The hash passed to store().
+//   handle_type get_handle();
+//
+// Ids are handed out sequentially and resolved through a two-level id map, so
+// Get() is a couple of loads. Put() looks the arguments up in a hash table
+// without taking any locks and only locks a bucket to insert. The table starts
+// with 1 << kTabSizeLog buckets and doubles whenever the average bucket holds
+// more than kMaxLoad nodes.
 template <class Node, int kReservedBits, int kTabSizeLog>
 class StackDepotBase {
  public:
@@ -31,27 +49,52 @@ class StackDepotBase {
   // Retrieves a stored stack trace by the id.
   args_type Get(u32 id);
 
-  StackDepotStats *GetStats() { return &stats; }
+  StackDepotStats *GetStats();
 
   void LockAll();
   void UnlockAll();
 
  private:
+  struct Table {
+    uptr size_log;
+    atomic_uintptr_t tab[1];  // [1 << size_log]
+  };
+
   static Node *find(Node *s, args_type args, u32 hash);
   static Node *lock(atomic_uintptr_t *p);
   static void unlock(atomic_uintptr_t *p, Node *s);
+  static atomic_uintptr_t *bucket(Table *t, u32 hash) {
+    return &t->tab[hash & ((1UL << t->size_log) - 1)];
+  }
+  Table *AllocTable(uptr size_log);
+  Table *GetTable();
+  void Grow(Table *t);
+  Node *GetNode(u32 id);
+  void SetNode(u32 id, Node *s);
 
-  static const int kTabSize = 1 << kTabSizeLog;  // Hash table size.
-  static const int kPartBits = 8;
-  static const int kPartShift = sizeof(u32) * 8 - kPartBits - kReservedBits;
-  static const int kPartCount =
-      1 << kPartBits;  // Number of subparts in the table.
-  static const int kPartSize = kTabSize / kPartCount;
-  static const int kMaxId = 1 << kPartShift;
+  static const uptr kMaxTabSizeLog = 28;
+  static const uptr kMaxLoad = 2;
+  // A lock-free lookup may race with Grow() relinking the chain it walks, so
+  // it gives up after this many nodes and retries under the bucket lock.
+  static const int kMaxLockFreeSteps = 64;
+  static const u64 kMaxId = 1ULL << (sizeof(u32) * 8 - kReservedBits);
+  static const uptr kIdBlockSizeLog = 16;
+  static const uptr kIdBlockSize = 1UL << kIdBlockSizeLog;
+  static const uptr kIdBlockCount = kMaxId >> kIdBlockSizeLog;
 
-  atomic_uintptr_t tab[kTabSize];   // Hash table of Node's.
-  atomic_uint32_t seq[kPartCount];  // Unique id generators.
+  // Current Table. Replaced tables are never unmapped: lock-free readers may
+  // still be walking them.
+  atomic_uintptr_t table_;
+  atomic_uint32_t seq_;  // The last handed out id.
+  // Id map: block i holds the nodes with ids [i * kIdBlockSize, ...).
+  atomic_uintptr_t id_map_[kIdBlockCount];
+  // Serializes Grow(), LockAll() and the first table allocation.
+  StaticSpinMutex mtx_;
 
+  atomic_uintptr_t allocated_;
+  atomic_uintptr_t mapped_;
+  atomic_uintptr_t n_collisions_;
+  atomic_uintptr_t max_bucket_size_;
   StackDepotStats stats;
 
   friend class StackDepotReverseMap;
@@ -62,7 +105,7 @@ Node *StackDepotBase<Node, kReservedBits, kTabSizeLog>::find(Node *s,
                                                              args_type args,
                                                              u32 hash) {
   // Searches linked list s for the stack, returns its id.
-  for (; s; s = s->link) {
+  for (int i = 0; s && i < kMaxLockFreeSteps; s = s->link, i++) {
     if (s->eq(hash, args)) {
       return s;
     }
@@ -93,42 +136,144 @@ void StackDepotBase<Node, kReservedBits, kTabSizeLog>::unlock(
   atomic_store(p, (uptr)s, memory_order_release);
 }
 
+template <class Node, int kReservedBits, int kTabSizeLog>
+typename StackDepotBase<Node, kReservedBits, kTabSizeLog>::Table *
+StackDepotBase<Node, kReservedBits, kTabSizeLog>::AllocTable(uptr size_log) {
+  uptr size = sizeof(Table) + ((1UL << size_log) - 1) * sizeof(uptr);
+  Table *t = (Table *)MmapOrDie(size, "StackDepot table");
+  t->size_log = size_log;
+  atomic_fetch_add(&mapped_, size, memory_order_relaxed);
+  return t;
+}
+
+template <class Node, int kReservedBits, int kTabSizeLog>
+typename StackDepotBase<Node, kReservedBits, kTabSizeLog>::Table *
+StackDepotBase<Node, kReservedBits, kTabSizeLog>::GetTable() {
+  Table *t = (Table *)atomic_load(&table_, memory_order_acquire);
+  if (LIKELY(t))
+    return t;
+  SpinMutexLock l(&mtx_);
+  t = (Table *)atomic_load(&table_, memory_order_relaxed);
+  if (!t) {
+    t = AllocTable(kTabSizeLog);
+    atomic_store(&table_, (uptr)t, memory_order_release);
+  }
+  return t;
+}
+
+template <class Node, int kReservedBits, int kTabSizeLog>
+void StackDepotBase<Node, kReservedBits, kTabSizeLog>::Grow(Table *t) {
+  SpinMutexLock l(&mtx_);
+  if ((Table *)atomic_load(&table_, memory_order_relaxed) != t ||
+      t->size_log >= kMaxTabSizeLog)
+    return;
+  uptr size = 1UL << t->size_log;
+  Table *nt = AllocTable(t->size_log + 1);
+  // Wait for the inserters and keep out new ones; Put() rechecks table_ after
+  // locking a bucket.
+  for (uptr i = 0; i < size; i++)
+    lock(&t->tab[i]);
+  for (uptr i = 0; i < size; i++) {
+    Node *s = (Node *)(atomic_load(&t->tab[i], memory_order_relaxed) & ~1UL);
+    while (s) {
+      Node *next = s->link;
+      atomic_uintptr_t *p = bucket(nt, s->stored_hash());
+      s->link = (Node *)atomic_load(p, memory_order_relaxed);
+      atomic_store(p, (uptr)s, memory_order_relaxed);
+      s = next;
+    }
+  }
+  atomic_store(&table_, (uptr)nt, memory_order_release);
+  for (uptr i = 0; i < size; i++) {
+    atomic_uintptr_t *p = &t->tab[i];
+    unlock(p, (Node *)(atomic_load(p, memory_order_relaxed) & ~1UL));
+  }
+}
+
+template <class Node, int kReservedBits, int kTabSizeLog>
+Node *StackDepotBase<Node, kReservedBits, kTabSizeLog>::GetNode(u32 id) {
+  uptr block = atomic_load(&id_map_[id >> kIdBlockSizeLog],
+                           memory_order_acquire);
+  if (!block)
+    return nullptr;
+  atomic_uintptr_t *p =
+      &((atomic_uintptr_t *)block)[id & (kIdBlockSize - 1)];
+  return (Node *)atomic_load(p, memory_order_acquire);
+}
+
+template <class Node, int kReservedBits, int kTabSizeLog>
+void StackDepotBase<Node, kReservedBits, kTabSizeLog>::SetNode(u32 id,
+                                                               Node *s) {
+  atomic_uintptr_t *slot = &id_map_[id >> kIdBlockSizeLog];
+  uptr block = atomic_load(slot, memory_order_acquire);
+  if (!block) {
+    uptr size = kIdBlockSize * sizeof(uptr);
+    uptr fresh = (uptr)MmapOrDie(size, "StackDepot id map");
+    if (atomic_compare_exchange_strong(slot, &block, fresh,
+                                       memory_order_acq_rel)) {
+      atomic_fetch_add(&mapped_, size, memory_order_relaxed);
+      block = fresh;
+    } else {
+      UnmapOrDie((void *)fresh, size);
+    }
+  }
+  atomic_uintptr_t *p =
+      &((atomic_uintptr_t *)block)[id & (kIdBlockSize - 1)];
+  atomic_store(p, (uptr)s, memory_order_release);
+}
+
 template <class Node, int kReservedBits, int kTabSizeLog>
 typename StackDepotBase<Node, kReservedBits, kTabSizeLog>::handle_type
 StackDepotBase<Node, kReservedBits, kTabSizeLog>::Put(args_type args,
                                                       bool *inserted) {
   if (inserted) *inserted = false;
   if (!Node::is_valid(args)) return handle_type();
-  uptr h = Node::hash(args);
-  atomic_uintptr_t *p = &tab[h % kTabSize];
+  u32 h = Node::hash(args);
+  Table *t = GetTable();
+  atomic_uintptr_t *p = bucket(t, h);
   uptr v = atomic_load(p, memory_order_consume);
   Node *s = (Node *)(v & ~1);
   // First, try to find the existing stack.
   Node *node = find(s, args, h);
   if (node) return node->get_handle();
-  // If failed, lock, retry and insert new.
-  Node *s2 = lock(p);
-  if (s2 != s) {
-    node = find(s2, args, h);
-    if (node) {
+  // If failed, lock, retry and insert new. Grow() may have replaced the table
+  // while we were waiting for the lock.
+  Node *s2;
+  for (;;) {
+    s2 = lock(p);
+    Table *t2 = (Table *)atomic_load(&table_, memory_order_acquire);
+    if (t2 == t)
+      break;
+    unlock(p, s2);
+    t = t2;
+    p = bucket(t, h);
+  }
+  uptr bucket_size = 0;
+  for (node = s2; node; node = node->link, bucket_size++) {
+    if (node->eq(h, args)) {
       unlock(p, s2);
       return node->get_handle();
     }
   }
-  uptr part = (h % kTabSize) / kPartSize;
-  u32 id = atomic_fetch_add(&seq[part], 1, memory_order_relaxed) + 1;
-  stats.n_uniq_ids++;
+  u32 id = atomic_fetch_add(&seq_, 1, memory_order_relaxed) + 1;
   CHECK_LT(id, kMaxId);
-  id |= part << kPartShift;
   CHECK_NE(id, 0);
   CHECK_EQ(id & (((u32)-1) >> kReservedBits), id);
   uptr memsz = Node::storage_size(args);
   s = (Node *)PersistentAlloc(memsz);
-  stats.allocated += memsz;
+  atomic_fetch_add(&allocated_, memsz, memory_order_relaxed);
   s->id = id;
   s->store(args, h);
   s->link = s2;
+  SetNode(id, s);
   unlock(p, s);
+  if (bucket_size) {
+    atomic_fetch_add(&n_collisions_, 1, memory_order_relaxed);
+    if (bucket_size + 1 > atomic_load(&max_bucket_size_, memory_order_relaxed))
+      atomic_store(&max_bucket_size_, bucket_size + 1, memory_order_relaxed);
+  }
+  if (id > (kMaxLoad << t->size_log))
+    Grow(t);
   if (inserted) *inserted = true;
   return s->get_handle();
 }
@@ -140,37 +285,42 @@ StackDepotBase<Node, kReservedBits, kTabSizeLog>::Get(u32 id) {
     return args_type();
   }
   CHECK_EQ(id & (((u32)-1) >> kReservedBits), id);
-  // High kPartBits contain part id, so we need to scan at most kPartSize lists.
-  uptr part = id >> kPartShift;
-  for (int i = 0; i != kPartSize; i++) {
-    uptr idx = part * kPartSize + i;
-    CHECK_LT(idx, kTabSize);
-    atomic_uintptr_t *p = &tab[idx];
-    uptr v = atomic_load(p, memory_order_consume);
-    Node *s = (Node *)(v & ~1);
-    for (; s; s = s->link) {
-      if (s->id == id) {
-        return s->load();
-      }
-    }
-  }
-  return args_type();
+  Node *s = GetNode(id);
+  return s ? s->load() : args_type();
+}
+
+template <class Node, int kReservedBits, int kTabSizeLog>
+StackDepotStats *StackDepotBase<Node, kReservedBits, kTabSizeLog>::GetStats() {
+  Table *t = (Table *)atomic_load(&table_, memory_order_acquire);
+  stats.n_uniq_ids = atomic_load(&seq_, memory_order_relaxed);
+  stats.allocated = atomic_load(&allocated_, memory_order_relaxed);
+  stats.mapped = atomic_load(&mapped_, memory_order_relaxed);
+  stats.n_buckets = t ? 1UL << t->size_log : 0;
+  stats.n_collisions = atomic_load(&n_collisions_, memory_order_relaxed);
+  stats.max_bucket_size = atomic_load(&max_bucket_size_, memory_order_relaxed);
+  return &stats;
 }
 
 template <class Node, int kReservedBits, int kTabSizeLog>
 void StackDepotBase<Node, kReservedBits, kTabSizeLog>::LockAll() {
-  for (int i = 0; i < kTabSize; ++i) {
-    lock(&tab[i]);
+  mtx_.Lock();
+  Table *t = (Table *)atomic_load(&table_, memory_order_relaxed);
+  if (!t)
+    return;
+  for (uptr i = 0; i < (1UL << t->size_log); ++i) {
+    lock(&t->tab[i]);
   }
 }
 
 template <class Node, int kReservedBits, int kTabSizeLog>
 void StackDepotBase<Node, kReservedBits, kTabSizeLog>::UnlockAll() {
-  for (int i = 0; i < kTabSize; ++i) {
-    atomic_uintptr_t *p = &tab[i];
+  Table *t = (Table *)atomic_load(&table_, memory_order_relaxed);
+  for (uptr i = 0; t && i < (1UL << t->size_log); ++i) {
+    atomic_uintptr_t *p = &t->tab[i];
     uptr s = atomic_load(p, memory_order_relaxed);
     unlock(p, (Node *)(s & ~1UL));
   }
+  mtx_.Unlock();
 }
 
 } // namespace __sanitizer
@@ -1051,6 +1051,10 @@ u32 GetNumberOfCPUs() {
   return sysinfo.dwNumberOfProcessors;
 }
 
+int GetCurrentCPU() {
+  return GetCurrentProcessorNumber();
+}
+
 }  // namespace __sanitizer
 
 #endif  // _WIN32
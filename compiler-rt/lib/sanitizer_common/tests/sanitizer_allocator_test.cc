@@ -796,6 +796,67 @@ TEST(Allocator, AllocatorCacheDeallocNewThread) {
 
   allocator.TestOnlyUnmap();
 }
+
+typedef CombinedAllocator<Allocator64, AllocatorCache, LargeMmapAllocator<> >
+    PerCPUTestAllocator;
+typedef PerCPUAllocatorCache<AllocatorCache> PerCPUTestCache;
+
+struct PerCPUCacheParams {
+  PerCPUTestAllocator *allocator;
+  PerCPUTestCache *caches;
+};
+
+static void *PerCPUCacheWorker(void *arg) {
+  PerCPUCacheParams *params = reinterpret_cast<PerCPUCacheParams *>(arg);
+  const uptr kNumAllocs = 1000;
+  void *allocated[kNumAllocs];
+  for (int it = 0; it < 10; it++) {
+    for (uptr i = 0; i < kNumAllocs; i++) {
+      PerCPUTestCache::ScopedLock l(params->caches);
+      allocated[i] = params->allocator->Allocate(l.cache(), 1 + i % 2000, 1);
+      CHECK(allocated[i]);
+    }
+    for (uptr i = 0; i < kNumAllocs; i++) {
+      PerCPUTestCache::ScopedLock l(params->caches);
+      params->allocator->Deallocate(l.cache(), allocated[i]);
+    }
+  }
+  return 0;
+}
+
+TEST(SanitizerCommon, PerCPUAllocatorCache) {
+  PerCPUTestAllocator *a = new PerCPUTestAllocator;
+  a->Init(kReleaseToOSIntervalNever);
+  PerCPUTestCache caches;
+  memset(&caches, 0, sizeof(caches));
+  EXPECT_FALSE(caches.enabled());
+  caches.Init(a);
+  EXPECT_TRUE(caches.enabled());
+
+  PerCPUCacheParams params = {a, &caches};
+  const int kNumThreads = 8;
+  pthread_t t[kNumThreads];
+  for (int i = 0; i < kNumThreads; i++)
+    PTHREAD_CREATE(&t[i], 0, PerCPUCacheWorker, &params);
+  for (int i = 0; i < kNumThreads; i++)
+    PTHREAD_JOIN(t[i], 0);
+
+  PerCPUAllocatorCacheStats stats;
+  caches.GetStats(&stats);
+  EXPECT_EQ(Max(1U, GetNumberOfCPUsCached()), stats.n_caches);
+  EXPECT_GT(stats.cached, 0U);
+  EXPECT_GE(stats.mapped, stats.n_caches * sizeof(AllocatorCache));
+  AllocatorStatCounters counters;
+  a->GetStats(counters);
+  EXPECT_EQ(0U, counters[AllocatorStatAllocated]);
+
+  caches.Drain(a);
+  caches.GetStats(&stats);
+  EXPECT_EQ(0U, stats.cached);
+
+  a->TestOnlyUnmap();
+  delete a;
+}
 #endif
 
 TEST(Allocator, Basic) {
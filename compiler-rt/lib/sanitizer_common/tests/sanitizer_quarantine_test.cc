@@ -177,4 +177,52 @@ TEST(SanitizerCommon, QuarantineCacheMergeBatchesALotOfBatches) {
   DeallocateCache(&to_deallocate);
 }
 
+struct CountingCallback {
+  void Recycle(void *m) { recycled++; }
+  void *Allocate(uptr size) { return malloc(size); }
+  void Deallocate(void *p) { free(p); }
+  static uptr recycled;
+};
+uptr CountingCallback::recycled;
+
+struct BatchCountingCallback : CountingCallback {
+  void RecycleBatch(void **ptrs, uptr count) {
+    batches++;
+    batch_recycled += count;
+  }
+  static uptr batches, batch_recycled;
+};
+uptr BatchCountingCallback::batches, BatchCountingCallback::batch_recycled;
+
+static Quarantine<CountingCallback, void> counting_quarantine(
+    LINKER_INITIALIZED);
+static Quarantine<BatchCountingCallback, void> batch_counting_quarantine(
+    LINKER_INITIALIZED);
+
+template <typename QuarantineT, typename Callback>
+static void PutAndRecycleAll(QuarantineT *q, Callback cb, uptr n) {
+  typename QuarantineT::Cache cache;
+  q->Init(1 << 20, 1 << 20);
+  for (uptr i = 0; i < n; i++)
+    q->Put(&cache, cb, kFakePtr, kBlockSize);
+  q->DrainAndRecycle(&cache, cb);
+}
+
+TEST(SanitizerCommon, QuarantineRecycle) {
+  const uptr kNumBlocks = QuarantineBatch::kSize * 2 + 1;
+  PutAndRecycleAll(&counting_quarantine, CountingCallback(), kNumBlocks);
+  ASSERT_EQ(kNumBlocks, CountingCallback::recycled);
+}
+
+TEST(SanitizerCommon, QuarantineRecycleBatch) {
+  const uptr kNumBlocks = QuarantineBatch::kSize * 2 + 1;
+  const uptr recycled_before = CountingCallback::recycled;
+  PutAndRecycleAll(&batch_counting_quarantine, BatchCountingCallback(),
+                   kNumBlocks);
+  // Recycle is not used when the callback can recycle a batch at once.
+  ASSERT_EQ(recycled_before, CountingCallback::recycled);
+  ASSERT_EQ(3UL, BatchCountingCallback::batches);
+  ASSERT_EQ(kNumBlocks, BatchCountingCallback::batch_recycled);
+}
+
 }  // namespace __sanitizer
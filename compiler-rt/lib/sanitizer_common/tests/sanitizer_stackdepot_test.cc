@@ -11,6 +11,7 @@
 //
 //===----------------------------------------------------------------------===//
 #include "sanitizer_common/sanitizer_stackdepot.h"
+#include "sanitizer_common/sanitizer_flags.h"
 #include "sanitizer_common/sanitizer_internal_defs.h"
 #include "sanitizer_common/sanitizer_libc.h"
 #include "gtest/gtest.h"
@@ -90,4 +91,53 @@ TEST(SanitizerCommon, StackDepotReverseMap) {
   }
 }
 
+TEST(SanitizerCommon, StackDepotMany) {
+  // Enough distinct stacks to make the hash table grow a couple of times.
+  const uptr kNumStacks = 1 << 19;
+  const uptr kFrames = 4;
+  uptr array[kFrames];
+  InternalMmapVector<u32> ids(kNumStacks);
+  uptr buckets_before = StackDepotGetStats()->n_buckets;
+  for (uptr i = 0; i < kNumStacks; i++) {
+    for (uptr j = 0; j < kFrames; j++) array[j] = 0x400000 + i * 16 + j;
+    ids[i] = StackDepotPut(StackTrace(array, kFrames));
+    ASSERT_NE(0U, ids[i]);
+  }
+  EXPECT_GT(StackDepotGetStats()->n_buckets, buckets_before);
+  EXPECT_GE(StackDepotGetStats()->n_uniq_ids, kNumStacks);
+  for (uptr i = 0; i < kNumStacks; i++) {
+    for (uptr j = 0; j < kFrames; j++) array[j] = 0x400000 + i * 16 + j;
+    ASSERT_EQ(ids[i], StackDepotPut(StackTrace(array, kFrames)));
+    StackTrace stack = StackDepotGet(ids[i]);
+    ASSERT_EQ(kFrames, stack.size);
+    ASSERT_EQ(0, internal_memcmp(stack.trace, array, sizeof(array)));
+  }
+}
+
+TEST(SanitizerCommon, StackDepotCompressed) {
+  CommonFlags flags;
+  flags.CopyFrom(*common_flags());
+  flags.compress_stack_depot = true;
+  OverrideCommonFlags(flags);
+  uptr array[] = {0x10401000, 0x10400f00, 0x10402345, 1, 0, 0x10401000};
+  StackTrace s1(array, ARRAY_SIZE(array));
+  uptr allocated_before = StackDepotGetStats()->allocated;
+  u32 i1 = StackDepotPut(s1);
+  uptr packed = StackDepotGetStats()->allocated - allocated_before;
+  EXPECT_EQ(i1, StackDepotPut(s1));
+  flags.compress_stack_depot = false;
+  OverrideCommonFlags(flags);
+  uptr array2[] = {0x10401000, 0x10400f00, 0x10402345, 1, 0, 0x10401001};
+  allocated_before = StackDepotGetStats()->allocated;
+  StackDepotPut(StackTrace(array2, ARRAY_SIZE(array2)));
+  uptr unpacked = StackDepotGetStats()->allocated - allocated_before;
+  EXPECT_LT(packed, unpacked);
+  // Lookups of a packed stack work regardless of the current flag value.
+  EXPECT_EQ(i1, StackDepotPut(s1));
+  StackTrace stack = StackDepotGet(i1);
+  EXPECT_EQ(ARRAY_SIZE(array), stack.size);
+  EXPECT_EQ(0, internal_memcmp(stack.trace, array, sizeof(array)));
+  EXPECT_EQ(stack.trace, StackDepotGet(i1).trace);
+}
+
 }  // namespace __sanitizer
@@ -0,0 +1,72 @@
+// Mini-benchmark for the Scudo allocation fast path.
+// Every thread repeatedly allocates a few chunks of small, varying sizes and
+// frees them, which exercises the header checksum, the caches and the
+// quarantine (when enabled).
+//
+// Build it twice, with and without -fsanitize=scudo, to compare against the
+// system allocator. The runtime options can be varied with SCUDO_OPTIONS, e.g.
+//   SCUDO_OPTIONS=allocator_per_cpu_cache=1
+//   SCUDO_OPTIONS=QuarantineSizeKb=256:ThreadLocalQuarantineSizeKb=64
+//
+// Usage: malloc_bench n_threads n_iterations
+
+#include <assert.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static const int kChunks = 16;
+
+int n_threads, n_iterations;
+
+void *Thread(void *arg) {
+  unsigned seed = (unsigned)(long)arg;
+  void *chunks[kChunks];
+  for (int i = 0; i < n_iterations; i++) {
+    for (int j = 0; j < kChunks; j++) {
+      seed = seed * 1103515245 + 12345;
+      chunks[j] = malloc(16 + (seed >> 16) % 512);
+      assert(chunks[j]);
+    }
+    for (int j = 0; j < kChunks; j++)
+      free(chunks[j]);
+  }
+  return 0;
+}
+
+static double Now() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int main(int argc, char **argv) {
+  if (argc == 1) {
+    n_threads = 4;
+    n_iterations = 100000;
+  } else if (argc == 3) {
+    n_threads = atoi(argv[1]);
+    assert(n_threads > 0);
+    n_iterations = atoi(argv[2]);
+  } else {
+    printf("Usage: %s n_threads n_iterations\n", argv[0]);
+    return 1;
+  }
+  printf("%s: n_threads=%d n_iterations=%d\n", __FILE__, n_threads,
+         n_iterations);
+
+  double start = Now();
+  pthread_t *t = new pthread_t[n_threads];
+  for (int i = 0; i < n_threads; i++) {
+    int status = pthread_create(&t[i], 0, Thread, (void*)(long)i);
+    assert(status == 0);
+  }
+  for (int i = 0; i < n_threads; i++)
+    pthread_join(t[i], 0);
+  double elapsed = Now() - start;
+  delete [] t;
+  double ops = 2.0 * kChunks * n_iterations * n_threads;
+  printf("%.3f s, %.1f ns per malloc or free\n", elapsed, elapsed * 1e9 / ops);
+  return 0;
+}
@@ -49,12 +49,10 @@ INLINE u32 computeCRC32(u32 Crc, uptr Value, uptr *Array, uptr ArraySize) {
     Crc = CRC32_INTRINSIC(Crc, Array[i]);
   return Crc;
 #else
-  if (atomic_load_relaxed(&HashAlgorithm) == CRC32Hardware) {
-    Crc = computeHardwareCRC32(Crc, Value);
-    for (uptr i = 0; i < ArraySize; i++)
-      Crc = computeHardwareCRC32(Crc, Array[i]);
-    return Crc;
-  }
+  // The hardware version lives in scudo_crc32.cpp, so make a single call
+  // there for the whole header rather than one per word.
+  if (atomic_load_relaxed(&HashAlgorithm) == CRC32Hardware)
+    return computeHardwareCRC32Block(Crc, Value, Array, ArraySize);
   Crc = computeSoftwareCRC32(Crc, Value);
   for (uptr i = 0; i < ArraySize; i++)
     Crc = computeSoftwareCRC32(Crc, Array[i]);
@@ -188,6 +186,39 @@ struct QuarantineCallback {
       getBackend().deallocateSecondary(BackendPtr);
   }
 
+  // Batched version of Recycle, used by the quarantine. The headers of all the
+  // chunks are checked and released first, which are independent operations
+  // that can overlap, then the chunks are handed back to the backend in a row.
+  // The batch is reused to hold the backend pointers.
+  void RecycleBatch(void **Ptrs, uptr Count) {
+    DCHECK_LE(Count, QuarantineBatch::kSize);
+    u8 ClassIds[QuarantineBatch::kSize];
+    const uptr kPrefetch = 8;
+    for (uptr I = 0; I < Min(kPrefetch, Count); I++)
+      PREFETCH(Chunk::getConstAtomicHeader(Ptrs[I]));
+    for (uptr I = 0; I < Count; I++) {
+      if (I + kPrefetch < Count)
+        PREFETCH(Chunk::getConstAtomicHeader(Ptrs[I + kPrefetch]));
+      void *Ptr = Ptrs[I];
+      UnpackedHeader Header;
+      Chunk::loadHeader(Ptr, &Header);
+      if (UNLIKELY(Header.State != ChunkQuarantine))
+        dieWithMessage("invalid chunk state when recycling address %p\n",
+                       Ptr);
+      UnpackedHeader NewHeader = Header;
+      NewHeader.State = ChunkAvailable;
+      Chunk::compareExchangeHeader(Ptr, &NewHeader, &Header);
+      Ptrs[I] = Chunk::getBackendPtr(Ptr, &Header);
+      ClassIds[I] = Header.ClassId;
+    }
+    for (uptr I = 0; I < Count; I++) {
+      if (ClassIds[I])
+        getBackend().deallocatePrimary(Cache_, Ptrs[I], ClassIds[I]);
+      else
+        getBackend().deallocateSecondary(Ptrs[I]);
+    }
+  }
+
   // Internal quarantine allocation and deallocation functions. We first check
   // that the batches are indeed serviced by the Primary.
   // TODO(kostyak): figure out the best way to protect the batches.
@@ -249,7 +280,7 @@ struct Allocator {
 
     // Check if hardware CRC32 is supported in the binary and by the platform,
     // if so, opt for the CRC32 hardware version of the checksum.
-    if (&computeHardwareCRC32 && hasHardwareCRC32())
+    if (&computeHardwareCRC32Block && hasHardwareCRC32())
       atomic_store_relaxed(&HashAlgorithm, CRC32Hardware);
 
     SetAllocatorMayReturnNull(common_flags()->allocator_may_return_null);
@@ -95,6 +95,10 @@ INLINE u32 computeSoftwareCRC32(u32 Crc, uptr Data) {
 }
 
 SANITIZER_WEAK_ATTRIBUTE u32 computeHardwareCRC32(u32 Crc, uptr Data);
+// Checksums Value then the elements of Array, in a single call.
+SANITIZER_WEAK_ATTRIBUTE u32 computeHardwareCRC32Block(u32 Crc, uptr Value,
+                                                       const uptr *Array,
+                                                       uptr ArraySize);
 
 }  // namespace __scudo
 
@@ -13,6 +13,8 @@
 
 #include "scudo_tsd.h"
 
+#include "sanitizer_common/sanitizer_flags.h"
+
 #if SCUDO_TSD_EXCLUSIVE
 
 namespace __scudo {
@@ -29,6 +31,13 @@ THREADLOCAL ScudoTSD TSD;
 // can be shared between multiple threads and as such must be locked.
 ScudoTSD FallbackTSD;
 
+// With the allocator_per_cpu_cache common flag, threads do not get their own
+// TSD but share one per CPU. This bounds the memory held in the caches and the
+// thread local quarantines by the number of CPUs rather than of threads, at
+// the cost of locking the TSD.
+static ScudoTSD *PerCPUTSDs;
+static u32 NumberOfPerCPUTSDs;
+
 static void teardownThread(void *Ptr) {
   uptr I = reinterpret_cast<uptr>(Ptr);
   // The glibc POSIX thread-local-storage deallocation routine calls user
@@ -51,18 +60,52 @@ static void initOnce() {
   CHECK_EQ(pthread_key_create(&PThreadKey, teardownThread), 0);
   initScudo();
   FallbackTSD.init();
+  if (common_flags()->allocator_per_cpu_cache) {
+    NumberOfPerCPUTSDs = Max(1U, GetNumberOfCPUsCached());
+    ScudoTSD *TSDs = reinterpret_cast<ScudoTSD *>(
+        MmapOrDie(sizeof(ScudoTSD) * NumberOfPerCPUTSDs, "ScudoPerCPUTSDs"));
+    for (u32 I = 0; I < NumberOfPerCPUTSDs; I++)
+      TSDs[I].init();
+    PerCPUTSDs = TSDs;
+  }
 }
 
 void initThread(bool MinimalInit) {
   CHECK_EQ(pthread_once(&GlobalInitialized, initOnce), 0);
   if (UNLIKELY(MinimalInit))
     return;
+  // There is nothing to tear down for a thread using the per-CPU TSDs.
+  if (PerCPUTSDs) {
+    ScudoThreadState = ThreadPerCPU;
+    return;
+  }
   CHECK_EQ(pthread_setspecific(PThreadKey, reinterpret_cast<void *>(
       GetPthreadDestructorIterations())), 0);
   TSD.init();
   ScudoThreadState = ThreadInitialized;
 }
 
+ScudoTSD *getTSDAndLockSlow(bool *UnlockRequired) {
+  *UnlockRequired = true;
+  if (ScudoThreadState == ThreadPerCPU) {
+    const int CPU = GetCurrentCPU();
+    // Without a CPU number, spread the threads by their stacks.
+    const u32 Start = static_cast<u32>(
+        (CPU >= 0 ? static_cast<uptr>(CPU) : GET_CURRENT_FRAME() >> 16) %
+        NumberOfPerCPUTSDs);
+    // Rather than waiting for a preempted thread, try a few neighbours.
+    for (u32 I = 0; I < Min(4U, NumberOfPerCPUTSDs); I++) {
+      ScudoTSD *TSD = &PerCPUTSDs[(Start + I) % NumberOfPerCPUTSDs];
+      if (TSD->tryLock())
+        return TSD;
+    }
+    PerCPUTSDs[Start].lock();
+    return &PerCPUTSDs[Start];
+  }
+  FallbackTSD.lock();
+  return &FallbackTSD;
+}
+
 }  // namespace __scudo
 
 #endif  // SCUDO_TSD_EXCLUSIVE
@@ -13,6 +13,8 @@
 
 #include "scudo_tsd.h"
 
+#include "sanitizer_common/sanitizer_flags.h"
+
 #if !SCUDO_TSD_EXCLUSIVE
 
 namespace __scudo {
@@ -25,6 +27,9 @@ static ScudoTSD *TSDs;
 static u32 NumberOfTSDs;
 static u32 CoPrimes[SCUDO_SHARED_TSD_POOL_SIZE];
 static u32 NumberOfCoPrimes = 0;
+// Whether threads should prefer the TSD matching the CPU they run on, as set
+// by the allocator_per_cpu_cache common flag.
+static bool PreferCurrentCPU;
 
 #if SANITIZER_LINUX && !SANITIZER_ANDROID
 __attribute__((tls_model("initial-exec")))
@@ -34,6 +39,7 @@ THREADLOCAL ScudoTSD *CurrentTSD;
 static void initOnce() {
   CHECK_EQ(pthread_key_create(&PThreadKey, NULL), 0);
   initScudo();
+  PreferCurrentCPU = common_flags()->allocator_per_cpu_cache;
   NumberOfTSDs = Min(Max(1U, GetNumberOfCPUsCached()),
                      static_cast<u32>(SCUDO_SHARED_TSD_POOL_SIZE));
   TSDs = reinterpret_cast<ScudoTSD *>(
@@ -58,8 +64,19 @@ ALWAYS_INLINE void setCurrentTSD(ScudoTSD *TSD) {
 #endif  // SANITIZER_ANDROID
 }
 
+static ScudoTSD *getCurrentCPUTSD() {
+  const int CPU = PreferCurrentCPU ? GetCurrentCPU() : -1;
+  if (CPU < 0)
+    return nullptr;
+  return &TSDs[static_cast<u32>(CPU) % NumberOfTSDs];
+}
+
 void initThread(bool MinimalInit) {
   pthread_once(&GlobalInitialized, initOnce);
+  if (ScudoTSD *TSD = getCurrentCPUTSD()) {
+    setCurrentTSD(TSD);
+    return;
+  }
   // Initial context assignment is done in a plain round-robin fashion.
   u32 Index = atomic_fetch_add(&CurrentIndex, 1, memory_order_relaxed);
   setCurrentTSD(&TSDs[Index % NumberOfTSDs]);
@@ -67,6 +84,13 @@ void initThread(bool MinimalInit) {
 
 ScudoTSD *getTSDAndLockSlow(ScudoTSD *TSD) {
   if (NumberOfTSDs > 1) {
+    // The thread may have migrated since it last picked a TSD: try the one of
+    // the CPU it runs on now before looking around.
+    ScudoTSD *CPUTSD = getCurrentCPUTSD();
+    if (CPUTSD && CPUTSD != TSD && CPUTSD->tryLock()) {
+      setCurrentTSD(CPUTSD);
+      return CPUTSD;
+    }
     // Use the Precedence of the current TSD as our random seed. Since we are in
     // the slow path, it means that tryLock failed, and as a result it's very
     // likely that said Precedence is non-zero.
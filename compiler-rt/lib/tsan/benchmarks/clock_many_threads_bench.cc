@@ -0,0 +1,88 @@
+// Mini-benchmark for tsan vector clock operations with many live threads.
+// Idea:
+// 1) Spawn N threads and wait until all of them are running, so that
+//    vector clocks have N elements.
+// 2) Thread i repeatedly locks a mutex shared only with its neighbour
+//    (i + 1), and every 'global_period' iterations a mutex shared by all
+//    threads.
+//
+// With dense vector clocks every release of the neighbour mutex is O(N) once
+// the global mutex has been acquired. Only the elements of the threads that
+// synchronized via the global mutex since the last release actually change,
+// so the cost of a release should depend on global_period rather than on N.
+//
+// Usage: clock_many_threads_bench n_threads n_iterations global_period
+// Try e.g. n_threads=1000 with global_period=1, 100 and 1000000.
+
+#include <assert.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+class __attribute__((aligned(64))) Mutex {
+ public:
+  Mutex()  { pthread_mutex_init(&m_, NULL); }
+  ~Mutex() { pthread_mutex_destroy(&m_); }
+  void Lock() { pthread_mutex_lock(&m_); }
+  void Unlock() { pthread_mutex_unlock(&m_); }
+
+ private:
+  pthread_mutex_t m_;
+};
+
+int n_threads, n_iterations, global_period;
+Mutex *mutexes;
+Mutex global_mutex;
+long global_counter;
+pthread_barrier_t all_threads_ready;
+
+void *Thread(void *arg) {
+  long idx = (long)arg;
+  Mutex *mine = &mutexes[idx];
+  Mutex *neighbour = &mutexes[(idx + 1) % n_threads];
+  pthread_barrier_wait(&all_threads_ready);
+  for (int i = 0; i < n_iterations; i++) {
+    Mutex *m = (i & 1) ? mine : neighbour;
+    m->Lock();
+    m->Unlock();
+    if (i % global_period == 0) {
+      global_mutex.Lock();
+      global_counter++;
+      global_mutex.Unlock();
+    }
+  }
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  if (argc == 1) {
+    n_threads = 500;
+    n_iterations = 20000;
+    global_period = 100;
+  } else if (argc == 4) {
+    n_threads = atoi(argv[1]);
+    assert(n_threads > 1 && n_threads <= 8000);
+    n_iterations = atoi(argv[2]);
+    global_period = atoi(argv[3]);
+    assert(global_period > 0);
+  } else {
+    printf("Usage: %s n_threads n_iterations global_period\n", argv[0]);
+    return 1;
+  }
+  printf("%s: n_threads=%d n_iterations=%d global_period=%d\n",
+         __FILE__, n_threads, n_iterations, global_period);
+
+  mutexes = new Mutex[n_threads];
+  pthread_barrier_init(&all_threads_ready, NULL, n_threads);
+  pthread_t *t = new pthread_t[n_threads];
+  for (int i = 0; i < n_threads; i++) {
+    int status = pthread_create(&t[i], 0, Thread, (void*)(long)i);
+    assert(status == 0);
+  }
+  for (int i = 0; i < n_threads; i++)
+    pthread_join(t[i], 0);
+  printf("global_counter=%ld\n", global_counter);
+  delete [] t;
+  delete [] mutexes;
+  return 0;
+}
@@ -56,6 +56,22 @@
 // read-only phase, these reads will be O(1); if it later switches to read/write
 // phase, the implementation will correctly handle that by switching to O(N).
 //
+// Releases that cannot use any of the above are still proportional to the
+// part of the clock that changed rather than to the number of threads.
+// When a thread releases to a SyncClock at time E, the SyncClock receives
+// everything the thread knows at E, and it keeps knowing it afterwards (other
+// threads only increase it, and a release-store by another thread stores a
+// clock that itself includes everything the releasing thread knew at E).
+// So on the next release the thread only needs to merge the elements that
+// increased after E. ThreadClock remembers, for every block of
+// ClockBlock::kClockCount elements, the own time of the last increase;
+// blocks that did not change since E are skipped. If nothing besides the
+// own element increases, the release is done as a dirty update and the
+// 'acquired' flags of other threads are preserved. This is what makes mutexes
+// shared by many threads cheap: a thread that acquires a mutex picks up the
+// times of the threads that released it before, and these are already in the
+// mutex when the thread releases it.
+//
 // Thread-safety note: all const operations on SyncClock's are conducted under
 // a shared lock; all non-const operations on SyncClock's are conducted under
 // an exclusive lock; ThreadClock's are private to respective threads and so
@@ -116,6 +132,7 @@ ThreadClock::ThreadClock(unsigned tid, unsigned reused)
   nclk_ = tid_ + 1;
   last_acquire_ = 0;
   internal_memset(clk_, 0, sizeof(clk_));
+  internal_memset(changed_, 0, sizeof(changed_));
 }
 
 void ThreadClock::ResetCached(ClockCache *c) {
@@ -146,6 +163,10 @@ void ThreadClock::acquire(ClockCache *c, SyncClock *src) {
     if (tid != kInvalidTid) {
       if (clk_[tid] < dirty.epoch) {
         clk_[tid] = dirty.epoch;
+        MarkChanged(tid);
+        // The dirty element can be beyond what we acquired before
+        // if only its owner released to src since then.
+        nclk_ = max(nclk_, (uptr)tid + 1);
         acquired = true;
       }
     }
@@ -161,6 +182,7 @@ void ThreadClock::acquire(ClockCache *c, SyncClock *src) {
       u64 epoch = src_elem.epoch;
       if (*dst_pos < epoch) {
         *dst_pos = epoch;
+        MarkChanged(dst_pos - &clk_[0]);
         acquired = true;
       }
       dst_pos++;
@@ -205,26 +227,21 @@ void ThreadClock::release(ClockCache *c, SyncClock *dst) {
     return;
   }
 
-  // O(N) release.
-  CPP_STAT_INC(StatClockReleaseFull);
-  dst->Unshare(c);
   // First, remember whether we've acquired dst.
   bool acquired = IsAlreadyAcquired(dst);
+  // Merge the elements that changed since the last release to dst.
+  if (!ReleaseChanged(c, dst)) {
+    // Nothing new for dst except for our own time.
+    CPP_STAT_INC(StatClockReleaseSparse);
+    UpdateCurrentThread(c, dst);
+    if (dst->release_store_tid_ != tid_ ||
+        dst->release_store_reused_ != reused_)
+      dst->release_store_tid_ = kInvalidTid;
+    return;
+  }
+  CPP_STAT_INC(StatClockReleaseFull);
   if (acquired)
     CPP_STAT_INC(StatClockReleaseAcquired);
-  // Update dst->clk_.
-  dst->FlushDirty();
-  uptr i = 0;
-  for (ClockElem &ce : *dst) {
-    ce.epoch = max(ce.epoch, clk_[i]);
-    ce.reused = 0;
-    i++;
-  }
-  // Clear 'acquired' flag in the remaining elements.
-  if (nclk_ < dst->size_)
-    CPP_STAT_INC(StatClockReleaseClearTail);
-  for (uptr i = nclk_; i < dst->size_; i++)
-    dst->elem(i).reused = 0;
   dst->release_store_tid_ = kInvalidTid;
   dst->release_store_reused_ = 0;
   // If we've acquired dst, remember this fact,
@@ -269,28 +286,37 @@ void ThreadClock::ReleaseStore(ClockCache *c, SyncClock *dst) {
     dst->Resize(c, nclk_);
 
   if (dst->release_store_tid_ == tid_ &&
-      dst->release_store_reused_ == reused_ &&
-      dst->elem(tid_).epoch > last_acquire_) {
-    CPP_STAT_INC(StatClockStoreFast);
-    UpdateCurrentThread(c, dst);
-    return;
-  }
-
-  // O(N) release-store.
-  CPP_STAT_INC(StatClockStoreFull);
-  dst->Unshare(c);
-  // Note: dst can be larger than this ThreadClock.
-  // This is fine since clk_ beyond size is all zeros.
-  uptr i = 0;
-  for (ClockElem &ce : *dst) {
-    ce.epoch = clk_[i];
-    ce.reused = 0;
-    i++;
+      dst->release_store_reused_ == reused_) {
+    if (dst->elem(tid_).epoch > last_acquire_) {
+      CPP_STAT_INC(StatClockStoreFast);
+      UpdateCurrentThread(c, dst);
+      return;
+    }
+    // dst still holds what we stored into it at the last release-store,
+    // so storing only the elements that changed since then is enough.
+    if (!ReleaseChanged(c, dst)) {
+      CPP_STAT_INC(StatClockStoreSparse);
+      UpdateCurrentThread(c, dst);
+      return;
+    }
+    CPP_STAT_INC(StatClockStoreChanged);
+  } else {
+    // O(N) release-store.
+    CPP_STAT_INC(StatClockStoreFull);
+    dst->Unshare(c);
+    // Note: dst can be larger than this ThreadClock.
+    // This is fine since clk_ beyond size is all zeros.
+    uptr i = 0;
+    for (ClockElem &ce : *dst) {
+      ce.epoch = clk_[i];
+      ce.reused = 0;
+      i++;
+    }
+    for (uptr i = 0; i < kDirtyTids; i++)
+      dst->dirty_[i].tid = kInvalidTid;
+    dst->release_store_tid_ = tid_;
+    dst->release_store_reused_ = reused_;
   }
-  for (uptr i = 0; i < kDirtyTids; i++)
-    dst->dirty_[i].tid = kInvalidTid;
-  dst->release_store_tid_ = tid_;
-  dst->release_store_reused_ = reused_;
   // Rememeber that we don't need to acquire it in future.
   dst->elem(tid_).reused = reused_;
 
@@ -338,6 +364,60 @@ void ThreadClock::UpdateCurrentThread(ClockCache *c, SyncClock *dst) const {
   dst->FlushDirty();
 }
 
+// Merges into dst the blocks of the clock that changed since the current
+// thread last released to dst (see the comment at the top of the file).
+// Returns false, leaving dst intact (and possibly shared), if dst already has
+// everything except possibly the current thread's own time. Otherwise flushes
+// dirty entries, updates dst, including the own element, and clears all
+// 'acquired' flags.
+bool ThreadClock::ReleaseChanged(ClockCache *c, SyncClock *dst) const {
+  const uptr kClockCount = ClockBlock::kClockCount;
+  // Our time at the last release to dst. A value from the future means that
+  // it was not us who put it there (e.g. a previous thread with the same tid
+  // in tests), so nothing can be skipped.
+  u64 last = dst->get(tid_);
+  if (last > clk_[tid_])
+    last = 0;
+  const uptr size = min(nclk_, (uptr)dst->size_);
+  const uptr blocks = (size + kClockCount - 1) / kClockCount;
+  bool grows = false;
+  for (uptr bi = 0; bi < blocks && !grows; bi++) {
+    if (changed_[bi] < last)
+      continue;
+    ClockElem *ce = dst->block_clock(bi);
+    const uptr base = bi * kClockCount;
+    const uptr n = min(size - base, kClockCount);
+    for (uptr i = 0; i < n; i++) {
+      // The table can be behind dirty entries (e.g. of the previous owner
+      // of a mutex), so check them before concluding that dst grows.
+      if (ce[i].epoch < clk_[base + i] && base + i != tid_ &&
+          dst->get(base + i) < clk_[base + i]) {
+        grows = true;
+        break;
+      }
+    }
+  }
+  if (!grows)
+    return false;
+  dst->Unshare(c);
+  dst->FlushDirty();
+  for (uptr bi = 0; bi < blocks; bi++) {
+    if (changed_[bi] < last)
+      continue;
+    ClockElem *ce = dst->block_clock(bi);
+    const uptr base = bi * kClockCount;
+    const uptr n = min(size - base, kClockCount);
+    for (uptr i = 0; i < n; i++)
+      ce[i].epoch = max(ce[i].epoch, clk_[base + i]);
+  }
+  ClockElem &own = dst->elem(tid_);
+  own.epoch = max(own.epoch, clk_[tid_]);
+  // Clear 'acquired' flags, everybody needs to acquire the new elements.
+  for (ClockElem &ce : *dst)
+    ce.reused = 0;
+  return true;
+}
+
 // Checks whether the current thread has already acquired src.
 bool ThreadClock::IsAlreadyAcquired(const SyncClock *src) const {
   if (src->elem(tid_).reused != reused_)
@@ -358,6 +438,7 @@ void ThreadClock::set(ClockCache *c, unsigned tid, u64 v) {
   DCHECK_LT(tid, kMaxTid);
   DCHECK_GE(v, clk_[tid]);
   clk_[tid] = v;
+  MarkChanged(tid);
   if (nclk_ <= tid)
     nclk_ = tid + 1;
   last_acquire_ = clk_[tid_];
@@ -523,6 +604,14 @@ ALWAYS_INLINE ClockElem &SyncClock::elem(unsigned tid) const {
   return cb->clock[tid];
 }
 
+// Returns the elements [bi * kClockCount, (bi + 1) * kClockCount).
+ALWAYS_INLINE ClockElem *SyncClock::block_clock(uptr bi) const {
+  DCHECK_LE(bi, blocks_);
+  if (bi == blocks_)
+    return &tab_->clock[0];
+  return &ctx->clock_alloc.Map(get_block(bi))->clock[0];
+}
+
 ALWAYS_INLINE uptr SyncClock::capacity() const {
   if (size_ == 0)
     return 0;
@@ -545,7 +634,6 @@ ALWAYS_INLINE void SyncClock::append_block(u32 idx) {
   tab_->table[ClockBlock::kBlockIdx - bi] = idx;
 }
 
-// Used only by tests.
 u64 SyncClock::get(unsigned tid) const {
   for (unsigned i = 0; i < kDirtyTids; i++) {
     Dirty dirty = dirty_[i];
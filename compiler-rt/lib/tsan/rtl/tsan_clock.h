@@ -29,8 +29,9 @@ class SyncClock {
 
   uptr size() const;
 
-  // These are used only in tests.
+  // Returns the element for tid, taking dirty entries into account.
   u64 get(unsigned tid) const;
+  // This is used only in tests.
   u64 get_clean(unsigned tid) const;
 
   void Resize(ClockCache *c, uptr nclk);
@@ -119,6 +120,7 @@ class SyncClock {
   u32 get_block(uptr bi) const;
   void append_block(u32 idx);
   ClockElem &elem(unsigned tid) const;
+  ClockElem *block_clock(uptr bi) const;
 };
 
 // The clock that lives in threads.
@@ -163,9 +165,18 @@ class ThreadClock {
   // Number of active elements in the clk_ table (the rest is zeros).
   uptr nclk_;
   u64 clk_[kMaxTidInClock];  // Fixed size vector clock.
+  // For every ClockBlock::kClockCount elements of clk_, the current thread
+  // time when any of them was last increased. Allows release operations to
+  // skip the parts of the clock that did not change since the previous
+  // release to the same SyncClock.
+  static const uptr kChangedBlocks =
+      (kMaxTidInClock + ClockBlock::kClockCount - 1) / ClockBlock::kClockCount;
+  u64 changed_[kChangedBlocks];
 
   bool IsAlreadyAcquired(const SyncClock *src) const;
   void UpdateCurrentThread(ClockCache *c, SyncClock *dst) const;
+  bool ReleaseChanged(ClockCache *c, SyncClock *dst) const;
+  void MarkChanged(uptr tid);
 };
 
 ALWAYS_INLINE u64 ThreadClock::get(unsigned tid) const {
@@ -178,6 +189,10 @@ ALWAYS_INLINE void ThreadClock::set(u64 v) {
   clk_[tid_] = v;
 }
 
+ALWAYS_INLINE void ThreadClock::MarkChanged(uptr tid) {
+  changed_[tid / ClockBlock::kClockCount] = clk_[tid_];
+}
+
 ALWAYS_INLINE void ThreadClock::tick() {
   clk_[tid_]++;
 }
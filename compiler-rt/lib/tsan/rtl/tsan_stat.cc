@@ -81,12 +81,15 @@ void StatOutput(u64 *stat) {
   name[StatClockReleaseResize]           = "  resize                          ";
   name[StatClockReleaseFast]             = "  fast                            ";
   name[StatClockReleaseSlow]             = "  dirty overflow (slow)           ";
+  name[StatClockReleaseSparse]           = "  nothing new (sparse)            ";
   name[StatClockReleaseFull]             = "  full (slow)                     ";
   name[StatClockReleaseAcquired]         = "  was acquired                    ";
   name[StatClockReleaseClearTail]        = "  clear tail                      ";
   name[StatClockStore]                   = "Clock release store               ";
   name[StatClockStoreResize]             = "  resize                          ";
   name[StatClockStoreFast]               = "  fast                            ";
+  name[StatClockStoreSparse]             = "  nothing new (sparse)            ";
+  name[StatClockStoreChanged]            = "  changed blocks only             ";
   name[StatClockStoreFull]               = "  slow                            ";
   name[StatClockStoreTail]               = "  clear tail                      ";
   name[StatClockAcquireRelease]          = "Clock acquire-release             ";
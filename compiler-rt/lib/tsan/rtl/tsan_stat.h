@@ -81,6 +81,7 @@ enum StatType {
   StatClockReleaseResize,
   StatClockReleaseFast,
   StatClockReleaseSlow,
+  StatClockReleaseSparse,
   StatClockReleaseFull,
   StatClockReleaseAcquired,
   StatClockReleaseClearTail,
@@ -88,6 +89,8 @@ enum StatType {
   StatClockStore,
   StatClockStoreResize,
   StatClockStoreFast,
+  StatClockStoreSparse,
+  StatClockStoreChanged,
   StatClockStoreFull,
   StatClockStoreTail,
   // Clocks - acquire-release.
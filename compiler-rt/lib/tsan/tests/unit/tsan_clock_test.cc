@@ -135,6 +135,35 @@ TEST(Clock, ManyThreads) {
   chunked.Reset(&cache);
 }
 
+TEST(Clock, ManyThreadsMutex) {
+  // Threads in different ClockBlock's take turns on the same mutex.
+  const unsigned kCount = 200;
+  ThreadClock *thr[kCount];
+  for (unsigned i = 0; i < kCount; i++)
+    thr[i] = new ThreadClock(i);
+  SyncClock mtx;
+  for (unsigned iter = 0; iter < 3; iter++) {
+    for (unsigned i = 0; i < kCount; i++) {
+      thr[i]->tick();
+      thr[i]->acquire(&cache, &mtx);
+      thr[i]->tick();
+      thr[i]->release(&cache, &mtx);
+      ASSERT_EQ(mtx.get(i), thr[i]->get(i));
+    }
+  }
+  for (unsigned i = 0; i < kCount; i++) {
+    ASSERT_EQ(mtx.get(i), 6U);
+    ASSERT_EQ(thr[kCount - 1]->get(i), 6U);
+  }
+  // The first thread has not seen the last round of the others yet.
+  thr[0]->acquire(&cache, &mtx);
+  for (unsigned i = 0; i < kCount; i++)
+    ASSERT_EQ(thr[0]->get(i), 6U);
+  for (unsigned i = 0; i < kCount; i++)
+    delete thr[i];
+  mtx.Reset(&cache);
+}
+
 TEST(Clock, DifferentSizes) {
   {
     ThreadClock vector1(10);
@@ -275,11 +304,13 @@ TEST(Clock, Growth2) {
 
 const uptr kThreads = 4;
 const uptr kClocks = 4;
+// Size of the simple clocks, enough for the largest tid used by the fuzzer.
+const uptr kSimpleClockSize = 320;
 
 // SimpleSyncClock and SimpleThreadClock implement the same thing as
 // SyncClock and ThreadClock, but in a very simple way.
 struct SimpleSyncClock {
-  u64 clock[kThreads];
+  u64 clock[kSimpleClockSize];
   uptr size;
 
   SimpleSyncClock() {
@@ -288,7 +319,7 @@ struct SimpleSyncClock {
 
   void Reset() {
     size = 0;
-    for (uptr i = 0; i < kThreads; i++)
+    for (uptr i = 0; i < kSimpleClockSize; i++)
       clock[i] = 0;
   }
 
@@ -308,14 +339,14 @@ struct SimpleSyncClock {
 };
 
 struct SimpleThreadClock {
-  u64 clock[kThreads];
+  u64 clock[kSimpleClockSize];
   uptr size;
   unsigned tid;
 
   explicit SimpleThreadClock(unsigned tid) {
     this->tid = tid;
     size = tid + 1;
-    for (uptr i = 0; i < kThreads; i++)
+    for (uptr i = 0; i < kSimpleClockSize; i++)
       clock[i] = 0;
   }
 
@@ -326,14 +357,14 @@ struct SimpleThreadClock {
   void acquire(const SimpleSyncClock *src) {
     if (size < src->size)
       size = src->size;
-    for (uptr i = 0; i < kThreads; i++)
+    for (uptr i = 0; i < kSimpleClockSize; i++)
       clock[i] = max(clock[i], src->clock[i]);
   }
 
   void release(SimpleSyncClock *dst) const {
     if (dst->size < size)
       dst->size = size;
-    for (uptr i = 0; i < kThreads; i++)
+    for (uptr i = 0; i < kSimpleClockSize; i++)
       dst->clock[i] = max(dst->clock[i], clock[i]);
   }
 
@@ -345,7 +376,7 @@ struct SimpleThreadClock {
   void ReleaseStore(SimpleSyncClock *dst) const {
     if (dst->size < size)
       dst->size = size;
-    for (uptr i = 0; i < kThreads; i++)
+    for (uptr i = 0; i < kSimpleClockSize; i++)
       dst->clock[i] = clock[i];
   }
 
@@ -364,15 +395,16 @@ struct SimpleThreadClock {
   }
 };
 
-static bool ClockFuzzer(bool printing) {
+// Thread i of the fuzzer has tid tids[i].
+static bool ClockFuzzer(bool printing, const unsigned *tids) {
   // Create kThreads thread clocks.
   SimpleThreadClock *thr0[kThreads];
   ThreadClock *thr1[kThreads];
   unsigned reused[kThreads];
   for (unsigned i = 0; i < kThreads; i++) {
     reused[i] = 0;
-    thr0[i] = new SimpleThreadClock(i);
-    thr1[i] = new ThreadClock(i, reused[i]);
+    thr0[i] = new SimpleThreadClock(tids[i]);
+    thr1[i] = new ThreadClock(tids[i], reused[i]);
   }
 
   // Create kClocks sync clocks.
@@ -425,13 +457,13 @@ static bool ClockFuzzer(bool printing) {
     case 5:
       if (printing)
         printf("reset thr%d\n", tid);
-      u64 epoch = thr0[tid]->clock[tid] + 1;
+      u64 epoch = thr0[tid]->clock[tids[tid]] + 1;
       reused[tid]++;
       delete thr0[tid];
-      thr0[tid] = new SimpleThreadClock(tid);
-      thr0[tid]->clock[tid] = epoch;
+      thr0[tid] = new SimpleThreadClock(tids[tid]);
+      thr0[tid]->clock[tids[tid]] = epoch;
       delete thr1[tid];
-      thr1[tid] = new ThreadClock(tid, reused[tid]);
+      thr1[tid] = new ThreadClock(tids[tid], reused[tid]);
       thr1[tid]->set(epoch);
       break;
     }
@@ -477,18 +509,30 @@ static bool ClockFuzzer(bool printing) {
   return true;
 }
 
-TEST(Clock, Fuzzer) {
+static void RunClockFuzzer(const unsigned *tids) {
   struct timeval tv;
   gettimeofday(&tv, NULL);
   int seed = tv.tv_sec + tv.tv_usec;
   printf("seed=%d\n", seed);
   srand(seed);
-  if (!ClockFuzzer(false)) {
+  if (!ClockFuzzer(false, tids)) {
     // Redo the test with the same seed, but logging operations.
     srand(seed);
-    ClockFuzzer(true);
+    ClockFuzzer(true, tids);
     ASSERT_TRUE(false);
   }
 }
 
+TEST(Clock, Fuzzer) {
+  const unsigned tids[kThreads] = {0, 1, 2, 3};
+  RunClockFuzzer(tids);
+}
+
+TEST(Clock, FuzzerSparse) {
+  // Every thread is in a different ClockBlock, so that releases can skip
+  // the blocks that did not change.
+  const unsigned tids[kThreads] = {1, 70, 150, 300};
+  RunClockFuzzer(tids);
+}
+
 }  // namespace __tsan
@@ -0,0 +1,25 @@
+// Check that with -asan-opt-loops an overflow in a simple loop is reported by
+// the range check before the loop, with the size of the whole range.
+// RUN: %clangxx_asan -O1 -mllvm -asan-opt-loops %s -o %t
+// RUN: not %run %t 2>&1 | FileCheck %s
+
+// REQUIRES: Clang
+
+#include <stdlib.h>
+
+__attribute__((noinline)) int Sum(int *a, int n) {
+  int sum = 0;
+  for (int i = 0; i <= n; i++)
+    sum += a[i];
+  // CHECK: {{READ of size 44 at 0x.* thread T0}}
+  // CHECK: {{    #0 0x.* in Sum.*loop-range-check.cc:}}[[@LINE-3]]
+  // CHECK: {{0x.* is located 0 bytes to the right of 40-byte region}}
+  return sum;
+}
+
+int main(int argc, char **argv) {
+  int *a = (int *)calloc(10, sizeof(int));
+  int res = Sum(a, argc * 10);
+  free(a);
+  return res;
+}
@@ -0,0 +1,51 @@
+// RUN: %clang_profgen -mllvm -runtime-counter-relocation -o %t.exe %s
+// RUN: rm -rf %t.dir && mkdir -p %t.dir
+//
+// The counters reach the file before the process exits.
+// RUN: not --crash env LLVM_PROFILE_FILE="%t.dir/%c%m.profraw" \
+// RUN:   %run %t.exe %t.dir abort
+// RUN: llvm-profdata show --function=foo --counts %t.dir/*.profraw \
+// RUN:   | FileCheck %s -check-prefix=ONE
+//
+// Later runs add to the mapped file in place.
+// RUN: env LLVM_PROFILE_FILE="%t.dir/%c%m.profraw" %run %t.exe %t.dir
+// RUN: env LLVM_PROFILE_FILE="%t.dir/%c%m.profraw" %run %t.exe %t.dir
+// RUN: llvm-profdata show --function=foo --counts %t.dir/*.profraw \
+// RUN:   | FileCheck %s -check-prefix=THREE
+//
+// Without relocated counters, %c falls back to writing at exit.
+// RUN: %clang_profgen -o %t.plain.exe %s
+// RUN: env LLVM_PROFILE_FILE="%t.plain.profraw%c" %run %t.plain.exe %t.dir \
+// RUN:   2>&1 | FileCheck %s -check-prefix=WARN
+// RUN: llvm-profdata show --function=foo --counts %t.plain.profraw \
+// RUN:   | FileCheck %s -check-prefix=ONE
+
+// ONE: Function count: 20
+// ONE: Block counts: [10]
+// THREE: Function count: 60
+// THREE: Block counts: [30]
+// WARN: Continuous mode needs code compiled with -mllvm
+// WARN-SAME: -runtime-counter-relocation
+
+#include <stdlib.h>
+#include <string.h>
+
+int __llvm_profile_is_continuous_mode_enabled(void);
+
+int g;
+void __attribute__((noinline)) foo(int i) {
+  if (i % 2)
+    g++;
+}
+
+int main(int argc, char **argv) {
+  int i;
+  for (i = 0; i < 20; i++)
+    foo(i);
+  if (argc > 2 && !strcmp(argv[2], "abort")) {
+    if (!__llvm_profile_is_continuous_mode_enabled())
+      return 1;
+    abort();
+  }
+  return 0;
+}
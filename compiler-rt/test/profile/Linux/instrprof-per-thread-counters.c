@@ -0,0 +1,35 @@
+// RUN: %clang_profgen -mllvm -instrprof-per-thread-counters -o %t -O2 %s \
+// RUN:   -lpthread
+// RUN: env LLVM_PROFILE_FILE=%t.profraw %run %t
+// RUN: llvm-profdata show --function=foo --counts %t.profraw | FileCheck %s
+
+// Both the threads that exited and the main thread, which is still running
+// when the profile is written, are counted exactly.
+// CHECK: Function count: 800001
+// CHECK: Block counts: [400000]
+
+#include <pthread.h>
+
+int g;
+void __attribute__((noinline)) foo(int i) {
+  if (i % 2)
+    __atomic_fetch_add(&g, 1, __ATOMIC_RELAXED);
+}
+
+void *thread(void *arg) {
+  int i;
+  for (i = 0; i < 100000; i++)
+    foo(i);
+  return 0;
+}
+
+int main() {
+  pthread_t t[8];
+  int i;
+  for (i = 0; i < 8; i++)
+    pthread_create(&t[i], 0, thread, 0);
+  for (i = 0; i < 8; i++)
+    pthread_join(t[i], 0);
+  foo(0);
+  return 0;
+}
@@ -0,0 +1,29 @@
+// RUN: %clang_pgogen -O2 -mllvm -disable-vp=false -o %t %s
+// RUN: env LLVM_PROFILE_FILE=%t.sampled.profraw LLVM_VP_SAMPLING_PERIOD=50 \
+// RUN:   %run %t
+// RUN: llvm-profdata show --all-functions -ic-targets %t.sampled.profraw \
+// RUN:   | FileCheck %s -check-prefix=SAMPLED
+//
+// Sampled counts are scaled, so they merge with complete ones.
+// RUN: env LLVM_PROFILE_FILE=%t.full.profraw %run %t
+// RUN: llvm-profdata merge -o %t.profdata %t.sampled.profraw %t.full.profraw
+// RUN: llvm-profdata show --all-functions -ic-targets %t.profdata \
+// RUN:   | FileCheck %s -check-prefix=MERGED
+
+// SAMPLED-DAG: [ 0, callee_0, {{(9[0-9]|10[0-9])[0-9]{3}}} ]
+// SAMPLED-DAG: [ 0, callee_1, {{(2[89]|3[01])[0-9]{4}}} ]
+// MERGED-DAG: [ 0, callee_0, {{(19|20|21)[0-9]{4}}} ]
+// MERGED-DAG: [ 0, callee_1, {{(5[89]|6[01])[0-9]{4}}} ]
+
+void callee_0() {}
+void callee_1() {}
+
+typedef void (*FPT)(void);
+FPT Callees[] = {callee_0, callee_1, callee_1, callee_1};
+
+int main() {
+  int I;
+  for (I = 0; I < 400000; I++)
+    Callees[I % 4]();
+  return 0;
+}
@@ -108,6 +108,50 @@ static void BM_FindRehash(benchmark::State& st, Container c, GenInputs gen) {
     }
 }
 
+// Erases half of the elements and inserts them back, as a table whose contents
+// are replaced over time does.
+template <class Container, class GenInputs>
+static void BM_EraseInsert(benchmark::State& st, Container c, GenInputs gen) {
+    auto in = gen(st.range(0));
+    c.insert(in.begin(), in.end());
+    const auto end = in.data() + in.size();
+    while (st.KeepRunning()) {
+        for (auto it = in.data(); it < end; it += 2) {
+            c.erase(*it);
+        }
+        for (auto it = in.data(); it < end; it += 2) {
+            benchmark::DoNotOptimize(&(*c.insert(*it).first));
+        }
+        benchmark::ClobberMemory();
+    }
+}
+
+// Lookups in a table whose elements were erased and inserted back many times,
+// in a different order each time, rather than in a freshly built one.
+template <class Container, class GenInputs>
+static void BM_FindAfterChurn(benchmark::State& st, Container c, GenInputs gen) {
+    auto in = gen(st.range(0));
+    c.insert(in.begin(), in.end());
+    const std::size_t size = in.size();
+    for (std::size_t round = 1; round < 16; ++round) {
+        const std::size_t stride = 2 * round + 1;
+        for (std::size_t i = round; i < size; i += stride) {
+            c.erase(in[i]);
+        }
+        for (std::size_t i = size; i-- > 0;) {
+            c.insert(in[i]);
+        }
+    }
+    benchmark::DoNotOptimize(&(*c.begin()));
+    const auto end = in.data() + in.size();
+    while (st.KeepRunning()) {
+        for (auto it = in.data(); it != end; ++it) {
+            benchmark::DoNotOptimize(&(*c.find(*it)));
+        }
+        benchmark::ClobberMemory();
+    }
+}
+
 } // end namespace ContainerBenchmarks
 
 #endif // BENCHMARK_CONTAINER_BENCHMARKS_HPP
@@ -1,6 +1,8 @@
 #include <unordered_set>
 #include <vector>
 #include <cstdint>
+#include <execution>
+#include <numeric>
 
 #include "benchmark/benchmark.h"
 #include "GenerateInput.hpp"
@@ -58,5 +60,154 @@ BENCHMARK_CAPTURE(BM_Sort, sorted_descending_strings,
 BENCHMARK_CAPTURE(BM_Sort, single_element_strings,
     getDuplicateStringInputs)->Arg(TestNumInputs);
 
+// The searches on contiguous ranges, where the element searched for is at the
+// end of the range.
+
+template <class T>
+void BM_Find(benchmark::State& st) {
+    std::vector<T> in(st.range(0), T(1));
+    in.back() = T(2);
+    while (st.KeepRunning()) {
+        benchmark::DoNotOptimize(std::find(in.begin(), in.end(), T(2)));
+        benchmark::ClobberMemory();
+    }
+    st.SetBytesProcessed(st.iterations() * st.range(0) * sizeof(T));
+}
+BENCHMARK_TEMPLATE(BM_Find, uint8_t)->Arg(16)->Arg(TestNumInputs);
+BENCHMARK_TEMPLATE(BM_Find, uint16_t)->Arg(16)->Arg(TestNumInputs);
+BENCHMARK_TEMPLATE(BM_Find, uint32_t)->Arg(16)->Arg(TestNumInputs);
+BENCHMARK_TEMPLATE(BM_Find, uint64_t)->Arg(16)->Arg(TestNumInputs);
+
+template <class T>
+void BM_Count(benchmark::State& st) {
+    std::vector<T> in(st.range(0));
+    for (std::size_t i = 0; i < in.size(); ++i)
+        in[i] = T(i % 3);
+    while (st.KeepRunning()) {
+        benchmark::DoNotOptimize(std::count(in.begin(), in.end(), T(2)));
+        benchmark::ClobberMemory();
+    }
+    st.SetBytesProcessed(st.iterations() * st.range(0) * sizeof(T));
+}
+BENCHMARK_TEMPLATE(BM_Count, uint8_t)->Arg(16)->Arg(TestNumInputs);
+BENCHMARK_TEMPLATE(BM_Count, uint32_t)->Arg(16)->Arg(TestNumInputs);
+BENCHMARK_TEMPLATE(BM_Count, uint64_t)->Arg(16)->Arg(TestNumInputs);
+
+template <class T>
+void BM_Mismatch(benchmark::State& st) {
+    std::vector<T> in1(st.range(0), T(1));
+    std::vector<T> in2 = in1;
+    in2.back() = T(2);
+    while (st.KeepRunning()) {
+        benchmark::DoNotOptimize(
+            std::mismatch(in1.begin(), in1.end(), in2.begin()));
+        benchmark::ClobberMemory();
+    }
+    st.SetBytesProcessed(st.iterations() * st.range(0) * sizeof(T));
+}
+BENCHMARK_TEMPLATE(BM_Mismatch, uint8_t)->Arg(16)->Arg(TestNumInputs);
+BENCHMARK_TEMPLATE(BM_Mismatch, uint32_t)->Arg(16)->Arg(TestNumInputs);
+
+// The algorithms with an execution policy. Comparing the seq and par versions
+// of each gives the speedup of the parallel algorithms.
+
+constexpr std::size_t TestNumParallelInputs = 1 << 20;
+
+template <class Policy, class GenInputs>
+void BM_SortPolicy(benchmark::State& st, Policy&& policy, GenInputs gen) {
+    const auto in = gen(st.range(0));
+    auto C = in;
+    while (st.KeepRunning()) {
+        std::sort(policy, C.begin(), C.end());
+        benchmark::DoNotOptimize(C.data());
+        st.PauseTiming();
+        C = in;
+        benchmark::ClobberMemory();
+        st.ResumeTiming();
+    }
+}
+
+template <class Policy>
+void BM_ForEachPolicy(benchmark::State& st, Policy&& policy) {
+    auto C = getRandomIntegerInputs<uint32_t>(st.range(0));
+    while (st.KeepRunning()) {
+        std::for_each(policy, C.begin(), C.end(),
+                      [](uint32_t& x) { x = x * 2654435761u + 1; });
+        benchmark::DoNotOptimize(C.data());
+    }
+}
+
+template <class Policy>
+void BM_TransformPolicy(benchmark::State& st, Policy&& policy) {
+    const auto in = getRandomIntegerInputs<uint32_t>(st.range(0));
+    std::vector<uint64_t> out(in.size());
+    while (st.KeepRunning()) {
+        std::transform(policy, in.begin(), in.end(), out.begin(),
+                       [](uint32_t x) { return uint64_t(x) * x; });
+        benchmark::DoNotOptimize(out.data());
+    }
+}
+
+template <class Policy>
+void BM_ReducePolicy(benchmark::State& st, Policy&& policy) {
+    const auto in = getRandomIntegerInputs<uint32_t>(st.range(0));
+    while (st.KeepRunning())
+        benchmark::DoNotOptimize(
+            std::reduce(policy, in.begin(), in.end(), uint64_t(0)));
+}
+
+template <class Policy>
+void BM_TransformReducePolicy(benchmark::State& st, Policy&& policy) {
+    const auto in = getRandomIntegerInputs<uint32_t>(st.range(0));
+    while (st.KeepRunning())
+        benchmark::DoNotOptimize(std::transform_reduce(
+            policy, in.begin(), in.end(), in.begin(), uint64_t(0)));
+}
+
+template <class Policy>
+void BM_InclusiveScanPolicy(benchmark::State& st, Policy&& policy) {
+    const auto in = getRandomIntegerInputs<uint32_t>(st.range(0));
+    std::vector<uint32_t> out(in.size());
+    while (st.KeepRunning()) {
+        std::inclusive_scan(policy, in.begin(), in.end(), out.begin());
+        benchmark::DoNotOptimize(out.data());
+    }
+}
+
+template <class Policy>
+void BM_ExclusiveScanPolicy(benchmark::State& st, Policy&& policy) {
+    const auto in = getRandomIntegerInputs<uint32_t>(st.range(0));
+    std::vector<uint32_t> out(in.size());
+    while (st.KeepRunning()) {
+        std::exclusive_scan(policy, in.begin(), in.end(), out.begin(), 0u);
+        benchmark::DoNotOptimize(out.data());
+    }
+}
+
+template <class Policy>
+void BM_CopyIfPolicy(benchmark::State& st, Policy&& policy) {
+    const auto in = getRandomIntegerInputs<uint32_t>(st.range(0));
+    std::vector<uint32_t> out(in.size());
+    while (st.KeepRunning()) {
+        auto end = std::copy_if(policy, in.begin(), in.end(), out.begin(),
+                                [](uint32_t x) { return x % 3 == 0; });
+        benchmark::DoNotOptimize(end);
+    }
+}
+
+#define BENCHMARK_POLICIES(Name, ...)                                          \
+    BENCHMARK_CAPTURE(Name, seq, std::execution::seq, ##__VA_ARGS__)           \
+        ->Arg(TestNumParallelInputs)->UseRealTime();                           \
+    BENCHMARK_CAPTURE(Name, par, std::execution::par, ##__VA_ARGS__)           \
+        ->Arg(TestNumParallelInputs)->UseRealTime()
+
+BENCHMARK_POLICIES(BM_SortPolicy, getRandomIntegerInputs<uint32_t>);
+BENCHMARK_POLICIES(BM_ForEachPolicy);
+BENCHMARK_POLICIES(BM_TransformPolicy);
+BENCHMARK_POLICIES(BM_ReducePolicy);
+BENCHMARK_POLICIES(BM_TransformReducePolicy);
+BENCHMARK_POLICIES(BM_InclusiveScanPolicy);
+BENCHMARK_POLICIES(BM_ExclusiveScanPolicy);
+BENCHMARK_POLICIES(BM_CopyIfPolicy);
 
 BENCHMARK_MAIN();
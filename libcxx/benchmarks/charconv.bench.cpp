@@ -0,0 +1,177 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+// Floating-point conversions with <charconv> compared to the printf and
+// strtod family, which are what users of the shortest round-trip
+// representation had to use before.
+
+namespace {
+
+// Doubles spread over the whole exponent range, and "human" decimals with a
+// few significant digits, which are the common case when parsing.
+template <class F>
+std::vector<F> makeValues(bool human) {
+  std::mt19937_64 rng(42);
+  std::vector<F> values;
+  while (values.size() < 1024) {
+    F v;
+    if (human) {
+      v = F(rng() % 1000000) / F(1000);
+    } else {
+      uint64_t bits = rng();
+      std::memcpy(&v, &bits, sizeof(v));
+      if (!(v == v) || v - v != 0)
+        continue;
+    }
+    values.push_back(v);
+  }
+  return values;
+}
+
+template <class F>
+std::vector<std::string> makeStrings(bool human) {
+  std::vector<std::string> strings;
+  char buf[64];
+  for (F v : makeValues<F>(human)) {
+    std::to_chars_result r = std::to_chars(buf, buf + sizeof(buf), v);
+    strings.emplace_back(buf, r.ptr);
+  }
+  return strings;
+}
+
+} // namespace
+
+template <class F>
+static void BM_ToChars(benchmark::State& st) {
+  const std::vector<F> values = makeValues<F>(st.range(0));
+  char buf[64];
+  size_t i = 0;
+  for (auto _ : st) {
+    std::to_chars_result r =
+        std::to_chars(buf, buf + sizeof(buf), values[i++ % values.size()]);
+    benchmark::DoNotOptimize(r.ptr);
+  }
+}
+BENCHMARK_TEMPLATE(BM_ToChars, float)->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_ToChars, double)->Arg(0)->Arg(1);
+
+// The shortest representation with printf is a search over the precision.
+template <class F>
+static void BM_SnprintfShortest(benchmark::State& st) {
+  const std::vector<F> values = makeValues<F>(st.range(0));
+  char buf[64];
+  size_t i = 0;
+  for (auto _ : st) {
+    const F v = values[i++ % values.size()];
+    for (int p = 1; p <= 17; ++p) {
+      std::snprintf(buf, sizeof(buf), "%.*g", p, static_cast<double>(v));
+      if (static_cast<F>(std::strtod(buf, nullptr)) == v)
+        break;
+    }
+    benchmark::DoNotOptimize(buf);
+  }
+}
+BENCHMARK_TEMPLATE(BM_SnprintfShortest, float)->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_SnprintfShortest, double)->Arg(0)->Arg(1);
+
+// What is used when the shortest representation is not needed.
+static void BM_Snprintf17(benchmark::State& st) {
+  const std::vector<double> values = makeValues<double>(st.range(0));
+  char buf[64];
+  size_t i = 0;
+  for (auto _ : st) {
+    std::snprintf(buf, sizeof(buf), "%.17g", values[i++ % values.size()]);
+    benchmark::DoNotOptimize(buf);
+  }
+}
+BENCHMARK(BM_Snprintf17)->Arg(0)->Arg(1);
+
+static void BM_ToCharsPrecision(benchmark::State& st) {
+  const std::vector<double> values = makeValues<double>(st.range(0));
+  char buf[64];
+  size_t i = 0;
+  for (auto _ : st) {
+    std::to_chars_result r =
+        std::to_chars(buf, buf + sizeof(buf), values[i++ % values.size()],
+                      std::chars_format::general, 17);
+    benchmark::DoNotOptimize(r.ptr);
+  }
+}
+BENCHMARK(BM_ToCharsPrecision)->Arg(0)->Arg(1);
+
+template <class F>
+static void BM_FromChars(benchmark::State& st) {
+  const std::vector<std::string> strings = makeStrings<F>(st.range(0));
+  size_t i = 0;
+  F v;
+  for (auto _ : st) {
+    const std::string& s = strings[i++ % strings.size()];
+    std::from_chars(s.data(), s.data() + s.size(), v);
+    benchmark::DoNotOptimize(v);
+  }
+}
+BENCHMARK_TEMPLATE(BM_FromChars, float)->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_FromChars, double)->Arg(0)->Arg(1);
+
+static void BM_Strtof(benchmark::State& st) {
+  const std::vector<std::string> strings = makeStrings<float>(st.range(0));
+  size_t i = 0;
+  for (auto _ : st)
+    benchmark::DoNotOptimize(
+        std::strtof(strings[i++ % strings.size()].c_str(), nullptr));
+}
+BENCHMARK(BM_Strtof)->Arg(0)->Arg(1);
+
+static void BM_Strtod(benchmark::State& st) {
+  const std::vector<std::string> strings = makeStrings<double>(st.range(0));
+  size_t i = 0;
+  for (auto _ : st)
+    benchmark::DoNotOptimize(
+        std::strtod(strings[i++ % strings.size()].c_str(), nullptr));
+}
+BENCHMARK(BM_Strtod)->Arg(0)->Arg(1);
+
+// Round trip through text, as when serializing and reading back data.
+static void BM_RoundTrip_Charconv(benchmark::State& st) {
+  const std::vector<double> values = makeValues<double>(st.range(0));
+  char buf[64];
+  size_t i = 0;
+  double v;
+  for (auto _ : st) {
+    std::to_chars_result r =
+        std::to_chars(buf, buf + sizeof(buf), values[i++ % values.size()]);
+    std::from_chars(buf, r.ptr, v);
+    benchmark::DoNotOptimize(v);
+  }
+}
+BENCHMARK(BM_RoundTrip_Charconv)->Arg(0)->Arg(1);
+
+static void BM_RoundTrip_Stdio(benchmark::State& st) {
+  const std::vector<double> values = makeValues<double>(st.range(0));
+  char buf[64];
+  size_t i = 0;
+  for (auto _ : st) {
+    std::snprintf(buf, sizeof(buf), "%.17g", values[i++ % values.size()]);
+    benchmark::DoNotOptimize(std::strtod(buf, nullptr));
+  }
+}
+BENCHMARK(BM_RoundTrip_Stdio)->Arg(0)->Arg(1);
+
+BENCHMARK_MAIN();
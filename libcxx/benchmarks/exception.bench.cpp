@@ -0,0 +1,98 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include <stdexcept>
+
+#include "benchmark/benchmark.h"
+
+// Throughput of throwing and catching exceptions, from one and from several
+// threads unwinding at once. Each frame unwound looks up the unwind tables of
+// the object containing it, which used to go through the dynamic loader
+// under its lock.
+
+namespace {
+
+// Throws after `depth` frames, each of which has to be unwound.
+__attribute__((noinline)) int throwAfter(int depth) {
+  if (depth == 0)
+    throw std::runtime_error("benchmark");
+  int r = throwAfter(depth - 1);
+  benchmark::DoNotOptimize(r);
+  return r + 1;
+}
+
+struct Cleanup {
+  __attribute__((noinline)) ~Cleanup() { benchmark::ClobberMemory(); }
+};
+
+__attribute__((noinline)) void throwIf(bool b) {
+  if (b)
+    throw std::runtime_error("benchmark");
+}
+
+// Each object to destroy gives a call site of its own, so the personality
+// routine goes over a long table in both phases of the unwinding.
+#define CLEANUP(i) Cleanup c##i; throwIf(false);
+#define CLEANUPS(i) CLEANUP(i##0) CLEANUP(i##1) CLEANUP(i##2) CLEANUP(i##3)
+__attribute__((noinline)) void throwAfterCleanups() {
+  CLEANUPS(0) CLEANUPS(1) CLEANUPS(2) CLEANUPS(3)
+  CLEANUPS(4) CLEANUPS(5) CLEANUPS(6) CLEANUPS(7)
+  throwIf(true);
+}
+#undef CLEANUPS
+#undef CLEANUP
+
+} // namespace
+
+static void BM_ThrowCatch(benchmark::State& st) {
+  const int depth = st.range(0);
+  for (auto _ : st) {
+    try {
+      throwAfter(depth);
+    } catch (const std::runtime_error& e) {
+      benchmark::DoNotOptimize(e.what());
+    }
+  }
+  st.SetItemsProcessed(st.iterations());
+}
+BENCHMARK(BM_ThrowCatch)
+    ->Arg(0)->Arg(16)->ThreadRange(1, 8)->UseRealTime();
+
+// Rethrowing unwinds the frames between the handlers twice.
+static void BM_ThrowRethrowCatch(benchmark::State& st) {
+  const int depth = st.range(0);
+  for (auto _ : st) {
+    try {
+      try {
+        throwAfter(depth);
+      } catch (...) {
+        throw;
+      }
+    } catch (const std::exception& e) {
+      benchmark::DoNotOptimize(e.what());
+    }
+  }
+  st.SetItemsProcessed(st.iterations());
+}
+BENCHMARK(BM_ThrowRethrowCatch)
+    ->Arg(0)->Arg(16)->ThreadRange(1, 8)->UseRealTime();
+
+static void BM_ThrowCatchThroughCleanups(benchmark::State& st) {
+  for (auto _ : st) {
+    try {
+      throwAfterCleanups();
+    } catch (const std::runtime_error& e) {
+      benchmark::DoNotOptimize(e.what());
+    }
+  }
+  st.SetItemsProcessed(st.iterations());
+}
+BENCHMARK(BM_ThrowCatchThroughCleanups)->ThreadRange(1, 8)->UseRealTime();
+
+BENCHMARK_MAIN();
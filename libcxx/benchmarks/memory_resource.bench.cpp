@@ -0,0 +1,147 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cstddef>
+#include <map>
+#include <memory_resource>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+// Each benchmark runs the same allocation-heavy workload with containers using
+// std::allocator and with pmr containers on top of each memory resource.
+
+namespace {
+
+// Builds the containers needed to handle one "request": a list of strings
+// too long for the small string buffer, and an index over them.
+template <class Vector, class Map, class String, class Alloc>
+size_t buildIndex(size_t n, const Alloc& alloc) {
+  Vector words(alloc);
+  Map index(alloc);
+  for (size_t i = 0; i < n; ++i) {
+    words.emplace_back(String(32 + i % 32, char('a' + i % 26), alloc));
+    index.emplace(words.back(), i);
+  }
+  benchmark::DoNotOptimize(words.data());
+  return index.size();
+}
+
+struct StdContainers {
+  typedef std::vector<std::string> Vector;
+  typedef std::unordered_map<std::string, size_t> Map;
+  typedef std::string String;
+  typedef std::allocator<char> Alloc;
+};
+
+struct PmrContainers {
+  typedef std::pmr::vector<std::pmr::string> Vector;
+  typedef std::pmr::unordered_map<std::pmr::string, size_t> Map;
+  typedef std::pmr::string String;
+  typedef std::pmr::polymorphic_allocator<char> Alloc;
+};
+
+template <class C>
+size_t handleRequest(size_t n, const typename C::Alloc& alloc) {
+  return buildIndex<typename C::Vector, typename C::Map, typename C::String>(
+      n, alloc);
+}
+
+} // namespace
+
+static void BM_Request_StdAllocator(benchmark::State& st) {
+  const size_t n = st.range(0);
+  for (auto _ : st)
+    benchmark::DoNotOptimize(
+        handleRequest<StdContainers>(n, std::allocator<char>()));
+  st.SetItemsProcessed(st.iterations() * n);
+}
+BENCHMARK(BM_Request_StdAllocator)->Arg(64)->Arg(1024);
+
+static void BM_Request_NewDeleteResource(benchmark::State& st) {
+  const size_t n = st.range(0);
+  for (auto _ : st)
+    benchmark::DoNotOptimize(
+        handleRequest<PmrContainers>(n, std::pmr::new_delete_resource()));
+  st.SetItemsProcessed(st.iterations() * n);
+}
+BENCHMARK(BM_Request_NewDeleteResource)->Arg(64)->Arg(1024);
+
+// The arena idiom: all of a request's memory comes from a fixed buffer and is
+// dropped at once when the request is done.
+static void BM_Request_MonotonicBuffer(benchmark::State& st) {
+  const size_t n = st.range(0);
+  alignas(std::max_align_t) static char buffer[1 << 16];
+  for (auto _ : st) {
+    std::pmr::monotonic_buffer_resource mr(buffer, sizeof(buffer));
+    benchmark::DoNotOptimize(handleRequest<PmrContainers>(n, &mr));
+  }
+  st.SetItemsProcessed(st.iterations() * n);
+}
+BENCHMARK(BM_Request_MonotonicBuffer)->Arg(64)->Arg(1024);
+
+// A pool kept across requests recycles the blocks of the previous ones.
+static void BM_Request_UnsynchronizedPool(benchmark::State& st) {
+  const size_t n = st.range(0);
+  std::pmr::unsynchronized_pool_resource mr;
+  for (auto _ : st)
+    benchmark::DoNotOptimize(handleRequest<PmrContainers>(n, &mr));
+  st.SetItemsProcessed(st.iterations() * n);
+}
+BENCHMARK(BM_Request_UnsynchronizedPool)->Arg(64)->Arg(1024);
+
+static void BM_Request_SynchronizedPool(benchmark::State& st) {
+  const size_t n = st.range(0);
+  static std::pmr::synchronized_pool_resource* mr =
+      new std::pmr::synchronized_pool_resource;
+  for (auto _ : st)
+    benchmark::DoNotOptimize(handleRequest<PmrContainers>(n, mr));
+  st.SetItemsProcessed(st.iterations() * n);
+}
+BENCHMARK(BM_Request_SynchronizedPool)
+    ->Arg(64)->Arg(1024)->ThreadRange(1, 8)->UseRealTime();
+
+// Node-based containers: a steady state of inserting and erasing elements.
+template <class Map>
+static void runNodeChurn(benchmark::State& st, Map& m) {
+  const int n = st.range(0);
+  for (int i = 0; i < n; ++i)
+    m.emplace(i, i);
+  int next = n;
+  for (auto _ : st) {
+    m.erase(m.begin());
+    m.emplace(next, next);
+    ++next;
+  }
+  st.SetItemsProcessed(st.iterations());
+}
+
+static void BM_MapChurn_StdAllocator(benchmark::State& st) {
+  std::map<int, int> m;
+  runNodeChurn(st, m);
+}
+BENCHMARK(BM_MapChurn_StdAllocator)->Arg(1024)->Arg(1 << 16);
+
+static void BM_MapChurn_UnsynchronizedPool(benchmark::State& st) {
+  std::pmr::unsynchronized_pool_resource mr;
+  std::pmr::map<int, int> m(&mr);
+  runNodeChurn(st, m);
+}
+BENCHMARK(BM_MapChurn_UnsynchronizedPool)->Arg(1024)->Arg(1 << 16);
+
+static void BM_MapChurn_SynchronizedPool(benchmark::State& st) {
+  std::pmr::synchronized_pool_resource mr;
+  std::pmr::map<int, int> m(&mr);
+  runNodeChurn(st, m);
+}
+BENCHMARK(BM_MapChurn_SynchronizedPool)->Arg(1024)->Arg(1 << 16);
+
+BENCHMARK_MAIN();
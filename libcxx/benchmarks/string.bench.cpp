@@ -46,6 +46,59 @@ static void BM_StringFindMatch2(benchmark::State &state) {
 }
 BENCHMARK(BM_StringFindMatch2)->Range(1, MAX_STRING_LEN / 4);
 
+// Benchmark with a needle whose first and last characters often occur in the
+// string, as in text.
+static void BM_StringFindPartialMatches(benchmark::State &state) {
+  std::string s1;
+  while (s1.size() < static_cast<size_t>(state.range(0)))
+    s1 += "the theorem then thereby ";
+  std::string s2 = "the theory";
+  while (state.KeepRunning())
+    benchmark::DoNotOptimize(s1.find(s2));
+}
+BENCHMARK(BM_StringFindPartialMatches)->Range(16, MAX_STRING_LEN);
+
+static void BM_StringFindChar(benchmark::State &state) {
+  std::string s1(state.range(0), '-');
+  while (state.KeepRunning())
+    benchmark::DoNotOptimize(s1.find('*'));
+}
+BENCHMARK(BM_StringFindChar)->Range(10, MAX_STRING_LEN);
+
+static void BM_StringRFindChar(benchmark::State &state) {
+  std::string s1(state.range(0), '-');
+  while (state.KeepRunning())
+    benchmark::DoNotOptimize(s1.rfind('*'));
+}
+BENCHMARK(BM_StringRFindChar)->Range(10, MAX_STRING_LEN);
+
+static void BM_StringRFindNoMatch(benchmark::State &state) {
+  std::string s1(state.range(0), '-');
+  std::string s2(8, '*');
+  while (state.KeepRunning())
+    benchmark::DoNotOptimize(s1.rfind(s2));
+}
+BENCHMARK(BM_StringRFindNoMatch)->Range(10, MAX_STRING_LEN);
+
+// Benchmark with a few delimiters, and with a set of characters too large to
+// compare one at a time.
+static void BM_StringFindFirstOf(benchmark::State &state) {
+  std::string s1(state.range(0), '-');
+  const std::string delims = " \t\n,;";
+  while (state.KeepRunning())
+    benchmark::DoNotOptimize(s1.find_first_of(delims));
+}
+BENCHMARK(BM_StringFindFirstOf)->Range(10, MAX_STRING_LEN);
+
+static void BM_StringFindFirstOfLargeSet(benchmark::State &state) {
+  std::string s1(state.range(0), '-');
+  const std::string digits_and_letters =
+      "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+  while (state.KeepRunning())
+    benchmark::DoNotOptimize(s1.find_first_of(digits_and_letters));
+}
+BENCHMARK(BM_StringFindFirstOfLargeSet)->Range(10, MAX_STRING_LEN);
+
 static void BM_StringCtorDefault(benchmark::State &state) {
   while (state.KeepRunning()) {
     for (unsigned I=0; I < 1000; ++I) {
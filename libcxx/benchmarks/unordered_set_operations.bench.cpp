@@ -13,6 +13,7 @@
 using namespace ContainerBenchmarks;
 
 constexpr std::size_t TestNumInputs = 1024;
+constexpr std::size_t TestNumInputsLarge = 1 << 20;
 
 template <class _Size>
 inline __attribute__((__always_inline__))
@@ -265,6 +266,45 @@ BENCHMARK_CAPTURE(BM_FindRehash,
     std::unordered_set<std::string>{},
     getRandomStringInputs)->Arg(TestNumInputs);
 
+//----------------------------------------------------------------------------//
+//                       BM_EraseInsert / BM_FindAfterChurn
+// ---------------------------------------------------------------------------//
+
+BENCHMARK_CAPTURE(BM_EraseInsert,
+    unordered_set_random_uint64,
+    std::unordered_set<uint64_t>{},
+    getRandomIntegerInputs<uint64_t>)->Arg(TestNumInputs)->Arg(TestNumInputsLarge);
+
+BENCHMARK_CAPTURE(BM_EraseInsert,
+    unordered_set_string,
+    std::unordered_set<std::string>{},
+    getRandomStringInputs)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_FindAfterChurn,
+    unordered_set_random_uint64,
+    std::unordered_set<uint64_t>{},
+    getRandomIntegerInputs<uint64_t>)->Arg(TestNumInputs)->Arg(TestNumInputsLarge);
+
+BENCHMARK_CAPTURE(BM_FindAfterChurn,
+    unordered_set_string,
+    std::unordered_set<std::string>{},
+    getRandomStringInputs)->Arg(TestNumInputs);
+
+//----------------------------------------------------------------------------//
+//                       Large tables
+// ---------------------------------------------------------------------------//
+
+// Tables much larger than the caches, where each lookup misses.
+BENCHMARK_CAPTURE(BM_InsertValue,
+    unordered_set_uint32,
+    std::unordered_set<uint32_t>{},
+    getRandomIntegerInputs<uint32_t>)->Arg(TestNumInputsLarge);
+
+BENCHMARK_CAPTURE(BM_Find,
+    unordered_set_random_uint64,
+    std::unordered_set<uint64_t>{},
+    getRandomIntegerInputs<uint64_t>)->Arg(TestNumInputsLarge);
+
 ///////////////////////////////////////////////////////////////////////////////
 BENCHMARK_CAPTURE(BM_InsertDuplicate,
     unordered_set_int,
@@ -8,8 +8,14 @@
 //===----------------------------------------------------------------------===//
 
 #include "charconv"
+#include "locale"
+#include "memory"
+#include <float.h>
+#include <stdlib.h>
 #include <string.h>
 
+#include "include/charconv_tables.h"
+
 _LIBCPP_BEGIN_NAMESPACE_STD
 
 namespace __itoa
@@ -177,22 +183,43 @@ __u64toa(uint64_t value, char* buffer)
         const uint32_t b0 = v0 / 10000;
         const uint32_t c0 = v0 % 10000;
 
-        if (v0 < 1000000)
+        if (v0 < 10000)
         {
-            if (v0 < 100000)
-                buffer = append1(buffer, b0);
+            if (v0 < 100)
+            {
+                if (v0 < 10)
+                    buffer = append1(buffer, v0);
+                else
+                    buffer = append2(buffer, v0);
+            }
             else
-                buffer = append2(buffer, b0);
+            {
+                if (v0 < 1000)
+                    buffer = append3(buffer, v0);
+                else
+                    buffer = append4(buffer, v0);
+            }
         }
         else
         {
-            if (v0 < 10000000)
-                buffer = append3(buffer, b0);
+            if (v0 < 1000000)
+            {
+                if (v0 < 100000)
+                    buffer = append1(buffer, b0);
+                else
+                    buffer = append2(buffer, b0);
+            }
             else
-                buffer = append4(buffer, b0);
+            {
+                if (v0 < 10000000)
+                    buffer = append3(buffer, b0);
+                else
+                    buffer = append4(buffer, b0);
+            }
+
+            buffer = append4(buffer, c0);
         }
 
-        buffer = append4(buffer, c0);
         buffer = append4(buffer, v1 / 10000);
         buffer = append4(buffer, v1 % 10000);
     }
@@ -230,4 +257,1512 @@ __u64toa(uint64_t value, char* buffer)
 
 }  // namespace __itoa
 
+#if _LIBCPP_STD_VER > 14
+
+namespace __charconv
+{
+
+namespace
+{
+
+struct __u128
+{
+    uint64_t __lo;
+    uint64_t __hi;
+};
+
+inline __u128
+__umul128(uint64_t __a, uint64_t __b)
+{
+#ifndef _LIBCPP_HAS_NO_INT128
+    __uint128_t __p = static_cast<__uint128_t>(__a) * __b;
+    return {static_cast<uint64_t>(__p), static_cast<uint64_t>(__p >> 64)};
+#else
+    uint64_t __a_lo = static_cast<uint32_t>(__a), __a_hi = __a >> 32;
+    uint64_t __b_lo = static_cast<uint32_t>(__b), __b_hi = __b >> 32;
+    uint64_t __p00 = __a_lo * __b_lo;
+    uint64_t __p01 = __a_lo * __b_hi;
+    uint64_t __p10 = __a_hi * __b_lo;
+    uint64_t __p11 = __a_hi * __b_hi;
+    uint64_t __mid = (__p00 >> 32) + static_cast<uint32_t>(__p01) +
+                     static_cast<uint32_t>(__p10);
+    return {(__mid << 32) | static_cast<uint32_t>(__p00),
+            __p11 + (__p01 >> 32) + (__p10 >> 32) + (__mid >> 32)};
+#endif
+}
+
+inline int
+__clz64(uint64_t __x)
+{
+    return __builtin_clzll(__x);
+}
+
+inline int
+__ctz64(uint64_t __x)
+{
+    return __builtin_ctzll(__x);
+}
+
+template <class _Fp>
+struct __float_traits;
+
+template <>
+struct __float_traits<float>
+{
+    typedef uint32_t __bits_type;
+    static const int __mantissa_bits = 23;
+    static const int __exponent_bits = 8;
+    static const int __bias = 127;
+
+    // Eisel-Lemire parameters, see __compute_float.
+    static const int __min_exponent_round_to_even = -17;
+    static const int __max_exponent_round_to_even = 10;
+    static const int __smallest_power_of_ten = -65;
+    static const int __largest_power_of_ten = 38;
+
+    // Clinger's fast path: both the mantissa and the power of ten are exact.
+    static const int __max_exponent_fast_path = 10;
+};
+
+template <>
+struct __float_traits<double>
+{
+    typedef uint64_t __bits_type;
+    static const int __mantissa_bits = 52;
+    static const int __exponent_bits = 11;
+    static const int __bias = 1023;
+
+    static const int __min_exponent_round_to_even = -4;
+    static const int __max_exponent_round_to_even = 23;
+    static const int __smallest_power_of_ten = -342;
+    static const int __largest_power_of_ten = 308;
+
+    static const int __max_exponent_fast_path = 22;
+};
+
+template <class _Fp>
+inline typename __float_traits<_Fp>::__bits_type
+__bit_cast_to_bits(_Fp __f)
+{
+    typename __float_traits<_Fp>::__bits_type __b;
+    memcpy(&__b, &__f, sizeof(__b));
+    return __b;
+}
+
+template <class _Fp>
+inline _Fp
+__bit_cast_from_bits(typename __float_traits<_Fp>::__bits_type __b)
+{
+    _Fp __f;
+    memcpy(&__f, &__b, sizeof(__f));
+    return __f;
+}
+
+// Ryu: shortest round-trip decimal representation.
+//
+// [Adams 2018] Ulf Adams. Ryu: Fast Float-to-String Conversion. PLDI 2018.
+//
+// The binary value, and the halfway points to its neighbours, are multiplied
+// by a precomputed approximation of a power of ten so that the interval of
+// decimals that round to the value is known exactly; then digits are removed
+// as long as the interval still contains a shorter decimal.
+
+struct __decimal
+{
+    uint64_t __mantissa;
+    int32_t __exponent;
+};
+
+// ceil(log2(5^__e)) for 0 < __e <= 3528, and 1 for __e == 0.
+inline int32_t
+__pow5bits(int32_t __e)
+{
+    return static_cast<int32_t>(
+        ((static_cast<uint32_t>(__e) * 1217359) >> 19) + 1);
+}
+
+// floor(log10(2^__e)) for 0 <= __e <= 1650.
+inline uint32_t
+__log10_pow2(int32_t __e)
+{
+    return (static_cast<uint32_t>(__e) * 78913) >> 18;
+}
+
+// floor(log10(5^__e)) for 0 <= __e <= 2620.
+inline uint32_t
+__log10_pow5(int32_t __e)
+{
+    return (static_cast<uint32_t>(__e) * 732923) >> 20;
+}
+
+inline uint32_t
+__pow5_factor(uint64_t __v)
+{
+    uint32_t __count = 0;
+    for (;;)
+    {
+        uint64_t __q = __v / 5;
+        if (__v - 5 * __q != 0)
+            break;
+        __v = __q;
+        ++__count;
+    }
+    return __count;
+}
+
+inline bool
+__multiple_of_pow5(uint64_t __v, uint32_t __p)
+{
+    return __pow5_factor(__v) >= __p;
+}
+
+inline bool
+__multiple_of_pow2(uint64_t __v, uint32_t __p)
+{
+    return (__v & ((uint64_t(1) << __p) - 1)) == 0;
+}
+
+// (__m * __mul) >> __j, where __mul is a 128-bit table entry and
+// 64 < __j < 128.
+inline uint64_t
+__mul_shift64(uint64_t __m, const uint64_t* __mul, int32_t __j)
+{
+    __u128 __b0 = __umul128(__m, __mul[0]);
+    __u128 __b2 = __umul128(__m, __mul[1]);
+    uint64_t __lo = __b2.__lo + __b0.__hi;
+    uint64_t __hi = __b2.__hi + (__lo < __b0.__hi);
+    const unsigned __dist = static_cast<unsigned>(__j - 64);
+    return (__hi << (64 - __dist)) | (__lo >> __dist);
+}
+
+// (__m * __factor) >> __shift, where 32 < __shift < 96.
+inline uint32_t
+__mul_shift32(uint32_t __m, uint64_t __factor, int32_t __shift)
+{
+    uint64_t __bits0 = uint64_t(__m) * static_cast<uint32_t>(__factor);
+    uint64_t __bits1 = uint64_t(__m) * (__factor >> 32);
+    uint64_t __sum = (__bits0 >> 32) + __bits1;
+    return static_cast<uint32_t>(__sum >> (__shift - 32));
+}
+
+__decimal
+__d2d(uint64_t __ieee_mantissa, uint32_t __ieee_exponent)
+{
+    const int32_t __pow5_inv_bitcount = 125;
+    const int32_t __pow5_bitcount = 125;
+    typedef __float_traits<double> _Tr;
+
+    int32_t __e2;
+    uint64_t __m2;
+    if (__ieee_exponent == 0)
+    {
+        __e2 = 1 - _Tr::__bias - _Tr::__mantissa_bits - 2;
+        __m2 = __ieee_mantissa;
+    }
+    else
+    {
+        __e2 = static_cast<int32_t>(__ieee_exponent) - _Tr::__bias -
+               _Tr::__mantissa_bits - 2;
+        __m2 = (uint64_t(1) << _Tr::__mantissa_bits) | __ieee_mantissa;
+    }
+    const bool __accept_bounds = (__m2 & 1) == 0;
+
+    // The value is __mv * 2^__e2, the halfway points are __mv + 2 and
+    // __mv - 1 - __mm_shift (closer for powers of two).
+    const uint64_t __mv = 4 * __m2;
+    const uint32_t __mm_shift = __ieee_mantissa != 0 || __ieee_exponent <= 1;
+
+    uint64_t __vr, __vp, __vm;
+    int32_t __e10;
+    bool __vm_is_trailing_zeros = false;
+    bool __vr_is_trailing_zeros = false;
+    if (__e2 >= 0)
+    {
+        const uint32_t __q = __log10_pow2(__e2) - (__e2 > 3);
+        __e10 = static_cast<int32_t>(__q);
+        const int32_t __k =
+            __pow5_inv_bitcount + __pow5bits(static_cast<int32_t>(__q)) - 1;
+        const int32_t __i = -__e2 + static_cast<int32_t>(__q) + __k;
+        const uint64_t* __mul = __double_pow5_inv_split[__q];
+        __vr = __mul_shift64(4 * __m2, __mul, __i);
+        __vp = __mul_shift64(4 * __m2 + 2, __mul, __i);
+        __vm = __mul_shift64(4 * __m2 - 1 - __mm_shift, __mul, __i);
+        if (__q <= 21)
+        {
+            // Only one of __mp, __mv and __mm can be a multiple of 5.
+            if (__mv % 5 == 0)
+                __vr_is_trailing_zeros = __multiple_of_pow5(__mv, __q);
+            else if (__accept_bounds)
+                __vm_is_trailing_zeros =
+                    __multiple_of_pow5(__mv - 1 - __mm_shift, __q);
+            else
+                __vp -= __multiple_of_pow5(__mv + 2, __q);
+        }
+    }
+    else
+    {
+        const uint32_t __q = __log10_pow5(-__e2) - (-__e2 > 1);
+        __e10 = static_cast<int32_t>(__q) + __e2;
+        const int32_t __i = -__e2 - static_cast<int32_t>(__q);
+        const int32_t __k = __pow5bits(__i) - __pow5_bitcount;
+        const int32_t __j = static_cast<int32_t>(__q) - __k;
+        const uint64_t* __mul = __double_pow5_split[__i];
+        __vr = __mul_shift64(4 * __m2, __mul, __j);
+        __vp = __mul_shift64(4 * __m2 + 2, __mul, __j);
+        __vm = __mul_shift64(4 * __m2 - 1 - __mm_shift, __mul, __j);
+        if (__q <= 1)
+        {
+            // __mv has at least two trailing zero bits.
+            __vr_is_trailing_zeros = true;
+            if (__accept_bounds)
+                __vm_is_trailing_zeros = __mm_shift == 1;
+            else
+                --__vp;
+        }
+        else if (__q < 63)
+        {
+            __vr_is_trailing_zeros = __multiple_of_pow2(__mv, __q);
+        }
+    }
+
+    int32_t __removed = 0;
+    uint8_t __last_removed_digit = 0;
+    uint64_t __output;
+    if (__vm_is_trailing_zeros || __vr_is_trailing_zeros)
+    {
+        // The general case, rare.
+        while (__vp / 10 > __vm / 10)
+        {
+            __vm_is_trailing_zeros &= __vm % 10 == 0;
+            __vr_is_trailing_zeros &= __last_removed_digit == 0;
+            __last_removed_digit = static_cast<uint8_t>(__vr % 10);
+            __vr /= 10;
+            __vp /= 10;
+            __vm /= 10;
+            ++__removed;
+        }
+        if (__vm_is_trailing_zeros)
+        {
+            while (__vm % 10 == 0)
+            {
+                __vr_is_trailing_zeros &= __last_removed_digit == 0;
+                __last_removed_digit = static_cast<uint8_t>(__vr % 10);
+                __vr /= 10;
+                __vp /= 10;
+                __vm /= 10;
+                ++__removed;
+            }
+        }
+        // Round to even if the exact value is .....50..0.
+        if (__vr_is_trailing_zeros && __last_removed_digit == 5 && __vr % 2 == 0)
+            __last_removed_digit = 4;
+        __output = __vr + ((__vr == __vm &&
+                            (!__accept_bounds || !__vm_is_trailing_zeros)) ||
+                           __last_removed_digit >= 5);
+    }
+    else
+    {
+        // The common case: no trailing zeros to keep track of.
+        bool __round_up = false;
+        if (__vp / 100 > __vm / 100)
+        {
+            __round_up = __vr % 100 >= 50;
+            __vr /= 100;
+            __vp /= 100;
+            __vm /= 100;
+            __removed += 2;
+        }
+        while (__vp / 10 > __vm / 10)
+        {
+            __round_up = __vr % 10 >= 5;
+            __vr /= 10;
+            __vp /= 10;
+            __vm /= 10;
+            ++__removed;
+        }
+        __output = __vr + (__vr == __vm || __round_up);
+    }
+    return {__output, __e10 + __removed};
+}
+
+__decimal
+__f2d(uint32_t __ieee_mantissa, uint32_t __ieee_exponent)
+{
+    const int32_t __pow5_inv_bitcount = 59;
+    const int32_t __pow5_bitcount = 61;
+    typedef __float_traits<float> _Tr;
+
+    int32_t __e2;
+    uint32_t __m2;
+    if (__ieee_exponent == 0)
+    {
+        __e2 = 1 - _Tr::__bias - _Tr::__mantissa_bits - 2;
+        __m2 = __ieee_mantissa;
+    }
+    else
+    {
+        __e2 = static_cast<int32_t>(__ieee_exponent) - _Tr::__bias -
+               _Tr::__mantissa_bits - 2;
+        __m2 = (uint32_t(1) << _Tr::__mantissa_bits) | __ieee_mantissa;
+    }
+    const bool __accept_bounds = (__m2 & 1) == 0;
+
+    const uint32_t __mv = 4 * __m2;
+    const uint32_t __mp = 4 * __m2 + 2;
+    const uint32_t __mm_shift = __ieee_mantissa != 0 || __ieee_exponent <= 1;
+    const uint32_t __mm = 4 * __m2 - 1 - __mm_shift;
+
+    uint32_t __vr, __vp, __vm;
+    int32_t __e10;
+    bool __vm_is_trailing_zeros = false;
+    bool __vr_is_trailing_zeros = false;
+    uint8_t __last_removed_digit = 0;
+    if (__e2 >= 0)
+    {
+        const uint32_t __q = __log10_pow2(__e2);
+        __e10 = static_cast<int32_t>(__q);
+        const int32_t __k =
+            __pow5_inv_bitcount + __pow5bits(static_cast<int32_t>(__q)) - 1;
+        const int32_t __i = -__e2 + static_cast<int32_t>(__q) + __k;
+        __vr = __mul_shift32(__mv, __float_pow5_inv_split[__q], __i);
+        __vp = __mul_shift32(__mp, __float_pow5_inv_split[__q], __i);
+        __vm = __mul_shift32(__mm, __float_pow5_inv_split[__q], __i);
+        if (__q != 0 && (__vp - 1) / 10 <= __vm / 10)
+        {
+            // The loop below removes no digit, but the last removed digit
+            // is still needed for rounding.
+            const int32_t __l = __pow5_inv_bitcount +
+                                __pow5bits(static_cast<int32_t>(__q - 1)) - 1;
+            __last_removed_digit = static_cast<uint8_t>(
+                __mul_shift32(__mv, __float_pow5_inv_split[__q - 1],
+                              -__e2 + static_cast<int32_t>(__q) - 1 + __l) %
+                10);
+        }
+        if (__q <= 9)
+        {
+            if (__mv % 5 == 0)
+                __vr_is_trailing_zeros = __multiple_of_pow5(__mv, __q);
+            else if (__accept_bounds)
+                __vm_is_trailing_zeros = __multiple_of_pow5(__mm, __q);
+            else
+                __vp -= __multiple_of_pow5(__mp, __q);
+        }
+    }
+    else
+    {
+        const uint32_t __q = __log10_pow5(-__e2);
+        __e10 = static_cast<int32_t>(__q) + __e2;
+        const int32_t __i = -__e2 - static_cast<int32_t>(__q);
+        const int32_t __k = __pow5bits(__i) - __pow5_bitcount;
+        int32_t __j = static_cast<int32_t>(__q) - __k;
+        __vr = __mul_shift32(__mv, __float_pow5_split[__i], __j);
+        __vp = __mul_shift32(__mp, __float_pow5_split[__i], __j);
+        __vm = __mul_shift32(__mm, __float_pow5_split[__i], __j);
+        if (__q != 0 && (__vp - 1) / 10 <= __vm / 10)
+        {
+            __j = static_cast<int32_t>(__q) - 1 -
+                  (__pow5bits(__i + 1) - __pow5_bitcount);
+            __last_removed_digit = static_cast<uint8_t>(
+                __mul_shift32(__mv, __float_pow5_split[__i + 1], __j) % 10);
+        }
+        if (__q <= 1)
+        {
+            __vr_is_trailing_zeros = true;
+            if (__accept_bounds)
+                __vm_is_trailing_zeros = __mm_shift == 1;
+            else
+                --__vp;
+        }
+        else if (__q < 31)
+        {
+            __vr_is_trailing_zeros = __multiple_of_pow2(__mv, __q - 1);
+        }
+    }
+
+    int32_t __removed = 0;
+    uint32_t __output;
+    if (__vm_is_trailing_zeros || __vr_is_trailing_zeros)
+    {
+        while (__vp / 10 > __vm / 10)
+        {
+            __vm_is_trailing_zeros &= __vm % 10 == 0;
+            __vr_is_trailing_zeros &= __last_removed_digit == 0;
+            __last_removed_digit = static_cast<uint8_t>(__vr % 10);
+            __vr /= 10;
+            __vp /= 10;
+            __vm /= 10;
+            ++__removed;
+        }
+        if (__vm_is_trailing_zeros)
+        {
+            while (__vm % 10 == 0)
+            {
+                __vr_is_trailing_zeros &= __last_removed_digit == 0;
+                __last_removed_digit = static_cast<uint8_t>(__vr % 10);
+                __vr /= 10;
+                __vp /= 10;
+                __vm /= 10;
+                ++__removed;
+            }
+        }
+        if (__vr_is_trailing_zeros && __last_removed_digit == 5 && __vr % 2 == 0)
+            __last_removed_digit = 4;
+        __output = __vr + ((__vr == __vm &&
+                            (!__accept_bounds || !__vm_is_trailing_zeros)) ||
+                           __last_removed_digit >= 5);
+    }
+    else
+    {
+        while (__vp / 10 > __vm / 10)
+        {
+            __last_removed_digit = static_cast<uint8_t>(__vr % 10);
+            __vr /= 10;
+            __vp /= 10;
+            __vm /= 10;
+            ++__removed;
+        }
+        __output = __vr + (__vr == __vm || __last_removed_digit >= 5);
+    }
+    return {__output, __e10 + __removed};
+}
+
+inline __decimal
+__to_decimal(double __value)
+{
+    typedef __float_traits<double> _Tr;
+    uint64_t __bits = __bit_cast_to_bits(__value);
+    return __d2d(__bits & ((uint64_t(1) << _Tr::__mantissa_bits) - 1),
+                 static_cast<uint32_t>(__bits >> _Tr::__mantissa_bits) &
+                     ((1u << _Tr::__exponent_bits) - 1));
+}
+
+inline __decimal
+__to_decimal(float __value)
+{
+    typedef __float_traits<float> _Tr;
+    uint32_t __bits = __bit_cast_to_bits(__value);
+    return __f2d(__bits & ((uint32_t(1) << _Tr::__mantissa_bits) - 1),
+                 (__bits >> _Tr::__mantissa_bits) &
+                     ((1u << _Tr::__exponent_bits) - 1));
+}
+
+// Whether __d.__mantissa * 10^__d.__exponent, __d.__exponent > 0, is exactly
+// representable: the value it was computed from must then be that integer.
+// Otherwise the integer digits of the value differ from the shortest
+// decimal followed by zeros.
+template <class _Fp>
+bool
+__is_exact_integer(__decimal __d)
+{
+    const int __max_exponent = __float_traits<_Fp>::__max_exponent_fast_path;
+    if (__d.__exponent > __max_exponent)
+        return false;
+    // 10^e = 2^e * 5^e, and the powers of two only move the binary exponent.
+    uint64_t __shifted = __d.__mantissa >> __ctz64(__d.__mantissa);
+    const uint64_t __max =
+        (uint64_t(1) << (__float_traits<_Fp>::__mantissa_bits + 1)) - 1;
+    for (int32_t __i = 0; __i < __d.__exponent; ++__i)
+    {
+        if (__shifted > __max / 5)
+            return false;
+        __shifted *= 5;
+    }
+    return true;
+}
+
+// The length of d.ddde+xx with __len digits and the exponent __x; the
+// exponent has at least two digits.
+inline int
+__scientific_size(int __len, int32_t __x)
+{
+    const int32_t __abs_x = __x < 0 ? -__x : __x;
+    const int __exponent_digits =
+        __abs_x >= 1000 ? 4 : __abs_x >= 100 ? 3 : 2;
+    return __len + (__len > 1) + 2 + __exponent_digits;
+}
+
+// Formats the decimal __digits[0, __len) * 10^__exponent, where __digits has
+// no leading or trailing zeros. __fmt is either scientific, fixed, general or
+// zero for the format without chars_format.
+template <class _Fp>
+to_chars_result
+__format_decimal(char* __first, char* __last, _Fp __value,
+                 const char* __digits, int __len, int32_t __exponent,
+                 chars_format __fmt)
+{
+    // The exponent of the first digit in scientific notation.
+    const int32_t __x = __exponent + __len - 1;
+    const int __sci_size = __scientific_size(__len, __x);
+    int32_t __fixed_size;
+    if (__exponent >= 0)
+        __fixed_size = __len + __exponent;
+    else if (__len > -__exponent)
+        __fixed_size = __len + 1;
+    else
+        __fixed_size = 2 - __exponent;
+
+    bool __use_fixed;
+    if (__fmt == chars_format::scientific)
+        __use_fixed = false;
+    else if (__fmt == chars_format::fixed)
+        __use_fixed = true;
+    else if (__fmt == chars_format::general)
+        // As %g with the default precision of 6.
+        __use_fixed = -4 <= __x && __x < 6;
+    else
+        __use_fixed = __fixed_size <= __sci_size;
+
+    const ptrdiff_t __available = __last - __first;
+    if (!__use_fixed)
+    {
+        if (__available < __sci_size)
+            return {__last, errc::value_too_large};
+        char* __p = __first;
+        *__p++ = __digits[0];
+        if (__len > 1)
+        {
+            *__p++ = '.';
+            memcpy(__p, __digits + 1, __len - 1);
+            __p += __len - 1;
+        }
+        *__p++ = 'e';
+        *__p++ = __x < 0 ? '-' : '+';
+        const uint32_t __abs_x = __x < 0 ? -__x : __x;
+        if (__abs_x < 100)
+            __p = __itoa::append2(__p, __abs_x);
+        else
+            __p = __itoa::__u32toa(__abs_x, __p);
+        return {__p, errc(0)};
+    }
+
+    if (__available < __fixed_size)
+        return {__last, errc::value_too_large};
+    if (__exponent > 0)
+    {
+        __decimal __d;
+        __d.__exponent = __exponent;
+        __d.__mantissa = 0;
+        for (int __i = 0; __i < __len; ++__i)
+            __d.__mantissa = __d.__mantissa * 10 + (__digits[__i] - '0');
+        if (__len > 19 || !__is_exact_integer<_Fp>(__d))
+        {
+            // The integer digits of the value are the closest representation
+            // of that length. This is rare enough to be left to printf.
+            char __buf[400];
+            int __n = __libcpp_snprintf_l(__buf, sizeof(__buf),
+                                          _LIBCPP_GET_C_LOCALE, "%.0f",
+                                          static_cast<double>(__value));
+            _LIBCPP_ASSERT(__n == __fixed_size, "unexpected integer length");
+            memcpy(__first, __buf, __n);
+            return {__first + __n, errc(0)};
+        }
+        memcpy(__first, __digits, __len);
+        memset(__first + __len, '0', __exponent);
+    }
+    else if (__exponent == 0)
+        memcpy(__first, __digits, __len);
+    else if (__len > -__exponent)
+    {
+        const int __int_len = __len + __exponent;
+        memcpy(__first, __digits, __int_len);
+        __first[__int_len] = '.';
+        memcpy(__first + __int_len + 1, __digits + __int_len, -__exponent);
+    }
+    else
+    {
+        __first[0] = '0';
+        __first[1] = '.';
+        memset(__first + 2, '0', -__exponent - __len);
+        memcpy(__first + 2 - __exponent - __len, __digits, __len);
+    }
+    return {__first + __fixed_size, errc(0)};
+}
+
+// Writes "inf" or "nan" if __value is not finite.
+template <class _Fp>
+bool
+__format_special(char*& __first, char* __last, _Fp __value,
+                 to_chars_result& __r)
+{
+    if (isfinite(__value))
+        return false;
+    const char* __s = isinf(__value) ? "inf" : "nan";
+    if (__last - __first < 3)
+        __r = {__last, errc::value_too_large};
+    else
+    {
+        memcpy(__first, __s, 3);
+        __r = {__first + 3, errc(0)};
+    }
+    return true;
+}
+
+// Shortest hexadecimal representation, as %a without the 0x prefix.
+template <class _Fp>
+to_chars_result
+__to_chars_hex_shortest(char* __first, char* __last, _Fp __value)
+{
+    typedef __float_traits<_Fp> _Tr;
+    const uint64_t __bits = __bit_cast_to_bits(__value);
+    const uint32_t __ieee_exponent = static_cast<uint32_t>(
+        (__bits >> _Tr::__mantissa_bits) & ((1u << _Tr::__exponent_bits) - 1));
+    // Align the fraction on a nibble boundary.
+    const int __nibbles = (_Tr::__mantissa_bits + 3) / 4;
+    uint64_t __fraction = (__bits & ((uint64_t(1) << _Tr::__mantissa_bits) - 1))
+                          << (__nibbles * 4 - _Tr::__mantissa_bits);
+
+    char __leading;
+    int32_t __exponent;
+    if (__ieee_exponent == 0)
+    {
+        __leading = '0';
+        __exponent = __fraction == 0 ? 0 : 1 - _Tr::__bias;
+    }
+    else
+    {
+        __leading = '1';
+        __exponent = static_cast<int32_t>(__ieee_exponent) - _Tr::__bias;
+    }
+
+    char __buf[32];
+    char* __p = __buf;
+    *__p++ = __leading;
+    if (__fraction != 0)
+    {
+        *__p++ = '.';
+        int __n = __nibbles;
+        while ((__fraction & 0xF) == 0)
+        {
+            __fraction >>= 4;
+            --__n;
+        }
+        for (int __i = __n - 1; __i >= 0; --__i)
+            *__p++ = "0123456789abcdef"[(__fraction >> (4 * __i)) & 0xF];
+    }
+    *__p++ = 'p';
+    *__p++ = __exponent < 0 ? '-' : '+';
+    __p = __itoa::__u32toa(__exponent < 0 ? -__exponent : __exponent, __p);
+
+    const ptrdiff_t __n = __p - __buf;
+    if (__last - __first < __n)
+        return {__last, errc::value_too_large};
+    memcpy(__first, __buf, __n);
+    return {__first + __n, errc(0)};
+}
+
+template <class _Fp>
+to_chars_result
+__to_chars_shortest(char* __first, char* __last, _Fp __value,
+                    chars_format __fmt)
+{
+    if (signbit(__value))
+    {
+        if (__first == __last)
+            return {__last, errc::value_too_large};
+        *__first++ = '-';
+        __value = -__value;
+    }
+    to_chars_result __r;
+    if (__format_special(__first, __last, __value, __r))
+        return __r;
+    if (__fmt == chars_format::hex)
+        return __to_chars_hex_shortest(__first, __last, __value);
+
+    __decimal __d = __value == 0 ? __decimal{0, 0} : __to_decimal(__value);
+    char __digits[24];
+    const int __len =
+        static_cast<int>(__itoa::__u64toa(__d.__mantissa, __digits) - __digits);
+    return __format_decimal(__first, __last, __value, __digits, __len,
+                            __d.__exponent, __fmt);
+}
+
+// The overloads with a precision produce exactly what printf does.
+template <class _Fp>
+to_chars_result
+__to_chars_printf(char* __first, char* __last, _Fp __value,
+                  chars_format __fmt, int __precision)
+{
+    const bool __is_long = is_same<_Fp, long double>::value;
+    const char* __format;
+    switch (__fmt)
+    {
+    case chars_format::scientific:
+        __format = __is_long ? "%.*Le" : "%.*e";
+        break;
+    case chars_format::fixed:
+        __format = __is_long ? "%.*Lf" : "%.*f";
+        break;
+    case chars_format::hex:
+        __format = __is_long ? "%.*La" : "%.*a";
+        break;
+    default:
+        __format = __is_long ? "%.*Lg" : "%.*g";
+        break;
+    }
+
+    char __buf[128];
+    const ptrdiff_t __available = __last - __first;
+    char* __out = __buf;
+    unique_ptr<char[]> __heap;
+    int __n = __libcpp_snprintf_l(__buf, sizeof(__buf), _LIBCPP_GET_C_LOCALE,
+                                  __format, __precision, __value);
+    if (__n < 0)
+        return {__last, errc::value_too_large};
+    if (static_cast<size_t>(__n) >= sizeof(__buf))
+    {
+        if (__n > __available)
+            return {__last, errc::value_too_large};
+        __heap.reset(new char[__n + 1]);
+        __out = __heap.get();
+        __libcpp_snprintf_l(__out, __n + 1, _LIBCPP_GET_C_LOCALE, __format,
+                            __precision, __value);
+    }
+
+    // to_chars does not print the 0x prefix of %a.
+    const char* __s = __out;
+    if (__fmt == chars_format::hex && isfinite(__value))
+    {
+        const int __sign = *__s == '-';
+        if (__available < __n - 2)
+            return {__last, errc::value_too_large};
+        memcpy(__first, __s, __sign);
+        memcpy(__first + __sign, __s + __sign + 2, __n - __sign - 2);
+        return {__first + __n - 2, errc(0)};
+    }
+    if (__available < __n)
+        return {__last, errc::value_too_large};
+    memcpy(__first, __s, __n);
+    return {__first + __n, errc(0)};
+}
+
+#if LDBL_MANT_DIG != DBL_MANT_DIG
+
+// The shortest representation of a long double wider than double: the
+// smallest precision for which printf's correctly rounded digits read back
+// as the same value.
+to_chars_result
+__to_chars_shortest_long_double(char* __first, char* __last,
+                                long double __value, chars_format __fmt)
+{
+    if (signbit(__value))
+    {
+        if (__first == __last)
+            return {__last, errc::value_too_large};
+        *__first++ = '-';
+        __value = -__value;
+    }
+    to_chars_result __r;
+    if (__format_special(__first, __last, __value, __r))
+        return __r;
+    if (__fmt == chars_format::hex)
+        return __to_chars_printf(__first, __last, __value, __fmt, -1);
+
+    char __buf[64];
+    if (__value == 0)
+        memcpy(__buf, "0e+00", 6);
+    else
+    {
+        for (int __precision = 0;; ++__precision)
+        {
+            __libcpp_snprintf_l(__buf, sizeof(__buf), _LIBCPP_GET_C_LOCALE,
+                                "%.*Le", __precision, __value);
+            if (__precision >= LDBL_DECIMAL_DIG - 1 ||
+                strtold_l(__buf, nullptr, _LIBCPP_GET_C_LOCALE) == __value)
+                break;
+        }
+    }
+
+    // Split d.ddde+xx into the digits and the exponent of the last one.
+    char __digits[64];
+    int __len = 0;
+    const char* __p = __buf;
+    for (; *__p != 'e'; ++__p)
+        if (*__p != '.')
+            __digits[__len++] = *__p;
+    int32_t __exponent = static_cast<int32_t>(strtol(__p + 1, nullptr, 10));
+    while (__len > 1 && __digits[__len - 1] == '0')
+    {
+        --__len;
+        ++__exponent;
+    }
+    __exponent -= __len - 1;
+
+    if (__fmt == chars_format{} || __fmt == chars_format::fixed ||
+        __fmt == chars_format::general)
+    {
+        // __format_decimal only knows the exact integers of double.
+        const int32_t __x = __exponent + __len - 1;
+        const int __sci_size = __scientific_size(__len, __x);
+        const bool __fixed =
+            __fmt == chars_format::fixed ||
+            (__fmt == chars_format::general && __x < 6) ||
+            (__fmt == chars_format{} && __len + __exponent <= __sci_size);
+        if (__exponent > 0 && __fixed)
+            return __to_chars_printf(__first, __last, __value,
+                                     chars_format::fixed, 0);
+    }
+    return __format_decimal(__first, __last, static_cast<double>(__value),
+                            __digits, __len, __exponent, __fmt);
+}
+
+#endif  // LDBL_MANT_DIG != DBL_MANT_DIG
+
+// Eisel-Lemire: correctly rounded decimal to binary conversion.
+//
+// [Lemire 2021] Daniel Lemire. Number Parsing at a Gigabyte per Second.
+// Software: Practice and Experience 51(8), 2021.
+//
+// w * 10^q is approximated by the product of w and a truncated 128-bit power
+// of five. The result is correct unless the product falls too close to a
+// halfway point between two floats, which is detected; the caller then
+// falls back to strtod.
+
+struct __adjusted_mantissa
+{
+    uint64_t __mantissa;
+    int32_t __power2; // biased exponent; negative when undecided
+};
+
+// floor(log2(10^q)) + 63 for -342 <= q <= 308.
+inline int32_t
+__power(int32_t __q)
+{
+    return (((152170 + 65536) * __q) >> 16) + 63;
+}
+
+template <class _Fp>
+__adjusted_mantissa
+__compute_float(int64_t __q, uint64_t __w)
+{
+    typedef __float_traits<_Fp> _Tr;
+    const int __mantissa_bits = _Tr::__mantissa_bits;
+    const int32_t __infinite_power = (1 << _Tr::__exponent_bits) - 1;
+    const int32_t __minimum_exponent = -_Tr::__bias;
+
+    if (__w == 0 || __q < _Tr::__smallest_power_of_ten)
+        return {0, 0};
+    if (__q > _Tr::__largest_power_of_ten)
+        return {0, __infinite_power};
+
+    const int __lz = __clz64(__w);
+    __w <<= __lz;
+
+    // The high bits of __w * 5^q, computing the low ones only if the bits
+    // below the ones that matter are all ones.
+    const uint64_t* __pow5 =
+        __pow5_128[__q - _Tr::__smallest_power_of_ten -
+                   (__float_traits<double>::__smallest_power_of_ten -
+                    _Tr::__smallest_power_of_ten)];
+    const uint64_t __precision_mask = ~uint64_t(0) >> (__mantissa_bits + 3);
+    __u128 __product = __umul128(__w, __pow5[1]);
+    if ((__product.__hi & __precision_mask) == __precision_mask)
+    {
+        __u128 __second = __umul128(__w, __pow5[0]);
+        __product.__lo += __second.__hi;
+        if (__second.__hi > __product.__lo)
+            ++__product.__hi;
+    }
+    if (__product.__lo == ~uint64_t(0) && (__q < -27 || __q > 55))
+        return {0, -1};
+
+    const int __upperbit = static_cast<int>(__product.__hi >> 63);
+    const int __shift = __upperbit + 64 - __mantissa_bits - 3;
+    __adjusted_mantissa __r;
+    __r.__mantissa = __product.__hi >> __shift;
+    __r.__power2 = __power(static_cast<int32_t>(__q)) + __upperbit - __lz -
+                   __minimum_exponent;
+    if (__r.__power2 <= 0)
+    {
+        // Subnormal, or zero.
+        if (-__r.__power2 + 1 >= 64)
+            return {0, 0};
+        __r.__mantissa >>= -__r.__power2 + 1;
+        __r.__mantissa += __r.__mantissa & 1;
+        __r.__mantissa >>= 1;
+        // Rounding up may make it the smallest normal number.
+        __r.__power2 =
+            __r.__mantissa < (uint64_t(1) << __mantissa_bits) ? 0 : 1;
+        return __r;
+    }
+
+    // Round half to even: if the product is exactly halfway, only zeros
+    // were shifted out.
+    if (__product.__lo <= 1 && __q >= _Tr::__min_exponent_round_to_even &&
+        __q <= _Tr::__max_exponent_round_to_even &&
+        (__r.__mantissa & 3) == 1 &&
+        (__r.__mantissa << __shift) == __product.__hi)
+        __r.__mantissa &= ~uint64_t(1);
+
+    __r.__mantissa += __r.__mantissa & 1;
+    __r.__mantissa >>= 1;
+    if (__r.__mantissa >= (uint64_t(2) << __mantissa_bits))
+    {
+        __r.__mantissa = uint64_t(1) << __mantissa_bits;
+        ++__r.__power2;
+    }
+    __r.__mantissa &= ~(uint64_t(1) << __mantissa_bits);
+    if (__r.__power2 >= __infinite_power)
+        return {0, __infinite_power};
+    return __r;
+}
+
+inline bool
+__is_digit(char __c)
+{
+    return static_cast<unsigned char>(__c - '0') < 10;
+}
+
+inline int
+__hex_digit_value(char __c)
+{
+    if (__is_digit(__c))
+        return __c - '0';
+    if (__c >= 'a' && __c <= 'f')
+        return __c - 'a' + 10;
+    if (__c >= 'A' && __c <= 'F')
+        return __c - 'A' + 10;
+    return -1;
+}
+
+inline bool
+__match_ignore_case(const char*& __p, const char* __last, const char* __lower)
+{
+    const size_t __n = strlen(__lower);
+    if (static_cast<size_t>(__last - __p) < __n)
+        return false;
+    for (size_t __i = 0; __i < __n; ++__i)
+        if ((__p[__i] | 0x20) != __lower[__i])
+            return false;
+    __p += __n;
+    return true;
+}
+
+// Parses "inf", "infinity", "nan" or "nan(n-char-sequence)", ignoring case.
+template <class _Fp>
+bool
+__from_chars_special(const char* __p, const char* __last, bool __negative,
+                     _Fp& __value, from_chars_result& __r)
+{
+    if (__match_ignore_case(__p, __last, "inf"))
+    {
+        __match_ignore_case(__p, __last, "inity");
+        __value = __negative ? -numeric_limits<_Fp>::infinity()
+                             : numeric_limits<_Fp>::infinity();
+        __r = {__p, errc(0)};
+        return true;
+    }
+    if (__match_ignore_case(__p, __last, "nan"))
+    {
+        if (__p != __last && *__p == '(')
+        {
+            const char* __q = __p + 1;
+            while (__q != __last &&
+                   (__is_digit(*__q) || *__q == '_' ||
+                    ((*__q | 0x20) >= 'a' && (*__q | 0x20) <= 'z')))
+                ++__q;
+            if (__q != __last && *__q == ')')
+                __p = __q + 1;
+        }
+        __value = __negative ? -numeric_limits<_Fp>::quiet_NaN()
+                             : numeric_limits<_Fp>::quiet_NaN();
+        __r = {__p, errc(0)};
+        return true;
+    }
+    return false;
+}
+
+// The subject sequence of a decimal or hexadecimal number, split into up to
+// 19 significant decimal digits (16 hexadecimal) and an exponent.
+struct __number
+{
+    uint64_t __mantissa;
+    int64_t __exponent;  // decimal, or binary for hex
+    bool __truncated;    // non-zero digits did not fit in __mantissa
+    const char* __end;
+};
+
+// Parses an optionally signed exponent after 'e' or 'p'. Returns false if
+// there are no digits, in which case the exponent is not part of the number.
+inline bool
+__parse_exponent(const char*& __p, const char* __last, int64_t& __exponent)
+{
+    const char* __q = __p + 1;
+    bool __negative = false;
+    if (__q != __last && (*__q == '+' || *__q == '-'))
+        __negative = *__q++ == '-';
+    if (__q == __last || !__is_digit(*__q))
+        return false;
+    int64_t __e = 0;
+    for (; __q != __last && __is_digit(*__q); ++__q)
+        if (__e < 0x10000000)
+            __e = __e * 10 + (*__q - '0');
+    __exponent = __negative ? -__e : __e;
+    __p = __q;
+    return true;
+}
+
+bool
+__parse_decimal(const char* __p, const char* __last, chars_format __fmt,
+                __number& __n)
+{
+    const int __max_digits = 19;
+    uint64_t __w = 0;
+    int __digits = 0;
+    int64_t __adjust = 0;
+    bool __any = false;
+    bool __truncated = false;
+
+    for (; __p != __last && __is_digit(*__p); ++__p)
+    {
+        __any = true;
+        if (__w == 0 && *__p == '0')
+            continue;
+        if (__digits < __max_digits)
+        {
+            __w = __w * 10 + (*__p - '0');
+            ++__digits;
+        }
+        else
+        {
+            ++__adjust;
+            __truncated |= *__p != '0';
+        }
+    }
+    if (__p != __last && *__p == '.')
+    {
+        ++__p;
+        for (; __p != __last && __is_digit(*__p); ++__p)
+        {
+            __any = true;
+            if (__w == 0 && *__p == '0')
+            {
+                --__adjust;
+                continue;
+            }
+            if (__digits < __max_digits)
+            {
+                __w = __w * 10 + (*__p - '0');
+                ++__digits;
+                --__adjust;
+            }
+            else
+                __truncated |= *__p != '0';
+        }
+    }
+    if (!__any)
+        return false;
+
+    int64_t __e = 0;
+    const bool __has_exponent =
+        (__fmt & chars_format::scientific) == chars_format::scientific &&
+        __p != __last && (*__p == 'e' || *__p == 'E') &&
+        __parse_exponent(__p, __last, __e);
+    // The scientific format requires the exponent, the fixed format does not
+    // parse it.
+    if (!__has_exponent && __fmt == chars_format::scientific)
+        return false;
+
+    __n.__mantissa = __w;
+    __n.__exponent = __e + __adjust;
+    __n.__truncated = __truncated;
+    __n.__end = __p;
+    return true;
+}
+
+bool
+__parse_hex(const char* __p, const char* __last, __number& __n)
+{
+    const int __max_digits = 16;
+    uint64_t __m = 0;
+    int __digits = 0;
+    int64_t __adjust = 0;
+    bool __any = false;
+    bool __truncated = false;
+
+    int __v;
+    for (; __p != __last && (__v = __hex_digit_value(*__p)) >= 0; ++__p)
+    {
+        __any = true;
+        if (__m == 0 && __v == 0)
+            continue;
+        if (__digits < __max_digits)
+        {
+            __m = __m * 16 + __v;
+            ++__digits;
+        }
+        else
+        {
+            __adjust += 4;
+            __truncated |= __v != 0;
+        }
+    }
+    if (__p != __last && *__p == '.')
+    {
+        ++__p;
+        for (; __p != __last && (__v = __hex_digit_value(*__p)) >= 0; ++__p)
+        {
+            __any = true;
+            if (__m == 0 && __v == 0)
+            {
+                __adjust -= 4;
+                continue;
+            }
+            if (__digits < __max_digits)
+            {
+                __m = __m * 16 + __v;
+                ++__digits;
+                __adjust -= 4;
+            }
+            else
+                __truncated |= __v != 0;
+        }
+    }
+    if (!__any)
+        return false;
+
+    int64_t __e = 0;
+    if (__p != __last && (*__p == 'p' || *__p == 'P'))
+        __parse_exponent(__p, __last, __e);
+
+    __n.__mantissa = __m;
+    __n.__exponent = __e + __adjust;
+    __n.__truncated = __truncated;
+    __n.__end = __p;
+    return true;
+}
+
+// Rounds __n.__mantissa * 2^__n.__exponent to nearest, ties to even; the
+// truncated digits act as a sticky bit.
+template <class _Fp>
+__adjusted_mantissa
+__round_binary(__number __n)
+{
+    typedef __float_traits<_Fp> _Tr;
+    const int __mantissa_bits = _Tr::__mantissa_bits;
+    const int32_t __infinite_power = (1 << _Tr::__exponent_bits) - 1;
+    const int32_t __min_exponent = 1 - _Tr::__bias - __mantissa_bits;
+
+    if (__n.__mantissa == 0)
+        return {0, 0};
+
+    // Put the leading bit at position __mantissa_bits, then move it right
+    // if the value is subnormal.
+    uint64_t __m = __n.__mantissa;
+    const int __bitlen = 64 - __clz64(__m);
+    if (__n.__exponent > 0x10000 || __n.__exponent < -0x10000)
+        return __n.__exponent > 0 ? __adjusted_mantissa{0, __infinite_power}
+                                  : __adjusted_mantissa{0, 0};
+    int64_t __e = __n.__exponent;
+    int64_t __shift = __bitlen - (__mantissa_bits + 1);
+    if (__e + __shift < __min_exponent)
+        __shift = __min_exponent - __e;
+
+    if (__shift > 0)
+    {
+        if (__shift > 64)
+            return {0, 0};
+        const uint64_t __removed =
+            __shift == 64 ? __m : __m & ((uint64_t(1) << __shift) - 1);
+        const uint64_t __half = uint64_t(1) << (__shift - 1);
+        __m = __shift == 64 ? 0 : __m >> __shift;
+        __e += __shift;
+        if (__removed > __half ||
+            (__removed == __half && (__n.__truncated || (__m & 1))))
+            ++__m;
+        if (__m >> (__mantissa_bits + 1))
+        {
+            __m >>= 1;
+            ++__e;
+        }
+    }
+    else
+    {
+        __m <<= -__shift;
+        __e += __shift;
+    }
+
+    if (__m < (uint64_t(1) << __mantissa_bits))
+        return {__m, 0};
+    const int64_t __biased = __e + __mantissa_bits + _Tr::__bias;
+    if (__biased >= __infinite_power)
+        return {0, __infinite_power};
+    return {__m & ((uint64_t(1) << __mantissa_bits) - 1),
+            static_cast<int32_t>(__biased)};
+}
+
+template <class _Fp>
+_Fp
+__strto(const char* __s);
+
+template <>
+float
+__strto<float>(const char* __s)
+{
+    return strtof_l(__s, nullptr, _LIBCPP_GET_C_LOCALE);
+}
+
+template <>
+double
+__strto<double>(const char* __s)
+{
+    return strtod_l(__s, nullptr, _LIBCPP_GET_C_LOCALE);
+}
+
+#if LDBL_MANT_DIG != DBL_MANT_DIG
+template <>
+long double
+__strto<long double>(const char* __s)
+{
+    return strtold_l(__s, nullptr, _LIBCPP_GET_C_LOCALE);
+}
+#endif
+
+// Converts the subject sequence [__first, __last) with strtod.
+template <class _Fp>
+_Fp
+__from_chars_strtod(const char* __first, const char* __last, bool __hex)
+{
+    const size_t __n = static_cast<size_t>(__last - __first);
+    char __buf[256];
+    unique_ptr<char[]> __heap;
+    char* __s = __buf;
+    if (__n + 3 > sizeof(__buf))
+    {
+        __heap.reset(new char[__n + 3]);
+        __s = __heap.get();
+    }
+    char* __p = __s;
+    if (__hex)
+    {
+        *__p++ = '0';
+        *__p++ = 'x';
+    }
+    memcpy(__p, __first, __n);
+    __p[__n] = '\0';
+    return __strto<_Fp>(__s);
+}
+
+template <class _Fp>
+from_chars_result
+__from_chars_floating(const char* __first, const char* __last, _Fp& __value,
+                      chars_format __fmt)
+{
+    typedef __float_traits<_Fp> _Tr;
+    typedef typename _Tr::__bits_type _Bits;
+
+    const char* __p = __first;
+    const bool __negative = __p != __last && *__p == '-';
+    if (__negative)
+        ++__p;
+
+    from_chars_result __r;
+    if (__from_chars_special(__p, __last, __negative, __value, __r))
+        return __r;
+
+    const bool __hex = __fmt == chars_format::hex;
+    __number __n;
+    if (!(__hex ? __parse_hex(__p, __last, __n)
+                : __parse_decimal(__p, __last, __fmt, __n)))
+        return {__first, errc::invalid_argument};
+
+    _Fp __result;
+    if (__n.__mantissa == 0)
+        __result = 0;
+    else
+    {
+        __adjusted_mantissa __am;
+        if (__hex)
+            __am = __round_binary<_Fp>(__n);
+        else
+        {
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+            // Clinger's fast path: one correctly rounded operation on exact
+            // operands.
+            static const _Fp __pow10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,
+                                          1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                          1e12, 1e13, 1e14, 1e15, 1e16, 1e17,
+                                          1e18, 1e19, 1e20, 1e21, 1e22};
+            if (!__n.__truncated &&
+                -_Tr::__max_exponent_fast_path <= __n.__exponent &&
+                __n.__exponent <= _Tr::__max_exponent_fast_path &&
+                __n.__mantissa <= (uint64_t(2) << _Tr::__mantissa_bits))
+            {
+                __result = static_cast<_Fp>(__n.__mantissa);
+                if (__n.__exponent < 0)
+                    __result /= __pow10[-__n.__exponent];
+                else
+                    __result *= __pow10[__n.__exponent];
+                __value = __negative ? -__result : __result;
+                return {__n.__end, errc(0)};
+            }
+#endif
+            __am = __compute_float<_Fp>(__n.__exponent, __n.__mantissa);
+            // With truncated digits the value lies between w and w + 1;
+            // both must round to the same float.
+            if (__n.__truncated && __am.__power2 >= 0)
+            {
+                __adjusted_mantissa __up =
+                    __compute_float<_Fp>(__n.__exponent, __n.__mantissa + 1);
+                if (__up.__power2 != __am.__power2 ||
+                    __up.__mantissa != __am.__mantissa)
+                    __am.__power2 = -1;
+            }
+        }
+
+        if (__am.__power2 < 0)
+            __result = __from_chars_strtod<_Fp>(__p, __n.__end, __hex);
+        else
+            __result = __bit_cast_from_bits<_Fp>(
+                static_cast<_Bits>(__am.__mantissa |
+                                   (uint64_t(__am.__power2)
+                                    << _Tr::__mantissa_bits)));
+
+        // A non-zero number that rounds to zero or infinity is out of range.
+        if (__result == 0 || isinf(__result))
+            return {__n.__end, errc::result_out_of_range};
+    }
+    __value = __negative ? -__result : __result;
+    return {__n.__end, errc(0)};
+}
+
+#if LDBL_MANT_DIG != DBL_MANT_DIG
+
+from_chars_result
+__from_chars_long_double(const char* __first, const char* __last,
+                         long double& __value, chars_format __fmt)
+{
+    const char* __p = __first;
+    const bool __negative = __p != __last && *__p == '-';
+    if (__negative)
+        ++__p;
+
+    from_chars_result __r;
+    if (__from_chars_special(__p, __last, __negative, __value, __r))
+        return __r;
+
+    const bool __hex = __fmt == chars_format::hex;
+    __number __n;
+    if (!(__hex ? __parse_hex(__p, __last, __n)
+                : __parse_decimal(__p, __last, __fmt, __n)))
+        return {__first, errc::invalid_argument};
+
+    long double __result = 0;
+    if (__n.__mantissa != 0)
+    {
+        __result = __from_chars_strtod<long double>(__p, __n.__end, __hex);
+        if (__result == 0 || isinf(__result))
+            return {__n.__end, errc::result_out_of_range};
+    }
+    __value = __negative ? -__result : __result;
+    return {__n.__end, errc(0)};
+}
+
+#endif  // LDBL_MANT_DIG != DBL_MANT_DIG
+
+}  // namespace
+
+}  // namespace __charconv
+
+to_chars_result
+to_chars(char* __first, char* __last, float __value)
+{
+    return __charconv::__to_chars_shortest(__first, __last, __value,
+                                           chars_format{});
+}
+
+to_chars_result
+to_chars(char* __first, char* __last, double __value)
+{
+    return __charconv::__to_chars_shortest(__first, __last, __value,
+                                           chars_format{});
+}
+
+to_chars_result
+to_chars(char* __first, char* __last, long double __value)
+{
+    return to_chars(__first, __last, __value, chars_format{});
+}
+
+to_chars_result
+to_chars(char* __first, char* __last, float __value, chars_format __fmt)
+{
+    return __charconv::__to_chars_shortest(__first, __last, __value, __fmt);
+}
+
+to_chars_result
+to_chars(char* __first, char* __last, double __value, chars_format __fmt)
+{
+    return __charconv::__to_chars_shortest(__first, __last, __value, __fmt);
+}
+
+to_chars_result
+to_chars(char* __first, char* __last, long double __value, chars_format __fmt)
+{
+#if LDBL_MANT_DIG == DBL_MANT_DIG
+    return __charconv::__to_chars_shortest(__first, __last,
+                                           static_cast<double>(__value), __fmt);
+#else
+    return __charconv::__to_chars_shortest_long_double(__first, __last,
+                                                       __value, __fmt);
+#endif
+}
+
+to_chars_result
+to_chars(char* __first, char* __last, float __value, chars_format __fmt,
+         int __precision)
+{
+    return __charconv::__to_chars_printf(__first, __last,
+                                         static_cast<double>(__value), __fmt,
+                                         __precision);
+}
+
+to_chars_result
+to_chars(char* __first, char* __last, double __value, chars_format __fmt,
+         int __precision)
+{
+    return __charconv::__to_chars_printf(__first, __last, __value, __fmt,
+                                         __precision);
+}
+
+to_chars_result
+to_chars(char* __first, char* __last, long double __value, chars_format __fmt,
+         int __precision)
+{
+    return __charconv::__to_chars_printf(__first, __last, __value, __fmt,
+                                         __precision);
+}
+
+from_chars_result
+from_chars(const char* __first, const char* __last, float& __value,
+           chars_format __fmt)
+{
+    return __charconv::__from_chars_floating(__first, __last, __value, __fmt);
+}
+
+from_chars_result
+from_chars(const char* __first, const char* __last, double& __value,
+           chars_format __fmt)
+{
+    return __charconv::__from_chars_floating(__first, __last, __value, __fmt);
+}
+
+from_chars_result
+from_chars(const char* __first, const char* __last, long double& __value,
+           chars_format __fmt)
+{
+#if LDBL_MANT_DIG == DBL_MANT_DIG
+    double __d;
+    from_chars_result __r =
+        __charconv::__from_chars_floating(__first, __last, __d, __fmt);
+    if (__r.ec == errc())
+        __value = __d;
+    return __r;
+#else
+    return __charconv::__from_chars_long_double(__first, __last, __value,
+                                                __fmt);
+#endif
+}
+
+#endif  // _LIBCPP_STD_VER > 14
+
 _LIBCPP_END_NAMESPACE_STD
@@ -0,0 +1,223 @@
+//===------------------------- execution.cpp ------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "__config"
+#include "__parallel_backend"
+
+#if !defined(_LIBCPP_HAS_NO_THREADS) && \
+    !defined(_LIBCPP_HAS_PARALLEL_BACKEND_SERIAL) && \
+    !defined(_LIBCPP_HAS_PARALLEL_BACKEND_EXTERNAL)
+
+#include "atomic"
+#include "condition_variable"
+#include "memory"
+#include "mutex"
+#include "thread"
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+namespace __par_backend
+{
+
+namespace
+{
+
+// The built-in backend: a pool of worker threads, started on first use, which
+// run the chunks of one parallel algorithm at a time along with the calling
+// thread.
+//
+// Every participating thread owns a slot holding a range of chunk indices. The
+// chunks are split evenly between the slots when a job starts. A thread runs
+// the chunks at the front of its own range and, once it is empty, steals the
+// back half of the range of another thread. The job is over when all the
+// chunks have run and all the workers have left it.
+//
+// A parallel algorithm called while the pool is busy, e.g. from inside one of
+// the chunks, runs its chunks on the calling thread.
+class __pool
+{
+    struct alignas(64) __slot
+    {
+        mutex __m;
+        size_t __begin = 0;
+        size_t __end = 0;
+    };
+
+public:
+    static __pool& __instance()
+    {
+        // Never destroyed: the workers may be waiting for a job at exit.
+        static __pool* __p = new __pool;
+        return *__p;
+    }
+
+    unsigned __concurrency() const { return __nthreads_; }
+
+    void __run(size_t __n, void (*__fn)(void*, size_t), void* __ctx)
+    {
+        if (__nthreads_ == 1 || __busy_.exchange(true, memory_order_acquire))
+        {
+            for (size_t __i = 0; __i < __n; ++__i)
+                __fn(__ctx, __i);
+            return;
+        }
+        for (unsigned __t = 0; __t < __nthreads_; ++__t)
+        {
+            lock_guard<mutex> __lk(__slots_[__t].__m);
+            __slots_[__t].__begin = __n * __t / __nthreads_;
+            __slots_[__t].__end = __n * (__t + 1) / __nthreads_;
+        }
+        __remaining_.store(__n, memory_order_relaxed);
+        {
+            lock_guard<mutex> __lk(__m_);
+            __fn_ = __fn;
+            __ctx_ = __ctx;
+            ++__generation_;
+        }
+        __wake_cv_.notify_all();
+
+        __process(0, __fn, __ctx);
+
+        {
+            unique_lock<mutex> __lk(__m_);
+            __done_cv_.wait(__lk, [this] {
+                return __active_ == 0 &&
+                       __remaining_.load(memory_order_acquire) == 0;
+            });
+            // Late workers must not join the finished job.
+            __fn_ = nullptr;
+        }
+        __busy_.store(false, memory_order_release);
+    }
+
+private:
+    __pool()
+    {
+        unsigned __hw = thread::hardware_concurrency();
+        __nthreads_ = __hw == 0 ? 1 : __hw;
+        __slots_.reset(new __slot[__nthreads_]);
+        for (unsigned __t = 1; __t < __nthreads_; ++__t)
+            thread(&__pool::__worker, this, __t).detach();
+    }
+
+    void __worker(unsigned __self)
+    {
+        unsigned long long __seen = 0;
+        for (;;)
+        {
+            void (*__fn)(void*, size_t);
+            void* __ctx;
+            {
+                unique_lock<mutex> __lk(__m_);
+                __wake_cv_.wait(__lk, [&] {
+                    return __fn_ != nullptr && __generation_ != __seen;
+                });
+                __seen = __generation_;
+                __fn = __fn_;
+                __ctx = __ctx_;
+                ++__active_;
+            }
+            __process(__self, __fn, __ctx);
+            {
+                lock_guard<mutex> __lk(__m_);
+                --__active_;
+            }
+            __done_cv_.notify_all();
+        }
+    }
+
+    // Takes the first chunk of the range of slot __self.
+    bool __pop(unsigned __self, size_t& __i)
+    {
+        __slot& __s = __slots_[__self];
+        lock_guard<mutex> __lk(__s.__m);
+        if (__s.__begin == __s.__end)
+            return false;
+        __i = __s.__begin++;
+        return true;
+    }
+
+    // Moves the back half of the range of another slot to slot __self.
+    bool __steal(unsigned __self)
+    {
+        for (unsigned __k = 1; __k < __nthreads_; ++__k)
+        {
+            __slot& __victim = __slots_[(__self + __k) % __nthreads_];
+            size_t __begin, __end;
+            {
+                lock_guard<mutex> __lk(__victim.__m);
+                size_t __size = __victim.__end - __victim.__begin;
+                if (__size == 0)
+                    continue;
+                __begin = __victim.__end - (__size + 1) / 2;
+                __end = __victim.__end;
+                __victim.__end = __begin;
+            }
+            __slot& __s = __slots_[__self];
+            lock_guard<mutex> __lk(__s.__m);
+            __s.__begin = __begin;
+            __s.__end = __end;
+            return true;
+        }
+        return false;
+    }
+
+    void __process(unsigned __self, void (*__fn)(void*, size_t),
+                   void* __ctx) _NOEXCEPT
+    {
+        for (;;)
+        {
+            size_t __i;
+            while (__pop(__self, __i))
+            {
+                __fn(__ctx, __i);
+                if (__remaining_.fetch_sub(1, memory_order_acq_rel) == 1)
+                {
+                    // Make sure the caller is either not waiting yet or woken.
+                    lock_guard<mutex> __lk(__m_);
+                    __done_cv_.notify_all();
+                }
+            }
+            if (!__steal(__self))
+                return;
+        }
+    }
+
+    unsigned __nthreads_;
+    unique_ptr<__slot[]> __slots_;
+    atomic<bool> __busy_{false};
+    atomic<size_t> __remaining_{0};
+
+    // Protects the fields below.
+    mutex __m_;
+    condition_variable __wake_cv_;
+    condition_variable __done_cv_;
+    void (*__fn_)(void*, size_t) = nullptr;
+    void* __ctx_ = nullptr;
+    unsigned long long __generation_ = 0;
+    unsigned __active_ = 0;
+};
+
+} // namespace
+
+unsigned __concurrency() _NOEXCEPT
+{
+    return __pool::__instance().__concurrency();
+}
+
+void __run(size_t __n, void (*__fn)(void*, size_t), void* __ctx) _NOEXCEPT
+{
+    __pool::__instance().__run(__n, __fn, __ctx);
+}
+
+} // namespace __par_backend
+
+_LIBCPP_END_NAMESPACE_STD
+
+#endif
@@ -0,0 +1,1446 @@
+//===------------------------ charconv_tables.h ---------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCPP_CHARCONV_TABLES_H
+#define _LIBCPP_CHARCONV_TABLES_H
+
+#include <stdint.h>
+
+// Powers of five used by the floating-point conversions in charconv.cpp.
+// Multi-word entries are stored least significant word first.
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+namespace __charconv
+{
+
+// Ryu [Adams, PLDI 2018], double: floor(2^(pow5bits(q) - 1 + 125) / 5^q) + 1
+// for 0 <= q < 342.
+static const uint64_t __double_pow5_inv_split[342][2] = {
+    {UINT64_C(1), UINT64_C(2305843009213693952)},
+    {UINT64_C(11068046444225730970), UINT64_C(1844674407370955161)},
+    {UINT64_C(5165088340638674453), UINT64_C(1475739525896764129)},
+    {UINT64_C(7821419487252849886), UINT64_C(1180591620717411303)},
+    {UINT64_C(8824922364862649494), UINT64_C(1888946593147858085)},
+    {UINT64_C(7059937891890119595), UINT64_C(1511157274518286468)},
+    {UINT64_C(13026647942995916322), UINT64_C(1208925819614629174)},
+    {UINT64_C(9774590264567735146), UINT64_C(1934281311383406679)},
+    {UINT64_C(11509021026396098440), UINT64_C(1547425049106725343)},
+    {UINT64_C(16585914450600699399), UINT64_C(1237940039285380274)},
+    {UINT64_C(15469416676735388068), UINT64_C(1980704062856608439)},
+    {UINT64_C(16064882156130220778), UINT64_C(1584563250285286751)},
+    {UINT64_C(9162556910162266299), UINT64_C(1267650600228229401)},
+    {UINT64_C(7281393426775805432), UINT64_C(2028240960365167042)},
+    {UINT64_C(16893161185646375315), UINT64_C(1622592768292133633)},
+    {UINT64_C(2446482504291369283), UINT64_C(1298074214633706907)},
+    {UINT64_C(7603720821608101175), UINT64_C(2076918743413931051)},
+    {UINT64_C(2393627842544570617), UINT64_C(1661534994731144841)},
+    {UINT64_C(16672297533003297786), UINT64_C(1329227995784915872)},
+    {UINT64_C(11918280793837635165), UINT64_C(2126764793255865396)},
+    {UINT64_C(5845275820328197809), UINT64_C(1701411834604692317)},
+    {UINT64_C(15744267100488289217), UINT64_C(1361129467683753853)},
+    {UINT64_C(3054734472329800808), UINT64_C(2177807148294006166)},
+    {UINT64_C(17201182836831481939), UINT64_C(1742245718635204932)},
+    {UINT64_C(6382248639981364905), UINT64_C(1393796574908163946)},
+    {UINT64_C(2832900194486363201), UINT64_C(2230074519853062314)},
+    {UINT64_C(5955668970331000884), UINT64_C(1784059615882449851)},
+    {UINT64_C(1075186361522890384), UINT64_C(1427247692705959881)},
+    {UINT64_C(12788344622662355584), UINT64_C(2283596308329535809)},
+    {UINT64_C(13920024512871794791), UINT64_C(1826877046663628647)},
+    {UINT64_C(3757321980813615186), UINT64_C(1461501637330902918)},
+    {UINT64_C(10384555214134712795), UINT64_C(1169201309864722334)},
+    {UINT64_C(5547241898389809503), UINT64_C(1870722095783555735)},
+    {UINT64_C(4437793518711847602), UINT64_C(1496577676626844588)},
+    {UINT64_C(10928932444453298728), UINT64_C(1197262141301475670)},
+    {UINT64_C(17486291911125277965), UINT64_C(1915619426082361072)},
+    {UINT64_C(6610335899416401726), UINT64_C(1532495540865888858)},
+    {UINT64_C(12666966349016942027), UINT64_C(1225996432692711086)},
+    {UINT64_C(12888448528943286597), UINT64_C(1961594292308337738)},
+    {UINT64_C(17689456452638449924), UINT64_C(1569275433846670190)},
+    {UINT64_C(14151565162110759939), UINT64_C(1255420347077336152)},
+    {UINT64_C(7885109000409574610), UINT64_C(2008672555323737844)},
+    {UINT64_C(9997436015069570011), UINT64_C(1606938044258990275)},
+    {UINT64_C(7997948812055656009), UINT64_C(1285550435407192220)},
+    {UINT64_C(12796718099289049614), UINT64_C(2056880696651507552)},
+    {UINT64_C(2858676849947419045), UINT64_C(1645504557321206042)},
+    {UINT64_C(13354987924183666206), UINT64_C(1316403645856964833)},
+    {UINT64_C(17678631863951955605), UINT64_C(2106245833371143733)},
+    {UINT64_C(3074859046935833515), UINT64_C(1684996666696914987)},
+    {UINT64_C(13527933681774397782), UINT64_C(1347997333357531989)},
+    {UINT64_C(10576647446613305481), UINT64_C(2156795733372051183)},
+    {UINT64_C(15840015586774465031), UINT64_C(1725436586697640946)},
+    {UINT64_C(8982663654677661702), UINT64_C(1380349269358112757)},
+    {UINT64_C(18061610662226169046), UINT64_C(2208558830972980411)},
+    {UINT64_C(10759939715039024913), UINT64_C(1766847064778384329)},
+    {UINT64_C(12297300586773130254), UINT64_C(1413477651822707463)},
+    {UINT64_C(15986332124095098083), UINT64_C(2261564242916331941)},
+    {UINT64_C(9099716884534168143), UINT64_C(1809251394333065553)},
+    {UINT64_C(14658471137111155161), UINT64_C(1447401115466452442)},
+    {UINT64_C(4348079280205103483), UINT64_C(1157920892373161954)},
+    {UINT64_C(14335624477811986218), UINT64_C(1852673427797059126)},
+    {UINT64_C(7779150767507678651), UINT64_C(1482138742237647301)},
+    {UINT64_C(2533971799264232598), UINT64_C(1185710993790117841)},
+    {UINT64_C(15122401323048503126), UINT64_C(1897137590064188545)},
+    {UINT64_C(12097921058438802501), UINT64_C(1517710072051350836)},
+    {UINT64_C(5988988032009131678), UINT64_C(1214168057641080669)},
+    {UINT64_C(16961078480698431330), UINT64_C(1942668892225729070)},
+    {UINT64_C(13568862784558745064), UINT64_C(1554135113780583256)},
+    {UINT64_C(7165741412905085728), UINT64_C(1243308091024466605)},
+    {UINT64_C(11465186260648137165), UINT64_C(1989292945639146568)},
+    {UINT64_C(16550846638002330379), UINT64_C(1591434356511317254)},
+    {UINT64_C(16930026125143774626), UINT64_C(1273147485209053803)},
+    {UINT64_C(4951948911778577463), UINT64_C(2037035976334486086)},
+    {UINT64_C(272210314680951647), UINT64_C(1629628781067588869)},
+    {UINT64_C(3907117066486671641), UINT64_C(1303703024854071095)},
+    {UINT64_C(6251387306378674625), UINT64_C(2085924839766513752)},
+    {UINT64_C(16069156289328670670), UINT64_C(1668739871813211001)},
+    {UINT64_C(9165976216721026213), UINT64_C(1334991897450568801)},
+    {UINT64_C(7286864317269821294), UINT64_C(2135987035920910082)},
+    {UINT64_C(16897537898041588005), UINT64_C(1708789628736728065)},
+    {UINT64_C(13518030318433270404), UINT64_C(1367031702989382452)},
+    {UINT64_C(6871453250525591353), UINT64_C(2187250724783011924)},
+    {UINT64_C(9186511415162383406), UINT64_C(1749800579826409539)},
+    {UINT64_C(11038557946871817048), UINT64_C(1399840463861127631)},
+    {UINT64_C(10282995085511086630), UINT64_C(2239744742177804210)},
+    {UINT64_C(8226396068408869304), UINT64_C(1791795793742243368)},
+    {UINT64_C(13959814484210916090), UINT64_C(1433436634993794694)},
+    {UINT64_C(11267656730511734774), UINT64_C(2293498615990071511)},
+    {UINT64_C(5324776569667477496), UINT64_C(1834798892792057209)},
+    {UINT64_C(7949170070475892320), UINT64_C(1467839114233645767)},
+    {UINT64_C(17427382500606444826), UINT64_C(1174271291386916613)},
+    {UINT64_C(5747719112518849781), UINT64_C(1878834066219066582)},
+    {UINT64_C(15666221734240810795), UINT64_C(1503067252975253265)},
+    {UINT64_C(12532977387392648636), UINT64_C(1202453802380202612)},
+    {UINT64_C(5295368560860596524), UINT64_C(1923926083808324180)},
+    {UINT64_C(4236294848688477220), UINT64_C(1539140867046659344)},
+    {UINT64_C(7078384693692692099), UINT64_C(1231312693637327475)},
+    {UINT64_C(11325415509908307358), UINT64_C(1970100309819723960)},
+    {UINT64_C(9060332407926645887), UINT64_C(1576080247855779168)},
+    {UINT64_C(14626963555825137356), UINT64_C(1260864198284623334)},
+    {UINT64_C(12335095245094488799), UINT64_C(2017382717255397335)},
+    {UINT64_C(9868076196075591040), UINT64_C(1613906173804317868)},
+    {UINT64_C(15273158586344293478), UINT64_C(1291124939043454294)},
+    {UINT64_C(13369007293925138595), UINT64_C(2065799902469526871)},
+    {UINT64_C(7005857020398200553), UINT64_C(1652639921975621497)},
+    {UINT64_C(16672732060544291412), UINT64_C(1322111937580497197)},
+    {UINT64_C(11918976037903224966), UINT64_C(2115379100128795516)},
+    {UINT64_C(5845832015580669650), UINT64_C(1692303280103036413)},
+    {UINT64_C(12055363241948356366), UINT64_C(1353842624082429130)},
+    {UINT64_C(841837113407818570), UINT64_C(2166148198531886609)},
+    {UINT64_C(4362818505468165179), UINT64_C(1732918558825509287)},
+    {UINT64_C(14558301248600263113), UINT64_C(1386334847060407429)},
+    {UINT64_C(12225235553534690011), UINT64_C(2218135755296651887)},
+    {UINT64_C(2401490813343931363), UINT64_C(1774508604237321510)},
+    {UINT64_C(1921192650675145090), UINT64_C(1419606883389857208)},
+    {UINT64_C(17831303500047873437), UINT64_C(2271371013423771532)},
+    {UINT64_C(6886345170554478103), UINT64_C(1817096810739017226)},
+    {UINT64_C(1819727321701672159), UINT64_C(1453677448591213781)},
+    {UINT64_C(16213177116328979020), UINT64_C(1162941958872971024)},
+    {UINT64_C(14873036941900635463), UINT64_C(1860707134196753639)},
+    {UINT64_C(15587778368262418694), UINT64_C(1488565707357402911)},
+    {UINT64_C(8780873879868024632), UINT64_C(1190852565885922329)},
+    {UINT64_C(2981351763563108441), UINT64_C(1905364105417475727)},
+    {UINT64_C(13453127855076217722), UINT64_C(1524291284333980581)},
+    {UINT64_C(7073153469319063855), UINT64_C(1219433027467184465)},
+    {UINT64_C(11317045550910502167), UINT64_C(1951092843947495144)},
+    {UINT64_C(12742985255470312057), UINT64_C(1560874275157996115)},
+    {UINT64_C(10194388204376249646), UINT64_C(1248699420126396892)},
+    {UINT64_C(1553625868034358140), UINT64_C(1997919072202235028)},
+    {UINT64_C(8621598323911307159), UINT64_C(1598335257761788022)},
+    {UINT64_C(17965325103354776697), UINT64_C(1278668206209430417)},
+    {UINT64_C(13987124906400001422), UINT64_C(2045869129935088668)},
+    {UINT64_C(121653480894270168), UINT64_C(1636695303948070935)},
+    {UINT64_C(97322784715416134), UINT64_C(1309356243158456748)},
+    {UINT64_C(14913111714512307107), UINT64_C(2094969989053530796)},
+    {UINT64_C(8241140556867935363), UINT64_C(1675975991242824637)},
+    {UINT64_C(17660958889720079260), UINT64_C(1340780792994259709)},
+    {UINT64_C(17189487779326395846), UINT64_C(2145249268790815535)},
+    {UINT64_C(13751590223461116677), UINT64_C(1716199415032652428)},
+    {UINT64_C(18379969808252713988), UINT64_C(1372959532026121942)},
+    {UINT64_C(14650556434236701088), UINT64_C(2196735251241795108)},
+    {UINT64_C(652398703163629901), UINT64_C(1757388200993436087)},
+    {UINT64_C(11589965406756634890), UINT64_C(1405910560794748869)},
+    {UINT64_C(7475898206584884855), UINT64_C(2249456897271598191)},
+    {UINT64_C(2291369750525997561), UINT64_C(1799565517817278553)},
+    {UINT64_C(9211793429904618695), UINT64_C(1439652414253822842)},
+    {UINT64_C(18428218302589300235), UINT64_C(2303443862806116547)},
+    {UINT64_C(7363877012587619542), UINT64_C(1842755090244893238)},
+    {UINT64_C(13269799239553916280), UINT64_C(1474204072195914590)},
+    {UINT64_C(10615839391643133024), UINT64_C(1179363257756731672)},
+    {UINT64_C(2227947767661371545), UINT64_C(1886981212410770676)},
+    {UINT64_C(16539753473096738529), UINT64_C(1509584969928616540)},
+    {UINT64_C(13231802778477390823), UINT64_C(1207667975942893232)},
+    {UINT64_C(6413489186596184024), UINT64_C(1932268761508629172)},
+    {UINT64_C(16198837793502678189), UINT64_C(1545815009206903337)},
+    {UINT64_C(5580372605318321905), UINT64_C(1236652007365522670)},
+    {UINT64_C(8928596168509315048), UINT64_C(1978643211784836272)},
+    {UINT64_C(18210923379033183008), UINT64_C(1582914569427869017)},
+    {UINT64_C(7190041073742725760), UINT64_C(1266331655542295214)},
+    {UINT64_C(436019273762630246), UINT64_C(2026130648867672343)},
+    {UINT64_C(7727513048493924843), UINT64_C(1620904519094137874)},
+    {UINT64_C(9871359253537050198), UINT64_C(1296723615275310299)},
+    {UINT64_C(4726128361433549347), UINT64_C(2074757784440496479)},
+    {UINT64_C(7470251503888749801), UINT64_C(1659806227552397183)},
+    {UINT64_C(13354898832594820487), UINT64_C(1327844982041917746)},
+    {UINT64_C(13989140502667892133), UINT64_C(2124551971267068394)},
+    {UINT64_C(14880661216876224029), UINT64_C(1699641577013654715)},
+    {UINT64_C(11904528973500979224), UINT64_C(1359713261610923772)},
+    {UINT64_C(4289851098633925465), UINT64_C(2175541218577478036)},
+    {UINT64_C(18189276137874781665), UINT64_C(1740432974861982428)},
+    {UINT64_C(3483374466074094362), UINT64_C(1392346379889585943)},
+    {UINT64_C(1884050330976640656), UINT64_C(2227754207823337509)},
+    {UINT64_C(5196589079523222848), UINT64_C(1782203366258670007)},
+    {UINT64_C(15225317707844309248), UINT64_C(1425762693006936005)},
+    {UINT64_C(5913764258841343181), UINT64_C(2281220308811097609)},
+    {UINT64_C(8420360221814984868), UINT64_C(1824976247048878087)},
+    {UINT64_C(17804334621677718864), UINT64_C(1459980997639102469)},
+    {UINT64_C(17932816512084085415), UINT64_C(1167984798111281975)},
+    {UINT64_C(10245762345624985047), UINT64_C(1868775676978051161)},
+    {UINT64_C(4507261061758077715), UINT64_C(1495020541582440929)},
+    {UINT64_C(7295157664148372495), UINT64_C(1196016433265952743)},
+    {UINT64_C(7982903447895485668), UINT64_C(1913626293225524389)},
+    {UINT64_C(10075671573058298858), UINT64_C(1530901034580419511)},
+    {UINT64_C(4371188443704728763), UINT64_C(1224720827664335609)},
+    {UINT64_C(14372599139411386667), UINT64_C(1959553324262936974)},
+    {UINT64_C(15187428126271019657), UINT64_C(1567642659410349579)},
+    {UINT64_C(15839291315758726049), UINT64_C(1254114127528279663)},
+    {UINT64_C(3206773216762499739), UINT64_C(2006582604045247462)},
+    {UINT64_C(13633465017635730761), UINT64_C(1605266083236197969)},
+    {UINT64_C(14596120828850494932), UINT64_C(1284212866588958375)},
+    {UINT64_C(4907049252451240275), UINT64_C(2054740586542333401)},
+    {UINT64_C(236290587219081897), UINT64_C(1643792469233866721)},
+    {UINT64_C(14946427728742906810), UINT64_C(1315033975387093376)},
+    {UINT64_C(16535586736504830250), UINT64_C(2104054360619349402)},
+    {UINT64_C(5849771759720043554), UINT64_C(1683243488495479522)},
+    {UINT64_C(15747863852001765813), UINT64_C(1346594790796383617)},
+    {UINT64_C(10439186904235184007), UINT64_C(2154551665274213788)},
+    {UINT64_C(15730047152871967852), UINT64_C(1723641332219371030)},
+    {UINT64_C(12584037722297574282), UINT64_C(1378913065775496824)},
+    {UINT64_C(9066413911450387881), UINT64_C(2206260905240794919)},
+    {UINT64_C(10942479943902220628), UINT64_C(1765008724192635935)},
+    {UINT64_C(8753983955121776503), UINT64_C(1412006979354108748)},
+    {UINT64_C(10317025513452932081), UINT64_C(2259211166966573997)},
+    {UINT64_C(874922781278525018), UINT64_C(1807368933573259198)},
+    {UINT64_C(8078635854506640661), UINT64_C(1445895146858607358)},
+    {UINT64_C(13841606313089133175), UINT64_C(1156716117486885886)},
+    {UINT64_C(14767872471458792434), UINT64_C(1850745787979017418)},
+    {UINT64_C(746251532941302978), UINT64_C(1480596630383213935)},
+    {UINT64_C(597001226353042382), UINT64_C(1184477304306571148)},
+    {UINT64_C(15712597221132509104), UINT64_C(1895163686890513836)},
+    {UINT64_C(8880728962164096960), UINT64_C(1516130949512411069)},
+    {UINT64_C(10793931984473187891), UINT64_C(1212904759609928855)},
+    {UINT64_C(17270291175157100626), UINT64_C(1940647615375886168)},
+    {UINT64_C(2748186495899949531), UINT64_C(1552518092300708935)},
+    {UINT64_C(2198549196719959625), UINT64_C(1242014473840567148)},
+    {UINT64_C(18275073973719576693), UINT64_C(1987223158144907436)},
+    {UINT64_C(10930710364233751031), UINT64_C(1589778526515925949)},
+    {UINT64_C(12433917106128911148), UINT64_C(1271822821212740759)},
+    {UINT64_C(8826220925580526867), UINT64_C(2034916513940385215)},
+    {UINT64_C(7060976740464421494), UINT64_C(1627933211152308172)},
+    {UINT64_C(16716827836597268165), UINT64_C(1302346568921846537)},
+    {UINT64_C(11989529279587987770), UINT64_C(2083754510274954460)},
+    {UINT64_C(9591623423670390216), UINT64_C(1667003608219963568)},
+    {UINT64_C(15051996368420132820), UINT64_C(1333602886575970854)},
+    {UINT64_C(13015147745246481542), UINT64_C(2133764618521553367)},
+    {UINT64_C(3033420566713364587), UINT64_C(1707011694817242694)},
+    {UINT64_C(6116085268112601993), UINT64_C(1365609355853794155)},
+    {UINT64_C(9785736428980163188), UINT64_C(2184974969366070648)},
+    {UINT64_C(15207286772667951197), UINT64_C(1747979975492856518)},
+    {UINT64_C(1097782973908629988), UINT64_C(1398383980394285215)},
+    {UINT64_C(1756452758253807981), UINT64_C(2237414368630856344)},
+    {UINT64_C(5094511021344956708), UINT64_C(1789931494904685075)},
+    {UINT64_C(4075608817075965366), UINT64_C(1431945195923748060)},
+    {UINT64_C(6520974107321544586), UINT64_C(2291112313477996896)},
+    {UINT64_C(1527430471115325346), UINT64_C(1832889850782397517)},
+    {UINT64_C(12289990821117991246), UINT64_C(1466311880625918013)},
+    {UINT64_C(17210690286378213644), UINT64_C(1173049504500734410)},
+    {UINT64_C(9090360384495590213), UINT64_C(1876879207201175057)},
+    {UINT64_C(18340334751822203140), UINT64_C(1501503365760940045)},
+    {UINT64_C(14672267801457762512), UINT64_C(1201202692608752036)},
+    {UINT64_C(16096930852848599373), UINT64_C(1921924308174003258)},
+    {UINT64_C(1809498238053148529), UINT64_C(1537539446539202607)},
+    {UINT64_C(12515645034668249793), UINT64_C(1230031557231362085)},
+    {UINT64_C(1578287981759648052), UINT64_C(1968050491570179337)},
+    {UINT64_C(12330676829633449412), UINT64_C(1574440393256143469)},
+    {UINT64_C(13553890278448669853), UINT64_C(1259552314604914775)},
+    {UINT64_C(3239480371808320148), UINT64_C(2015283703367863641)},
+    {UINT64_C(17348979556414297411), UINT64_C(1612226962694290912)},
+    {UINT64_C(6500486015647617283), UINT64_C(1289781570155432730)},
+    {UINT64_C(10400777625036187652), UINT64_C(2063650512248692368)},
+    {UINT64_C(15699319729512770768), UINT64_C(1650920409798953894)},
+    {UINT64_C(16248804598352126938), UINT64_C(1320736327839163115)},
+    {UINT64_C(7551343283653851484), UINT64_C(2113178124542660985)},
+    {UINT64_C(6041074626923081187), UINT64_C(1690542499634128788)},
+    {UINT64_C(12211557331022285596), UINT64_C(1352433999707303030)},
+    {UINT64_C(1091747655926105338), UINT64_C(2163894399531684849)},
+    {UINT64_C(4562746939482794594), UINT64_C(1731115519625347879)},
+    {UINT64_C(7339546366328145998), UINT64_C(1384892415700278303)},
+    {UINT64_C(8053925371383123274), UINT64_C(2215827865120445285)},
+    {UINT64_C(6443140297106498619), UINT64_C(1772662292096356228)},
+    {UINT64_C(12533209867169019542), UINT64_C(1418129833677084982)},
+    {UINT64_C(5295740528502789974), UINT64_C(2269007733883335972)},
+    {UINT64_C(15304638867027962949), UINT64_C(1815206187106668777)},
+    {UINT64_C(4865013464138549713), UINT64_C(1452164949685335022)},
+    {UINT64_C(14960057215536570740), UINT64_C(1161731959748268017)},
+    {UINT64_C(9178696285890871890), UINT64_C(1858771135597228828)},
+    {UINT64_C(14721654658196518159), UINT64_C(1487016908477783062)},
+    {UINT64_C(4398626097073393881), UINT64_C(1189613526782226450)},
+    {UINT64_C(7037801755317430209), UINT64_C(1903381642851562320)},
+    {UINT64_C(5630241404253944167), UINT64_C(1522705314281249856)},
+    {UINT64_C(814844308661245011), UINT64_C(1218164251424999885)},
+    {UINT64_C(1303750893857992017), UINT64_C(1949062802279999816)},
+    {UINT64_C(15800395974054034906), UINT64_C(1559250241823999852)},
+    {UINT64_C(5261619149759407279), UINT64_C(1247400193459199882)},
+    {UINT64_C(12107939454356961969), UINT64_C(1995840309534719811)},
+    {UINT64_C(5997002748743659252), UINT64_C(1596672247627775849)},
+    {UINT64_C(8486951013736837725), UINT64_C(1277337798102220679)},
+    {UINT64_C(2511075177753209390), UINT64_C(2043740476963553087)},
+    {UINT64_C(13076906586428298482), UINT64_C(1634992381570842469)},
+    {UINT64_C(14150874083884549109), UINT64_C(1307993905256673975)},
+    {UINT64_C(4194654460505726958), UINT64_C(2092790248410678361)},
+    {UINT64_C(18113118827372222859), UINT64_C(1674232198728542688)},
+    {UINT64_C(3422448617672047318), UINT64_C(1339385758982834151)},
+    {UINT64_C(16543964232501006678), UINT64_C(2143017214372534641)},
+    {UINT64_C(9545822571258895019), UINT64_C(1714413771498027713)},
+    {UINT64_C(15015355686490936662), UINT64_C(1371531017198422170)},
+    {UINT64_C(5577825024675947042), UINT64_C(2194449627517475473)},
+    {UINT64_C(11840957649224578280), UINT64_C(1755559702013980378)},
+    {UINT64_C(16851463748863483271), UINT64_C(1404447761611184302)},
+    {UINT64_C(12204946739213931940), UINT64_C(2247116418577894884)},
+    {UINT64_C(13453306206113055875), UINT64_C(1797693134862315907)},
+    {UINT64_C(3383947335406624054), UINT64_C(1438154507889852726)},
+    {UINT64_C(16482362180876329456), UINT64_C(2301047212623764361)},
+    {UINT64_C(9496540929959153242), UINT64_C(1840837770099011489)},
+    {UINT64_C(11286581558709232917), UINT64_C(1472670216079209191)},
+    {UINT64_C(5339916432225476010), UINT64_C(1178136172863367353)},
+    {UINT64_C(4854517476818851293), UINT64_C(1885017876581387765)},
+    {UINT64_C(3883613981455081034), UINT64_C(1508014301265110212)},
+    {UINT64_C(14174937629389795797), UINT64_C(1206411441012088169)},
+    {UINT64_C(11611853762797942306), UINT64_C(1930258305619341071)},
+    {UINT64_C(5600134195496443521), UINT64_C(1544206644495472857)},
+    {UINT64_C(15548153800622885787), UINT64_C(1235365315596378285)},
+    {UINT64_C(6430302007287065643), UINT64_C(1976584504954205257)},
+    {UINT64_C(16212288050055383484), UINT64_C(1581267603963364205)},
+    {UINT64_C(12969830440044306787), UINT64_C(1265014083170691364)},
+    {UINT64_C(9683682259845159889), UINT64_C(2024022533073106183)},
+    {UINT64_C(15125643437359948558), UINT64_C(1619218026458484946)},
+    {UINT64_C(8411165935146048523), UINT64_C(1295374421166787957)},
+    {UINT64_C(17147214310975587960), UINT64_C(2072599073866860731)},
+    {UINT64_C(10028422634038560045), UINT64_C(1658079259093488585)},
+    {UINT64_C(8022738107230848036), UINT64_C(1326463407274790868)},
+    {UINT64_C(9147032156827446534), UINT64_C(2122341451639665389)},
+    {UINT64_C(11006974540203867551), UINT64_C(1697873161311732311)},
+    {UINT64_C(5116230817421183718), UINT64_C(1358298529049385849)},
+    {UINT64_C(15564666937357714594), UINT64_C(2173277646479017358)},
+    {UINT64_C(1383687105660440706), UINT64_C(1738622117183213887)},
+    {UINT64_C(12174996128754083534), UINT64_C(1390897693746571109)},
+    {UINT64_C(8411947361780802685), UINT64_C(2225436309994513775)},
+    {UINT64_C(6729557889424642148), UINT64_C(1780349047995611020)},
+    {UINT64_C(5383646311539713719), UINT64_C(1424279238396488816)},
+    {UINT64_C(1235136468979721303), UINT64_C(2278846781434382106)},
+    {UINT64_C(15745504434151418335), UINT64_C(1823077425147505684)},
+    {UINT64_C(16285752362063044992), UINT64_C(1458461940118004547)},
+    {UINT64_C(5649904260166615347), UINT64_C(1166769552094403638)},
+    {UINT64_C(5350498001524674232), UINT64_C(1866831283351045821)},
+    {UINT64_C(591049586477829062), UINT64_C(1493465026680836657)},
+    {UINT64_C(11540886113407994219), UINT64_C(1194772021344669325)},
+    {UINT64_C(18673707743239135), UINT64_C(1911635234151470921)},
+    {UINT64_C(14772334225162232601), UINT64_C(1529308187321176736)},
+    {UINT64_C(8128518565387875758), UINT64_C(1223446549856941389)},
+    {UINT64_C(1937583260394870242), UINT64_C(1957514479771106223)},
+    {UINT64_C(8928764237799716840), UINT64_C(1566011583816884978)},
+    {UINT64_C(14521709019723594119), UINT64_C(1252809267053507982)},
+    {UINT64_C(8477339172590109297), UINT64_C(2004494827285612772)},
+    {UINT64_C(17849917782297818407), UINT64_C(1603595861828490217)},
+    {UINT64_C(6901236596354434079), UINT64_C(1282876689462792174)},
+    {UINT64_C(18420676183650915173), UINT64_C(2052602703140467478)},
+    {UINT64_C(3668494502695001169), UINT64_C(1642082162512373983)},
+    {UINT64_C(10313493231639821582), UINT64_C(1313665730009899186)},
+    {UINT64_C(9122891541139893884), UINT64_C(2101865168015838698)},
+    {UINT64_C(14677010862395735754), UINT64_C(1681492134412670958)},
+    {UINT64_C(673562245690857633), UINT64_C(1345193707530136767)},
+};
+
+// Ryu, double: 5^i scaled to exactly 125 bits, for 0 <= i < 326.
+static const uint64_t __double_pow5_split[326][2] = {
+    {UINT64_C(0), UINT64_C(1152921504606846976)},
+    {UINT64_C(0), UINT64_C(1441151880758558720)},
+    {UINT64_C(0), UINT64_C(1801439850948198400)},
+    {UINT64_C(0), UINT64_C(2251799813685248000)},
+    {UINT64_C(0), UINT64_C(1407374883553280000)},
+    {UINT64_C(0), UINT64_C(1759218604441600000)},
+    {UINT64_C(0), UINT64_C(2199023255552000000)},
+    {UINT64_C(0), UINT64_C(1374389534720000000)},
+    {UINT64_C(0), UINT64_C(1717986918400000000)},
+    {UINT64_C(0), UINT64_C(2147483648000000000)},
+    {UINT64_C(0), UINT64_C(1342177280000000000)},
+    {UINT64_C(0), UINT64_C(1677721600000000000)},
+    {UINT64_C(0), UINT64_C(2097152000000000000)},
+    {UINT64_C(0), UINT64_C(1310720000000000000)},
+    {UINT64_C(0), UINT64_C(1638400000000000000)},
+    {UINT64_C(0), UINT64_C(2048000000000000000)},
+    {UINT64_C(0), UINT64_C(1280000000000000000)},
+    {UINT64_C(0), UINT64_C(1600000000000000000)},
+    {UINT64_C(0), UINT64_C(2000000000000000000)},
+    {UINT64_C(0), UINT64_C(1250000000000000000)},
+    {UINT64_C(0), UINT64_C(1562500000000000000)},
+    {UINT64_C(0), UINT64_C(1953125000000000000)},
+    {UINT64_C(0), UINT64_C(1220703125000000000)},
+    {UINT64_C(0), UINT64_C(1525878906250000000)},
+    {UINT64_C(0), UINT64_C(1907348632812500000)},
+    {UINT64_C(0), UINT64_C(1192092895507812500)},
+    {UINT64_C(0), UINT64_C(1490116119384765625)},
+    {UINT64_C(4611686018427387904), UINT64_C(1862645149230957031)},
+    {UINT64_C(9799832789158199296), UINT64_C(1164153218269348144)},
+    {UINT64_C(12249790986447749120), UINT64_C(1455191522836685180)},
+    {UINT64_C(15312238733059686400), UINT64_C(1818989403545856475)},
+    {UINT64_C(14528612397897220096), UINT64_C(2273736754432320594)},
+    {UINT64_C(13692068767113150464), UINT64_C(1421085471520200371)},
+    {UINT64_C(12503399940464050176), UINT64_C(1776356839400250464)},
+    {UINT64_C(15629249925580062720), UINT64_C(2220446049250313080)},
+    {UINT64_C(9768281203487539200), UINT64_C(1387778780781445675)},
+    {UINT64_C(7598665485932036096), UINT64_C(1734723475976807094)},
+    {UINT64_C(274959820560269312), UINT64_C(2168404344971008868)},
+    {UINT64_C(9395221924704944128), UINT64_C(1355252715606880542)},
+    {UINT64_C(2520655369026404352), UINT64_C(1694065894508600678)},
+    {UINT64_C(12374191248137781248), UINT64_C(2117582368135750847)},
+    {UINT64_C(14651398557727195136), UINT64_C(1323488980084844279)},
+    {UINT64_C(13702562178731606016), UINT64_C(1654361225106055349)},
+    {UINT64_C(3293144668132343808), UINT64_C(2067951531382569187)},
+    {UINT64_C(18199116482078572544), UINT64_C(1292469707114105741)},
+    {UINT64_C(8913837547316051968), UINT64_C(1615587133892632177)},
+    {UINT64_C(15753982952572452864), UINT64_C(2019483917365790221)},
+    {UINT64_C(12152082354571476992), UINT64_C(1262177448353618888)},
+    {UINT64_C(15190102943214346240), UINT64_C(1577721810442023610)},
+    {UINT64_C(9764256642163156992), UINT64_C(1972152263052529513)},
+    {UINT64_C(17631875447420442880), UINT64_C(1232595164407830945)},
+    {UINT64_C(8204786253993389888), UINT64_C(1540743955509788682)},
+    {UINT64_C(1032610780636961552), UINT64_C(1925929944387235853)},
+    {UINT64_C(2951224747111794922), UINT64_C(1203706215242022408)},
+    {UINT64_C(3689030933889743652), UINT64_C(1504632769052528010)},
+    {UINT64_C(13834660704216955373), UINT64_C(1880790961315660012)},
+    {UINT64_C(17870034976990372916), UINT64_C(1175494350822287507)},
+    {UINT64_C(17725857702810578241), UINT64_C(1469367938527859384)},
+    {UINT64_C(3710578054803671186), UINT64_C(1836709923159824231)},
+    {UINT64_C(26536550077201078), UINT64_C(2295887403949780289)},
+    {UINT64_C(11545800389866720434), UINT64_C(1434929627468612680)},
+    {UINT64_C(14432250487333400542), UINT64_C(1793662034335765850)},
+    {UINT64_C(8816941072311974870), UINT64_C(2242077542919707313)},
+    {UINT64_C(17039803216263454053), UINT64_C(1401298464324817070)},
+    {UINT64_C(12076381983474541759), UINT64_C(1751623080406021338)},
+    {UINT64_C(5872105442488401391), UINT64_C(2189528850507526673)},
+    {UINT64_C(15199280947623720629), UINT64_C(1368455531567204170)},
+    {UINT64_C(9775729147674874978), UINT64_C(1710569414459005213)},
+    {UINT64_C(16831347453020981627), UINT64_C(2138211768073756516)},
+    {UINT64_C(1296220121283337709), UINT64_C(1336382355046097823)},
+    {UINT64_C(15455333206886335848), UINT64_C(1670477943807622278)},
+    {UINT64_C(10095794471753144002), UINT64_C(2088097429759527848)},
+    {UINT64_C(6309871544845715001), UINT64_C(1305060893599704905)},
+    {UINT64_C(12499025449484531656), UINT64_C(1631326116999631131)},
+    {UINT64_C(11012095793428276666), UINT64_C(2039157646249538914)},
+    {UINT64_C(11494245889320060820), UINT64_C(1274473528905961821)},
+    {UINT64_C(532749306367912313), UINT64_C(1593091911132452277)},
+    {UINT64_C(5277622651387278295), UINT64_C(1991364888915565346)},
+    {UINT64_C(7910200175544436838), UINT64_C(1244603055572228341)},
+    {UINT64_C(14499436237857933952), UINT64_C(1555753819465285426)},
+    {UINT64_C(8900923260467641632), UINT64_C(1944692274331606783)},
+    {UINT64_C(12480606065433357876), UINT64_C(1215432671457254239)},
+    {UINT64_C(10989071563364309441), UINT64_C(1519290839321567799)},
+    {UINT64_C(9124653435777998898), UINT64_C(1899113549151959749)},
+    {UINT64_C(8008751406574943263), UINT64_C(1186945968219974843)},
+    {UINT64_C(5399253239791291175), UINT64_C(1483682460274968554)},
+    {UINT64_C(15972438586593889776), UINT64_C(1854603075343710692)},
+    {UINT64_C(759402079766405302), UINT64_C(1159126922089819183)},
+    {UINT64_C(14784310654990170340), UINT64_C(1448908652612273978)},
+    {UINT64_C(9257016281882937117), UINT64_C(1811135815765342473)},
+    {UINT64_C(16182956370781059300), UINT64_C(2263919769706678091)},
+    {UINT64_C(7808504722524468110), UINT64_C(1414949856066673807)},
+    {UINT64_C(5148944884728197234), UINT64_C(1768687320083342259)},
+    {UINT64_C(1824495087482858639), UINT64_C(2210859150104177824)},
+    {UINT64_C(1140309429676786649), UINT64_C(1381786968815111140)},
+    {UINT64_C(1425386787095983311), UINT64_C(1727233711018888925)},
+    {UINT64_C(6393419502297367043), UINT64_C(2159042138773611156)},
+    {UINT64_C(13219259225790630210), UINT64_C(1349401336733506972)},
+    {UINT64_C(16524074032238287762), UINT64_C(1686751670916883715)},
+    {UINT64_C(16043406521870471799), UINT64_C(2108439588646104644)},
+    {UINT64_C(803757039314269066), UINT64_C(1317774742903815403)},
+    {UINT64_C(14839754354425000045), UINT64_C(1647218428629769253)},
+    {UINT64_C(4714634887749086344), UINT64_C(2059023035787211567)},
+    {UINT64_C(9864175832484260821), UINT64_C(1286889397367007229)},
+    {UINT64_C(16941905809032713930), UINT64_C(1608611746708759036)},
+    {UINT64_C(2730638187581340797), UINT64_C(2010764683385948796)},
+    {UINT64_C(10930020904093113806), UINT64_C(1256727927116217997)},
+    {UINT64_C(18274212148543780162), UINT64_C(1570909908895272496)},
+    {UINT64_C(4396021111970173586), UINT64_C(1963637386119090621)},
+    {UINT64_C(5053356204195052443), UINT64_C(1227273366324431638)},
+    {UINT64_C(15540067292098591362), UINT64_C(1534091707905539547)},
+    {UINT64_C(14813398096695851299), UINT64_C(1917614634881924434)},
+    {UINT64_C(13870059828862294966), UINT64_C(1198509146801202771)},
+    {UINT64_C(12725888767650480803), UINT64_C(1498136433501503464)},
+    {UINT64_C(15907360959563101004), UINT64_C(1872670541876879330)},
+    {UINT64_C(14553786618154326031), UINT64_C(1170419088673049581)},
+    {UINT64_C(4357175217410743827), UINT64_C(1463023860841311977)},
+    {UINT64_C(10058155040190817688), UINT64_C(1828779826051639971)},
+    {UINT64_C(7961007781811134206), UINT64_C(2285974782564549964)},
+    {UINT64_C(14199001900486734687), UINT64_C(1428734239102843727)},
+    {UINT64_C(13137066357181030455), UINT64_C(1785917798878554659)},
+    {UINT64_C(11809646928048900164), UINT64_C(2232397248598193324)},
+    {UINT64_C(16604401366885338411), UINT64_C(1395248280373870827)},
+    {UINT64_C(16143815690179285109), UINT64_C(1744060350467338534)},
+    {UINT64_C(10956397575869330579), UINT64_C(2180075438084173168)},
+    {UINT64_C(6847748484918331612), UINT64_C(1362547148802608230)},
+    {UINT64_C(17783057643002690323), UINT64_C(1703183936003260287)},
+    {UINT64_C(17617136035325974999), UINT64_C(2128979920004075359)},
+    {UINT64_C(17928239049719816230), UINT64_C(1330612450002547099)},
+    {UINT64_C(17798612793722382384), UINT64_C(1663265562503183874)},
+    {UINT64_C(13024893955298202172), UINT64_C(2079081953128979843)},
+    {UINT64_C(5834715712847682405), UINT64_C(1299426220705612402)},
+    {UINT64_C(16516766677914378815), UINT64_C(1624282775882015502)},
+    {UINT64_C(11422586310538197711), UINT64_C(2030353469852519378)},
+    {UINT64_C(11750802462513761473), UINT64_C(1268970918657824611)},
+    {UINT64_C(10076817059714813937), UINT64_C(1586213648322280764)},
+    {UINT64_C(12596021324643517422), UINT64_C(1982767060402850955)},
+    {UINT64_C(5566670318688504437), UINT64_C(1239229412751781847)},
+    {UINT64_C(2346651879933242642), UINT64_C(1549036765939727309)},
+    {UINT64_C(7545000868343941206), UINT64_C(1936295957424659136)},
+    {UINT64_C(4715625542714963254), UINT64_C(1210184973390411960)},
+    {UINT64_C(5894531928393704067), UINT64_C(1512731216738014950)},
+    {UINT64_C(16591536947346905892), UINT64_C(1890914020922518687)},
+    {UINT64_C(17287239619732898039), UINT64_C(1181821263076574179)},
+    {UINT64_C(16997363506238734644), UINT64_C(1477276578845717724)},
+    {UINT64_C(2799960309088866689), UINT64_C(1846595723557147156)},
+    {UINT64_C(10973347230035317489), UINT64_C(1154122327223216972)},
+    {UINT64_C(13716684037544146861), UINT64_C(1442652909029021215)},
+    {UINT64_C(12534169028502795672), UINT64_C(1803316136286276519)},
+    {UINT64_C(11056025267201106687), UINT64_C(2254145170357845649)},
+    {UINT64_C(18439230838069161439), UINT64_C(1408840731473653530)},
+    {UINT64_C(13825666510731675991), UINT64_C(1761050914342066913)},
+    {UINT64_C(3447025083132431277), UINT64_C(2201313642927583642)},
+    {UINT64_C(6766076695385157452), UINT64_C(1375821026829739776)},
+    {UINT64_C(8457595869231446815), UINT64_C(1719776283537174720)},
+    {UINT64_C(10571994836539308519), UINT64_C(2149720354421468400)},
+    {UINT64_C(6607496772837067824), UINT64_C(1343575221513417750)},
+    {UINT64_C(17482743002901110588), UINT64_C(1679469026891772187)},
+    {UINT64_C(17241742735199000331), UINT64_C(2099336283614715234)},
+    {UINT64_C(15387775227926763111), UINT64_C(1312085177259197021)},
+    {UINT64_C(5399660979626290177), UINT64_C(1640106471573996277)},
+    {UINT64_C(11361262242960250625), UINT64_C(2050133089467495346)},
+    {UINT64_C(11712474920277544544), UINT64_C(1281333180917184591)},
+    {UINT64_C(10028907631919542777), UINT64_C(1601666476146480739)},
+    {UINT64_C(7924448521472040567), UINT64_C(2002083095183100924)},
+    {UINT64_C(14176152362774801162), UINT64_C(1251301934489438077)},
+    {UINT64_C(3885132398186337741), UINT64_C(1564127418111797597)},
+    {UINT64_C(9468101516160310080), UINT64_C(1955159272639746996)},
+    {UINT64_C(15140935484454969608), UINT64_C(1221974545399841872)},
+    {UINT64_C(479425281859160394), UINT64_C(1527468181749802341)},
+    {UINT64_C(5210967620751338397), UINT64_C(1909335227187252926)},
+    {UINT64_C(17091912818251750210), UINT64_C(1193334516992033078)},
+    {UINT64_C(12141518985959911954), UINT64_C(1491668146240041348)},
+    {UINT64_C(15176898732449889943), UINT64_C(1864585182800051685)},
+    {UINT64_C(11791404716994875166), UINT64_C(1165365739250032303)},
+    {UINT64_C(10127569877816206054), UINT64_C(1456707174062540379)},
+    {UINT64_C(8047776328842869663), UINT64_C(1820883967578175474)},
+    {UINT64_C(836348374198811271), UINT64_C(2276104959472719343)},
+    {UINT64_C(7440246761515338900), UINT64_C(1422565599670449589)},
+    {UINT64_C(13911994470321561530), UINT64_C(1778206999588061986)},
+    {UINT64_C(8166621051047176104), UINT64_C(2222758749485077483)},
+    {UINT64_C(2798295147690791113), UINT64_C(1389224218428173427)},
+    {UINT64_C(17332926989895652603), UINT64_C(1736530273035216783)},
+    {UINT64_C(17054472718942177850), UINT64_C(2170662841294020979)},
+    {UINT64_C(8353202440125167204), UINT64_C(1356664275808763112)},
+    {UINT64_C(10441503050156459005), UINT64_C(1695830344760953890)},
+    {UINT64_C(3828506775840797949), UINT64_C(2119787930951192363)},
+    {UINT64_C(86973725686804766), UINT64_C(1324867456844495227)},
+    {UINT64_C(13943775212390669669), UINT64_C(1656084321055619033)},
+    {UINT64_C(3594660960206173375), UINT64_C(2070105401319523792)},
+    {UINT64_C(2246663100128858359), UINT64_C(1293815875824702370)},
+    {UINT64_C(12031700912015848757), UINT64_C(1617269844780877962)},
+    {UINT64_C(5816254103165035138), UINT64_C(2021587305976097453)},
+    {UINT64_C(5941001823691840913), UINT64_C(1263492066235060908)},
+    {UINT64_C(7426252279614801142), UINT64_C(1579365082793826135)},
+    {UINT64_C(4671129331091113523), UINT64_C(1974206353492282669)},
+    {UINT64_C(5225298841145639904), UINT64_C(1233878970932676668)},
+    {UINT64_C(6531623551432049880), UINT64_C(1542348713665845835)},
+    {UINT64_C(3552843420862674446), UINT64_C(1927935892082307294)},
+    {UINT64_C(16055585193321335241), UINT64_C(1204959932551442058)},
+    {UINT64_C(10846109454796893243), UINT64_C(1506199915689302573)},
+    {UINT64_C(18169322836923504458), UINT64_C(1882749894611628216)},
+    {UINT64_C(11355826773077190286), UINT64_C(1176718684132267635)},
+    {UINT64_C(9583097447919099954), UINT64_C(1470898355165334544)},
+    {UINT64_C(11978871809898874942), UINT64_C(1838622943956668180)},
+    {UINT64_C(14973589762373593678), UINT64_C(2298278679945835225)},
+    {UINT64_C(2440964573842414192), UINT64_C(1436424174966147016)},
+    {UINT64_C(3051205717303017741), UINT64_C(1795530218707683770)},
+    {UINT64_C(13037379183483547984), UINT64_C(2244412773384604712)},
+    {UINT64_C(8148361989677217490), UINT64_C(1402757983365377945)},
+    {UINT64_C(14797138505523909766), UINT64_C(1753447479206722431)},
+    {UINT64_C(13884737113477499304), UINT64_C(2191809349008403039)},
+    {UINT64_C(15595489723564518921), UINT64_C(1369880843130251899)},
+    {UINT64_C(14882676136028260747), UINT64_C(1712351053912814874)},
+    {UINT64_C(9379973133180550126), UINT64_C(2140438817391018593)},
+    {UINT64_C(17391698254306313589), UINT64_C(1337774260869386620)},
+    {UINT64_C(3292878744173340370), UINT64_C(1672217826086733276)},
+    {UINT64_C(4116098430216675462), UINT64_C(2090272282608416595)},
+    {UINT64_C(266718509671728212), UINT64_C(1306420176630260372)},
+    {UINT64_C(333398137089660265), UINT64_C(1633025220787825465)},
+    {UINT64_C(5028433689789463235), UINT64_C(2041281525984781831)},
+    {UINT64_C(10060300083759496378), UINT64_C(1275800953740488644)},
+    {UINT64_C(12575375104699370472), UINT64_C(1594751192175610805)},
+    {UINT64_C(1884160825592049379), UINT64_C(1993438990219513507)},
+    {UINT64_C(17318501580490888525), UINT64_C(1245899368887195941)},
+    {UINT64_C(7813068920331446945), UINT64_C(1557374211108994927)},
+    {UINT64_C(5154650131986920777), UINT64_C(1946717763886243659)},
+    {UINT64_C(915813323278131534), UINT64_C(1216698602428902287)},
+    {UINT64_C(14979824709379828129), UINT64_C(1520873253036127858)},
+    {UINT64_C(9501408849870009354), UINT64_C(1901091566295159823)},
+    {UINT64_C(12855909558809837702), UINT64_C(1188182228934474889)},
+    {UINT64_C(2234828893230133415), UINT64_C(1485227786168093612)},
+    {UINT64_C(2793536116537666769), UINT64_C(1856534732710117015)},
+    {UINT64_C(8663489100477123587), UINT64_C(1160334207943823134)},
+    {UINT64_C(1605989338741628675), UINT64_C(1450417759929778918)},
+    {UINT64_C(11230858710281811652), UINT64_C(1813022199912223647)},
+    {UINT64_C(9426887369424876662), UINT64_C(2266277749890279559)},
+    {UINT64_C(12809333633531629769), UINT64_C(1416423593681424724)},
+    {UINT64_C(16011667041914537212), UINT64_C(1770529492101780905)},
+    {UINT64_C(6179525747111007803), UINT64_C(2213161865127226132)},
+    {UINT64_C(13085575628799155685), UINT64_C(1383226165704516332)},
+    {UINT64_C(16356969535998944606), UINT64_C(1729032707130645415)},
+    {UINT64_C(15834525901571292854), UINT64_C(2161290883913306769)},
+    {UINT64_C(2979049660840976177), UINT64_C(1350806802445816731)},
+    {UINT64_C(17558870131333383934), UINT64_C(1688508503057270913)},
+    {UINT64_C(8113529608884566205), UINT64_C(2110635628821588642)},
+    {UINT64_C(9682642023980241782), UINT64_C(1319147268013492901)},
+    {UINT64_C(16714988548402690132), UINT64_C(1648934085016866126)},
+    {UINT64_C(11670363648648586857), UINT64_C(2061167606271082658)},
+    {UINT64_C(11905663298832754689), UINT64_C(1288229753919426661)},
+    {UINT64_C(1047021068258779650), UINT64_C(1610287192399283327)},
+    {UINT64_C(15143834390605638274), UINT64_C(2012858990499104158)},
+    {UINT64_C(4853210475701136017), UINT64_C(1258036869061940099)},
+    {UINT64_C(1454827076199032118), UINT64_C(1572546086327425124)},
+    {UINT64_C(1818533845248790147), UINT64_C(1965682607909281405)},
+    {UINT64_C(3442426662494187794), UINT64_C(1228551629943300878)},
+    {UINT64_C(13526405364972510550), UINT64_C(1535689537429126097)},
+    {UINT64_C(3072948650933474476), UINT64_C(1919611921786407622)},
+    {UINT64_C(15755650962115585259), UINT64_C(1199757451116504763)},
+    {UINT64_C(15082877684217093670), UINT64_C(1499696813895630954)},
+    {UINT64_C(9630225068416591280), UINT64_C(1874621017369538693)},
+    {UINT64_C(8324733676974063502), UINT64_C(1171638135855961683)},
+    {UINT64_C(5794231077790191473), UINT64_C(1464547669819952104)},
+    {UINT64_C(7242788847237739342), UINT64_C(1830684587274940130)},
+    {UINT64_C(18276858095901949986), UINT64_C(2288355734093675162)},
+    {UINT64_C(16034722328366106645), UINT64_C(1430222333808546976)},
+    {UINT64_C(1596658836748081690), UINT64_C(1787777917260683721)},
+    {UINT64_C(6607509564362490017), UINT64_C(2234722396575854651)},
+    {UINT64_C(1823850468512862308), UINT64_C(1396701497859909157)},
+    {UINT64_C(6891499104068465790), UINT64_C(1745876872324886446)},
+    {UINT64_C(17837745916940358045), UINT64_C(2182346090406108057)},
+    {UINT64_C(4231062170446641922), UINT64_C(1363966306503817536)},
+    {UINT64_C(5288827713058302403), UINT64_C(1704957883129771920)},
+    {UINT64_C(6611034641322878003), UINT64_C(2131197353912214900)},
+    {UINT64_C(13355268687681574560), UINT64_C(1331998346195134312)},
+    {UINT64_C(16694085859601968200), UINT64_C(1664997932743917890)},
+    {UINT64_C(11644235287647684442), UINT64_C(2081247415929897363)},
+    {UINT64_C(4971804045566108824), UINT64_C(1300779634956185852)},
+    {UINT64_C(6214755056957636030), UINT64_C(1625974543695232315)},
+    {UINT64_C(3156757802769657134), UINT64_C(2032468179619040394)},
+    {UINT64_C(6584659645158423613), UINT64_C(1270292612261900246)},
+    {UINT64_C(17454196593302805324), UINT64_C(1587865765327375307)},
+    {UINT64_C(17206059723201118751), UINT64_C(1984832206659219134)},
+    {UINT64_C(6142101308573311315), UINT64_C(1240520129162011959)},
+    {UINT64_C(3065940617289251240), UINT64_C(1550650161452514949)},
+    {UINT64_C(8444111790038951954), UINT64_C(1938312701815643686)},
+    {UINT64_C(665883850346957067), UINT64_C(1211445438634777304)},
+    {UINT64_C(832354812933696334), UINT64_C(1514306798293471630)},
+    {UINT64_C(10263815553021896226), UINT64_C(1892883497866839537)},
+    {UINT64_C(17944099766707154901), UINT64_C(1183052186166774710)},
+    {UINT64_C(13206752671529167818), UINT64_C(1478815232708468388)},
+    {UINT64_C(16508440839411459773), UINT64_C(1848519040885585485)},
+    {UINT64_C(12623618533845856310), UINT64_C(1155324400553490928)},
+    {UINT64_C(15779523167307320387), UINT64_C(1444155500691863660)},
+    {UINT64_C(1277659885424598868), UINT64_C(1805194375864829576)},
+    {UINT64_C(1597074856780748586), UINT64_C(2256492969831036970)},
+    {UINT64_C(5609857803915355770), UINT64_C(1410308106144398106)},
+    {UINT64_C(16235694291748970521), UINT64_C(1762885132680497632)},
+    {UINT64_C(1847873790976661535), UINT64_C(2203606415850622041)},
+    {UINT64_C(12684136165428883219), UINT64_C(1377254009906638775)},
+    {UINT64_C(11243484188358716120), UINT64_C(1721567512383298469)},
+    {UINT64_C(219297180166231438), UINT64_C(2151959390479123087)},
+    {UINT64_C(7054589765244976505), UINT64_C(1344974619049451929)},
+    {UINT64_C(13429923224983608535), UINT64_C(1681218273811814911)},
+    {UINT64_C(12175718012802122765), UINT64_C(2101522842264768639)},
+    {UINT64_C(14527352785642408584), UINT64_C(1313451776415480399)},
+    {UINT64_C(13547504963625622826), UINT64_C(1641814720519350499)},
+    {UINT64_C(12322695186104640628), UINT64_C(2052268400649188124)},
+    {UINT64_C(16925056528170176201), UINT64_C(1282667750405742577)},
+    {UINT64_C(7321262604930556539), UINT64_C(1603334688007178222)},
+    {UINT64_C(18374950293017971482), UINT64_C(2004168360008972777)},
+    {UINT64_C(4566814905495150320), UINT64_C(1252605225005607986)},
+    {UINT64_C(14931890668723713708), UINT64_C(1565756531257009982)},
+    {UINT64_C(9441491299049866327), UINT64_C(1957195664071262478)},
+    {UINT64_C(1289246043478778550), UINT64_C(1223247290044539049)},
+    {UINT64_C(6223243572775861092), UINT64_C(1529059112555673811)},
+    {UINT64_C(3167368447542438461), UINT64_C(1911323890694592264)},
+    {UINT64_C(1979605279714024038), UINT64_C(1194577431684120165)},
+    {UINT64_C(7086192618069917952), UINT64_C(1493221789605150206)},
+    {UINT64_C(18081112809442173248), UINT64_C(1866527237006437757)},
+    {UINT64_C(13606538515115052232), UINT64_C(1166579523129023598)},
+    {UINT64_C(7784801107039039482), UINT64_C(1458224403911279498)},
+    {UINT64_C(507629346944023544), UINT64_C(1822780504889099373)},
+    {UINT64_C(5246222702107417334), UINT64_C(2278475631111374216)},
+    {UINT64_C(3278889188817135834), UINT64_C(1424047269444608885)},
+    {UINT64_C(8710297504448807696), UINT64_C(1780059086805761106)},
+};
+
+// Ryu, float: floor(2^(pow5bits(q) - 1 + 59) / 5^q) + 1 for 0 <= q < 31.
+static const uint64_t __float_pow5_inv_split[31] = {
+    UINT64_C(576460752303423489),
+    UINT64_C(461168601842738791),
+    UINT64_C(368934881474191033),
+    UINT64_C(295147905179352826),
+    UINT64_C(472236648286964522),
+    UINT64_C(377789318629571618),
+    UINT64_C(302231454903657294),
+    UINT64_C(483570327845851670),
+    UINT64_C(386856262276681336),
+    UINT64_C(309485009821345069),
+    UINT64_C(495176015714152110),
+    UINT64_C(396140812571321688),
+    UINT64_C(316912650057057351),
+    UINT64_C(507060240091291761),
+    UINT64_C(405648192073033409),
+    UINT64_C(324518553658426727),
+    UINT64_C(519229685853482763),
+    UINT64_C(415383748682786211),
+    UINT64_C(332306998946228969),
+    UINT64_C(531691198313966350),
+    UINT64_C(425352958651173080),
+    UINT64_C(340282366920938464),
+    UINT64_C(544451787073501542),
+    UINT64_C(435561429658801234),
+    UINT64_C(348449143727040987),
+    UINT64_C(557518629963265579),
+    UINT64_C(446014903970612463),
+    UINT64_C(356811923176489971),
+    UINT64_C(570899077082383953),
+    UINT64_C(456719261665907162),
+    UINT64_C(365375409332725730),
+};
+
+// Ryu, float: 5^i scaled to exactly 61 bits, for 0 <= i < 47.
+static const uint64_t __float_pow5_split[47] = {
+    UINT64_C(1152921504606846976),
+    UINT64_C(1441151880758558720),
+    UINT64_C(1801439850948198400),
+    UINT64_C(2251799813685248000),
+    UINT64_C(1407374883553280000),
+    UINT64_C(1759218604441600000),
+    UINT64_C(2199023255552000000),
+    UINT64_C(1374389534720000000),
+    UINT64_C(1717986918400000000),
+    UINT64_C(2147483648000000000),
+    UINT64_C(1342177280000000000),
+    UINT64_C(1677721600000000000),
+    UINT64_C(2097152000000000000),
+    UINT64_C(1310720000000000000),
+    UINT64_C(1638400000000000000),
+    UINT64_C(2048000000000000000),
+    UINT64_C(1280000000000000000),
+    UINT64_C(1600000000000000000),
+    UINT64_C(2000000000000000000),
+    UINT64_C(1250000000000000000),
+    UINT64_C(1562500000000000000),
+    UINT64_C(1953125000000000000),
+    UINT64_C(1220703125000000000),
+    UINT64_C(1525878906250000000),
+    UINT64_C(1907348632812500000),
+    UINT64_C(1192092895507812500),
+    UINT64_C(1490116119384765625),
+    UINT64_C(1862645149230957031),
+    UINT64_C(1164153218269348144),
+    UINT64_C(1455191522836685180),
+    UINT64_C(1818989403545856475),
+    UINT64_C(2273736754432320594),
+    UINT64_C(1421085471520200371),
+    UINT64_C(1776356839400250464),
+    UINT64_C(2220446049250313080),
+    UINT64_C(1387778780781445675),
+    UINT64_C(1734723475976807094),
+    UINT64_C(2168404344971008868),
+    UINT64_C(1355252715606880542),
+    UINT64_C(1694065894508600678),
+    UINT64_C(2117582368135750847),
+    UINT64_C(1323488980084844279),
+    UINT64_C(1654361225106055349),
+    UINT64_C(2067951531382569187),
+    UINT64_C(1292469707114105741),
+    UINT64_C(1615587133892632177),
+    UINT64_C(2019483917365790221),
+};
+
+// Eisel-Lemire [Lemire, SPE 2021]: 5^q normalized to 128 bits, truncated,
+// for -342 <= q <= 308. Negative powers are rounded up from 2^b / 5^-q.
+static const uint64_t __pow5_128[651][2] = {
+    {UINT64_C(0x113faa2906a13b3f), UINT64_C(0xeef453d6923bd65a)},
+    {UINT64_C(0x4ac7ca59a424c507), UINT64_C(0x9558b4661b6565f8)},
+    {UINT64_C(0x5d79bcf00d2df649), UINT64_C(0xbaaee17fa23ebf76)},
+    {UINT64_C(0xf4d82c2c107973dc), UINT64_C(0xe95a99df8ace6f53)},
+    {UINT64_C(0x79071b9b8a4be869), UINT64_C(0x91d8a02bb6c10594)},
+    {UINT64_C(0x9748e2826cdee284), UINT64_C(0xb64ec836a47146f9)},
+    {UINT64_C(0xfd1b1b2308169b25), UINT64_C(0xe3e27a444d8d98b7)},
+    {UINT64_C(0xfe30f0f5e50e20f7), UINT64_C(0x8e6d8c6ab0787f72)},
+    {UINT64_C(0xbdbd2d335e51a935), UINT64_C(0xb208ef855c969f4f)},
+    {UINT64_C(0xad2c788035e61382), UINT64_C(0xde8b2b66b3bc4723)},
+    {UINT64_C(0x4c3bcb5021afcc31), UINT64_C(0x8b16fb203055ac76)},
+    {UINT64_C(0xdf4abe242a1bbf3d), UINT64_C(0xaddcb9e83c6b1793)},
+    {UINT64_C(0xd71d6dad34a2af0d), UINT64_C(0xd953e8624b85dd78)},
+    {UINT64_C(0x8672648c40e5ad68), UINT64_C(0x87d4713d6f33aa6b)},
+    {UINT64_C(0x680efdaf511f18c2), UINT64_C(0xa9c98d8ccb009506)},
+    {UINT64_C(0x0212bd1b2566def2), UINT64_C(0xd43bf0effdc0ba48)},
+    {UINT64_C(0x014bb630f7604b57), UINT64_C(0x84a57695fe98746d)},
+    {UINT64_C(0x419ea3bd35385e2d), UINT64_C(0xa5ced43b7e3e9188)},
+    {UINT64_C(0x52064cac828675b9), UINT64_C(0xcf42894a5dce35ea)},
+    {UINT64_C(0x7343efebd1940993), UINT64_C(0x818995ce7aa0e1b2)},
+    {UINT64_C(0x1014ebe6c5f90bf8), UINT64_C(0xa1ebfb4219491a1f)},
+    {UINT64_C(0xd41a26e077774ef6), UINT64_C(0xca66fa129f9b60a6)},
+    {UINT64_C(0x8920b098955522b4), UINT64_C(0xfd00b897478238d0)},
+    {UINT64_C(0x55b46e5f5d5535b0), UINT64_C(0x9e20735e8cb16382)},
+    {UINT64_C(0xeb2189f734aa831d), UINT64_C(0xc5a890362fddbc62)},
+    {UINT64_C(0xa5e9ec7501d523e4), UINT64_C(0xf712b443bbd52b7b)},
+    {UINT64_C(0x47b233c92125366e), UINT64_C(0x9a6bb0aa55653b2d)},
+    {UINT64_C(0x999ec0bb696e840a), UINT64_C(0xc1069cd4eabe89f8)},
+    {UINT64_C(0xc00670ea43ca250d), UINT64_C(0xf148440a256e2c76)},
+    {UINT64_C(0x380406926a5e5728), UINT64_C(0x96cd2a865764dbca)},
+    {UINT64_C(0xc605083704f5ecf2), UINT64_C(0xbc807527ed3e12bc)},
+    {UINT64_C(0xf7864a44c633682e), UINT64_C(0xeba09271e88d976b)},
+    {UINT64_C(0x7ab3ee6afbe0211d), UINT64_C(0x93445b8731587ea3)},
+    {UINT64_C(0x5960ea05bad82964), UINT64_C(0xb8157268fdae9e4c)},
+    {UINT64_C(0x6fb92487298e33bd), UINT64_C(0xe61acf033d1a45df)},
+    {UINT64_C(0xa5d3b6d479f8e056), UINT64_C(0x8fd0c16206306bab)},
+    {UINT64_C(0x8f48a4899877186c), UINT64_C(0xb3c4f1ba87bc8696)},
+    {UINT64_C(0x331acdabfe94de87), UINT64_C(0xe0b62e2929aba83c)},
+    {UINT64_C(0x9ff0c08b7f1d0b14), UINT64_C(0x8c71dcd9ba0b4925)},
+    {UINT64_C(0x07ecf0ae5ee44dd9), UINT64_C(0xaf8e5410288e1b6f)},
+    {UINT64_C(0xc9e82cd9f69d6150), UINT64_C(0xdb71e91432b1a24a)},
+    {UINT64_C(0xbe311c083a225cd2), UINT64_C(0x892731ac9faf056e)},
+    {UINT64_C(0x6dbd630a48aaf406), UINT64_C(0xab70fe17c79ac6ca)},
+    {UINT64_C(0x092cbbccdad5b108), UINT64_C(0xd64d3d9db981787d)},
+    {UINT64_C(0x25bbf56008c58ea5), UINT64_C(0x85f0468293f0eb4e)},
+    {UINT64_C(0xaf2af2b80af6f24e), UINT64_C(0xa76c582338ed2621)},
+    {UINT64_C(0x1af5af660db4aee1), UINT64_C(0xd1476e2c07286faa)},
+    {UINT64_C(0x50d98d9fc890ed4d), UINT64_C(0x82cca4db847945ca)},
+    {UINT64_C(0xe50ff107bab528a0), UINT64_C(0xa37fce126597973c)},
+    {UINT64_C(0x1e53ed49a96272c8), UINT64_C(0xcc5fc196fefd7d0c)},
+    {UINT64_C(0x25e8e89c13bb0f7a), UINT64_C(0xff77b1fcbebcdc4f)},
+    {UINT64_C(0x77b191618c54e9ac), UINT64_C(0x9faacf3df73609b1)},
+    {UINT64_C(0xd59df5b9ef6a2417), UINT64_C(0xc795830d75038c1d)},
+    {UINT64_C(0x4b0573286b44ad1d), UINT64_C(0xf97ae3d0d2446f25)},
+    {UINT64_C(0x4ee367f9430aec32), UINT64_C(0x9becce62836ac577)},
+    {UINT64_C(0x229c41f793cda73f), UINT64_C(0xc2e801fb244576d5)},
+    {UINT64_C(0x6b43527578c1110f), UINT64_C(0xf3a20279ed56d48a)},
+    {UINT64_C(0x830a13896b78aaa9), UINT64_C(0x9845418c345644d6)},
+    {UINT64_C(0x23cc986bc656d553), UINT64_C(0xbe5691ef416bd60c)},
+    {UINT64_C(0x2cbfbe86b7ec8aa8), UINT64_C(0xedec366b11c6cb8f)},
+    {UINT64_C(0x7bf7d71432f3d6a9), UINT64_C(0x94b3a202eb1c3f39)},
+    {UINT64_C(0xdaf5ccd93fb0cc53), UINT64_C(0xb9e08a83a5e34f07)},
+    {UINT64_C(0xd1b3400f8f9cff68), UINT64_C(0xe858ad248f5c22c9)},
+    {UINT64_C(0x23100809b9c21fa1), UINT64_C(0x91376c36d99995be)},
+    {UINT64_C(0xabd40a0c2832a78a), UINT64_C(0xb58547448ffffb2d)},
+    {UINT64_C(0x16c90c8f323f516c), UINT64_C(0xe2e69915b3fff9f9)},
+    {UINT64_C(0xae3da7d97f6792e3), UINT64_C(0x8dd01fad907ffc3b)},
+    {UINT64_C(0x99cd11cfdf41779c), UINT64_C(0xb1442798f49ffb4a)},
+    {UINT64_C(0x40405643d711d583), UINT64_C(0xdd95317f31c7fa1d)},
+    {UINT64_C(0x482835ea666b2572), UINT64_C(0x8a7d3eef7f1cfc52)},
+    {UINT64_C(0xda3243650005eecf), UINT64_C(0xad1c8eab5ee43b66)},
+    {UINT64_C(0x90bed43e40076a82), UINT64_C(0xd863b256369d4a40)},
+    {UINT64_C(0x5a7744a6e804a291), UINT64_C(0x873e4f75e2224e68)},
+    {UINT64_C(0x711515d0a205cb36), UINT64_C(0xa90de3535aaae202)},
+    {UINT64_C(0x0d5a5b44ca873e03), UINT64_C(0xd3515c2831559a83)},
+    {UINT64_C(0xe858790afe9486c2), UINT64_C(0x8412d9991ed58091)},
+    {UINT64_C(0x626e974dbe39a872), UINT64_C(0xa5178fff668ae0b6)},
+    {UINT64_C(0xfb0a3d212dc8128f), UINT64_C(0xce5d73ff402d98e3)},
+    {UINT64_C(0x7ce66634bc9d0b99), UINT64_C(0x80fa687f881c7f8e)},
+    {UINT64_C(0x1c1fffc1ebc44e80), UINT64_C(0xa139029f6a239f72)},
+    {UINT64_C(0xa327ffb266b56220), UINT64_C(0xc987434744ac874e)},
+    {UINT64_C(0x4bf1ff9f0062baa8), UINT64_C(0xfbe9141915d7a922)},
+    {UINT64_C(0x6f773fc3603db4a9), UINT64_C(0x9d71ac8fada6c9b5)},
+    {UINT64_C(0xcb550fb4384d21d3), UINT64_C(0xc4ce17b399107c22)},
+    {UINT64_C(0x7e2a53a146606a48), UINT64_C(0xf6019da07f549b2b)},
+    {UINT64_C(0x2eda7444cbfc426d), UINT64_C(0x99c102844f94e0fb)},
+    {UINT64_C(0xfa911155fefb5308), UINT64_C(0xc0314325637a1939)},
+    {UINT64_C(0x793555ab7eba27ca), UINT64_C(0xf03d93eebc589f88)},
+    {UINT64_C(0x4bc1558b2f3458de), UINT64_C(0x96267c7535b763b5)},
+    {UINT64_C(0x9eb1aaedfb016f16), UINT64_C(0xbbb01b9283253ca2)},
+    {UINT64_C(0x465e15a979c1cadc), UINT64_C(0xea9c227723ee8bcb)},
+    {UINT64_C(0x0bfacd89ec191ec9), UINT64_C(0x92a1958a7675175f)},
+    {UINT64_C(0xcef980ec671f667b), UINT64_C(0xb749faed14125d36)},
+    {UINT64_C(0x82b7e12780e7401a), UINT64_C(0xe51c79a85916f484)},
+    {UINT64_C(0xd1b2ecb8b0908810), UINT64_C(0x8f31cc0937ae58d2)},
+    {UINT64_C(0x861fa7e6dcb4aa15), UINT64_C(0xb2fe3f0b8599ef07)},
+    {UINT64_C(0x67a791e093e1d49a), UINT64_C(0xdfbdcece67006ac9)},
+    {UINT64_C(0xe0c8bb2c5c6d24e0), UINT64_C(0x8bd6a141006042bd)},
+    {UINT64_C(0x58fae9f773886e18), UINT64_C(0xaecc49914078536d)},
+    {UINT64_C(0xaf39a475506a899e), UINT64_C(0xda7f5bf590966848)},
+    {UINT64_C(0x6d8406c952429603), UINT64_C(0x888f99797a5e012d)},
+    {UINT64_C(0xc8e5087ba6d33b83), UINT64_C(0xaab37fd7d8f58178)},
+    {UINT64_C(0xfb1e4a9a90880a64), UINT64_C(0xd5605fcdcf32e1d6)},
+    {UINT64_C(0x5cf2eea09a55067f), UINT64_C(0x855c3be0a17fcd26)},
+    {UINT64_C(0xf42faa48c0ea481e), UINT64_C(0xa6b34ad8c9dfc06f)},
+    {UINT64_C(0xf13b94daf124da26), UINT64_C(0xd0601d8efc57b08b)},
+    {UINT64_C(0x76c53d08d6b70858), UINT64_C(0x823c12795db6ce57)},
+    {UINT64_C(0x54768c4b0c64ca6e), UINT64_C(0xa2cb1717b52481ed)},
+    {UINT64_C(0xa9942f5dcf7dfd09), UINT64_C(0xcb7ddcdda26da268)},
+    {UINT64_C(0xd3f93b35435d7c4c), UINT64_C(0xfe5d54150b090b02)},
+    {UINT64_C(0xc47bc5014a1a6daf), UINT64_C(0x9efa548d26e5a6e1)},
+    {UINT64_C(0x359ab6419ca1091b), UINT64_C(0xc6b8e9b0709f109a)},
+    {UINT64_C(0xc30163d203c94b62), UINT64_C(0xf867241c8cc6d4c0)},
+    {UINT64_C(0x79e0de63425dcf1d), UINT64_C(0x9b407691d7fc44f8)},
+    {UINT64_C(0x985915fc12f542e4), UINT64_C(0xc21094364dfb5636)},
+    {UINT64_C(0x3e6f5b7b17b2939d), UINT64_C(0xf294b943e17a2bc4)},
+    {UINT64_C(0xa705992ceecf9c42), UINT64_C(0x979cf3ca6cec5b5a)},
+    {UINT64_C(0x50c6ff782a838353), UINT64_C(0xbd8430bd08277231)},
+    {UINT64_C(0xa4f8bf5635246428), UINT64_C(0xece53cec4a314ebd)},
+    {UINT64_C(0x871b7795e136be99), UINT64_C(0x940f4613ae5ed136)},
+    {UINT64_C(0x28e2557b59846e3f), UINT64_C(0xb913179899f68584)},
+    {UINT64_C(0x331aeada2fe589cf), UINT64_C(0xe757dd7ec07426e5)},
+    {UINT64_C(0x3ff0d2c85def7621), UINT64_C(0x9096ea6f3848984f)},
+    {UINT64_C(0x0fed077a756b53a9), UINT64_C(0xb4bca50b065abe63)},
+    {UINT64_C(0xd3e8495912c62894), UINT64_C(0xe1ebce4dc7f16dfb)},
+    {UINT64_C(0x64712dd7abbbd95c), UINT64_C(0x8d3360f09cf6e4bd)},
+    {UINT64_C(0xbd8d794d96aacfb3), UINT64_C(0xb080392cc4349dec)},
+    {UINT64_C(0xecf0d7a0fc5583a0), UINT64_C(0xdca04777f541c567)},
+    {UINT64_C(0xf41686c49db57244), UINT64_C(0x89e42caaf9491b60)},
+    {UINT64_C(0x311c2875c522ced5), UINT64_C(0xac5d37d5b79b6239)},
+    {UINT64_C(0x7d633293366b828b), UINT64_C(0xd77485cb25823ac7)},
+    {UINT64_C(0xae5dff9c02033197), UINT64_C(0x86a8d39ef77164bc)},
+    {UINT64_C(0xd9f57f830283fdfc), UINT64_C(0xa8530886b54dbdeb)},
+    {UINT64_C(0xd072df63c324fd7b), UINT64_C(0xd267caa862a12d66)},
+    {UINT64_C(0x4247cb9e59f71e6d), UINT64_C(0x8380dea93da4bc60)},
+    {UINT64_C(0x52d9be85f074e608), UINT64_C(0xa46116538d0deb78)},
+    {UINT64_C(0x67902e276c921f8b), UINT64_C(0xcd795be870516656)},
+    {UINT64_C(0x00ba1cd8a3db53b6), UINT64_C(0x806bd9714632dff6)},
+    {UINT64_C(0x80e8a40eccd228a4), UINT64_C(0xa086cfcd97bf97f3)},
+    {UINT64_C(0x6122cd128006b2cd), UINT64_C(0xc8a883c0fdaf7df0)},
+    {UINT64_C(0x796b805720085f81), UINT64_C(0xfad2a4b13d1b5d6c)},
+    {UINT64_C(0xcbe3303674053bb0), UINT64_C(0x9cc3a6eec6311a63)},
+    {UINT64_C(0xbedbfc4411068a9c), UINT64_C(0xc3f490aa77bd60fc)},
+    {UINT64_C(0xee92fb5515482d44), UINT64_C(0xf4f1b4d515acb93b)},
+    {UINT64_C(0x751bdd152d4d1c4a), UINT64_C(0x991711052d8bf3c5)},
+    {UINT64_C(0xd262d45a78a0635d), UINT64_C(0xbf5cd54678eef0b6)},
+    {UINT64_C(0x86fb897116c87c34), UINT64_C(0xef340a98172aace4)},
+    {UINT64_C(0xd45d35e6ae3d4da0), UINT64_C(0x9580869f0e7aac0e)},
+    {UINT64_C(0x8974836059cca109), UINT64_C(0xbae0a846d2195712)},
+    {UINT64_C(0x2bd1a438703fc94b), UINT64_C(0xe998d258869facd7)},
+    {UINT64_C(0x7b6306a34627ddcf), UINT64_C(0x91ff83775423cc06)},
+    {UINT64_C(0x1a3bc84c17b1d542), UINT64_C(0xb67f6455292cbf08)},
+    {UINT64_C(0x20caba5f1d9e4a93), UINT64_C(0xe41f3d6a7377eeca)},
+    {UINT64_C(0x547eb47b7282ee9c), UINT64_C(0x8e938662882af53e)},
+    {UINT64_C(0xe99e619a4f23aa43), UINT64_C(0xb23867fb2a35b28d)},
+    {UINT64_C(0x6405fa00e2ec94d4), UINT64_C(0xdec681f9f4c31f31)},
+    {UINT64_C(0xde83bc408dd3dd04), UINT64_C(0x8b3c113c38f9f37e)},
+    {UINT64_C(0x9624ab50b148d445), UINT64_C(0xae0b158b4738705e)},
+    {UINT64_C(0x3badd624dd9b0957), UINT64_C(0xd98ddaee19068c76)},
+    {UINT64_C(0xe54ca5d70a80e5d6), UINT64_C(0x87f8a8d4cfa417c9)},
+    {UINT64_C(0x5e9fcf4ccd211f4c), UINT64_C(0xa9f6d30a038d1dbc)},
+    {UINT64_C(0x7647c3200069671f), UINT64_C(0xd47487cc8470652b)},
+    {UINT64_C(0x29ecd9f40041e073), UINT64_C(0x84c8d4dfd2c63f3b)},
+    {UINT64_C(0xf468107100525890), UINT64_C(0xa5fb0a17c777cf09)},
+    {UINT64_C(0x7182148d4066eeb4), UINT64_C(0xcf79cc9db955c2cc)},
+    {UINT64_C(0xc6f14cd848405530), UINT64_C(0x81ac1fe293d599bf)},
+    {UINT64_C(0xb8ada00e5a506a7c), UINT64_C(0xa21727db38cb002f)},
+    {UINT64_C(0xa6d90811f0e4851c), UINT64_C(0xca9cf1d206fdc03b)},
+    {UINT64_C(0x908f4a166d1da663), UINT64_C(0xfd442e4688bd304a)},
+    {UINT64_C(0x9a598e4e043287fe), UINT64_C(0x9e4a9cec15763e2e)},
+    {UINT64_C(0x40eff1e1853f29fd), UINT64_C(0xc5dd44271ad3cdba)},
+    {UINT64_C(0xd12bee59e68ef47c), UINT64_C(0xf7549530e188c128)},
+    {UINT64_C(0x82bb74f8301958ce), UINT64_C(0x9a94dd3e8cf578b9)},
+    {UINT64_C(0xe36a52363c1faf01), UINT64_C(0xc13a148e3032d6e7)},
+    {UINT64_C(0xdc44e6c3cb279ac1), UINT64_C(0xf18899b1bc3f8ca1)},
+    {UINT64_C(0x29ab103a5ef8c0b9), UINT64_C(0x96f5600f15a7b7e5)},
+    {UINT64_C(0x7415d448f6b6f0e7), UINT64_C(0xbcb2b812db11a5de)},
+    {UINT64_C(0x111b495b3464ad21), UINT64_C(0xebdf661791d60f56)},
+    {UINT64_C(0xcab10dd900beec34), UINT64_C(0x936b9fcebb25c995)},
+    {UINT64_C(0x3d5d514f40eea742), UINT64_C(0xb84687c269ef3bfb)},
+    {UINT64_C(0x0cb4a5a3112a5112), UINT64_C(0xe65829b3046b0afa)},
+    {UINT64_C(0x47f0e785eaba72ab), UINT64_C(0x8ff71a0fe2c2e6dc)},
+    {UINT64_C(0x59ed216765690f56), UINT64_C(0xb3f4e093db73a093)},
+    {UINT64_C(0x306869c13ec3532c), UINT64_C(0xe0f218b8d25088b8)},
+    {UINT64_C(0x1e414218c73a13fb), UINT64_C(0x8c974f7383725573)},
+    {UINT64_C(0xe5d1929ef90898fa), UINT64_C(0xafbd2350644eeacf)},
+    {UINT64_C(0xdf45f746b74abf39), UINT64_C(0xdbac6c247d62a583)},
+    {UINT64_C(0x6b8bba8c328eb783), UINT64_C(0x894bc396ce5da772)},
+    {UINT64_C(0x066ea92f3f326564), UINT64_C(0xab9eb47c81f5114f)},
+    {UINT64_C(0xc80a537b0efefebd), UINT64_C(0xd686619ba27255a2)},
+    {UINT64_C(0xbd06742ce95f5f36), UINT64_C(0x8613fd0145877585)},
+    {UINT64_C(0x2c48113823b73704), UINT64_C(0xa798fc4196e952e7)},
+    {UINT64_C(0xf75a15862ca504c5), UINT64_C(0xd17f3b51fca3a7a0)},
+    {UINT64_C(0x9a984d73dbe722fb), UINT64_C(0x82ef85133de648c4)},
+    {UINT64_C(0xc13e60d0d2e0ebba), UINT64_C(0xa3ab66580d5fdaf5)},
+    {UINT64_C(0x318df905079926a8), UINT64_C(0xcc963fee10b7d1b3)},
+    {UINT64_C(0xfdf17746497f7052), UINT64_C(0xffbbcfe994e5c61f)},
+    {UINT64_C(0xfeb6ea8bedefa633), UINT64_C(0x9fd561f1fd0f9bd3)},
+    {UINT64_C(0xfe64a52ee96b8fc0), UINT64_C(0xc7caba6e7c5382c8)},
+    {UINT64_C(0x3dfdce7aa3c673b0), UINT64_C(0xf9bd690a1b68637b)},
+    {UINT64_C(0x06bea10ca65c084e), UINT64_C(0x9c1661a651213e2d)},
+    {UINT64_C(0x486e494fcff30a62), UINT64_C(0xc31bfa0fe5698db8)},
+    {UINT64_C(0x5a89dba3c3efccfa), UINT64_C(0xf3e2f893dec3f126)},
+    {UINT64_C(0xf89629465a75e01c), UINT64_C(0x986ddb5c6b3a76b7)},
+    {UINT64_C(0xf6bbb397f1135823), UINT64_C(0xbe89523386091465)},
+    {UINT64_C(0x746aa07ded582e2c), UINT64_C(0xee2ba6c0678b597f)},
+    {UINT64_C(0xa8c2a44eb4571cdc), UINT64_C(0x94db483840b717ef)},
+    {UINT64_C(0x92f34d62616ce413), UINT64_C(0xba121a4650e4ddeb)},
+    {UINT64_C(0x77b020baf9c81d17), UINT64_C(0xe896a0d7e51e1566)},
+    {UINT64_C(0x0ace1474dc1d122e), UINT64_C(0x915e2486ef32cd60)},
+    {UINT64_C(0x0d819992132456ba), UINT64_C(0xb5b5ada8aaff80b8)},
+    {UINT64_C(0x10e1fff697ed6c69), UINT64_C(0xe3231912d5bf60e6)},
+    {UINT64_C(0xca8d3ffa1ef463c1), UINT64_C(0x8df5efabc5979c8f)},
+    {UINT64_C(0xbd308ff8a6b17cb2), UINT64_C(0xb1736b96b6fd83b3)},
+    {UINT64_C(0xac7cb3f6d05ddbde), UINT64_C(0xddd0467c64bce4a0)},
+    {UINT64_C(0x6bcdf07a423aa96b), UINT64_C(0x8aa22c0dbef60ee4)},
+    {UINT64_C(0x86c16c98d2c953c6), UINT64_C(0xad4ab7112eb3929d)},
+    {UINT64_C(0xe871c7bf077ba8b7), UINT64_C(0xd89d64d57a607744)},
+    {UINT64_C(0x11471cd764ad4972), UINT64_C(0x87625f056c7c4a8b)},
+    {UINT64_C(0xd598e40d3dd89bcf), UINT64_C(0xa93af6c6c79b5d2d)},
+    {UINT64_C(0x4aff1d108d4ec2c3), UINT64_C(0xd389b47879823479)},
+    {UINT64_C(0xcedf722a585139ba), UINT64_C(0x843610cb4bf160cb)},
+    {UINT64_C(0xc2974eb4ee658828), UINT64_C(0xa54394fe1eedb8fe)},
+    {UINT64_C(0x733d226229feea32), UINT64_C(0xce947a3da6a9273e)},
+    {UINT64_C(0x0806357d5a3f525f), UINT64_C(0x811ccc668829b887)},
+    {UINT64_C(0xca07c2dcb0cf26f7), UINT64_C(0xa163ff802a3426a8)},
+    {UINT64_C(0xfc89b393dd02f0b5), UINT64_C(0xc9bcff6034c13052)},
+    {UINT64_C(0xbbac2078d443ace2), UINT64_C(0xfc2c3f3841f17c67)},
+    {UINT64_C(0xd54b944b84aa4c0d), UINT64_C(0x9d9ba7832936edc0)},
+    {UINT64_C(0x0a9e795e65d4df11), UINT64_C(0xc5029163f384a931)},
+    {UINT64_C(0x4d4617b5ff4a16d5), UINT64_C(0xf64335bcf065d37d)},
+    {UINT64_C(0x504bced1bf8e4e45), UINT64_C(0x99ea0196163fa42e)},
+    {UINT64_C(0xe45ec2862f71e1d6), UINT64_C(0xc06481fb9bcf8d39)},
+    {UINT64_C(0x5d767327bb4e5a4c), UINT64_C(0xf07da27a82c37088)},
+    {UINT64_C(0x3a6a07f8d510f86f), UINT64_C(0x964e858c91ba2655)},
+    {UINT64_C(0x890489f70a55368b), UINT64_C(0xbbe226efb628afea)},
+    {UINT64_C(0x2b45ac74ccea842e), UINT64_C(0xeadab0aba3b2dbe5)},
+    {UINT64_C(0x3b0b8bc90012929d), UINT64_C(0x92c8ae6b464fc96f)},
+    {UINT64_C(0x09ce6ebb40173744), UINT64_C(0xb77ada0617e3bbcb)},
+    {UINT64_C(0xcc420a6a101d0515), UINT64_C(0xe55990879ddcaabd)},
+    {UINT64_C(0x9fa946824a12232d), UINT64_C(0x8f57fa54c2a9eab6)},
+    {UINT64_C(0x47939822dc96abf9), UINT64_C(0xb32df8e9f3546564)},
+    {UINT64_C(0x59787e2b93bc56f7), UINT64_C(0xdff9772470297ebd)},
+    {UINT64_C(0x57eb4edb3c55b65a), UINT64_C(0x8bfbea76c619ef36)},
+    {UINT64_C(0xede622920b6b23f1), UINT64_C(0xaefae51477a06b03)},
+    {UINT64_C(0xe95fab368e45eced), UINT64_C(0xdab99e59958885c4)},
+    {UINT64_C(0x11dbcb0218ebb414), UINT64_C(0x88b402f7fd75539b)},
+    {UINT64_C(0xd652bdc29f26a119), UINT64_C(0xaae103b5fcd2a881)},
+    {UINT64_C(0x4be76d3346f0495f), UINT64_C(0xd59944a37c0752a2)},
+    {UINT64_C(0x6f70a4400c562ddb), UINT64_C(0x857fcae62d8493a5)},
+    {UINT64_C(0xcb4ccd500f6bb952), UINT64_C(0xa6dfbd9fb8e5b88e)},
+    {UINT64_C(0x7e2000a41346a7a7), UINT64_C(0xd097ad07a71f26b2)},
+    {UINT64_C(0x8ed400668c0c28c8), UINT64_C(0x825ecc24c873782f)},
+    {UINT64_C(0x728900802f0f32fa), UINT64_C(0xa2f67f2dfa90563b)},
+    {UINT64_C(0x4f2b40a03ad2ffb9), UINT64_C(0xcbb41ef979346bca)},
+    {UINT64_C(0xe2f610c84987bfa8), UINT64_C(0xfea126b7d78186bc)},
+    {UINT64_C(0x0dd9ca7d2df4d7c9), UINT64_C(0x9f24b832e6b0f436)},
+    {UINT64_C(0x91503d1c79720dbb), UINT64_C(0xc6ede63fa05d3143)},
+    {UINT64_C(0x75a44c6397ce912a), UINT64_C(0xf8a95fcf88747d94)},
+    {UINT64_C(0xc986afbe3ee11aba), UINT64_C(0x9b69dbe1b548ce7c)},
+    {UINT64_C(0xfbe85badce996168), UINT64_C(0xc24452da229b021b)},
+    {UINT64_C(0xfae27299423fb9c3), UINT64_C(0xf2d56790ab41c2a2)},
+    {UINT64_C(0xdccd879fc967d41a), UINT64_C(0x97c560ba6b0919a5)},
+    {UINT64_C(0x5400e987bbc1c920), UINT64_C(0xbdb6b8e905cb600f)},
+    {UINT64_C(0x290123e9aab23b68), UINT64_C(0xed246723473e3813)},
+    {UINT64_C(0xf9a0b6720aaf6521), UINT64_C(0x9436c0760c86e30b)},
+    {UINT64_C(0xf808e40e8d5b3e69), UINT64_C(0xb94470938fa89bce)},
+    {UINT64_C(0xb60b1d1230b20e04), UINT64_C(0xe7958cb87392c2c2)},
+    {UINT64_C(0xb1c6f22b5e6f48c2), UINT64_C(0x90bd77f3483bb9b9)},
+    {UINT64_C(0x1e38aeb6360b1af3), UINT64_C(0xb4ecd5f01a4aa828)},
+    {UINT64_C(0x25c6da63c38de1b0), UINT64_C(0xe2280b6c20dd5232)},
+    {UINT64_C(0x579c487e5a38ad0e), UINT64_C(0x8d590723948a535f)},
+    {UINT64_C(0x2d835a9df0c6d851), UINT64_C(0xb0af48ec79ace837)},
+    {UINT64_C(0xf8e431456cf88e65), UINT64_C(0xdcdb1b2798182244)},
+    {UINT64_C(0x1b8e9ecb641b58ff), UINT64_C(0x8a08f0f8bf0f156b)},
+    {UINT64_C(0xe272467e3d222f3f), UINT64_C(0xac8b2d36eed2dac5)},
+    {UINT64_C(0x5b0ed81dcc6abb0f), UINT64_C(0xd7adf884aa879177)},
+    {UINT64_C(0x98e947129fc2b4e9), UINT64_C(0x86ccbb52ea94baea)},
+    {UINT64_C(0x3f2398d747b36224), UINT64_C(0xa87fea27a539e9a5)},
+    {UINT64_C(0x8eec7f0d19a03aad), UINT64_C(0xd29fe4b18e88640e)},
+    {UINT64_C(0x1953cf68300424ac), UINT64_C(0x83a3eeeef9153e89)},
+    {UINT64_C(0x5fa8c3423c052dd7), UINT64_C(0xa48ceaaab75a8e2b)},
+    {UINT64_C(0x3792f412cb06794d), UINT64_C(0xcdb02555653131b6)},
+    {UINT64_C(0xe2bbd88bbee40bd0), UINT64_C(0x808e17555f3ebf11)},
+    {UINT64_C(0x5b6aceaeae9d0ec4), UINT64_C(0xa0b19d2ab70e6ed6)},
+    {UINT64_C(0xf245825a5a445275), UINT64_C(0xc8de047564d20a8b)},
+    {UINT64_C(0xeed6e2f0f0d56712), UINT64_C(0xfb158592be068d2e)},
+    {UINT64_C(0x55464dd69685606b), UINT64_C(0x9ced737bb6c4183d)},
+    {UINT64_C(0xaa97e14c3c26b886), UINT64_C(0xc428d05aa4751e4c)},
+    {UINT64_C(0xd53dd99f4b3066a8), UINT64_C(0xf53304714d9265df)},
+    {UINT64_C(0xe546a8038efe4029), UINT64_C(0x993fe2c6d07b7fab)},
+    {UINT64_C(0xde98520472bdd033), UINT64_C(0xbf8fdb78849a5f96)},
+    {UINT64_C(0x963e66858f6d4440), UINT64_C(0xef73d256a5c0f77c)},
+    {UINT64_C(0xdde7001379a44aa8), UINT64_C(0x95a8637627989aad)},
+    {UINT64_C(0x5560c018580d5d52), UINT64_C(0xbb127c53b17ec159)},
+    {UINT64_C(0xaab8f01e6e10b4a6), UINT64_C(0xe9d71b689dde71af)},
+    {UINT64_C(0xcab3961304ca70e8), UINT64_C(0x9226712162ab070d)},
+    {UINT64_C(0x3d607b97c5fd0d22), UINT64_C(0xb6b00d69bb55c8d1)},
+    {UINT64_C(0x8cb89a7db77c506a), UINT64_C(0xe45c10c42a2b3b05)},
+    {UINT64_C(0x77f3608e92adb242), UINT64_C(0x8eb98a7a9a5b04e3)},
+    {UINT64_C(0x55f038b237591ed3), UINT64_C(0xb267ed1940f1c61c)},
+    {UINT64_C(0x6b6c46dec52f6688), UINT64_C(0xdf01e85f912e37a3)},
+    {UINT64_C(0x2323ac4b3b3da015), UINT64_C(0x8b61313bbabce2c6)},
+    {UINT64_C(0xabec975e0a0d081a), UINT64_C(0xae397d8aa96c1b77)},
+    {UINT64_C(0x96e7bd358c904a21), UINT64_C(0xd9c7dced53c72255)},
+    {UINT64_C(0x7e50d64177da2e54), UINT64_C(0x881cea14545c7575)},
+    {UINT64_C(0xdde50bd1d5d0b9e9), UINT64_C(0xaa242499697392d2)},
+    {UINT64_C(0x955e4ec64b44e864), UINT64_C(0xd4ad2dbfc3d07787)},
+    {UINT64_C(0xbd5af13bef0b113e), UINT64_C(0x84ec3c97da624ab4)},
+    {UINT64_C(0xecb1ad8aeacdd58e), UINT64_C(0xa6274bbdd0fadd61)},
+    {UINT64_C(0x67de18eda5814af2), UINT64_C(0xcfb11ead453994ba)},
+    {UINT64_C(0x80eacf948770ced7), UINT64_C(0x81ceb32c4b43fcf4)},
+    {UINT64_C(0xa1258379a94d028d), UINT64_C(0xa2425ff75e14fc31)},
+    {UINT64_C(0x096ee45813a04330), UINT64_C(0xcad2f7f5359a3b3e)},
+    {UINT64_C(0x8bca9d6e188853fc), UINT64_C(0xfd87b5f28300ca0d)},
+    {UINT64_C(0x775ea264cf55347e), UINT64_C(0x9e74d1b791e07e48)},
+    {UINT64_C(0x95364afe032a819e), UINT64_C(0xc612062576589dda)},
+    {UINT64_C(0x3a83ddbd83f52205), UINT64_C(0xf79687aed3eec551)},
+    {UINT64_C(0xc4926a9672793543), UINT64_C(0x9abe14cd44753b52)},
+    {UINT64_C(0x75b7053c0f178294), UINT64_C(0xc16d9a0095928a27)},
+    {UINT64_C(0x5324c68b12dd6339), UINT64_C(0xf1c90080baf72cb1)},
+    {UINT64_C(0xd3f6fc16ebca5e04), UINT64_C(0x971da05074da7bee)},
+    {UINT64_C(0x88f4bb1ca6bcf585), UINT64_C(0xbce5086492111aea)},
+    {UINT64_C(0x2b31e9e3d06c32e6), UINT64_C(0xec1e4a7db69561a5)},
+    {UINT64_C(0x3aff322e62439fd0), UINT64_C(0x9392ee8e921d5d07)},
+    {UINT64_C(0x09befeb9fad487c3), UINT64_C(0xb877aa3236a4b449)},
+    {UINT64_C(0x4c2ebe687989a9b4), UINT64_C(0xe69594bec44de15b)},
+    {UINT64_C(0x0f9d37014bf60a11), UINT64_C(0x901d7cf73ab0acd9)},
+    {UINT64_C(0x538484c19ef38c95), UINT64_C(0xb424dc35095cd80f)},
+    {UINT64_C(0x2865a5f206b06fba), UINT64_C(0xe12e13424bb40e13)},
+    {UINT64_C(0xf93f87b7442e45d4), UINT64_C(0x8cbccc096f5088cb)},
+    {UINT64_C(0xf78f69a51539d749), UINT64_C(0xafebff0bcb24aafe)},
+    {UINT64_C(0xb573440e5a884d1c), UINT64_C(0xdbe6fecebdedd5be)},
+    {UINT64_C(0x31680a88f8953031), UINT64_C(0x89705f4136b4a597)},
+    {UINT64_C(0xfdc20d2b36ba7c3e), UINT64_C(0xabcc77118461cefc)},
+    {UINT64_C(0x3d32907604691b4d), UINT64_C(0xd6bf94d5e57a42bc)},
+    {UINT64_C(0xa63f9a49c2c1b110), UINT64_C(0x8637bd05af6c69b5)},
+    {UINT64_C(0x0fcf80dc33721d54), UINT64_C(0xa7c5ac471b478423)},
+    {UINT64_C(0xd3c36113404ea4a9), UINT64_C(0xd1b71758e219652b)},
+    {UINT64_C(0x645a1cac083126ea), UINT64_C(0x83126e978d4fdf3b)},
+    {UINT64_C(0x3d70a3d70a3d70a4), UINT64_C(0xa3d70a3d70a3d70a)},
+    {UINT64_C(0xcccccccccccccccd), UINT64_C(0xcccccccccccccccc)},
+    {UINT64_C(0x0000000000000000), UINT64_C(0x8000000000000000)},
+    {UINT64_C(0x0000000000000000), UINT64_C(0xa000000000000000)},
+    {UINT64_C(0x0000000000000000), UINT64_C(0xc800000000000000)},
+    {UINT64_C(0x0000000000000000), UINT64_C(0xfa00000000000000)},
+    {UINT64_C(0x0000000000000000), UINT64_C(0x9c40000000000000)},
+    {UINT64_C(0x0000000000000000), UINT64_C(0xc350000000000000)},
+    {UINT64_C(0x0000000000000000), UINT64_C(0xf424000000000000)},
+    {UINT64_C(0x0000000000000000), UINT64_C(0x9896800000000000)},
+    {UINT64_C(0x0000000000000000), UINT64_C(0xbebc200000000000)},
+    {UINT64_C(0x0000000000000000), UINT64_C(0xee6b280000000000)},
+    {UINT64_C(0x0000000000000000), UINT64_C(0x9502f90000000000)},
+    {UINT64_C(0x0000000000000000), UINT64_C(0xba43b74000000000)},
+    {UINT64_C(0x0000000000000000), UINT64_C(0xe8d4a51000000000)},
+    {UINT64_C(0x0000000000000000), UINT64_C(0x9184e72a00000000)},
+    {UINT64_C(0x0000000000000000), UINT64_C(0xb5e620f480000000)},
+    {UINT64_C(0x0000000000000000), UINT64_C(0xe35fa931a0000000)},
+    {UINT64_C(0x0000000000000000), UINT64_C(0x8e1bc9bf04000000)},
+    {UINT64_C(0x0000000000000000), UINT64_C(0xb1a2bc2ec5000000)},
+    {UINT64_C(0x0000000000000000), UINT64_C(0xde0b6b3a76400000)},
+    {UINT64_C(0x0000000000000000), UINT64_C(0x8ac7230489e80000)},
+    {UINT64_C(0x0000000000000000), UINT64_C(0xad78ebc5ac620000)},
+    {UINT64_C(0x0000000000000000), UINT64_C(0xd8d726b7177a8000)},
+    {UINT64_C(0x0000000000000000), UINT64_C(0x878678326eac9000)},
+    {UINT64_C(0x0000000000000000), UINT64_C(0xa968163f0a57b400)},
+    {UINT64_C(0x0000000000000000), UINT64_C(0xd3c21bcecceda100)},
+    {UINT64_C(0x0000000000000000), UINT64_C(0x84595161401484a0)},
+    {UINT64_C(0x0000000000000000), UINT64_C(0xa56fa5b99019a5c8)},
+    {UINT64_C(0x0000000000000000), UINT64_C(0xcecb8f27f4200f3a)},
+    {UINT64_C(0x4000000000000000), UINT64_C(0x813f3978f8940984)},
+    {UINT64_C(0x5000000000000000), UINT64_C(0xa18f07d736b90be5)},
+    {UINT64_C(0xa400000000000000), UINT64_C(0xc9f2c9cd04674ede)},
+    {UINT64_C(0x4d00000000000000), UINT64_C(0xfc6f7c4045812296)},
+    {UINT64_C(0xf020000000000000), UINT64_C(0x9dc5ada82b70b59d)},
+    {UINT64_C(0x6c28000000000000), UINT64_C(0xc5371912364ce305)},
+    {UINT64_C(0xc732000000000000), UINT64_C(0xf684df56c3e01bc6)},
+    {UINT64_C(0x3c7f400000000000), UINT64_C(0x9a130b963a6c115c)},
+    {UINT64_C(0x4b9f100000000000), UINT64_C(0xc097ce7bc90715b3)},
+    {UINT64_C(0x1e86d40000000000), UINT64_C(0xf0bdc21abb48db20)},
+    {UINT64_C(0x1314448000000000), UINT64_C(0x96769950b50d88f4)},
+    {UINT64_C(0x17d955a000000000), UINT64_C(0xbc143fa4e250eb31)},
+    {UINT64_C(0x5dcfab0800000000), UINT64_C(0xeb194f8e1ae525fd)},
+    {UINT64_C(0x5aa1cae500000000), UINT64_C(0x92efd1b8d0cf37be)},
+    {UINT64_C(0xf14a3d9e40000000), UINT64_C(0xb7abc627050305ad)},
+    {UINT64_C(0x6d9ccd05d0000000), UINT64_C(0xe596b7b0c643c719)},
+    {UINT64_C(0xe4820023a2000000), UINT64_C(0x8f7e32ce7bea5c6f)},
+    {UINT64_C(0xdda2802c8a800000), UINT64_C(0xb35dbf821ae4f38b)},
+    {UINT64_C(0xd50b2037ad200000), UINT64_C(0xe0352f62a19e306e)},
+    {UINT64_C(0x4526f422cc340000), UINT64_C(0x8c213d9da502de45)},
+    {UINT64_C(0x9670b12b7f410000), UINT64_C(0xaf298d050e4395d6)},
+    {UINT64_C(0x3c0cdd765f114000), UINT64_C(0xdaf3f04651d47b4c)},
+    {UINT64_C(0xa5880a69fb6ac800), UINT64_C(0x88d8762bf324cd0f)},
+    {UINT64_C(0x8eea0d047a457a00), UINT64_C(0xab0e93b6efee0053)},
+    {UINT64_C(0x72a4904598d6d880), UINT64_C(0xd5d238a4abe98068)},
+    {UINT64_C(0x47a6da2b7f864750), UINT64_C(0x85a36366eb71f041)},
+    {UINT64_C(0x999090b65f67d924), UINT64_C(0xa70c3c40a64e6c51)},
+    {UINT64_C(0xfff4b4e3f741cf6d), UINT64_C(0xd0cf4b50cfe20765)},
+    {UINT64_C(0xbff8f10e7a8921a4), UINT64_C(0x82818f1281ed449f)},
+    {UINT64_C(0xaff72d52192b6a0d), UINT64_C(0xa321f2d7226895c7)},
+    {UINT64_C(0x9bf4f8a69f764490), UINT64_C(0xcbea6f8ceb02bb39)},
+    {UINT64_C(0x02f236d04753d5b4), UINT64_C(0xfee50b7025c36a08)},
+    {UINT64_C(0x01d762422c946590), UINT64_C(0x9f4f2726179a2245)},
+    {UINT64_C(0x424d3ad2b7b97ef5), UINT64_C(0xc722f0ef9d80aad6)},
+    {UINT64_C(0xd2e0898765a7deb2), UINT64_C(0xf8ebad2b84e0d58b)},
+    {UINT64_C(0x63cc55f49f88eb2f), UINT64_C(0x9b934c3b330c8577)},
+    {UINT64_C(0x3cbf6b71c76b25fb), UINT64_C(0xc2781f49ffcfa6d5)},
+    {UINT64_C(0x8bef464e3945ef7a), UINT64_C(0xf316271c7fc3908a)},
+    {UINT64_C(0x97758bf0e3cbb5ac), UINT64_C(0x97edd871cfda3a56)},
+    {UINT64_C(0x3d52eeed1cbea317), UINT64_C(0xbde94e8e43d0c8ec)},
+    {UINT64_C(0x4ca7aaa863ee4bdd), UINT64_C(0xed63a231d4c4fb27)},
+    {UINT64_C(0x8fe8caa93e74ef6a), UINT64_C(0x945e455f24fb1cf8)},
+    {UINT64_C(0xb3e2fd538e122b44), UINT64_C(0xb975d6b6ee39e436)},
+    {UINT64_C(0x60dbbca87196b616), UINT64_C(0xe7d34c64a9c85d44)},
+    {UINT64_C(0xbc8955e946fe31cd), UINT64_C(0x90e40fbeea1d3a4a)},
+    {UINT64_C(0x6babab6398bdbe41), UINT64_C(0xb51d13aea4a488dd)},
+    {UINT64_C(0xc696963c7eed2dd1), UINT64_C(0xe264589a4dcdab14)},
+    {UINT64_C(0xfc1e1de5cf543ca2), UINT64_C(0x8d7eb76070a08aec)},
+    {UINT64_C(0x3b25a55f43294bcb), UINT64_C(0xb0de65388cc8ada8)},
+    {UINT64_C(0x49ef0eb713f39ebe), UINT64_C(0xdd15fe86affad912)},
+    {UINT64_C(0x6e3569326c784337), UINT64_C(0x8a2dbf142dfcc7ab)},
+    {UINT64_C(0x49c2c37f07965404), UINT64_C(0xacb92ed9397bf996)},
+    {UINT64_C(0xdc33745ec97be906), UINT64_C(0xd7e77a8f87daf7fb)},
+    {UINT64_C(0x69a028bb3ded71a3), UINT64_C(0x86f0ac99b4e8dafd)},
+    {UINT64_C(0xc40832ea0d68ce0c), UINT64_C(0xa8acd7c0222311bc)},
+    {UINT64_C(0xf50a3fa490c30190), UINT64_C(0xd2d80db02aabd62b)},
+    {UINT64_C(0x792667c6da79e0fa), UINT64_C(0x83c7088e1aab65db)},
+    {UINT64_C(0x577001b891185938), UINT64_C(0xa4b8cab1a1563f52)},
+    {UINT64_C(0xed4c0226b55e6f86), UINT64_C(0xcde6fd5e09abcf26)},
+    {UINT64_C(0x544f8158315b05b4), UINT64_C(0x80b05e5ac60b6178)},
+    {UINT64_C(0x696361ae3db1c721), UINT64_C(0xa0dc75f1778e39d6)},
+    {UINT64_C(0x03bc3a19cd1e38e9), UINT64_C(0xc913936dd571c84c)},
+    {UINT64_C(0x04ab48a04065c723), UINT64_C(0xfb5878494ace3a5f)},
+    {UINT64_C(0x62eb0d64283f9c76), UINT64_C(0x9d174b2dcec0e47b)},
+    {UINT64_C(0x3ba5d0bd324f8394), UINT64_C(0xc45d1df942711d9a)},
+    {UINT64_C(0xca8f44ec7ee36479), UINT64_C(0xf5746577930d6500)},
+    {UINT64_C(0x7e998b13cf4e1ecb), UINT64_C(0x9968bf6abbe85f20)},
+    {UINT64_C(0x9e3fedd8c321a67e), UINT64_C(0xbfc2ef456ae276e8)},
+    {UINT64_C(0xc5cfe94ef3ea101e), UINT64_C(0xefb3ab16c59b14a2)},
+    {UINT64_C(0xbba1f1d158724a12), UINT64_C(0x95d04aee3b80ece5)},
+    {UINT64_C(0x2a8a6e45ae8edc97), UINT64_C(0xbb445da9ca61281f)},
+    {UINT64_C(0xf52d09d71a3293bd), UINT64_C(0xea1575143cf97226)},
+    {UINT64_C(0x593c2626705f9c56), UINT64_C(0x924d692ca61be758)},
+    {UINT64_C(0x6f8b2fb00c77836c), UINT64_C(0xb6e0c377cfa2e12e)},
+    {UINT64_C(0x0b6dfb9c0f956447), UINT64_C(0xe498f455c38b997a)},
+    {UINT64_C(0x4724bd4189bd5eac), UINT64_C(0x8edf98b59a373fec)},
+    {UINT64_C(0x58edec91ec2cb657), UINT64_C(0xb2977ee300c50fe7)},
+    {UINT64_C(0x2f2967b66737e3ed), UINT64_C(0xdf3d5e9bc0f653e1)},
+    {UINT64_C(0xbd79e0d20082ee74), UINT64_C(0x8b865b215899f46c)},
+    {UINT64_C(0xecd8590680a3aa11), UINT64_C(0xae67f1e9aec07187)},
+    {UINT64_C(0xe80e6f4820cc9495), UINT64_C(0xda01ee641a708de9)},
+    {UINT64_C(0x3109058d147fdcdd), UINT64_C(0x884134fe908658b2)},
+    {UINT64_C(0xbd4b46f0599fd415), UINT64_C(0xaa51823e34a7eede)},
+    {UINT64_C(0x6c9e18ac7007c91a), UINT64_C(0xd4e5e2cdc1d1ea96)},
+    {UINT64_C(0x03e2cf6bc604ddb0), UINT64_C(0x850fadc09923329e)},
+    {UINT64_C(0x84db8346b786151c), UINT64_C(0xa6539930bf6bff45)},
+    {UINT64_C(0xe612641865679a63), UINT64_C(0xcfe87f7cef46ff16)},
+    {UINT64_C(0x4fcb7e8f3f60c07e), UINT64_C(0x81f14fae158c5f6e)},
+    {UINT64_C(0xe3be5e330f38f09d), UINT64_C(0xa26da3999aef7749)},
+    {UINT64_C(0x5cadf5bfd3072cc5), UINT64_C(0xcb090c8001ab551c)},
+    {UINT64_C(0x73d9732fc7c8f7f6), UINT64_C(0xfdcb4fa002162a63)},
+    {UINT64_C(0x2867e7fddcdd9afa), UINT64_C(0x9e9f11c4014dda7e)},
+    {UINT64_C(0xb281e1fd541501b8), UINT64_C(0xc646d63501a1511d)},
+    {UINT64_C(0x1f225a7ca91a4226), UINT64_C(0xf7d88bc24209a565)},
+    {UINT64_C(0x3375788de9b06958), UINT64_C(0x9ae757596946075f)},
+    {UINT64_C(0x0052d6b1641c83ae), UINT64_C(0xc1a12d2fc3978937)},
+    {UINT64_C(0xc0678c5dbd23a49a), UINT64_C(0xf209787bb47d6b84)},
+    {UINT64_C(0xf840b7ba963646e0), UINT64_C(0x9745eb4d50ce6332)},
+    {UINT64_C(0xb650e5a93bc3d898), UINT64_C(0xbd176620a501fbff)},
+    {UINT64_C(0xa3e51f138ab4cebe), UINT64_C(0xec5d3fa8ce427aff)},
+    {UINT64_C(0xc66f336c36b10137), UINT64_C(0x93ba47c980e98cdf)},
+    {UINT64_C(0xb80b0047445d4184), UINT64_C(0xb8a8d9bbe123f017)},
+    {UINT64_C(0xa60dc059157491e5), UINT64_C(0xe6d3102ad96cec1d)},
+    {UINT64_C(0x87c89837ad68db2f), UINT64_C(0x9043ea1ac7e41392)},
+    {UINT64_C(0x29babe4598c311fb), UINT64_C(0xb454e4a179dd1877)},
+    {UINT64_C(0xf4296dd6fef3d67a), UINT64_C(0xe16a1dc9d8545e94)},
+    {UINT64_C(0x1899e4a65f58660c), UINT64_C(0x8ce2529e2734bb1d)},
+    {UINT64_C(0x5ec05dcff72e7f8f), UINT64_C(0xb01ae745b101e9e4)},
+    {UINT64_C(0x76707543f4fa1f73), UINT64_C(0xdc21a1171d42645d)},
+    {UINT64_C(0x6a06494a791c53a8), UINT64_C(0x899504ae72497eba)},
+    {UINT64_C(0x0487db9d17636892), UINT64_C(0xabfa45da0edbde69)},
+    {UINT64_C(0x45a9d2845d3c42b6), UINT64_C(0xd6f8d7509292d603)},
+    {UINT64_C(0x0b8a2392ba45a9b2), UINT64_C(0x865b86925b9bc5c2)},
+    {UINT64_C(0x8e6cac7768d7141e), UINT64_C(0xa7f26836f282b732)},
+    {UINT64_C(0x3207d795430cd926), UINT64_C(0xd1ef0244af2364ff)},
+    {UINT64_C(0x7f44e6bd49e807b8), UINT64_C(0x8335616aed761f1f)},
+    {UINT64_C(0x5f16206c9c6209a6), UINT64_C(0xa402b9c5a8d3a6e7)},
+    {UINT64_C(0x36dba887c37a8c0f), UINT64_C(0xcd036837130890a1)},
+    {UINT64_C(0xc2494954da2c9789), UINT64_C(0x802221226be55a64)},
+    {UINT64_C(0xf2db9baa10b7bd6c), UINT64_C(0xa02aa96b06deb0fd)},
+    {UINT64_C(0x6f92829494e5acc7), UINT64_C(0xc83553c5c8965d3d)},
+    {UINT64_C(0xcb772339ba1f17f9), UINT64_C(0xfa42a8b73abbf48c)},
+    {UINT64_C(0xff2a760414536efb), UINT64_C(0x9c69a97284b578d7)},
+    {UINT64_C(0xfef5138519684aba), UINT64_C(0xc38413cf25e2d70d)},
+    {UINT64_C(0x7eb258665fc25d69), UINT64_C(0xf46518c2ef5b8cd1)},
+    {UINT64_C(0xef2f773ffbd97a61), UINT64_C(0x98bf2f79d5993802)},
+    {UINT64_C(0xaafb550ffacfd8fa), UINT64_C(0xbeeefb584aff8603)},
+    {UINT64_C(0x95ba2a53f983cf38), UINT64_C(0xeeaaba2e5dbf6784)},
+    {UINT64_C(0xdd945a747bf26183), UINT64_C(0x952ab45cfa97a0b2)},
+    {UINT64_C(0x94f971119aeef9e4), UINT64_C(0xba756174393d88df)},
+    {UINT64_C(0x7a37cd5601aab85d), UINT64_C(0xe912b9d1478ceb17)},
+    {UINT64_C(0xac62e055c10ab33a), UINT64_C(0x91abb422ccb812ee)},
+    {UINT64_C(0x577b986b314d6009), UINT64_C(0xb616a12b7fe617aa)},
+    {UINT64_C(0xed5a7e85fda0b80b), UINT64_C(0xe39c49765fdf9d94)},
+    {UINT64_C(0x14588f13be847307), UINT64_C(0x8e41ade9fbebc27d)},
+    {UINT64_C(0x596eb2d8ae258fc8), UINT64_C(0xb1d219647ae6b31c)},
+    {UINT64_C(0x6fca5f8ed9aef3bb), UINT64_C(0xde469fbd99a05fe3)},
+    {UINT64_C(0x25de7bb9480d5854), UINT64_C(0x8aec23d680043bee)},
+    {UINT64_C(0xaf561aa79a10ae6a), UINT64_C(0xada72ccc20054ae9)},
+    {UINT64_C(0x1b2ba1518094da04), UINT64_C(0xd910f7ff28069da4)},
+    {UINT64_C(0x90fb44d2f05d0842), UINT64_C(0x87aa9aff79042286)},
+    {UINT64_C(0x353a1607ac744a53), UINT64_C(0xa99541bf57452b28)},
+    {UINT64_C(0x42889b8997915ce8), UINT64_C(0xd3fa922f2d1675f2)},
+    {UINT64_C(0x69956135febada11), UINT64_C(0x847c9b5d7c2e09b7)},
+    {UINT64_C(0x43fab9837e699095), UINT64_C(0xa59bc234db398c25)},
+    {UINT64_C(0x94f967e45e03f4bb), UINT64_C(0xcf02b2c21207ef2e)},
+    {UINT64_C(0x1d1be0eebac278f5), UINT64_C(0x8161afb94b44f57d)},
+    {UINT64_C(0x6462d92a69731732), UINT64_C(0xa1ba1ba79e1632dc)},
+    {UINT64_C(0x7d7b8f7503cfdcfe), UINT64_C(0xca28a291859bbf93)},
+    {UINT64_C(0x5cda735244c3d43e), UINT64_C(0xfcb2cb35e702af78)},
+    {UINT64_C(0x3a0888136afa64a7), UINT64_C(0x9defbf01b061adab)},
+    {UINT64_C(0x088aaa1845b8fdd0), UINT64_C(0xc56baec21c7a1916)},
+    {UINT64_C(0x8aad549e57273d45), UINT64_C(0xf6c69a72a3989f5b)},
+    {UINT64_C(0x36ac54e2f678864b), UINT64_C(0x9a3c2087a63f6399)},
+    {UINT64_C(0x84576a1bb416a7dd), UINT64_C(0xc0cb28a98fcf3c7f)},
+    {UINT64_C(0x656d44a2a11c51d5), UINT64_C(0xf0fdf2d3f3c30b9f)},
+    {UINT64_C(0x9f644ae5a4b1b325), UINT64_C(0x969eb7c47859e743)},
+    {UINT64_C(0x873d5d9f0dde1fee), UINT64_C(0xbc4665b596706114)},
+    {UINT64_C(0xa90cb506d155a7ea), UINT64_C(0xeb57ff22fc0c7959)},
+    {UINT64_C(0x09a7f12442d588f2), UINT64_C(0x9316ff75dd87cbd8)},
+    {UINT64_C(0x0c11ed6d538aeb2f), UINT64_C(0xb7dcbf5354e9bece)},
+    {UINT64_C(0x8f1668c8a86da5fa), UINT64_C(0xe5d3ef282a242e81)},
+    {UINT64_C(0xf96e017d694487bc), UINT64_C(0x8fa475791a569d10)},
+    {UINT64_C(0x37c981dcc395a9ac), UINT64_C(0xb38d92d760ec4455)},
+    {UINT64_C(0x85bbe253f47b1417), UINT64_C(0xe070f78d3927556a)},
+    {UINT64_C(0x93956d7478ccec8e), UINT64_C(0x8c469ab843b89562)},
+    {UINT64_C(0x387ac8d1970027b2), UINT64_C(0xaf58416654a6babb)},
+    {UINT64_C(0x06997b05fcc0319e), UINT64_C(0xdb2e51bfe9d0696a)},
+    {UINT64_C(0x441fece3bdf81f03), UINT64_C(0x88fcf317f22241e2)},
+    {UINT64_C(0xd527e81cad7626c3), UINT64_C(0xab3c2fddeeaad25a)},
+    {UINT64_C(0x8a71e223d8d3b074), UINT64_C(0xd60b3bd56a5586f1)},
+    {UINT64_C(0xf6872d5667844e49), UINT64_C(0x85c7056562757456)},
+    {UINT64_C(0xb428f8ac016561db), UINT64_C(0xa738c6bebb12d16c)},
+    {UINT64_C(0xe13336d701beba52), UINT64_C(0xd106f86e69d785c7)},
+    {UINT64_C(0xecc0024661173473), UINT64_C(0x82a45b450226b39c)},
+    {UINT64_C(0x27f002d7f95d0190), UINT64_C(0xa34d721642b06084)},
+    {UINT64_C(0x31ec038df7b441f4), UINT64_C(0xcc20ce9bd35c78a5)},
+    {UINT64_C(0x7e67047175a15271), UINT64_C(0xff290242c83396ce)},
+    {UINT64_C(0x0f0062c6e984d386), UINT64_C(0x9f79a169bd203e41)},
+    {UINT64_C(0x52c07b78a3e60868), UINT64_C(0xc75809c42c684dd1)},
+    {UINT64_C(0xa7709a56ccdf8a82), UINT64_C(0xf92e0c3537826145)},
+    {UINT64_C(0x88a66076400bb691), UINT64_C(0x9bbcc7a142b17ccb)},
+    {UINT64_C(0x6acff893d00ea435), UINT64_C(0xc2abf989935ddbfe)},
+    {UINT64_C(0x0583f6b8c4124d43), UINT64_C(0xf356f7ebf83552fe)},
+    {UINT64_C(0xc3727a337a8b704a), UINT64_C(0x98165af37b2153de)},
+    {UINT64_C(0x744f18c0592e4c5c), UINT64_C(0xbe1bf1b059e9a8d6)},
+    {UINT64_C(0x1162def06f79df73), UINT64_C(0xeda2ee1c7064130c)},
+    {UINT64_C(0x8addcb5645ac2ba8), UINT64_C(0x9485d4d1c63e8be7)},
+    {UINT64_C(0x6d953e2bd7173692), UINT64_C(0xb9a74a0637ce2ee1)},
+    {UINT64_C(0xc8fa8db6ccdd0437), UINT64_C(0xe8111c87c5c1ba99)},
+    {UINT64_C(0x1d9c9892400a22a2), UINT64_C(0x910ab1d4db9914a0)},
+    {UINT64_C(0x2503beb6d00cab4b), UINT64_C(0xb54d5e4a127f59c8)},
+    {UINT64_C(0x2e44ae64840fd61d), UINT64_C(0xe2a0b5dc971f303a)},
+    {UINT64_C(0x5ceaecfed289e5d2), UINT64_C(0x8da471a9de737e24)},
+    {UINT64_C(0x7425a83e872c5f47), UINT64_C(0xb10d8e1456105dad)},
+    {UINT64_C(0xd12f124e28f77719), UINT64_C(0xdd50f1996b947518)},
+    {UINT64_C(0x82bd6b70d99aaa6f), UINT64_C(0x8a5296ffe33cc92f)},
+    {UINT64_C(0x636cc64d1001550b), UINT64_C(0xace73cbfdc0bfb7b)},
+    {UINT64_C(0x3c47f7e05401aa4e), UINT64_C(0xd8210befd30efa5a)},
+    {UINT64_C(0x65acfaec34810a71), UINT64_C(0x8714a775e3e95c78)},
+    {UINT64_C(0x7f1839a741a14d0d), UINT64_C(0xa8d9d1535ce3b396)},
+    {UINT64_C(0x1ede48111209a050), UINT64_C(0xd31045a8341ca07c)},
+    {UINT64_C(0x934aed0aab460432), UINT64_C(0x83ea2b892091e44d)},
+    {UINT64_C(0xf81da84d5617853f), UINT64_C(0xa4e4b66b68b65d60)},
+    {UINT64_C(0x36251260ab9d668e), UINT64_C(0xce1de40642e3f4b9)},
+    {UINT64_C(0xc1d72b7c6b426019), UINT64_C(0x80d2ae83e9ce78f3)},
+    {UINT64_C(0xb24cf65b8612f81f), UINT64_C(0xa1075a24e4421730)},
+    {UINT64_C(0xdee033f26797b627), UINT64_C(0xc94930ae1d529cfc)},
+    {UINT64_C(0x169840ef017da3b1), UINT64_C(0xfb9b7cd9a4a7443c)},
+    {UINT64_C(0x8e1f289560ee864e), UINT64_C(0x9d412e0806e88aa5)},
+    {UINT64_C(0xf1a6f2bab92a27e2), UINT64_C(0xc491798a08a2ad4e)},
+    {UINT64_C(0xae10af696774b1db), UINT64_C(0xf5b5d7ec8acb58a2)},
+    {UINT64_C(0xacca6da1e0a8ef29), UINT64_C(0x9991a6f3d6bf1765)},
+    {UINT64_C(0x17fd090a58d32af3), UINT64_C(0xbff610b0cc6edd3f)},
+    {UINT64_C(0xddfc4b4cef07f5b0), UINT64_C(0xeff394dcff8a948e)},
+    {UINT64_C(0x4abdaf101564f98e), UINT64_C(0x95f83d0a1fb69cd9)},
+    {UINT64_C(0x9d6d1ad41abe37f1), UINT64_C(0xbb764c4ca7a4440f)},
+    {UINT64_C(0x84c86189216dc5ed), UINT64_C(0xea53df5fd18d5513)},
+    {UINT64_C(0x32fd3cf5b4e49bb4), UINT64_C(0x92746b9be2f8552c)},
+    {UINT64_C(0x3fbc8c33221dc2a1), UINT64_C(0xb7118682dbb66a77)},
+    {UINT64_C(0x0fabaf3feaa5334a), UINT64_C(0xe4d5e82392a40515)},
+    {UINT64_C(0x29cb4d87f2a7400e), UINT64_C(0x8f05b1163ba6832d)},
+    {UINT64_C(0x743e20e9ef511012), UINT64_C(0xb2c71d5bca9023f8)},
+    {UINT64_C(0x914da9246b255416), UINT64_C(0xdf78e4b2bd342cf6)},
+    {UINT64_C(0x1ad089b6c2f7548e), UINT64_C(0x8bab8eefb6409c1a)},
+    {UINT64_C(0xa184ac2473b529b1), UINT64_C(0xae9672aba3d0c320)},
+    {UINT64_C(0xc9e5d72d90a2741e), UINT64_C(0xda3c0f568cc4f3e8)},
+    {UINT64_C(0x7e2fa67c7a658892), UINT64_C(0x8865899617fb1871)},
+    {UINT64_C(0xddbb901b98feeab7), UINT64_C(0xaa7eebfb9df9de8d)},
+    {UINT64_C(0x552a74227f3ea565), UINT64_C(0xd51ea6fa85785631)},
+    {UINT64_C(0xd53a88958f87275f), UINT64_C(0x8533285c936b35de)},
+    {UINT64_C(0x8a892abaf368f137), UINT64_C(0xa67ff273b8460356)},
+    {UINT64_C(0x2d2b7569b0432d85), UINT64_C(0xd01fef10a657842c)},
+    {UINT64_C(0x9c3b29620e29fc73), UINT64_C(0x8213f56a67f6b29b)},
+    {UINT64_C(0x8349f3ba91b47b8f), UINT64_C(0xa298f2c501f45f42)},
+    {UINT64_C(0x241c70a936219a73), UINT64_C(0xcb3f2f7642717713)},
+    {UINT64_C(0xed238cd383aa0110), UINT64_C(0xfe0efb53d30dd4d7)},
+    {UINT64_C(0xf4363804324a40aa), UINT64_C(0x9ec95d1463e8a506)},
+    {UINT64_C(0xb143c6053edcd0d5), UINT64_C(0xc67bb4597ce2ce48)},
+    {UINT64_C(0xdd94b7868e94050a), UINT64_C(0xf81aa16fdc1b81da)},
+    {UINT64_C(0xca7cf2b4191c8326), UINT64_C(0x9b10a4e5e9913128)},
+    {UINT64_C(0xfd1c2f611f63a3f0), UINT64_C(0xc1d4ce1f63f57d72)},
+    {UINT64_C(0xbc633b39673c8cec), UINT64_C(0xf24a01a73cf2dccf)},
+    {UINT64_C(0xd5be0503e085d813), UINT64_C(0x976e41088617ca01)},
+    {UINT64_C(0x4b2d8644d8a74e18), UINT64_C(0xbd49d14aa79dbc82)},
+    {UINT64_C(0xddf8e7d60ed1219e), UINT64_C(0xec9c459d51852ba2)},
+    {UINT64_C(0xcabb90e5c942b503), UINT64_C(0x93e1ab8252f33b45)},
+    {UINT64_C(0x3d6a751f3b936243), UINT64_C(0xb8da1662e7b00a17)},
+    {UINT64_C(0x0cc512670a783ad4), UINT64_C(0xe7109bfba19c0c9d)},
+    {UINT64_C(0x27fb2b80668b24c5), UINT64_C(0x906a617d450187e2)},
+    {UINT64_C(0xb1f9f660802dedf6), UINT64_C(0xb484f9dc9641e9da)},
+    {UINT64_C(0x5e7873f8a0396973), UINT64_C(0xe1a63853bbd26451)},
+    {UINT64_C(0xdb0b487b6423e1e8), UINT64_C(0x8d07e33455637eb2)},
+    {UINT64_C(0x91ce1a9a3d2cda62), UINT64_C(0xb049dc016abc5e5f)},
+    {UINT64_C(0x7641a140cc7810fb), UINT64_C(0xdc5c5301c56b75f7)},
+    {UINT64_C(0xa9e904c87fcb0a9d), UINT64_C(0x89b9b3e11b6329ba)},
+    {UINT64_C(0x546345fa9fbdcd44), UINT64_C(0xac2820d9623bf429)},
+    {UINT64_C(0xa97c177947ad4095), UINT64_C(0xd732290fbacaf133)},
+    {UINT64_C(0x49ed8eabcccc485d), UINT64_C(0x867f59a9d4bed6c0)},
+    {UINT64_C(0x5c68f256bfff5a74), UINT64_C(0xa81f301449ee8c70)},
+    {UINT64_C(0x73832eec6fff3111), UINT64_C(0xd226fc195c6a2f8c)},
+    {UINT64_C(0xc831fd53c5ff7eab), UINT64_C(0x83585d8fd9c25db7)},
+    {UINT64_C(0xba3e7ca8b77f5e55), UINT64_C(0xa42e74f3d032f525)},
+    {UINT64_C(0x28ce1bd2e55f35eb), UINT64_C(0xcd3a1230c43fb26f)},
+    {UINT64_C(0x7980d163cf5b81b3), UINT64_C(0x80444b5e7aa7cf85)},
+    {UINT64_C(0xd7e105bcc332621f), UINT64_C(0xa0555e361951c366)},
+    {UINT64_C(0x8dd9472bf3fefaa7), UINT64_C(0xc86ab5c39fa63440)},
+    {UINT64_C(0xb14f98f6f0feb951), UINT64_C(0xfa856334878fc150)},
+    {UINT64_C(0x6ed1bf9a569f33d3), UINT64_C(0x9c935e00d4b9d8d2)},
+    {UINT64_C(0x0a862f80ec4700c8), UINT64_C(0xc3b8358109e84f07)},
+    {UINT64_C(0xcd27bb612758c0fa), UINT64_C(0xf4a642e14c6262c8)},
+    {UINT64_C(0x8038d51cb897789c), UINT64_C(0x98e7e9cccfbd7dbd)},
+    {UINT64_C(0xe0470a63e6bd56c3), UINT64_C(0xbf21e44003acdd2c)},
+    {UINT64_C(0x1858ccfce06cac74), UINT64_C(0xeeea5d5004981478)},
+    {UINT64_C(0x0f37801e0c43ebc8), UINT64_C(0x95527a5202df0ccb)},
+    {UINT64_C(0xd30560258f54e6ba), UINT64_C(0xbaa718e68396cffd)},
+    {UINT64_C(0x47c6b82ef32a2069), UINT64_C(0xe950df20247c83fd)},
+    {UINT64_C(0x4cdc331d57fa5441), UINT64_C(0x91d28b7416cdd27e)},
+    {UINT64_C(0xe0133fe4adf8e952), UINT64_C(0xb6472e511c81471d)},
+    {UINT64_C(0x58180fddd97723a6), UINT64_C(0xe3d8f9e563a198e5)},
+    {UINT64_C(0x570f09eaa7ea7648), UINT64_C(0x8e679c2f5e44ff8f)},
+};
+
+} // namespace __charconv
+
+_LIBCPP_END_NAMESPACE_STD
+
+#endif // _LIBCPP_CHARCONV_TABLES_H
@@ -0,0 +1,643 @@
+//===------------------------ memory_resource.cpp -------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "memory_resource"
+
+#ifndef _LIBCPP_HAS_NO_ATOMIC_HEADER
+#include "atomic"
+#endif
+#ifndef _LIBCPP_HAS_NO_THREADS
+#include "mutex"
+#endif
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+namespace pmr
+{
+
+// [mem.res.class]
+
+memory_resource::~memory_resource() {}
+
+// [mem.res.global]
+
+class _LIBCPP_TYPE_VIS __new_delete_memory_resource_imp
+    : public memory_resource
+{
+    void* do_allocate(size_t __bytes, size_t __align) override
+        { return _VSTD::__libcpp_allocate(__bytes, __align); }
+
+    void do_deallocate(void* __p, size_t, size_t __align) override
+        { _VSTD::__libcpp_deallocate(__p, __align); }
+
+    bool do_is_equal(const memory_resource& __other) const _NOEXCEPT override
+        { return &__other == this; }
+
+public:
+    ~__new_delete_memory_resource_imp() override = default;
+};
+
+class _LIBCPP_TYPE_VIS __null_memory_resource_imp
+    : public memory_resource
+{
+    void* do_allocate(size_t, size_t) override
+        { __throw_bad_alloc(); }
+
+    void do_deallocate(void*, size_t, size_t) override
+        {}
+
+    bool do_is_equal(const memory_resource& __other) const _NOEXCEPT override
+        { return &__other == this; }
+
+public:
+    ~__null_memory_resource_imp() override = default;
+};
+
+namespace {
+
+// The global resources must outlive every object with static storage
+// duration, so they are constructed before them and never destroyed.
+struct __resources_t
+{
+    __new_delete_memory_resource_imp __new_delete_res;
+    __null_memory_resource_imp __null_res;
+};
+
+union __resource_init_helper
+{
+    __resources_t __resources;
+    char __dummy;
+
+    _LIBCPP_CONSTEXPR_AFTER_CXX11 __resource_init_helper() : __resources() {}
+    ~__resource_init_helper() {}
+};
+
+_LIBCPP_SAFE_STATIC __resource_init_helper __res_init;
+
+} // namespace
+
+memory_resource* new_delete_resource() _NOEXCEPT
+{
+    return &__res_init.__resources.__new_delete_res;
+}
+
+memory_resource* null_memory_resource() _NOEXCEPT
+{
+    return &__res_init.__resources.__null_res;
+}
+
+static memory_resource*
+__default_memory_resource(bool __set = false,
+                          memory_resource* __new_res = nullptr) _NOEXCEPT
+{
+#ifndef _LIBCPP_HAS_NO_ATOMIC_HEADER
+    _LIBCPP_SAFE_STATIC static atomic<memory_resource*> __res(
+        &__res_init.__resources.__new_delete_res);
+    if (__set)
+    {
+        __new_res = __new_res ? __new_res : new_delete_resource();
+        return _VSTD::atomic_exchange_explicit(&__res, __new_res,
+                                               memory_order_acq_rel);
+    }
+    return _VSTD::atomic_load_explicit(&__res, memory_order_acquire);
+#else
+    _LIBCPP_SAFE_STATIC static memory_resource* __res =
+        &__res_init.__resources.__new_delete_res;
+    if (__set)
+    {
+        __new_res = __new_res ? __new_res : new_delete_resource();
+        memory_resource* __old_res = __res;
+        __res = __new_res;
+        return __old_res;
+    }
+    return __res;
+#endif
+}
+
+memory_resource* get_default_resource() _NOEXCEPT
+{
+    return __default_memory_resource();
+}
+
+memory_resource* set_default_resource(memory_resource* __new_res) _NOEXCEPT
+{
+    return __default_memory_resource(true, __new_res);
+}
+
+// [mem.res.pool]
+
+static size_t __roundup(size_t __count, size_t __align)
+{
+    const size_t __mask = __align - 1;
+    return (__count + __mask) & ~__mask;
+}
+
+namespace {
+
+// The smallest pool block: every free block must hold a pointer.
+const int __log2_smallest_block_size = 3;
+const size_t __smallest_block_size = size_t(1) << __log2_smallest_block_size;
+
+const size_t __default_largest_block_size = size_t(1) << 16;
+const size_t __max_largest_block_size = size_t(1) << 30;
+
+const size_t __default_max_blocks_per_chunk = size_t(1) << 20;
+const size_t __max_bytes_per_first_chunk = 4096;
+
+// Blocks are aligned to their size, but not beyond what operator new
+// guarantees, so that chunks can be obtained without over-alignment.
+const size_t __max_block_align = alignof(max_align_t);
+
+} // namespace
+
+struct unsynchronized_pool_resource::__adhoc_footer
+{
+    __adhoc_footer* __prev_;
+    __adhoc_footer* __next_;
+    char* __start_;
+    size_t __align_;
+
+    size_t __allocation_size()
+    {
+        return (reinterpret_cast<char*>(this) - __start_) + sizeof(*this);
+    }
+};
+
+class unsynchronized_pool_resource::__fixed_pool
+{
+    struct __chunk_footer
+    {
+        __chunk_footer* __next_;
+        char* __start_;
+        size_t __align_;
+
+        size_t __allocation_size()
+        {
+            return (reinterpret_cast<char*>(this) - __start_) + sizeof(*this);
+        }
+    };
+
+    struct __vacancy_header
+    {
+        __vacancy_header* __next_vacancy_;
+    };
+
+    __chunk_footer* __first_chunk_;
+    __vacancy_header* __first_vacancy_;
+    size_t __first_blocks_;
+    size_t __next_blocks_;
+
+public:
+    explicit __fixed_pool(size_t __first_blocks)
+      : __first_chunk_(nullptr), __first_vacancy_(nullptr),
+        __first_blocks_(__first_blocks), __next_blocks_(__first_blocks)
+    {}
+
+    void __release(memory_resource* __upstream)
+    {
+        __chunk_footer* __next;
+        for (__chunk_footer* __c = __first_chunk_; __c != nullptr; __c = __next)
+        {
+            __next = __c->__next_;
+            __upstream->deallocate(__c->__start_, __c->__allocation_size(),
+                                   __c->__align_);
+        }
+        __first_chunk_ = nullptr;
+        __first_vacancy_ = nullptr;
+        __next_blocks_ = __first_blocks_;
+    }
+
+    void* __try_allocate_from_vacancies()
+    {
+        __vacancy_header* __v = __first_vacancy_;
+        if (__v != nullptr)
+            __first_vacancy_ = __v->__next_vacancy_;
+        return __v;
+    }
+
+    // Returns the first block of a new chunk and puts the rest of the blocks
+    // on the free list.
+    void* __allocate_in_new_chunk(memory_resource* __upstream,
+                                  size_t __block_size,
+                                  size_t __max_blocks_per_chunk)
+    {
+        const size_t __blocks = __next_blocks_;
+        // Only possible where size_t is narrower than 64 bits.
+        if (__blocks > (numeric_limits<size_t>::max() -
+                        sizeof(__chunk_footer)) / __block_size)
+            __throw_bad_alloc();
+        const size_t __footer_offset = __blocks * __block_size;
+        const size_t __align =
+            _VSTD::max(_VSTD::min(__block_size, __max_block_align),
+                       alignof(__chunk_footer));
+        char* __start = static_cast<char*>(__upstream->allocate(
+            __footer_offset + sizeof(__chunk_footer), __align));
+
+        __chunk_footer* __f =
+            reinterpret_cast<__chunk_footer*>(__start + __footer_offset);
+        __f->__next_ = __first_chunk_;
+        __f->__start_ = __start;
+        __f->__align_ = __align;
+        __first_chunk_ = __f;
+
+        // Link the blocks in address order, which is the order in which they
+        // are handed out.
+        __vacancy_header* __first = __first_vacancy_;
+        for (size_t __i = __blocks - 1; __i > 0; --__i)
+        {
+            __vacancy_header* __v =
+                reinterpret_cast<__vacancy_header*>(__start +
+                                                    __i * __block_size);
+            __v->__next_vacancy_ = __first;
+            __first = __v;
+        }
+        __first_vacancy_ = __first;
+
+        if (__next_blocks_ < __max_blocks_per_chunk)
+            __next_blocks_ = _VSTD::min(__next_blocks_ * 2,
+                                        __max_blocks_per_chunk);
+        return __start;
+    }
+
+    void __release_block(void* __p)
+    {
+        __vacancy_header* __v = static_cast<__vacancy_header*>(__p);
+        __v->__next_vacancy_ = __first_vacancy_;
+        __first_vacancy_ = __v;
+    }
+};
+
+unsynchronized_pool_resource::unsynchronized_pool_resource(
+    const pool_options& __opts, memory_resource* __upstream)
+  : __res_(__upstream), __adhoc_first_(nullptr), __fixed_pools_(nullptr)
+{
+    size_t __largest = __opts.largest_required_pool_block;
+    if (__largest == 0)
+        __largest = __default_largest_block_size;
+    else if (__largest < __smallest_block_size)
+        __largest = __smallest_block_size;
+    else if (__largest > __max_largest_block_size)
+        __largest = __max_largest_block_size;
+
+    __num_fixed_pools_ = 1;
+    for (size_t __b = __smallest_block_size; __b < __largest; __b *= 2)
+        ++__num_fixed_pools_;
+
+    size_t __max_blocks = __opts.max_blocks_per_chunk;
+    if (__max_blocks == 0 || __max_blocks > __default_max_blocks_per_chunk)
+        __max_blocks = __default_max_blocks_per_chunk;
+    __options_max_blocks_per_chunk_ = static_cast<uint32_t>(__max_blocks);
+}
+
+unsynchronized_pool_resource::~unsynchronized_pool_resource()
+{
+    release();
+}
+
+void unsynchronized_pool_resource::release()
+{
+    __release_chunks();
+    if (__fixed_pools_ != nullptr)
+    {
+        for (int __i = 0; __i < __num_fixed_pools_; ++__i)
+            __fixed_pools_[__i].~__fixed_pool();
+        __res_->deallocate(__fixed_pools_,
+                           __num_fixed_pools_ * sizeof(__fixed_pool),
+                           alignof(__fixed_pool));
+        __fixed_pools_ = nullptr;
+    }
+}
+
+void unsynchronized_pool_resource::__release_chunks()
+{
+    __adhoc_footer* __next;
+    for (__adhoc_footer* __f = __adhoc_first_; __f != nullptr; __f = __next)
+    {
+        __next = __f->__next_;
+        __res_->deallocate(__f->__start_, __f->__allocation_size(),
+                           __f->__align_);
+    }
+    __adhoc_first_ = nullptr;
+
+    if (__fixed_pools_ != nullptr)
+        for (int __i = 0; __i < __num_fixed_pools_; ++__i)
+            __fixed_pools_[__i].__release(__res_);
+}
+
+void unsynchronized_pool_resource::__init_fixed_pools()
+{
+    __fixed_pools_ = static_cast<__fixed_pool*>(__res_->allocate(
+        __num_fixed_pools_ * sizeof(__fixed_pool), alignof(__fixed_pool)));
+    for (int __j = 0; __j < __num_fixed_pools_; ++__j)
+    {
+        const size_t __block_size = __smallest_block_size << __j;
+        size_t __first_blocks = __max_bytes_per_first_chunk / __block_size;
+        __first_blocks = _VSTD::max(__first_blocks, size_t(1));
+        __first_blocks = _VSTD::min(
+            __first_blocks, size_t(__options_max_blocks_per_chunk_));
+        ::new (static_cast<void*>(&__fixed_pools_[__j]))
+            __fixed_pool(__first_blocks);
+    }
+}
+
+pool_options unsynchronized_pool_resource::options() const
+{
+    pool_options __p;
+    __p.max_blocks_per_chunk = __options_max_blocks_per_chunk_;
+    __p.largest_required_pool_block =
+        __smallest_block_size << (__num_fixed_pools_ - 1);
+    return __p;
+}
+
+int unsynchronized_pool_resource::__pool_index(size_t __bytes,
+                                               size_t __align) const
+{
+    if (__align > __max_block_align ||
+        __bytes > (__smallest_block_size << (__num_fixed_pools_ - 1)))
+        return __num_fixed_pools_;
+    size_t __n = _VSTD::max(__bytes, __align);
+    int __i = 0;
+    for (size_t __b = __smallest_block_size; __b < __n; __b *= 2)
+        ++__i;
+    return __i;
+}
+
+void* unsynchronized_pool_resource::do_allocate(size_t __bytes, size_t __align)
+{
+    // A pool allocation is a push or pop on the free list of its size class;
+    // a new chunk is obtained from upstream only when the list is empty.
+    int __i = __pool_index(__bytes, __align);
+    if (__i == __num_fixed_pools_)
+    {
+        // Too large for any pool: forward to upstream and remember the
+        // allocation so that release() can return it.
+        if (__bytes > numeric_limits<size_t>::max() - sizeof(__adhoc_footer) -
+                          alignof(__adhoc_footer))
+            __throw_bad_alloc();
+        const size_t __footer_offset =
+            __roundup(__bytes, alignof(__adhoc_footer));
+        const size_t __footer_align =
+            _VSTD::max(__align, alignof(__adhoc_footer));
+        char* __start = static_cast<char*>(
+            __res_->allocate(__footer_offset + sizeof(__adhoc_footer),
+                             __footer_align));
+        __adhoc_footer* __f =
+            reinterpret_cast<__adhoc_footer*>(__start + __footer_offset);
+        __f->__prev_ = nullptr;
+        __f->__next_ = __adhoc_first_;
+        __f->__start_ = __start;
+        __f->__align_ = __footer_align;
+        if (__adhoc_first_ != nullptr)
+            __adhoc_first_->__prev_ = __f;
+        __adhoc_first_ = __f;
+        return __start;
+    }
+
+    if (__fixed_pools_ == nullptr)
+        __init_fixed_pools();
+
+    __fixed_pool& __pool = __fixed_pools_[__i];
+    if (void* __result = __pool.__try_allocate_from_vacancies())
+        return __result;
+    return __pool.__allocate_in_new_chunk(__res_, __smallest_block_size << __i,
+                                          __options_max_blocks_per_chunk_);
+}
+
+void unsynchronized_pool_resource::do_deallocate(void* __p, size_t __bytes,
+                                                 size_t __align)
+{
+    _LIBCPP_ASSERT(__p != nullptr, "deallocating a null pointer");
+    int __i = __pool_index(__bytes, __align);
+    if (__i == __num_fixed_pools_)
+    {
+        __adhoc_footer* __f = reinterpret_cast<__adhoc_footer*>(
+            static_cast<char*>(__p) +
+            __roundup(__bytes, alignof(__adhoc_footer)));
+        _LIBCPP_ASSERT(__f->__start_ == __p,
+                       "deallocating a block not allocated by this resource");
+        if (__f->__prev_ != nullptr)
+            __f->__prev_->__next_ = __f->__next_;
+        else
+            __adhoc_first_ = __f->__next_;
+        if (__f->__next_ != nullptr)
+            __f->__next_->__prev_ = __f->__prev_;
+        __res_->deallocate(__f->__start_, __f->__allocation_size(),
+                           __f->__align_);
+        return;
+    }
+    _LIBCPP_ASSERT(__fixed_pools_ != nullptr,
+                   "deallocating a block not allocated by this resource");
+    __fixed_pools_[__i].__release_block(__p);
+}
+
+// synchronized_pool_resource
+
+struct alignas(64) synchronized_pool_resource::__pool_lock
+{
+#ifndef _LIBCPP_HAS_NO_THREADS
+    mutex __mut_;
+#endif
+
+    void __lock()
+    {
+#ifndef _LIBCPP_HAS_NO_THREADS
+        __mut_.lock();
+#endif
+    }
+
+    void __unlock()
+    {
+#ifndef _LIBCPP_HAS_NO_THREADS
+        __mut_.unlock();
+#endif
+    }
+};
+
+namespace {
+
+template <class _Lock>
+class __pool_guard
+{
+    _Lock& __l_;
+
+public:
+    explicit __pool_guard(_Lock& __l) : __l_(__l) { __l_.__lock(); }
+    ~__pool_guard() { __l_.__unlock(); }
+
+    __pool_guard(const __pool_guard&) = delete;
+    __pool_guard& operator=(const __pool_guard&) = delete;
+};
+
+} // namespace
+
+synchronized_pool_resource::synchronized_pool_resource(
+    const pool_options& __opts, memory_resource* __upstream)
+  : __unsync_(__opts, __upstream), __locks_(nullptr)
+{
+    // The pools are set up here because the locks only protect their
+    // contents.
+    const size_t __num_locks = __unsync_.__num_fixed_pools_ + 1;
+    __unsync_.__init_fixed_pools();
+    __locks_ = static_cast<__pool_lock*>(__upstream->allocate(
+        __num_locks * sizeof(__pool_lock), alignof(__pool_lock)));
+    for (size_t __i = 0; __i < __num_locks; ++__i)
+        ::new (static_cast<void*>(&__locks_[__i])) __pool_lock();
+}
+
+synchronized_pool_resource::~synchronized_pool_resource()
+{
+    const size_t __num_locks = __unsync_.__num_fixed_pools_ + 1;
+    for (size_t __i = 0; __i < __num_locks; ++__i)
+        __locks_[__i].~__pool_lock();
+    __unsync_.__res_->deallocate(__locks_, __num_locks * sizeof(__pool_lock),
+                                 alignof(__pool_lock));
+}
+
+synchronized_pool_resource::__pool_lock&
+synchronized_pool_resource::__upstream_lock()
+{
+    return __locks_[__unsync_.__num_fixed_pools_];
+}
+
+void synchronized_pool_resource::release()
+{
+    // Locks are always taken in index order, the upstream lock last.
+    const int __num_locks = __unsync_.__num_fixed_pools_ + 1;
+    for (int __i = 0; __i < __num_locks; ++__i)
+        __locks_[__i].__lock();
+    __unsync_.__release_chunks();
+    for (int __i = __num_locks; __i > 0; --__i)
+        __locks_[__i - 1].__unlock();
+}
+
+void* synchronized_pool_resource::do_allocate(size_t __bytes, size_t __align)
+{
+    int __i = __unsync_.__pool_index(__bytes, __align);
+    if (__i == __unsync_.__num_fixed_pools_)
+    {
+        __pool_guard<__pool_lock> __g(__upstream_lock());
+        return __unsync_.do_allocate(__bytes, __align);
+    }
+
+    __pool_guard<__pool_lock> __g(__locks_[__i]);
+    unsynchronized_pool_resource::__fixed_pool& __pool =
+        __unsync_.__fixed_pools_[__i];
+    if (void* __result = __pool.__try_allocate_from_vacancies())
+        return __result;
+    __pool_guard<__pool_lock> __ug(__upstream_lock());
+    return __pool.__allocate_in_new_chunk(
+        __unsync_.__res_, __smallest_block_size << __i,
+        __unsync_.__options_max_blocks_per_chunk_);
+}
+
+void synchronized_pool_resource::do_deallocate(void* __p, size_t __bytes,
+                                               size_t __align)
+{
+    int __i = __unsync_.__pool_index(__bytes, __align);
+    __pool_guard<__pool_lock> __g(__i == __unsync_.__num_fixed_pools_
+                                      ? __upstream_lock()
+                                      : __locks_[__i]);
+    __unsync_.do_deallocate(__p, __bytes, __align);
+}
+
+// [mem.res.monotonic.buffer]
+
+struct monotonic_buffer_resource::__chunk_footer
+{
+    __chunk_footer* __next_;
+    char* __start_;
+    size_t __align_;
+
+    size_t __allocation_size()
+    {
+        return (reinterpret_cast<char*>(this) - __start_) + sizeof(*this);
+    }
+};
+
+monotonic_buffer_resource::~monotonic_buffer_resource()
+{
+    release();
+}
+
+void monotonic_buffer_resource::release()
+{
+    __chunk_footer* __next;
+    for (__chunk_footer* __c = __chunks_; __c != nullptr; __c = __next)
+    {
+        __next = __c->__next_;
+        __res_->deallocate(__c->__start_, __c->__allocation_size(),
+                           __c->__align_);
+    }
+    __chunks_ = nullptr;
+    __begin_ = __initial_;
+    __cur_ = __initial_ ? __initial_ + __initial_size_ : nullptr;
+    __next_size_ = __initial_size_ > 0 ? __initial_size_ : 1;
+}
+
+// Carves __bytes bytes aligned to __align from the end of [__begin, __cur).
+static char* __try_allocate_downward(char* __begin, char* __cur, size_t __bytes,
+                                     size_t __align)
+{
+    if (__cur == nullptr || size_t(__cur - __begin) < __bytes)
+        return nullptr;
+    uintptr_t __p = reinterpret_cast<uintptr_t>(__cur) - __bytes;
+    __p &= ~uintptr_t(__align - 1);
+    if (__p < reinterpret_cast<uintptr_t>(__begin))
+        return nullptr;
+    return reinterpret_cast<char*>(__p);
+}
+
+void* monotonic_buffer_resource::do_allocate(size_t __bytes, size_t __align)
+{
+    // Distinct allocations must have distinct addresses.
+    if (__bytes == 0)
+        __bytes = 1;
+
+    if (char* __result = __try_allocate_downward(__begin_, __cur_, __bytes,
+                                                 __align))
+    {
+        __cur_ = __result;
+        return __result;
+    }
+
+    if (__bytes > numeric_limits<size_t>::max() / 2 - sizeof(__chunk_footer))
+        __throw_bad_alloc();
+
+    // Grow geometrically so that the number of upstream calls is logarithmic
+    // in the total size allocated.
+    size_t __capacity = _VSTD::max(__bytes, __next_size_);
+    __capacity = __roundup(__capacity, alignof(__chunk_footer));
+    const size_t __chunk_align = _VSTD::max(
+        _VSTD::max(__align, alignof(__chunk_footer)),
+        size_t(__default_buffer_alignment));
+    char* __start = static_cast<char*>(
+        __res_->allocate(__capacity + sizeof(__chunk_footer), __chunk_align));
+
+    __chunk_footer* __c =
+        reinterpret_cast<__chunk_footer*>(__start + __capacity);
+    __c->__next_ = __chunks_;
+    __c->__start_ = __start;
+    __c->__align_ = __chunk_align;
+    __chunks_ = __c;
+
+    __begin_ = __start;
+    __cur_ = __start + __capacity;
+    if (__capacity <= numeric_limits<size_t>::max() / 2)
+        __next_size_ = __capacity * 2;
+
+    char* __result =
+        __try_allocate_downward(__begin_, __cur_, __bytes, __align);
+    _LIBCPP_ASSERT(__result != nullptr, "new chunk too small for allocation");
+    __cur_ = __result;
+    return __result;
+}
+
+} // namespace pmr
+
+_LIBCPP_END_NAMESPACE_STD
@@ -0,0 +1,149 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// <algorithm>
+
+// Test find, count and mismatch on contiguous ranges of integers, which are
+// vectorized on some targets, at every length and position around the vector
+// sizes.
+
+#include <algorithm>
+#include <vector>
+#include <cassert>
+
+#include "test_macros.h"
+
+template <class T>
+void test_find_count()
+{
+    for (int n = 0; n < 80; ++n)
+    {
+        std::vector<T> v(n + 1, T(1));
+        T* first = v.data() + 1; // misaligned
+        T* last = first + n;
+        assert(std::find(first, last, T(2)) == last);
+        assert(std::count(first, last, T(2)) == 0);
+        assert(std::count(first, last, T(1)) == n);
+        for (int i = 0; i < n; ++i)
+        {
+            first[i] = T(2);
+            assert(std::find(first, last, T(2)) == first + i);
+            assert(std::count(first, last, T(2)) == 1);
+            if (i + 1 < n)
+            {
+                first[n - 1] = T(2);
+                assert(std::find(first, last, T(2)) == first + i);
+                assert(std::count(first, last, T(2)) == 2);
+                first[n - 1] = T(1);
+            }
+            first[i] = T(1);
+        }
+    }
+    std::vector<T> v(100000, T(3));
+    assert(std::count(v.begin(), v.end(), T(3)) == 100000);
+    assert(std::find(v.begin(), v.end(), T(4)) == v.end());
+    const std::vector<T>& cv = v;
+    assert(std::find(cv.begin(), cv.end(), T(3)) == cv.begin());
+}
+
+template <class T>
+void test_mismatch()
+{
+    for (int n = 0; n < 80; ++n)
+    {
+        std::vector<T> a(n, T(5));
+        std::vector<T> b(n + 1, T(5));
+        const T* b1 = b.data() + 1;
+        assert(std::mismatch(a.data(), a.data() + n, b1).first == a.data() + n);
+        for (int i = 0; i < n; ++i)
+        {
+            b[i + 1] = T(6);
+            std::pair<T*, const T*> r = std::mismatch(a.data(), a.data() + n, b1);
+            assert(r.first == a.data() + i && r.second == b1 + i);
+            assert(std::mismatch(a.begin(), a.end(), b.begin() + 1).first ==
+                   a.begin() + i);
+#if TEST_STD_VER > 11
+            assert(std::mismatch(a.data(), a.data() + n, b1, b1 + i).first ==
+                   a.data() + i);
+            assert(std::mismatch(a.data(), a.data() + i, b1, b1 + n).first ==
+                   a.data() + i);
+#endif
+            b[i + 1] = T(5);
+        }
+    }
+}
+
+int main()
+{
+    test_find_count<char>();
+    test_find_count<signed char>();
+    test_find_count<unsigned short>();
+    test_find_count<int>();
+    test_find_count<unsigned long long>();
+    test_mismatch<char>();
+    test_mismatch<short>();
+    test_mismatch<unsigned>();
+    test_mismatch<long long>();
+
+    // The value is compared with the elements after the usual conversions.
+    {
+        unsigned char a[40] = {};
+        a[33] = 0xFF;
+        assert(std::find(a, a + 40, -1) == a + 40);
+        assert(std::find(a, a + 40, 0xFF) == a + 33);
+        assert(std::find(a, a + 40, 0x1FF) == a + 40);
+        assert(std::count(a, a + 40, 0) == 39);
+        assert(std::count(a, a + 40, 256) == 0);
+    }
+    {
+        signed char a[40] = {};
+        a[20] = -1;
+        assert(std::find(a, a + 40, -1) == a + 20);
+        assert(std::find(a, a + 40, 255) == a + 40);
+        assert(std::count(a, a + 40, -1L) == 1);
+    }
+    {
+        unsigned a[40] = {};
+        a[10] = 0xFFFFFFFF;
+        assert(std::find(a, a + 40, -1) == a + 10);
+        assert(std::find(a, a + 40, -1LL) == a + 40);
+        assert(std::find(a, a + 40, 0xFFFFFFFFLL) == a + 10);
+    }
+    {
+        const int a[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17};
+        assert(std::find(a, a + 17, true) == a);
+        assert(std::find(a, a + 17, 17LL) == a + 16);
+        assert(std::find(a, a + 17, 17.5) == a + 17);
+    }
+    // Both types are promoted to int, keeping their signedness.
+    {
+        std::vector<char> s(40, 'a');
+        s[25] = '\xFF';
+        const unsigned char u = 0xFF;
+        assert(std::find(s.begin(), s.end(), u) ==
+               (s[25] == u ? s.begin() + 25 : s.end()));
+        assert(std::count(s.begin(), s.end(), u) == (s[25] == u ? 1 : 0));
+        assert(std::find(s.begin(), s.end(), '\xFF') == s.begin() + 25);
+    }
+    {
+        std::vector<short> w(40, 0);
+        w[3] = -1;
+        const unsigned short u = 65535;
+        assert(std::find(w.begin(), w.end(), u) == w.end());
+        assert(std::count(w.begin(), w.end(), u) == 0);
+        assert(std::find(w.begin(), w.end(), (short)-1) == w.begin() + 3);
+    }
+    {
+        unsigned short a[40] = {};
+        a[7] = 65535;
+        assert(std::find(a, a + 40, (short)-1) == a + 40);
+        assert(std::count(a, a + 40, (short)-1) == 0);
+        assert(std::find(a, a + 40, (unsigned short)65535) == a + 7);
+    }
+}
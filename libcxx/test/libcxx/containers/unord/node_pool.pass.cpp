@@ -0,0 +1,122 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++98, c++03
+
+// Test that with _LIBCPP_ABI_HASH_TABLE_NODE_POOL the unordered containers
+// reuse the nodes of erased elements, and free them when destroyed.
+
+// MODULES_DEFINES: _LIBCPP_ABI_HASH_TABLE_NODE_POOL
+#define _LIBCPP_ABI_HASH_TABLE_NODE_POOL
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <cassert>
+
+#include "test_macros.h"
+#include "test_allocator.h"
+
+struct Counted
+{
+    static int live;
+    int value;
+
+    Counted(int v) : value(v) {++live;}
+    Counted(const Counted& c) : value(c.value) {++live;}
+    ~Counted() {--live;}
+
+    friend bool operator==(const Counted& x, const Counted& y)
+        {return x.value == y.value;}
+};
+
+int Counted::live = 0;
+
+struct CountedHash
+{
+    std::size_t operator()(const Counted& c) const {return c.value;}
+};
+
+typedef std::unordered_map<int, Counted, std::hash<int>, std::equal_to<int>,
+                           test_allocator<std::pair<const int, Counted> > > Map;
+typedef std::unordered_multiset<Counted, CountedHash, std::equal_to<Counted>,
+                                test_allocator<Counted> > MultiSet;
+
+int main()
+{
+    {
+        Map m;
+        for (int i = 0; i < 100; ++i)
+            m.emplace(i, i);
+        const int allocs = test_alloc_base::alloc_count;
+
+        // Erased elements are destroyed but their nodes are kept...
+        for (int i = 0; i < 100; i += 2)
+            assert(m.erase(i) == 1);
+        assert(Counted::live == 50);
+        assert(test_alloc_base::alloc_count == allocs);
+
+        // ...and reused by the next insertions.
+        for (int i = 100; i < 150; ++i)
+            m.emplace(i, i);
+        assert(m.size() == 100);
+        assert(Counted::live == 100);
+        assert(test_alloc_base::alloc_count == allocs);
+
+        // A failed insertion does not allocate either.
+        assert(!m.emplace(1, 1).second);
+        assert(Counted::live == 100);
+        assert(test_alloc_base::alloc_count == allocs);
+
+        m.clear();
+        assert(Counted::live == 0);
+        assert(test_alloc_base::alloc_count == allocs);
+        for (int i = 0; i < 100; ++i)
+            m.emplace(i, i);
+        assert(test_alloc_base::alloc_count == allocs);
+
+        // The pool never outgrows the bucket list.
+        m.clear();
+        m.rehash(0);
+        assert(m.bucket_count() == 0);
+        assert(test_alloc_base::alloc_count == 0);
+        m.emplace(1, 1);
+        assert(m.at(1).value == 1);
+    }
+    assert(Counted::live == 0);
+    assert(test_alloc_base::alloc_count == 0);
+    {
+        MultiSet s;
+        for (int i = 0; i < 100; ++i)
+            s.insert(i % 10);
+        for (MultiSet::iterator i = s.begin(); i != s.end();)
+            i = i->value < 5 ? s.erase(i) : std::next(i);
+        assert(s.size() == 50);
+        assert(Counted::live == 50);
+        const int allocs = test_alloc_base::alloc_count;
+
+        // The pool follows the nodes to the container they are moved to.
+        MultiSet t(std::move(s));
+        for (int i = 0; i < 50; ++i)
+            t.insert(i % 5);
+        assert(t.size() == 100);
+        assert(t.count(3) == 10);
+        assert(test_alloc_base::alloc_count == allocs);
+
+        MultiSet u;
+        u.swap(t);
+        for (int i = 0; i < 10; ++i)
+            t.insert(i);
+        assert(test_alloc_base::alloc_count == allocs + 11);
+        u = std::move(t);
+        assert(u.size() == 10);
+        assert(Counted::live == 10);
+    }
+    assert(Counted::live == 0);
+    assert(test_alloc_base::alloc_count == 0);
+}
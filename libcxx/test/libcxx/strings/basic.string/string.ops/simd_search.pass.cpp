@@ -0,0 +1,111 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// <string>
+
+// Test find, rfind and find_first_of, which are vectorized on some targets,
+// against simple loops at every length and position around the vector sizes.
+
+#include <string>
+#include <cassert>
+
+#include "test_macros.h"
+
+template <class S>
+typename S::size_type naive_find(const S& s, const S& n, typename S::size_type pos)
+{
+    for (; pos + n.size() <= s.size(); ++pos)
+        if (s.compare(pos, n.size(), n) == 0)
+            return pos;
+    return S::npos;
+}
+
+template <class S>
+typename S::size_type naive_rfind(const S& s, const S& n, typename S::size_type pos)
+{
+    if (n.size() > s.size())
+        return S::npos;
+    for (pos = std::min(pos, s.size() - n.size()) + 1; pos-- > 0;)
+        if (s.compare(pos, n.size(), n) == 0)
+            return pos;
+    return S::npos;
+}
+
+template <class S>
+typename S::size_type naive_find_first_of(const S& s, const S& n,
+                                          typename S::size_type pos)
+{
+    for (; pos < s.size(); ++pos)
+        if (n.find(s[pos]) != S::npos)
+            return pos;
+    return S::npos;
+}
+
+template <class S>
+void test(const S& s, const S& n)
+{
+    for (typename S::size_type pos = 0; pos <= s.size() + 1; pos += 7)
+    {
+        assert(s.find(n, pos) == naive_find(s, n, pos));
+        assert(s.rfind(n, pos) == naive_rfind(s, n, pos));
+        assert(s.find_first_of(n, pos) == naive_find_first_of(s, n, pos));
+    }
+    assert(s.rfind(n) == naive_rfind(s, n, S::npos));
+    if (!n.empty())
+    {
+        assert(s.find(n[0]) == naive_find(s, n.substr(0, 1), 0));
+        assert(s.rfind(n[0]) == naive_rfind(s, n.substr(0, 1), S::npos));
+    }
+}
+
+template <class S>
+void test_all()
+{
+    typedef typename S::value_type C;
+    const C a = C('a'), b = C('b'), c = C('c');
+    for (int len = 0; len < 100; ++len)
+    {
+        // Many partial matches of the first and last characters.
+        S s;
+        for (int i = 0; i < len; ++i)
+            s.push_back(i % 3 == 0 ? a : i % 5 == 0 ? c : b);
+        test(s, S());
+        test(s, S(1, a));
+        test(s, S(1, c));
+        test(s, S(2, b));
+        test(s, S(1, a) + S(2, b));
+        test(s, S(1, a) + S(1, b) + S(1, c));
+        test(s, S(1, c) + S(2, b) + S(1, a));
+        test(s, S(5, a));
+        S set;
+        for (int i = 0; i < 20; ++i)
+            set.push_back(C('d' + i));
+        test(s, set);
+        test(s, set + S(1, c));
+    }
+    // Characters outside the ASCII range, and with the sign bit set.
+    S s(70, C(0x7F));
+    s[65] = C(-2);
+    s[66] = C(0x80);
+    S set;
+    for (int i = 0; i < 30; ++i)
+        set.push_back(C(0x20 + i));
+    test(s, set + S(1, C(0x80)));
+    test(s, S(1, C(-2)) + S(1, C(0x80)));
+}
+
+int main()
+{
+    test_all<std::string>();
+    test_all<std::wstring>();
+#if TEST_STD_VER >= 11
+    test_all<std::u16string>();
+    test_all<std::u32string>();
+#endif
+}
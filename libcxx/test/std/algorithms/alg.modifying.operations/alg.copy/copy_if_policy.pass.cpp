@@ -0,0 +1,52 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// <algorithm>
+// UNSUPPORTED: c++98, c++03, c++11, c++14
+
+// template<class ExecutionPolicy, class ForwardIterator1,
+//          class ForwardIterator2, class Predicate>
+//   ForwardIterator2 copy_if(ExecutionPolicy&& exec, ForwardIterator1 first,
+//                            ForwardIterator1 last, ForwardIterator2 result,
+//                            Predicate pred);
+
+#include <algorithm>
+#include <cassert>
+#include <execution>
+#include <vector>
+
+#include "test_execution_policies.h"
+#include "test_iterators.h"
+
+template <class InIter, class OutIter>
+void test(int n) {
+  std::vector<int> v(n);
+  for (int i = 0; i < n; ++i)
+    v[i] = (i * 37) % 101;
+  auto pred = [](int x) { return x % 3 == 0; };
+  std::vector<int> expected;
+  std::copy_if(v.begin(), v.end(), std::back_inserter(expected), pred);
+  test_execution_policies([&](auto&& policy) {
+    std::vector<int> out(n, -1);
+    OutIter r = std::copy_if(policy, InIter(v.data()), InIter(v.data() + n),
+                             OutIter(out.data()), pred);
+    assert(base(r) == out.data() + expected.size());
+    assert(std::equal(expected.begin(), expected.end(), out.begin()));
+    assert(std::all_of(out.begin() + expected.size(), out.end(),
+                       [](int x) { return x == -1; }));
+  });
+}
+
+int main() {
+  for (int n : get_execution_policy_test_sizes()) {
+    test<const int*, int*>(n);
+    test<forward_iterator<const int*>, forward_iterator<int*> >(n);
+    test<random_access_iterator<const int*>, random_access_iterator<int*> >(n);
+  }
+}
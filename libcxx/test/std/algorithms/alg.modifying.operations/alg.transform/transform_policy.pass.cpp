@@ -0,0 +1,64 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// <algorithm>
+// UNSUPPORTED: c++98, c++03, c++11, c++14
+
+// template<class ExecutionPolicy, class ForwardIterator1,
+//          class ForwardIterator2, class UnaryOperation>
+//   ForwardIterator2 transform(ExecutionPolicy&& exec, ForwardIterator1 first,
+//                              ForwardIterator1 last, ForwardIterator2 result,
+//                              UnaryOperation op);
+// template<class ExecutionPolicy, class ForwardIterator1,
+//          class ForwardIterator2, class ForwardIterator,
+//          class BinaryOperation>
+//   ForwardIterator transform(ExecutionPolicy&& exec, ForwardIterator1 first1,
+//                             ForwardIterator1 last1, ForwardIterator2 first2,
+//                             ForwardIterator result, BinaryOperation op);
+
+#include <algorithm>
+#include <cassert>
+#include <execution>
+#include <vector>
+
+#include "test_execution_policies.h"
+#include "test_iterators.h"
+
+template <class InIter, class OutIter>
+void test(int n) {
+  std::vector<int> a(n), b(n);
+  for (int i = 0; i < n; ++i) {
+    a[i] = i;
+    b[i] = 3 * i;
+  }
+  test_execution_policies([&](auto&& policy) {
+    std::vector<long> out(n);
+    OutIter r = std::transform(policy, InIter(a.data()),
+                               InIter(a.data() + n), OutIter(out.data()),
+                               [](int x) { return x * 2L; });
+    assert(base(r) == out.data() + n);
+    for (int i = 0; i < n; ++i)
+      assert(out[i] == 2 * i);
+
+    r = std::transform(policy, InIter(a.data()), InIter(a.data() + n),
+                       InIter(b.data()), OutIter(out.data()),
+                       [](int x, int y) { return long(y - x); });
+    assert(base(r) == out.data() + n);
+    for (int i = 0; i < n; ++i)
+      assert(out[i] == 2 * i);
+  });
+}
+
+int main() {
+  for (int n : get_execution_policy_test_sizes()) {
+    test<const int*, long*>(n);
+    test<forward_iterator<const int*>, forward_iterator<long*> >(n);
+    test<random_access_iterator<const int*>, long*>(n);
+  }
+}
@@ -0,0 +1,44 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// <algorithm>
+// UNSUPPORTED: c++98, c++03, c++11, c++14
+
+// template<class ExecutionPolicy, class ForwardIterator, class Function>
+//   void for_each(ExecutionPolicy&& exec, ForwardIterator first,
+//                 ForwardIterator last, Function f);
+
+#include <algorithm>
+#include <cassert>
+#include <execution>
+#include <vector>
+
+#include "test_execution_policies.h"
+#include "test_iterators.h"
+
+template <class Iter>
+void test(int n) {
+  test_execution_policies([&](auto&& policy) {
+    std::vector<int> v(n);
+    for (int i = 0; i < n; ++i)
+      v[i] = i;
+    std::for_each(policy, Iter(v.data()), Iter(v.data() + v.size()),
+                  [](int& x) { x = 2 * x + 1; });
+    for (int i = 0; i < n; ++i)
+      assert(v[i] == 2 * i + 1);
+  });
+}
+
+int main() {
+  for (int n : get_execution_policy_test_sizes()) {
+    test<int*>(n);
+    test<forward_iterator<int*> >(n);
+    test<random_access_iterator<int*> >(n);
+  }
+}
@@ -0,0 +1,53 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// <algorithm>
+// UNSUPPORTED: c++98, c++03, c++11, c++14
+
+// template<class ExecutionPolicy, class RandomAccessIterator>
+//   void sort(ExecutionPolicy&& exec, RandomAccessIterator first,
+//             RandomAccessIterator last);
+// template<class ExecutionPolicy, class RandomAccessIterator, class Compare>
+//   void sort(ExecutionPolicy&& exec, RandomAccessIterator first,
+//             RandomAccessIterator last, Compare comp);
+
+#include <algorithm>
+#include <cassert>
+#include <execution>
+#include <functional>
+#include <vector>
+
+#include "test_execution_policies.h"
+#include "test_iterators.h"
+
+template <class Iter>
+void test(int n) {
+  std::vector<int> v(n);
+  for (int i = 0; i < n; ++i)
+    v[i] = (i * 7919) % 1009;
+  test_execution_policies([&](auto&& policy) {
+    std::vector<int> c = v;
+    std::sort(policy, Iter(c.data()), Iter(c.data() + c.size()));
+    assert(std::is_sorted(c.begin(), c.end()));
+    assert(std::is_permutation(c.begin(), c.end(), v.begin()));
+
+    c = v;
+    std::sort(policy, Iter(c.data()), Iter(c.data() + c.size()),
+              std::greater<int>());
+    assert(std::is_sorted(c.begin(), c.end(), std::greater<int>()));
+    assert(std::is_permutation(c.begin(), c.end(), v.begin()));
+  });
+}
+
+int main() {
+  for (int n : get_execution_policy_test_sizes()) {
+    test<int*>(n);
+    test<random_access_iterator<int*> >(n);
+  }
+}
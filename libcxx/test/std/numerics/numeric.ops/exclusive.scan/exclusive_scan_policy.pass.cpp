@@ -0,0 +1,74 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// <numeric>
+// UNSUPPORTED: c++98, c++03, c++11, c++14
+
+// template<class ExecutionPolicy, class ForwardIterator1,
+//          class ForwardIterator2, class T>
+//   ForwardIterator2 exclusive_scan(ExecutionPolicy&& exec,
+//                                   ForwardIterator1 first,
+//                                   ForwardIterator1 last,
+//                                   ForwardIterator2 result, T init);
+// template<class ExecutionPolicy, class ForwardIterator1,
+//          class ForwardIterator2, class T, class BinaryOperation>
+//   ForwardIterator2 exclusive_scan(ExecutionPolicy&& exec,
+//                                   ForwardIterator1 first,
+//                                   ForwardIterator1 last,
+//                                   ForwardIterator2 result, T init,
+//                                   BinaryOperation binary_op);
+
+#include <numeric>
+#include <cassert>
+#include <execution>
+#include <functional>
+#include <vector>
+
+#include "test_execution_policies.h"
+#include "test_iterators.h"
+
+template <class InIter, class OutIter>
+void test(int n) {
+  std::vector<long> v(n);
+  for (int i = 0; i < n; ++i)
+    v[i] = i % 17;
+  std::vector<long> expected(n);
+  long sum = 7;
+  for (int i = 0; i < n; ++i) {
+    expected[i] = sum;
+    sum += v[i];
+  }
+  test_execution_policies([&](auto&& policy) {
+    std::vector<long> out(n);
+    OutIter r = std::exclusive_scan(policy, InIter(v.data()),
+                                    InIter(v.data() + n), OutIter(out.data()),
+                                    7L);
+    assert(base(r) == out.data() + n);
+    assert(out == expected);
+
+    r = std::exclusive_scan(policy, InIter(v.data()), InIter(v.data() + n),
+                            OutIter(out.data()), 7L, std::plus<>());
+    assert(base(r) == out.data() + n);
+    assert(out == expected);
+
+    // In place.
+    out = v;
+    std::exclusive_scan(policy, OutIter(out.data()), OutIter(out.data() + n),
+                        OutIter(out.data()), 7L);
+    assert(out == expected);
+  });
+}
+
+int main() {
+  for (int n : get_execution_policy_test_sizes()) {
+    test<const long*, long*>(n);
+    test<forward_iterator<const long*>, forward_iterator<long*> >(n);
+    test<random_access_iterator<const long*>, random_access_iterator<long*> >(n);
+  }
+}
@@ -0,0 +1,82 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// <numeric>
+// UNSUPPORTED: c++98, c++03, c++11, c++14
+
+// template<class ExecutionPolicy, class ForwardIterator1,
+//          class ForwardIterator2>
+//   ForwardIterator2 inclusive_scan(ExecutionPolicy&& exec,
+//                                   ForwardIterator1 first,
+//                                   ForwardIterator1 last,
+//                                   ForwardIterator2 result);
+// template<class ExecutionPolicy, class ForwardIterator1,
+//          class ForwardIterator2, class BinaryOperation>
+//   ForwardIterator2 inclusive_scan(ExecutionPolicy&& exec,
+//                                   ForwardIterator1 first,
+//                                   ForwardIterator1 last,
+//                                   ForwardIterator2 result,
+//                                   BinaryOperation binary_op);
+// template<class ExecutionPolicy, class ForwardIterator1,
+//          class ForwardIterator2, class BinaryOperation, class T>
+//   ForwardIterator2 inclusive_scan(ExecutionPolicy&& exec,
+//                                   ForwardIterator1 first,
+//                                   ForwardIterator1 last,
+//                                   ForwardIterator2 result,
+//                                   BinaryOperation binary_op, T init);
+
+#include <numeric>
+#include <cassert>
+#include <execution>
+#include <functional>
+#include <vector>
+
+#include "test_execution_policies.h"
+#include "test_iterators.h"
+
+template <class InIter, class OutIter>
+void test(int n) {
+  std::vector<long> v(n);
+  for (int i = 0; i < n; ++i)
+    v[i] = i % 17;
+  std::vector<long> expected(n);
+  std::partial_sum(v.begin(), v.end(), expected.begin());
+  test_execution_policies([&](auto&& policy) {
+    std::vector<long> out(n);
+    OutIter r = std::inclusive_scan(policy, InIter(v.data()),
+                                    InIter(v.data() + n), OutIter(out.data()));
+    assert(base(r) == out.data() + n);
+    assert(out == expected);
+
+    r = std::inclusive_scan(policy, InIter(v.data()), InIter(v.data() + n),
+                            OutIter(out.data()), std::plus<>());
+    assert(base(r) == out.data() + n);
+    assert(out == expected);
+
+    r = std::inclusive_scan(policy, InIter(v.data()), InIter(v.data() + n),
+                            OutIter(out.data()), std::plus<>(), 100L);
+    assert(base(r) == out.data() + n);
+    for (int i = 0; i < n; ++i)
+      assert(out[i] == expected[i] + 100);
+
+    // In place.
+    out = v;
+    std::inclusive_scan(policy, OutIter(out.data()), OutIter(out.data() + n),
+                        OutIter(out.data()));
+    assert(out == expected);
+  });
+}
+
+int main() {
+  for (int n : get_execution_policy_test_sizes()) {
+    test<const long*, long*>(n);
+    test<forward_iterator<const long*>, forward_iterator<long*> >(n);
+    test<random_access_iterator<const long*>, random_access_iterator<long*> >(n);
+  }
+}
@@ -0,0 +1,75 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// <numeric>
+// UNSUPPORTED: c++98, c++03, c++11, c++14
+
+// template<class ExecutionPolicy, class ForwardIterator>
+//   typename iterator_traits<ForwardIterator>::value_type
+//     reduce(ExecutionPolicy&& exec, ForwardIterator first,
+//            ForwardIterator last);
+// template<class ExecutionPolicy, class ForwardIterator, class T>
+//   T reduce(ExecutionPolicy&& exec, ForwardIterator first,
+//            ForwardIterator last, T init);
+// template<class ExecutionPolicy, class ForwardIterator, class T,
+//          class BinaryOperation>
+//   T reduce(ExecutionPolicy&& exec, ForwardIterator first,
+//            ForwardIterator last, T init, BinaryOperation binary_op);
+
+#include <numeric>
+#include <cassert>
+#include <execution>
+#include <string>
+#include <vector>
+
+#include "test_execution_policies.h"
+#include "test_iterators.h"
+
+template <class Iter>
+void test(int n) {
+  std::vector<long> v(n);
+  for (int i = 0; i < n; ++i)
+    v[i] = i;
+  long sum = long(n) * (n - 1) / 2;
+  test_execution_policies([&](auto&& policy) {
+    Iter first(v.data()), last(v.data() + n);
+    static_assert(std::is_same<decltype(std::reduce(policy, first, last)),
+                               long>::value, "");
+    assert(std::reduce(policy, first, last) == sum);
+    assert(std::reduce(policy, first, last, 10L) == sum + 10);
+    assert(std::reduce(policy, first, last, 0LL,
+                       [](long long x, long long y) { return x + 2 * y; }) >= 0);
+    assert(std::reduce(policy, first, last, -1L,
+                       [](long x, long y) { return std::max(x, y); }) == n - 1);
+  });
+}
+
+// The elements are combined in an unspecified order, but string
+// concatenation is associative.
+void test_string(int n) {
+  std::vector<std::string> v(n);
+  std::string expected;
+  for (int i = 0; i < n; ++i) {
+    v[i] = std::to_string(i % 10);
+    expected += v[i];
+  }
+  test_execution_policies([&](auto&& policy) {
+    assert(std::reduce(policy, v.begin(), v.end(), std::string("x")) ==
+           "x" + expected);
+  });
+}
+
+int main() {
+  for (int n : get_execution_policy_test_sizes()) {
+    test<const long*>(n);
+    test<forward_iterator<const long*> >(n);
+    test<random_access_iterator<const long*> >(n);
+    test_string(n);
+  }
+}
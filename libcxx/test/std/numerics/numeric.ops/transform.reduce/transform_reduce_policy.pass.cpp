@@ -0,0 +1,68 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// <numeric>
+// UNSUPPORTED: c++98, c++03, c++11, c++14
+
+// template<class ExecutionPolicy, class ForwardIterator1,
+//          class ForwardIterator2, class T>
+//   T transform_reduce(ExecutionPolicy&& exec, ForwardIterator1 first1,
+//                      ForwardIterator1 last1, ForwardIterator2 first2,
+//                      T init);
+// template<class ExecutionPolicy, class ForwardIterator1,
+//          class ForwardIterator2, class T, class BinaryOperation1,
+//          class BinaryOperation2>
+//   T transform_reduce(ExecutionPolicy&& exec, ForwardIterator1 first1,
+//                      ForwardIterator1 last1, ForwardIterator2 first2,
+//                      T init, BinaryOperation1 binary_op1,
+//                      BinaryOperation2 binary_op2);
+// template<class ExecutionPolicy, class ForwardIterator, class T,
+//          class BinaryOperation, class UnaryOperation>
+//   T transform_reduce(ExecutionPolicy&& exec, ForwardIterator first,
+//                      ForwardIterator last, T init,
+//                      BinaryOperation binary_op, UnaryOperation unary_op);
+
+#include <numeric>
+#include <cassert>
+#include <execution>
+#include <functional>
+#include <vector>
+
+#include "test_execution_policies.h"
+#include "test_iterators.h"
+
+template <class Iter>
+void test(int n) {
+  std::vector<long> a(n), b(n);
+  long dot = 0;
+  for (int i = 0; i < n; ++i) {
+    a[i] = i % 13;
+    b[i] = i % 7;
+    dot += a[i] * b[i];
+  }
+  test_execution_policies([&](auto&& policy) {
+    Iter first1(a.data()), last1(a.data() + n), first2(b.data());
+    assert(std::transform_reduce(policy, first1, last1, first2, 5L) ==
+           dot + 5);
+    assert(std::transform_reduce(policy, first1, last1, first2, 5L,
+                                 std::plus<>(), std::multiplies<>()) ==
+           dot + 5);
+    assert(std::transform_reduce(policy, first1, last1, 0L, std::plus<>(),
+                                 [](long x) { return -x; }) ==
+           -std::accumulate(a.begin(), a.end(), 0L));
+  });
+}
+
+int main() {
+  for (int n : get_execution_policy_test_sizes()) {
+    test<const long*>(n);
+    test<forward_iterator<const long*> >(n);
+    test<random_access_iterator<const long*> >(n);
+  }
+}
@@ -0,0 +1,225 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++98, c++03, c++11, c++14
+
+// XFAIL: with_system_cxx_lib=macosx10.14
+// XFAIL: with_system_cxx_lib=macosx10.13
+// XFAIL: with_system_cxx_lib=macosx10.12
+// XFAIL: with_system_cxx_lib=macosx10.11
+// XFAIL: with_system_cxx_lib=macosx10.10
+// XFAIL: with_system_cxx_lib=macosx10.9
+// XFAIL: with_system_cxx_lib=macosx10.8
+// XFAIL: with_system_cxx_lib=macosx10.7
+
+// <charconv>
+
+// from_chars_result from_chars(const char* first, const char* last,
+//                              Floating& value,
+//                              chars_format fmt = chars_format::general)
+
+#include <charconv>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+template <typename T>
+T parse(const char* s);
+
+template <>
+float parse<float>(const char* s) { return strtof(s, nullptr); }
+
+template <>
+double parse<double>(const char* s) { return strtod(s, nullptr); }
+
+template <>
+long double parse<long double>(const char* s) { return strtold(s, nullptr); }
+
+template <typename T>
+bool same(T x, T y)
+{
+    return x == y && std::signbit(x) == std::signbit(y);
+}
+
+template <typename T, size_t N>
+void test(char const (&s)[N], T expect, size_t consumed = N - 1,
+          std::chars_format fmt = std::chars_format::general)
+{
+    T x = T(42);
+    std::from_chars_result r = std::from_chars(s, s + N - 1, x, fmt);
+    assert(r.ec == std::errc{});
+    assert(r.ptr == s + consumed);
+    assert(same(x, expect));
+}
+
+template <typename T, size_t N>
+void test_invalid(char const (&s)[N],
+                  std::chars_format fmt = std::chars_format::general)
+{
+    T x = T(42);
+    std::from_chars_result r = std::from_chars(s, s + N - 1, x, fmt);
+    assert(r.ec == std::errc::invalid_argument);
+    assert(r.ptr == s);
+    assert(x == T(42));
+}
+
+template <typename T, size_t N>
+void test_out_of_range(char const (&s)[N])
+{
+    T x = T(42);
+    std::from_chars_result r = std::from_chars(s, s + N - 1, x);
+    assert(r.ec == std::errc::result_out_of_range);
+    assert(r.ptr == s + N - 1);
+    assert(x == T(42));
+}
+
+// Compares with strtod, which is correctly rounded.
+template <typename T>
+void test_strtod(const char* s)
+{
+    T x = T(42);
+    std::from_chars_result r = std::from_chars(s, s + strlen(s), x);
+    assert(r.ec == std::errc{});
+    assert(r.ptr == s + strlen(s));
+    assert(same(x, parse<T>(s)));
+}
+
+template <typename T>
+void test_common()
+{
+    using xl = std::numeric_limits<T>;
+
+    test("0", T(0));
+    test("-0", -T(0));
+    test("0.000e10", T(0));
+    test("1", T(1));
+    test("-1.5", T(-1.5));
+    test("1e3", T(1000));
+    test("1E-3", T(1) / 1000);
+    test(".5", T(0.5));
+    test("5.", T(5));
+    test("0001.2500", T(1.25));
+    test("12x", T(12), 2);
+    test("1.5e", T(1.5), 3);
+    test("1.5e+", T(1.5), 3);
+    test("1.5e-x", T(1.5), 3);
+
+    test("inf", xl::infinity());
+    test("-INF", -xl::infinity());
+    test("Infinity", xl::infinity());
+    test("infinit", xl::infinity(), 3);
+
+    T x;
+    const char nan[] = "nan(0x1f)z";
+    std::from_chars_result r = std::from_chars(nan, nan + 10, x);
+    assert(r.ec == std::errc{} && r.ptr == nan + 9 && std::isnan(x));
+    r = std::from_chars(nan, nan + 5, x);
+    assert(r.ec == std::errc{} && r.ptr == nan + 3 && std::isnan(x));
+
+    // The fixed format does not parse an exponent, the scientific format
+    // requires one.
+    test("1e3", T(1), 1, std::chars_format::fixed);
+    test("1e3", T(1000), 3, std::chars_format::scientific);
+    test_invalid<T>("1.5", std::chars_format::scientific);
+
+    test("1.8p1", T(3), 5, std::chars_format::hex);
+    test("-0.8", T(-0.5), 4, std::chars_format::hex);
+    test("Ap-2", T(2.5), 4, std::chars_format::hex);
+    test("1p", T(1), 1, std::chars_format::hex);
+    test("0x1p1", T(0), 1, std::chars_format::hex);
+    test_invalid<T>("p1", std::chars_format::hex);
+
+    test_invalid<T>("");
+    test_invalid<T>("-");
+    test_invalid<T>("+1");
+    test_invalid<T>(" 1");
+    test_invalid<T>(".");
+    test_invalid<T>("e1");
+    test_invalid<T>("-.e1");
+    test_invalid<T>("in");
+
+    test_out_of_range<T>("1e100000");
+    test_out_of_range<T>("-1e100000");
+    test_out_of_range<T>("1e-100000");
+
+    test_strtod<T>("0.1");
+    test_strtod<T>("3.14159265358979323846264338327950288");
+    test_strtod<T>("1234567890123456789012345678901234567890e-30");
+    test_strtod<T>("0.00000000000000000000000000000000000000001e40");
+}
+
+template <typename T, typename U>
+void test_random(U bits, U mul, U add)
+{
+    char buf[64];
+    for (int i = 0; i < 20000; ++i)
+    {
+        bits = bits * mul + add;
+        T v;
+        memcpy(&v, &bits, sizeof(v));
+        if (!std::isfinite(v))
+            continue;
+        const int digits = 3 + i % std::numeric_limits<T>::max_digits10;
+        snprintf(buf, sizeof(buf), "%.*e", digits, static_cast<double>(v));
+        test_strtod<T>(buf);
+
+        snprintf(buf, sizeof(buf), "%a", static_cast<double>(v));
+        T x;
+        std::from_chars_result r = std::from_chars(
+            buf + 2 + (*buf == '-'), buf + strlen(buf), x,
+            std::chars_format::hex);
+        assert(r.ec == std::errc{});
+        assert(same(x, std::fabs(v)));
+    }
+}
+
+int
+main()
+{
+    test_common<float>();
+    test_common<double>();
+    test_common<long double>();
+
+    // Halfway between two floats: ties to even.
+    test("16777217", 16777216.f);
+    test("16777219", 16777220.f);
+    test("9007199254740993", 9007199254740992.);
+    test("9007199254740995", 9007199254740996.);
+    test("9007199254740993.0000000000000000000001", 9007199254740994.);
+    test("1.00000000000008", 1., 16, std::chars_format::hex);
+    test("1.00000000000018", 1.0000000000000004, 16, std::chars_format::hex);
+    test("1.000000000000080001", 1.0000000000000002, 20,
+         std::chars_format::hex);
+
+    test("3.4028235e38", 3.4028235e38f);
+    test("1e-45", 1e-45f);
+    test("8e-46", 1e-45f);
+    test("1.7976931348623157e308", 1.7976931348623157e308);
+    test("4.9406564584124654e-324", 5e-324);
+    test("2.4703282292062328e-324", 5e-324);
+    test("2.2250738585072011e-308", 2.2250738585072009e-308);
+    test("1p-1074", 5e-324, 7, std::chars_format::hex);
+    test("0.0000000000001p-1022", 5e-324, 21, std::chars_format::hex);
+
+    test_out_of_range<float>("3.5e38");
+    test_out_of_range<float>("1e-46");
+    test_out_of_range<double>("1.8e308");
+    test_out_of_range<double>("2e-324");
+    test_out_of_range<double>("2.4703282292062327e-324");
+
+    test_random<float>(uint32_t(0x9e3779b9), uint32_t(1664525),
+                       uint32_t(1013904223));
+    test_random<double>(uint64_t(0x9e3779b97f4a7c15),
+                        uint64_t(6364136223846793005),
+                        uint64_t(1442695040888963407));
+}
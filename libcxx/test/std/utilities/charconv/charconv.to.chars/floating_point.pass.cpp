@@ -0,0 +1,243 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++98, c++03, c++11, c++14
+
+// XFAIL: with_system_cxx_lib=macosx10.14
+// XFAIL: with_system_cxx_lib=macosx10.13
+// XFAIL: with_system_cxx_lib=macosx10.12
+// XFAIL: with_system_cxx_lib=macosx10.11
+// XFAIL: with_system_cxx_lib=macosx10.10
+// XFAIL: with_system_cxx_lib=macosx10.9
+// XFAIL: with_system_cxx_lib=macosx10.8
+// XFAIL: with_system_cxx_lib=macosx10.7
+
+// <charconv>
+
+// to_chars_result to_chars(char* first, char* last, Floating value);
+// to_chars_result to_chars(char* first, char* last, Floating value,
+//                          chars_format fmt);
+// to_chars_result to_chars(char* first, char* last, Floating value,
+//                          chars_format fmt, int precision);
+
+#include <charconv>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+char buf[2000];
+
+template <typename T, size_t N, typename... Ts>
+void test(T v, char const (&expect)[N], Ts... args)
+{
+    constexpr size_t len = N - 1;
+
+    std::to_chars_result r = std::to_chars(buf, buf + len - 1, v, args...);
+    assert(r.ptr == buf + len - 1);
+    assert(r.ec == std::errc::value_too_large);
+
+    r = std::to_chars(buf, buf + sizeof(buf), v, args...);
+    assert(r.ec == std::errc{});
+    assert(r.ptr == buf + len);
+    assert(memcmp(buf, expect, len) == 0);
+}
+
+template <typename T>
+T parse(const char* s);
+
+template <>
+float parse<float>(const char* s) { return strtof(s, nullptr); }
+
+template <>
+double parse<double>(const char* s) { return strtod(s, nullptr); }
+
+template <>
+long double parse<long double>(const char* s) { return strtold(s, nullptr); }
+
+// The number of significant digits of the shortest correctly rounded
+// representation that reads back as v.
+template <typename T>
+int shortest_digits(T v)
+{
+    char s[64];
+    for (int p = 0;; ++p)
+    {
+        snprintf(s, sizeof(s), "%.*Le", p, static_cast<long double>(v));
+        if (parse<T>(s) == v)
+            return p + 1;
+    }
+}
+
+template <typename T>
+void test_round_trip(T v)
+{
+    std::to_chars_result r = std::to_chars(buf, buf + sizeof(buf), v,
+                                           std::chars_format::scientific);
+    assert(r.ec == std::errc{});
+    *r.ptr = '\0';
+    assert(parse<T>(buf) == v);
+    const char* first = buf + (*buf == '-');
+    int digits = static_cast<int>(strchr(first, 'e') - first);
+    digits -= digits > 1;
+    assert(digits <= shortest_digits(v));
+
+    r = std::to_chars(buf, buf + sizeof(buf), v);
+    assert(r.ec == std::errc{});
+    *r.ptr = '\0';
+    assert(parse<T>(buf) == v);
+
+    r = std::to_chars(buf, buf + sizeof(buf), v, std::chars_format::hex);
+    assert(r.ec == std::errc{});
+    const int negative = *buf == '-';
+    char hex[64] = "-0x";
+    memcpy(hex + 3, buf + negative, r.ptr - buf - negative);
+    hex[r.ptr - buf - negative + 3] = '\0';
+    assert(parse<T>(hex + !negative) == v);
+}
+
+template <typename T>
+void test_common()
+{
+    using xl = std::numeric_limits<T>;
+
+    // Decimal fractions are computed in T, so that they are the closest T.
+    test(T(0), "0");
+    test(-T(0), "-0");
+    test(T(1), "1");
+    test(T(-1.5), "-1.5");
+    test(T(1) / 10, "0.1");
+    test(T(100), "100");
+    test(T(1e10), "1e+10");
+    test(T(123456), "123456");
+    test(T(1) / 1000, "0.001");
+    test(T(1) / 100000, "1e-05");
+    test(xl::infinity(), "inf");
+    test(-xl::infinity(), "-inf");
+    test(xl::quiet_NaN(), "nan");
+
+    test(T(0), "0e+00", std::chars_format::scientific);
+    test(T(1), "1e+00", std::chars_format::scientific);
+    test(T(-0.25), "-2.5e-01", std::chars_format::scientific);
+    test(T(1e20), "1e+20", std::chars_format::scientific);
+
+    test(T(0), "0", std::chars_format::fixed);
+    test(T(1e10), "10000000000", std::chars_format::fixed);
+    test(T(0.0625), "0.0625", std::chars_format::fixed);
+    test(T(-1.5), "-1.5", std::chars_format::fixed);
+
+    test(T(1e5), "100000", std::chars_format::general);
+    test(T(1e6), "1e+06", std::chars_format::general);
+    test(T(1) / 10000, "0.0001", std::chars_format::general);
+    test(T(1) / 100000, "1e-05", std::chars_format::general);
+
+    // As for printf, the leading hexadecimal digit of a long double depends
+    // on its format.
+    if (!std::is_same<T, long double>::value)
+    {
+        test(T(0), "0p+0", std::chars_format::hex);
+        test(T(1), "1p+0", std::chars_format::hex);
+        test(T(-1.5), "-1.8p+0", std::chars_format::hex);
+        test(T(0.25), "1p-2", std::chars_format::hex);
+        test(T(3072), "1.8p+11", std::chars_format::hex);
+        test(T(1), "1.000p+0", std::chars_format::hex, 3);
+    }
+
+    test(T(1.5), "1.500", std::chars_format::fixed, 3);
+    test(T(1.5), "1.50e+00", std::chars_format::scientific, 2);
+    test(T(1.5), "2", std::chars_format::general, 0);
+    test(T(1) / 100000, "1.00000e-05", std::chars_format::scientific, 5);
+
+    test_round_trip(xl::min());
+    test_round_trip(xl::denorm_min());
+    test_round_trip((xl::max)());
+    test_round_trip(xl::lowest());
+    test_round_trip(xl::epsilon());
+    test_round_trip(T(1) / 3);
+    test_round_trip(T(2) / 3);
+}
+
+void test_float()
+{
+    test(3.4028235e38f, "3.4028235e+38");
+    test(1e-45f, "1e-45");
+    test(1.17549435e-38f, "1.1754944e-38");
+    test(0.3f, "0.3");
+    test(16777216.f, "16777216");
+    test(1e23f, "1e+23");
+    test(1.0000001e23f, "1.0000001e+23", std::chars_format::scientific);
+    test(2.5e-4f, "0.00025", std::chars_format::fixed);
+    test(1.4e-45f, "0.000002p-126", std::chars_format::hex);
+    test(1.17549435e-38f, "1p-126", std::chars_format::hex);
+
+    // Shortest decimal, but the integer digits are exact.
+    test(1e10f, "10000000000", std::chars_format::fixed);
+    test(1e23f, "99999997781963083612160", std::chars_format::fixed);
+
+    uint32_t bits = 0x9e3779b9;
+    for (int i = 0; i < 20000; ++i)
+    {
+        bits = bits * 1664525 + 1013904223;
+        float f;
+        memcpy(&f, &bits, sizeof(f));
+        if (std::isfinite(f))
+            test_round_trip(f);
+    }
+}
+
+void test_double()
+{
+    test(1.7976931348623157e308, "1.7976931348623157e+308");
+    test(5e-324, "5e-324");
+    test(2.2250738585072014e-308, "2.2250738585072014e-308");
+    test(0.3, "0.3");
+    test(9007199254740992., "9007199254740992");
+    test(1e23, "1e+23");
+    test(123456789012345680., "123456789012345680");
+    test(1.2345678901234567e-7, "1.2345678901234566e-07");
+    test(5e-324, "0.0000000000001p-1022", std::chars_format::hex);
+    test(2.2250738585072014e-308, "1p-1022", std::chars_format::hex);
+    test(0.1, "1.999999999999ap-4", std::chars_format::hex);
+    test(1.7976931348623157e308, "1.fffffffffffffp+1023",
+         std::chars_format::hex);
+
+    test(1e22, "10000000000000000000000", std::chars_format::fixed);
+    test(1e23, "99999999999999991611392", std::chars_format::fixed);
+    test(1e-7, "0.0000001", std::chars_format::fixed);
+    test(0.1, "0.1000000000000000055511151231257827021181583404541015625",
+         std::chars_format::fixed, 55);
+
+    uint64_t bits = 0x9e3779b97f4a7c15;
+    for (int i = 0; i < 20000; ++i)
+    {
+        bits = bits * 6364136223846793005 + 1442695040888963407;
+        double d;
+        memcpy(&d, &bits, sizeof(d));
+        if (std::isfinite(d))
+            test_round_trip(d);
+    }
+}
+
+int
+main()
+{
+    test_common<float>();
+    test_common<double>();
+    test_common<long double>();
+    test_float();
+    test_double();
+
+    test(0.1L, "0.1");
+    test(1e30L, "1e+30");
+    test(-2.5L, "-2.5");
+}
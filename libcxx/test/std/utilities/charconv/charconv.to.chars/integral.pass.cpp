@@ -35,6 +35,10 @@ struct test_basics : to_chars_test_base<T>
         test(0, "0");
         test(42, "42");
         test(32768, "32768");
+        test(123456789, "123456789");
+        test(1234567890, "1234567890");
+        test(123456789012, "123456789012");
+        test(12345678901234567, "12345678901234567");
         test(0, "0", 10);
         test(42, "42", 10);
         test(32768, "32768", 10);
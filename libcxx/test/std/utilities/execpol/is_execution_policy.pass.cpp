@@ -0,0 +1,47 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// <execution>
+// UNSUPPORTED: c++98, c++03, c++11, c++14
+
+// template<class T> struct is_execution_policy;
+// template<class T> inline constexpr bool is_execution_policy_v;
+//
+// namespace execution {
+//   inline constexpr sequenced_policy seq;
+//   inline constexpr parallel_policy par;
+//   inline constexpr parallel_unsequenced_policy par_unseq;
+// }
+
+#include <execution>
+#include <type_traits>
+
+template <class T, bool Expected>
+void test() {
+  static_assert(std::is_execution_policy<T>::value == Expected, "");
+  static_assert(std::is_execution_policy_v<T> == Expected, "");
+  static_assert(std::is_base_of<std::integral_constant<bool, Expected>,
+                                std::is_execution_policy<T>>::value, "");
+}
+
+int main() {
+  test<std::execution::sequenced_policy, true>();
+  test<std::execution::parallel_policy, true>();
+  test<std::execution::parallel_unsequenced_policy, true>();
+  test<int, false>();
+  test<const std::execution::parallel_policy, false>();
+  test<std::execution::parallel_policy&, false>();
+
+  static_assert(std::is_same<decltype(std::execution::seq),
+                             const std::execution::sequenced_policy>::value, "");
+  static_assert(std::is_same<decltype(std::execution::par),
+                             const std::execution::parallel_policy>::value, "");
+  static_assert(std::is_same<decltype(std::execution::par_unseq),
+                             const std::execution::parallel_unsequenced_policy>::value, "");
+}
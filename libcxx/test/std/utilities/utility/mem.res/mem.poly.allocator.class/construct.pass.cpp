@@ -0,0 +1,123 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++98, c++03, c++11, c++14
+
+// <memory_resource>
+
+// template <class T> class polymorphic_allocator
+
+// template <class U, class... Args>
+//   void construct(U* p, Args&&... args);
+// template <class T1, class T2, class... Args1, class... Args2>
+//   void construct(pair<T1, T2>* p, piecewise_construct_t,
+//                  tuple<Args1...> x, tuple<Args2...> y);
+
+#include <memory_resource>
+#include <cassert>
+#include <map>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "test_macros.h"
+
+namespace pmr = std::pmr;
+
+struct CountingResource : pmr::memory_resource {
+    int allocations = 0;
+    int deallocations = 0;
+
+private:
+    void* do_allocate(std::size_t bytes, std::size_t align) override {
+        ++allocations;
+        return pmr::new_delete_resource()->allocate(bytes, align);
+    }
+    void do_deallocate(void* p, std::size_t bytes, std::size_t align) override {
+        ++deallocations;
+        pmr::new_delete_resource()->deallocate(p, bytes, align);
+    }
+    bool do_is_equal(const pmr::memory_resource& other) const noexcept override {
+        return &other == this;
+    }
+};
+
+// Takes the allocator as a trailing argument.
+struct Trailing {
+    using allocator_type = pmr::polymorphic_allocator<char>;
+    int value;
+    pmr::memory_resource* resource;
+    Trailing(int v, const allocator_type& a) : value(v), resource(a.resource()) {}
+};
+
+// Takes the allocator after allocator_arg.
+struct Leading {
+    using allocator_type = pmr::polymorphic_allocator<char>;
+    int value;
+    pmr::memory_resource* resource;
+    Leading(std::allocator_arg_t, const allocator_type& a, int v)
+        : value(v), resource(a.resource()) {}
+};
+
+int main()
+{
+    CountingResource r;
+    pmr::polymorphic_allocator<int> a(&r);
+    {
+        alignas(Trailing) char buf[sizeof(Trailing)];
+        Trailing* p = reinterpret_cast<Trailing*>(buf);
+        a.construct(p, 42);
+        assert(p->value == 42);
+        assert(p->resource == &r);
+        a.destroy(p);
+    }
+    {
+        alignas(Leading) char buf[sizeof(Leading)];
+        Leading* p = reinterpret_cast<Leading*>(buf);
+        a.construct(p, 7);
+        assert(p->value == 7);
+        assert(p->resource == &r);
+        a.destroy(p);
+    }
+    {
+        typedef std::pair<Leading, Trailing> P;
+        alignas(P) char buf[sizeof(P)];
+        P* p = reinterpret_cast<P*>(buf);
+        a.construct(p, std::piecewise_construct, std::make_tuple(1),
+                    std::make_tuple(2));
+        assert(p->first.value == 1 && p->first.resource == &r);
+        assert(p->second.value == 2 && p->second.resource == &r);
+        a.destroy(p);
+
+        a.construct(p, 3, 4);
+        assert(p->first.value == 3 && p->first.resource == &r);
+        assert(p->second.value == 4 && p->second.resource == &r);
+        a.destroy(p);
+    }
+    {
+        // The allocator propagates to the elements of pmr containers.
+        pmr::vector<pmr::string> v(&r);
+        v.emplace_back("a string long enough to need an allocation");
+        assert(v.back().get_allocator().resource() == &r);
+
+        pmr::map<int, pmr::string> m(&r);
+        m.emplace(1, "another string long enough to need an allocation");
+        assert(m[1].get_allocator().resource() == &r);
+    }
+    assert(r.allocations > 0);
+    assert(r.allocations == r.deallocations);
+    {
+        // Copies of a container use the default resource.
+        pmr::vector<int> v(&r);
+        pmr::vector<int> w(v);
+        assert(w.get_allocator().resource() == pmr::get_default_resource());
+        assert(v.get_allocator() != w.get_allocator());
+    }
+}
@@ -0,0 +1,71 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++98, c++03, c++11, c++14
+
+// <memory_resource>
+
+// memory_resource* new_delete_resource() noexcept;
+// memory_resource* null_memory_resource() noexcept;
+// memory_resource* get_default_resource() noexcept;
+// memory_resource* set_default_resource(memory_resource* r) noexcept;
+
+#include <memory_resource>
+#include <cassert>
+#include <cstdint>
+#include <new>
+
+#include "test_macros.h"
+
+namespace pmr = std::pmr;
+
+int main()
+{
+    static_assert(noexcept(pmr::new_delete_resource()), "");
+    static_assert(noexcept(pmr::null_memory_resource()), "");
+    static_assert(noexcept(pmr::get_default_resource()), "");
+    static_assert(noexcept(pmr::set_default_resource(nullptr)), "");
+
+    pmr::memory_resource* nd = pmr::new_delete_resource();
+    pmr::memory_resource* null = pmr::null_memory_resource();
+    assert(nd == pmr::new_delete_resource());
+    assert(null == pmr::null_memory_resource());
+    assert(*nd == *nd);
+    assert(*nd != *null);
+
+    {
+        void* p = nd->allocate(100);
+        assert(p != nullptr);
+        nd->deallocate(p, 100);
+
+        const std::size_t align = 256;
+        p = nd->allocate(64, align);
+        assert(reinterpret_cast<std::uintptr_t>(p) % align == 0);
+        nd->deallocate(p, 64, align);
+    }
+#ifndef TEST_HAS_NO_EXCEPTIONS
+    {
+        try {
+            (void)null->allocate(1);
+            assert(false);
+        } catch (const std::bad_alloc&) {
+        }
+    }
+#endif
+    {
+        assert(pmr::get_default_resource() == nd);
+        assert(pmr::set_default_resource(null) == nd);
+        assert(pmr::get_default_resource() == null);
+        pmr::polymorphic_allocator<int> a;
+        assert(a.resource() == null);
+        // A null argument restores new_delete_resource().
+        assert(pmr::set_default_resource(nullptr) == null);
+        assert(pmr::get_default_resource() == nd);
+    }
+}
@@ -0,0 +1,113 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++98, c++03, c++11, c++14
+
+// <memory_resource>
+
+// class monotonic_buffer_resource
+
+// void* do_allocate(size_t bytes, size_t alignment);
+// void release();
+
+#include <memory_resource>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "test_macros.h"
+
+namespace pmr = std::pmr;
+
+struct CountingResource : pmr::memory_resource {
+    int allocations = 0;
+    int deallocations = 0;
+    std::size_t last_size = 0;
+
+private:
+    void* do_allocate(std::size_t bytes, std::size_t align) override {
+        ++allocations;
+        last_size = bytes;
+        return pmr::new_delete_resource()->allocate(bytes, align);
+    }
+    void do_deallocate(void* p, std::size_t bytes, std::size_t align) override {
+        ++deallocations;
+        pmr::new_delete_resource()->deallocate(p, bytes, align);
+    }
+    bool do_is_equal(const pmr::memory_resource& other) const noexcept override {
+        return &other == this;
+    }
+};
+
+bool is_aligned(void* p, std::size_t align) {
+    return reinterpret_cast<std::uintptr_t>(p) % align == 0;
+}
+
+int main()
+{
+    {
+        // Allocations are served from the initial buffer first.
+        CountingResource up;
+        alignas(16) char buffer[256];
+        pmr::monotonic_buffer_resource mr(buffer, sizeof(buffer), &up);
+        assert(mr.upstream_resource() == &up);
+        void* p1 = mr.allocate(10, 1);
+        void* p2 = mr.allocate(16, 16);
+        void* p3 = mr.allocate(0, 1);
+        assert(p1 != p2 && p1 != p3 && p2 != p3);
+        for (void* p : {p1, p2, p3})
+            assert(p >= buffer && p < buffer + sizeof(buffer));
+        assert(is_aligned(p2, 16));
+        mr.deallocate(p1, 10, 1);
+        assert(up.allocations == 0);
+
+        // Then from geometrically growing chunks.
+        void* big = mr.allocate(300, 8);
+        assert(up.allocations == 1);
+        std::memset(big, 0, 300);
+        std::size_t first = up.last_size;
+        mr.allocate(first * 2, 8);
+        assert(up.allocations == 2);
+        assert(up.last_size >= 2 * first);
+
+        // release() returns the chunks and rewinds to the initial buffer.
+        mr.release();
+        assert(up.deallocations == 2);
+        void* p4 = mr.allocate(10, 1);
+        assert(p4 >= buffer && p4 < buffer + sizeof(buffer));
+        assert(up.allocations == 2);
+    }
+    {
+        CountingResource up;
+        {
+            pmr::monotonic_buffer_resource mr(100, &up);
+            for (std::size_t align = 1; align <= 512; align *= 2) {
+                void* p = mr.allocate(align * 3, align);
+                assert(is_aligned(p, align));
+                std::memset(p, 0xAB, align * 3);
+            }
+            assert(up.allocations > 0);
+        }
+        assert(up.allocations == up.deallocations);
+    }
+    {
+        // Containers using the resource.
+        CountingResource up;
+        {
+            pmr::monotonic_buffer_resource mr(&up);
+            pmr::vector<pmr::string> v(&mr);
+            for (int i = 0; i < 1000; ++i)
+                v.emplace_back(100, 'x');
+            assert(v[999] == pmr::string(100, 'x'));
+        }
+        assert(up.allocations == up.deallocations);
+    }
+}
@@ -0,0 +1,126 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++98, c++03, c++11, c++14
+// UNSUPPORTED: libcpp-has-no-threads
+
+// <memory_resource>
+
+// class synchronized_pool_resource
+
+#include <memory_resource>
+#include <atomic>
+#include <cassert>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "test_macros.h"
+
+namespace pmr = std::pmr;
+
+struct CountingResource : pmr::memory_resource {
+    std::atomic<int> allocations{0};
+    std::atomic<int> deallocations{0};
+
+private:
+    void* do_allocate(std::size_t bytes, std::size_t align) override {
+        ++allocations;
+        return pmr::new_delete_resource()->allocate(bytes, align);
+    }
+    void do_deallocate(void* p, std::size_t bytes, std::size_t align) override {
+        ++deallocations;
+        pmr::new_delete_resource()->deallocate(p, bytes, align);
+    }
+    bool do_is_equal(const pmr::memory_resource& other) const noexcept override {
+        return &other == this;
+    }
+};
+
+const int kThreads = 4;
+const int kBlocks = 500;
+const int kRounds = 10;
+
+int main()
+{
+    CountingResource up;
+    {
+        pmr::pool_options opts;
+        opts.largest_required_pool_block = 256;
+        pmr::synchronized_pool_resource mr(opts, &up);
+        assert(mr.upstream_resource() == &up);
+        assert(mr.options().largest_required_pool_block >= 256);
+
+        // Each thread frees the blocks allocated by the next one.
+        std::vector<std::vector<void*>> blocks(kThreads);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < kThreads; ++t)
+            threads.emplace_back([&, t] {
+                for (int i = 0; i < kBlocks; ++i) {
+                    std::size_t size = 1 + (i * 13) % 400;
+                    void* p = mr.allocate(size, 8);
+                    std::memset(p, t, size);
+                    blocks[t].push_back(p);
+                }
+            });
+        for (std::thread& th : threads)
+            th.join();
+        threads.clear();
+        for (int t = 0; t < kThreads; ++t)
+            threads.emplace_back([&, t] {
+                std::vector<void*>& mine = blocks[(t + 1) % kThreads];
+                for (int i = 0; i < kBlocks; ++i) {
+                    std::size_t size = 1 + (i * 13) % 400;
+                    const unsigned char* c = static_cast<unsigned char*>(mine[i]);
+                    assert(c[0] == (t + 1) % kThreads);
+                    assert(c[size - 1] == (t + 1) % kThreads);
+                    mr.deallocate(mine[i], size, 8);
+                }
+                for (int i = 0; i < kBlocks; ++i) {
+                    void* p = mr.allocate(64);
+                    mr.deallocate(p, 64);
+                }
+            });
+        for (std::thread& th : threads)
+            th.join();
+
+        // Blocks freed by the main thread are reused by the producer, which
+        // thus stops allocating upstream once the first round has been freed.
+        std::vector<void*> produced;
+        std::atomic<int> turn(0);
+        std::thread producer([&] {
+            for (int round = 0; round < kRounds; ++round) {
+                while (turn != 2 * round)
+                    std::this_thread::yield();
+                for (int i = 0; i < kBlocks; ++i)
+                    produced.push_back(mr.allocate(32));
+                turn = 2 * round + 1;
+            }
+        });
+        int warm = 0;
+        for (int round = 0; round < kRounds; ++round) {
+            while (turn != 2 * round + 1)
+                std::this_thread::yield();
+            if (round == 1)
+                warm = up.allocations;
+            else if (round > 1)
+                assert(up.allocations == warm);
+            for (void* p : produced)
+                mr.deallocate(p, 32);
+            produced.clear();
+            turn = 2 * round + 2;
+        }
+        producer.join();
+
+        mr.release();
+        void* p = mr.allocate(1000);
+        mr.deallocate(p, 1000);
+    }
+    assert(up.allocations == up.deallocations);
+}
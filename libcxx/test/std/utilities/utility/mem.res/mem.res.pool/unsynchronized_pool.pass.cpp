@@ -0,0 +1,124 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++98, c++03, c++11, c++14
+
+// <memory_resource>
+
+// class unsynchronized_pool_resource
+
+#include <memory_resource>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "test_macros.h"
+
+namespace pmr = std::pmr;
+
+struct CountingResource : pmr::memory_resource {
+    int allocations = 0;
+    int deallocations = 0;
+
+private:
+    void* do_allocate(std::size_t bytes, std::size_t align) override {
+        ++allocations;
+        return pmr::new_delete_resource()->allocate(bytes, align);
+    }
+    void do_deallocate(void* p, std::size_t bytes, std::size_t align) override {
+        ++deallocations;
+        pmr::new_delete_resource()->deallocate(p, bytes, align);
+    }
+    bool do_is_equal(const pmr::memory_resource& other) const noexcept override {
+        return &other == this;
+    }
+};
+
+bool is_aligned(void* p, std::size_t align) {
+    return reinterpret_cast<std::uintptr_t>(p) % align == 0;
+}
+
+int main()
+{
+    {
+        pmr::pool_options opts;
+        opts.max_blocks_per_chunk = 32;
+        opts.largest_required_pool_block = 1000;
+        pmr::unsynchronized_pool_resource mr(opts, pmr::new_delete_resource());
+        assert(mr.upstream_resource() == pmr::new_delete_resource());
+        pmr::pool_options got = mr.options();
+        assert(got.max_blocks_per_chunk <= 32);
+        assert(got.largest_required_pool_block >= 1000);
+        assert(mr == mr);
+        pmr::unsynchronized_pool_resource other;
+        assert(mr != other);
+    }
+    {
+        // Freed blocks are reused without going upstream.
+        CountingResource up;
+        {
+            pmr::unsynchronized_pool_resource mr(&up);
+            void* p = mr.allocate(24, 8);
+            int n = up.allocations;
+            mr.deallocate(p, 24, 8);
+            void* q = mr.allocate(24, 8);
+            assert(q == p);
+            assert(up.allocations == n);
+            mr.deallocate(q, 24, 8);
+        }
+        assert(up.allocations == up.deallocations);
+    }
+    {
+        // Every block is usable, aligned and distinct; oversized requests are
+        // forwarded upstream and returned by release().
+        CountingResource up;
+        pmr::pool_options opts;
+        opts.largest_required_pool_block = 512;
+        pmr::unsynchronized_pool_resource mr(opts, &up);
+        struct Block { void* p; std::size_t size; std::size_t align; };
+        std::vector<Block> blocks;
+        for (int i = 0; i < 2000; ++i) {
+            std::size_t size = 1 + (i * 37) % 2000;
+            std::size_t align = std::size_t(1) << (i % 8);
+            void* p = mr.allocate(size, align);
+            assert(is_aligned(p, align));
+            std::memset(p, i & 0xFF, size);
+            blocks.push_back(Block{p, size, align});
+        }
+        for (int i = 0; i < 2000; ++i) {
+            const unsigned char* c = static_cast<unsigned char*>(blocks[i].p);
+            for (std::size_t j = 0; j < blocks[i].size; ++j)
+                assert(c[j] == (i & 0xFF));
+        }
+        for (std::size_t i = 0; i < blocks.size(); i += 2)
+            mr.deallocate(blocks[i].p, blocks[i].size, blocks[i].align);
+        mr.release();
+        assert(up.allocations == up.deallocations);
+
+        // The resource is usable again after release().
+        void* p = mr.allocate(100);
+        mr.deallocate(p, 100);
+    }
+    {
+        CountingResource up;
+        {
+            pmr::unsynchronized_pool_resource mr(&up);
+            pmr::unordered_map<int, pmr::string> m(&mr);
+            for (int i = 0; i < 1000; ++i)
+                m.emplace(i, pmr::string(i % 64, 'x'));
+            for (int i = 0; i < 1000; i += 2)
+                m.erase(i);
+            assert(m.size() == 500);
+        }
+        assert(up.allocations == up.deallocations);
+    }
+}
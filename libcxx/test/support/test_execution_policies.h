@@ -0,0 +1,30 @@
+//===----------------------------------------------------------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef TEST_EXECUTION_POLICIES_H
+#define TEST_EXECUTION_POLICIES_H
+
+#include <execution>
+#include <vector>
+
+// Calls f with each of the standard execution policies.
+template <class Functor>
+void test_execution_policies(Functor f) {
+  f(std::execution::seq);
+  f(std::execution::par);
+  f(std::execution::par_unseq);
+}
+
+// Sizes below, around and well above the point where the parallel algorithms
+// start splitting the work.
+inline std::vector<int> get_execution_policy_test_sizes() {
+  return {0, 1, 2, 3, 100, 2047, 4096, 4099, 100000};
+}
+
+#endif // TEST_EXECUTION_POLICIES_H
@@ -160,6 +160,65 @@ static size_t get_cxa_exception_offset() {
   return offset;
 }
 
+// Exception buffers are recycled: each thread keeps the last few buffers it
+// freed in its __cxa_eh_globals, and reuses them for the next exceptions it
+// throws. This keeps malloc, and the lock of the emergency heap when memory
+// is short, off the path of code throwing exceptions at a high rate.
+//
+// Only buffers of kExceptionBufferSize bytes are kept, which is enough for
+// the header and most thrown objects. A prefix in front of each buffer tells
+// whether it has this size.
+static const size_t kExceptionBufferSize = 256;
+
+struct __attribute__((aligned)) exception_buffer_prefix {
+    bool cacheable;
+};
+
+static void *allocate_exception_buffer(size_t size) {
+    const bool cacheable = size <= kExceptionBufferSize;
+    exception_buffer_prefix *prefix = NULL;
+    if (cacheable) {
+        __cxa_eh_globals *globals = __cxa_get_globals();
+        // No buffer is kept once the count is past kExceptionBufferCacheSize.
+        if (globals->exceptionBufferCount - 1 < kExceptionBufferCacheSize)
+            prefix = static_cast<exception_buffer_prefix *>(
+                globals->exceptionBuffers[--globals->exceptionBufferCount]);
+    }
+    if (NULL == prefix) {
+        prefix = static_cast<exception_buffer_prefix *>(
+            __aligned_malloc_with_fallback(
+                sizeof(exception_buffer_prefix) +
+                (cacheable ? kExceptionBufferSize : size)));
+        if (NULL == prefix)
+            return NULL;
+        // The emergency heap gets its buffers back right away.
+        prefix->cacheable = cacheable && !__is_fallback_ptr(prefix);
+    }
+    return prefix + 1;
+}
+
+static void free_exception_buffer(void *ptr) {
+    exception_buffer_prefix *prefix =
+        static_cast<exception_buffer_prefix *>(ptr) - 1;
+    if (prefix->cacheable) {
+        // The exception may be freed by a thread that never threw.
+        __cxa_eh_globals *globals = __cxa_get_globals_fast();
+        if (NULL != globals &&
+            globals->exceptionBufferCount < kExceptionBufferCacheSize) {
+            globals->exceptionBuffers[globals->exceptionBufferCount++] = prefix;
+            return;
+        }
+    }
+    __aligned_free_with_fallback(prefix);
+}
+
+void __free_exception_buffer_cache(__cxa_eh_globals *globals) {
+    for (unsigned int i = 0; i < globals->exceptionBufferCount &&
+                             i < kExceptionBufferCacheSize; ++i)
+        __aligned_free_with_fallback(globals->exceptionBuffers[i]);
+    globals->exceptionBufferCount = kExceptionBufferCacheSize + 1;
+}
+
 extern "C" {
 
 //  Allocate a __cxa_exception object, and zero-fill it.
@@ -174,7 +233,7 @@ void *__cxa_allocate_exception(size_t thrown_size) throw() {
     // start of the thrown object is sufficiently aligned.
     size_t header_offset = get_cxa_exception_offset();
     char *raw_buffer =
-        (char *)__aligned_malloc_with_fallback(header_offset + actual_size);
+        (char *)allocate_exception_buffer(header_offset + actual_size);
     if (NULL == raw_buffer)
         std::terminate();
     __cxa_exception *exception_header =
@@ -190,7 +249,7 @@ void __cxa_free_exception(void *thrown_object) throw() {
     size_t header_offset = get_cxa_exception_offset();
     char *raw_buffer =
         ((char *)cxa_exception_from_thrown_object(thrown_object)) - header_offset;
-    __aligned_free_with_fallback((void *)raw_buffer);
+    free_exception_buffer((void *)raw_buffer);
 }
 
 
@@ -199,7 +258,7 @@ void __cxa_free_exception(void *thrown_object) throw() {
 //  Otherwise, it will work like __cxa_allocate_exception.
 void * __cxa_allocate_dependent_exception () {
     size_t actual_size = sizeof(__cxa_dependent_exception);
-    void *ptr = __aligned_malloc_with_fallback(actual_size);
+    void *ptr = allocate_exception_buffer(actual_size);
     if (NULL == ptr)
         std::terminate();
     std::memset(ptr, 0, actual_size);
@@ -210,7 +269,7 @@ void * __cxa_allocate_dependent_exception () {
 //  This function shall free a dependent_exception.
 //  It does not affect the reference count of the primary exception.
 void __cxa_free_dependent_exception (void * dependent_exception) {
-    __aligned_free_with_fallback(dependent_exception);
+    free_exception_buffer(dependent_exception);
 }
 
 
@@ -97,14 +97,25 @@ struct _LIBCXXABI_HIDDEN __cxa_dependent_exception {
     _Unwind_Exception unwindHeader;
 };
 
+// The number of freed exception buffers each thread keeps for reuse.
+static const unsigned int kExceptionBufferCacheSize = 4;
+
 struct _LIBCXXABI_HIDDEN __cxa_eh_globals {
     __cxa_exception *   caughtExceptions;
     unsigned int        uncaughtExceptions;
 #if defined(_LIBCXXABI_ARM_EHABI)
     __cxa_exception* propagatingExceptions;
 #endif
+    // Buffers of the exceptions freed by this thread, to be reused by the
+    // next ones it throws. Not part of the ABI, so they come last.
+    unsigned int        exceptionBufferCount;
+    void *              exceptionBuffers[kExceptionBufferCacheSize];
 };
 
+// Frees the exception buffers kept in globals, when its thread exits. No more
+// buffers are kept afterwards.
+_LIBCXXABI_HIDDEN void __free_exception_buffer_cache(__cxa_eh_globals *globals);
+
 extern "C" _LIBCXXABI_FUNC_VIS __cxa_eh_globals * __cxa_get_globals      ();
 extern "C" _LIBCXXABI_FUNC_VIS __cxa_eh_globals * __cxa_get_globals_fast ();
 
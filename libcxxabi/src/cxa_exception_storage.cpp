@@ -30,8 +30,12 @@ extern "C" {
 namespace __cxxabiv1 {
 
 namespace {
+    struct __thread_eh_globals : __cxa_eh_globals {
+        ~__thread_eh_globals () { __free_exception_buffer_cache ( this ); }
+        };
+
     __cxa_eh_globals * __globals () {
-        static thread_local __cxa_eh_globals eh_globals;
+        static thread_local __thread_eh_globals eh_globals;
         return &eh_globals;
         }
     }
@@ -57,6 +61,7 @@ namespace {
     std::__libcpp_exec_once_flag flag_ = _LIBCPP_EXEC_ONCE_INITIALIZER;
 
     void _LIBCPP_TLS_DESTRUCTOR_CC destruct_ (void *p) {
+        __free_exception_buffer_cache ( static_cast<__cxa_eh_globals*> ( p ) );
         __free_with_fallback ( p );
         if ( 0 != std::__libcpp_tls_set ( key_, NULL ) )
             abort_message("cannot zero out thread value for __cxa_get_globals()");
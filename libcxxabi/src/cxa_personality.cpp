@@ -237,6 +237,55 @@ readSLEB128(const uint8_t** data)
     return static_cast<intptr_t>(result);
 }
 
+/// Advance pointer past a uleb128 or sleb128 encoded value
+/// @param data reference variable holding memory pointer to decode from
+static
+void
+skipLEB128(const uint8_t** data)
+{
+    const uint8_t *p = *data;
+    while (*p++ & 0x80)
+        ;
+    *data = p;
+}
+
+/// Advance pointer past a pointer encoded value without decoding it
+/// @param data reference variable holding memory pointer to decode from
+/// @param encoding dwarf encoding type
+static
+void
+skipEncodedPointer(const uint8_t** data, uint8_t encoding)
+{
+    if (encoding == DW_EH_PE_omit)
+        return;
+    switch (encoding & 0x0F)
+    {
+    case DW_EH_PE_absptr:
+        *data += sizeof(uintptr_t);
+        break;
+    case DW_EH_PE_uleb128:
+    case DW_EH_PE_sleb128:
+        skipLEB128(data);
+        break;
+    case DW_EH_PE_udata2:
+    case DW_EH_PE_sdata2:
+        *data += 2;
+        break;
+    case DW_EH_PE_udata4:
+    case DW_EH_PE_sdata4:
+        *data += 4;
+        break;
+    case DW_EH_PE_udata8:
+    case DW_EH_PE_sdata8:
+        *data += 8;
+        break;
+    default:
+        // not supported 
+        abort();
+        break;
+    }
+}
+
 /// Read a pointer encoded value and advance pointer 
 /// See Variable Length Data in: 
 /// @link http://dwarfstd.org/Dwarf3.pdf @unlink
@@ -666,9 +715,18 @@ static void scan_eh_tab(scan_results &results, _Unwind_Action actions,
         // The call sites are ordered in increasing value of start
         uintptr_t start = readEncodedPointer(&callSitePtr, callSiteEncoding);
         uintptr_t length = readEncodedPointer(&callSitePtr, callSiteEncoding);
+        // The entries have no fixed size, as they end with a uleb128, so they
+        // cannot be binary searched. At least only decode the rest of the
+        // entry for ip.
+        if ((start <= ipOffset) && (ipOffset >= (start + length)))
+        {
+            skipEncodedPointer(&callSitePtr, callSiteEncoding);
+            skipLEB128(&callSitePtr);
+            continue;
+        }
         uintptr_t landingPad = readEncodedPointer(&callSitePtr, callSiteEncoding);
         uintptr_t actionEntry = readULEB128(&callSitePtr);
-        if ((start <= ipOffset) && (ipOffset < (start + length)))
+        if (start <= ipOffset)
 #else  // __USING_SJLJ_EXCEPTIONS__
         // ip is 1-based index into this table
         uintptr_t landingPad = readULEB128(&callSitePtr);
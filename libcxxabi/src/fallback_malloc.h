@@ -22,6 +22,9 @@ _LIBCXXABI_HIDDEN void * __aligned_malloc_with_fallback(size_t size);
 _LIBCXXABI_HIDDEN void * __calloc_with_fallback(size_t count, size_t size);
 
 _LIBCXXABI_HIDDEN void __aligned_free_with_fallback(void *ptr);
+
+// Whether ptr was allocated from the emergency heap
+_LIBCXXABI_HIDDEN bool __is_fallback_ptr(void *ptr);
 _LIBCXXABI_HIDDEN void __free_with_fallback(void *ptr);
 
 } // namespace __cxxabiv1
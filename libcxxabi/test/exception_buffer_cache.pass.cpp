@@ -0,0 +1,105 @@
+//===------------------ exception_buffer_cache.pass.cpp -------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: libcxxabi-no-exceptions
+
+// Check that the buffers of the exceptions a thread frees are reused by the
+// next ones it throws, and that exceptions freed by other threads, or too
+// large to be kept, are handled.
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <cxxabi.h>
+#include <__threading_support>
+
+struct Small {
+    int value;
+};
+
+struct Large {
+    char data[1024];
+};
+
+template <class T>
+const void* throwAndCatch() {
+    try {
+        throw T();
+    } catch (const T& e) {
+        return &e;
+    }
+    return 0;
+}
+
+#ifndef _LIBCXXABI_HAS_NO_THREADS
+// Rethrows an exception of the main thread, through a dependent exception,
+// and frees it.
+void* rethrowFromOtherThread(void* primary) {
+    try {
+        abi::__cxa_rethrow_primary_exception(primary);
+    } catch (const Small& e) {
+        assert(e.value == 42);
+    }
+    abi::__cxa_decrement_exception_refcount(primary);
+    return 0;
+}
+#endif
+
+int main() {
+    // The buffer of a caught exception is given to the next one.
+    const void* first = throwAndCatch<Small>();
+    for (int i = 0; i < 10; ++i)
+        assert(throwAndCatch<Small>() == first);
+
+    // Nested exceptions take several buffers.
+    try {
+        throw Small();
+    } catch (const Small& outer) {
+        const void* inner = throwAndCatch<Small>();
+        assert(inner != &outer);
+        assert(throwAndCatch<Small>() == inner);
+    }
+
+    // Large exceptions are allocated on their own.
+    for (int i = 0; i < 10; ++i) {
+        try {
+            Large l;
+            std::memset(l.data, i, sizeof(l.data));
+            throw l;
+        } catch (const Large& e) {
+            assert(e.data[0] == i && e.data[sizeof(e.data) - 1] == i);
+            assert(reinterpret_cast<std::uintptr_t>(&e) % alignof(Large) == 0);
+        }
+    }
+
+    // Reused buffers hold the new objects.
+    for (int i = 0; i < 10; ++i) {
+        try {
+            throw Small{i};
+        } catch (const Small& e) {
+            assert(e.value == i);
+        }
+    }
+
+#ifndef _LIBCXXABI_HAS_NO_THREADS
+    for (int i = 0; i < 10; ++i) {
+        void* primary = 0;
+        try {
+            throw Small{42};
+        } catch (...) {
+            primary = abi::__cxa_current_primary_exception();
+        }
+        std::__libcpp_thread_t t;
+        std::__libcpp_thread_create(&t, rethrowFromOtherThread, primary);
+        std::__libcpp_thread_join(&t);
+        assert(throwAndCatch<Small>() != 0);
+    }
+#endif
+    return 0;
+}
@@ -147,6 +147,31 @@ extern char __exidx_end;
 #define ElfW(type) Elf_##type
 #endif
 
+// Since glibc 2.35, _dl_find_object() finds the object containing an address
+// and its PT_GNU_EH_FRAME segment without taking the loader lock, in a time
+// logarithmic in the number of objects. Otherwise dl_iterate_phdr() goes over
+// the program headers of every object under the lock, and the objects found
+// are cached to cut this short when the same objects are unwound again.
+#ifndef _LIBUNWIND_USE_DL_FIND_OBJECT
+  #if defined(_LIBUNWIND_SUPPORT_DWARF_UNWIND) &&                              \
+      defined(DLFO_STRUCT_HAS_EH_DBASE) && DLFO_STRUCT_HAS_EH_DBASE == 0
+    #define _LIBUNWIND_USE_DL_FIND_OBJECT 1
+  #else
+    #define _LIBUNWIND_USE_DL_FIND_OBJECT 0
+  #endif
+#endif
+
+// The cache relies on the callbacks of dl_iterate_phdr() being serialized.
+#ifndef _LIBUNWIND_USE_FRAME_HEADER_CACHE
+  #if defined(_LIBUNWIND_SUPPORT_DWARF_UNWIND) &&                              \
+      !_LIBUNWIND_USE_DL_FIND_OBJECT &&                                        \
+      (defined(__GLIBC__) || defined(__FreeBSD__))
+    #define _LIBUNWIND_USE_FRAME_HEADER_CACHE 1
+  #else
+    #define _LIBUNWIND_USE_FRAME_HEADER_CACHE 0
+  #endif
+#endif
+
 #endif
 
 namespace libunwind {
@@ -176,6 +201,13 @@ struct UnwindInfoSections {
 #endif
 };
 
+} // namespace libunwind
+
+#if _LIBUNWIND_USE_FRAME_HEADER_CACHE
+#include "FrameHeaderCache.hpp"
+#endif
+
+namespace libunwind {
 
 /// LocalAddressSpace is used as a template parameter to UnwindCursor when
 /// unwinding a thread in the same process.  The wrappers compile away,
@@ -227,6 +259,9 @@ public:
   bool findOtherFDE(pint_t targetAddr, pint_t &fde);
 
   static LocalAddressSpace sThisAddressSpace;
+#if _LIBUNWIND_USE_FRAME_HEADER_CACHE
+  static FrameHeaderCache sFrameHeaderCache;
+#endif
 };
 
 inline uintptr_t LocalAddressSpace::getP(pint_t addr) {
@@ -466,16 +501,33 @@ inline bool LocalAddressSpace::findUnwindSections(pint_t targetAddr,
   info.arm_section_length = (uintptr_t)length;
   if (info.arm_section && info.arm_section_length)
     return true;
+#elif defined(_LIBUNWIND_SUPPORT_DWARF_UNWIND) && _LIBUNWIND_USE_DL_FIND_OBJECT
+  dl_find_object object;
+  if (_dl_find_object((void *)targetAddr, &object) != 0 ||
+      object.dlfo_eh_frame == NULL)
+    return false;
+  // The sizes of the sections are not known, but they end with the object.
+  uintptr_t object_end = (uintptr_t)object.dlfo_map_end;
+  EHHeaderParser<LocalAddressSpace>::EHHeaderInfo hdrInfo;
+  info.dso_base = (uintptr_t)object.dlfo_map_start;
+  info.dwarf_index_section = (uintptr_t)object.dlfo_eh_frame;
+  info.dwarf_index_section_length = object_end - info.dwarf_index_section;
+  EHHeaderParser<LocalAddressSpace>::decodeEHHdr(
+      *this, info.dwarf_index_section, object_end, hdrInfo);
+  info.dwarf_section = hdrInfo.eh_frame_ptr;
+  info.dwarf_section_length = object_end - info.dwarf_section;
+  return true;
 #elif defined(_LIBUNWIND_ARM_EHABI) || defined(_LIBUNWIND_SUPPORT_DWARF_UNWIND)
   struct dl_iterate_cb_data {
     LocalAddressSpace *addressSpace;
     UnwindInfoSections *sects;
     uintptr_t targetAddr;
+    bool checkedCache;
   };
 
-  dl_iterate_cb_data cb_data = {this, &info, targetAddr};
+  dl_iterate_cb_data cb_data = {this, &info, targetAddr, false};
   int found = dl_iterate_phdr(
-      [](struct dl_phdr_info *pinfo, size_t, void *data) -> int {
+      [](struct dl_phdr_info *pinfo, size_t pinfo_size, void *data) -> int {
         auto cbdata = static_cast<dl_iterate_cb_data *>(data);
         bool found_obj = false;
         bool found_hdr = false;
@@ -483,6 +535,17 @@ inline bool LocalAddressSpace::findUnwindSections(pint_t targetAddr,
         assert(cbdata);
         assert(cbdata->sects);
 
+#if _LIBUNWIND_USE_FRAME_HEADER_CACHE
+        if (!cbdata->checkedCache) {
+          cbdata->checkedCache = true;
+          if (sFrameHeaderCache.find(pinfo, pinfo_size, cbdata->targetAddr,
+                                     *cbdata->sects))
+            return true;
+        }
+#else
+        (void)pinfo_size;
+#endif
+
         if (cbdata->targetAddr < pinfo->dlpi_addr) {
           return false;
         }
@@ -544,6 +607,11 @@ inline bool LocalAddressSpace::findUnwindSections(pint_t targetAddr,
 
         if (found_obj && found_hdr) {
           cbdata->sects->dwarf_section_length = object_length;
+#if _LIBUNWIND_USE_FRAME_HEADER_CACHE
+          sFrameHeaderCache.add(cbdata->sects->dso_base,
+                                cbdata->sects->dso_base + object_length,
+                                *cbdata->sects);
+#endif
           return true;
         } else {
           return false;
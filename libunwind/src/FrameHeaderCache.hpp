@@ -0,0 +1,103 @@
+//===-------------------------- FrameHeaderCache.hpp ----------------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is dual licensed under the MIT and the University of Illinois Open
+// Source Licenses. See LICENSE.TXT for details.
+//
+//
+// Caches the unwind sections found through dl_iterate_phdr(), so that finding
+// them for a pc does not go over the program headers of every loaded object.
+//
+// Included by AddressSpace.hpp after the definition of UnwindInfoSections.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __FRAMEHEADER_CACHE_HPP__
+#define __FRAMEHEADER_CACHE_HPP__
+
+#include <link.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+namespace libunwind {
+
+/// FrameHeaderCache remembers the PT_LOAD segments that recently held a pc
+/// being unwound, along with the unwind sections of their object, in most
+/// recently used order.
+///
+/// The cache is only used from dl_iterate_phdr() callbacks, which the dynamic
+/// loader serializes, so it needs no lock of its own. The callbacks also
+/// report how many objects were ever loaded and unloaded: when these counts
+/// change, the cache is emptied, as the entries may describe unmapped memory.
+///
+/// It has no constructor, so that it is usable by exceptions thrown during
+/// static initialization: the zero-initialized cache is empty.
+class _LIBUNWIND_HIDDEN FrameHeaderCache {
+public:
+  /// Copies the sections of the cached segment containing pc to info and
+  /// returns true. Returns false if there is no such segment, or if the
+  /// cache cannot be checked against the loaded objects.
+  bool find(const dl_phdr_info *pinfo, size_t pinfoSize, uintptr_t pc,
+            UnwindInfoSections &info);
+
+  /// Adds the segment [lowPC, highPC) with the sections of its object. Must
+  /// follow a call to find() in the same dl_iterate_phdr() walk.
+  void add(uintptr_t lowPC, uintptr_t highPC, const UnwindInfoSections &info);
+
+private:
+  struct CacheEntry {
+    uintptr_t lowPC;
+    uintptr_t highPC;
+    UnwindInfoSections info;
+  };
+
+  static const size_t kCacheEntryCount = 8;
+
+  // The first _used entries, most recently used first.
+  CacheEntry _entries[kCacheEntryCount];
+  size_t _used;
+  unsigned long long _adds;
+  unsigned long long _subs;
+};
+
+inline bool FrameHeaderCache::find(const dl_phdr_info *pinfo,
+                                   size_t pinfoSize, uintptr_t pc,
+                                   UnwindInfoSections &info) {
+  // dlpi_adds and dlpi_subs were appended to dl_phdr_info, an older loader
+  // may not report them.
+  if (pinfoSize < offsetof(dl_phdr_info, dlpi_subs) + sizeof(pinfo->dlpi_subs))
+    return false;
+  if (pinfo->dlpi_adds != _adds || pinfo->dlpi_subs != _subs) {
+    _used = 0;
+    _adds = pinfo->dlpi_adds;
+    _subs = pinfo->dlpi_subs;
+    return false;
+  }
+  for (size_t i = 0; i < _used; ++i) {
+    if (pc >= _entries[i].lowPC && pc < _entries[i].highPC) {
+      CacheEntry entry = _entries[i];
+      memmove(&_entries[1], &_entries[0], i * sizeof(CacheEntry));
+      _entries[0] = entry;
+      info = entry.info;
+      return true;
+    }
+  }
+  return false;
+}
+
+inline void FrameHeaderCache::add(uintptr_t lowPC, uintptr_t highPC,
+                                  const UnwindInfoSections &info) {
+  // When full, the least recently used entry is dropped.
+  if (_used < kCacheEntryCount)
+    ++_used;
+  memmove(&_entries[1], &_entries[0], (_used - 1) * sizeof(CacheEntry));
+  _entries[0].lowPC = lowPC;
+  _entries[0].highPC = highPC;
+  _entries[0].info = info;
+}
+
+} // namespace libunwind
+
+#endif // __FRAMEHEADER_CACHE_HPP__
@@ -33,6 +33,11 @@ using namespace libunwind;
 /// internal object to represent this processes address space
 LocalAddressSpace LocalAddressSpace::sThisAddressSpace;
 
+#if _LIBUNWIND_USE_FRAME_HEADER_CACHE
+/// unwind sections of the objects that recently held a pc being unwound
+FrameHeaderCache LocalAddressSpace::sFrameHeaderCache;
+#endif
+
 _LIBUNWIND_EXPORT unw_addr_space_t unw_local_addr_space =
     (unw_addr_space_t)&LocalAddressSpace::sThisAddressSpace;
 
@@ -0,0 +1,89 @@
+// Tests the cache of the unwind sections found through dl_iterate_phdr(). It
+// is forced on, as _dl_find_object() makes it unneeded with recent glibcs.
+
+#define _LIBUNWIND_USE_FRAME_HEADER_CACHE 1
+#include "../src/config.h"
+
+#if defined(_LIBUNWIND_SUPPORT_DWARF_UNWIND) &&                                \
+    (defined(__GLIBC__) || defined(__FreeBSD__))
+
+#include <link.h>
+#include <stdlib.h>
+
+#include "../src/AddressSpace.hpp"
+
+using libunwind::FrameHeaderCache;
+using libunwind::UnwindInfoSections;
+
+static dl_phdr_info makeInfo(unsigned long long adds,
+                             unsigned long long subs) {
+  dl_phdr_info pinfo = {};
+  pinfo.dlpi_adds = adds;
+  pinfo.dlpi_subs = subs;
+  return pinfo;
+}
+
+static UnwindInfoSections makeSections(uintptr_t base) {
+  UnwindInfoSections info = {};
+  info.dso_base = base;
+  info.dwarf_section = base + 0x100;
+  return info;
+}
+
+static bool find(FrameHeaderCache &cache, const dl_phdr_info &pinfo,
+                 uintptr_t pc, uintptr_t expectedBase) {
+  UnwindInfoSections info = {};
+  if (!cache.find(&pinfo, sizeof(pinfo), pc, info))
+    return false;
+  if (info.dso_base != expectedBase ||
+      info.dwarf_section != expectedBase + 0x100)
+    abort();
+  return true;
+}
+
+int main() {
+  static FrameHeaderCache cache;
+  dl_phdr_info pinfo = makeInfo(3, 0);
+
+  // The first lookup records the loaded objects.
+  if (find(cache, pinfo, 0x1000, 0x1000))
+    abort();
+  cache.add(0x1000, 0x2000, makeSections(0x1000));
+  if (!find(cache, pinfo, 0x1000, 0x1000) ||
+      !find(cache, pinfo, 0x1fff, 0x1000) || find(cache, pinfo, 0x2000, 0))
+    abort();
+
+  // Without dlpi_adds and dlpi_subs the cache cannot be checked.
+  UnwindInfoSections info;
+  if (cache.find(&pinfo, offsetof(dl_phdr_info, dlpi_adds), 0x1000, info))
+    abort();
+
+  // Filling the cache evicts the least recently used entry.
+  for (uintptr_t base = 0x10000; base < 0x90000; base += 0x10000) {
+    if (!find(cache, pinfo, 0x1000, 0x1000))
+      abort();
+    cache.add(base, base + 0x10000, makeSections(base));
+  }
+  if (!find(cache, pinfo, 0x1000, 0x1000) || find(cache, pinfo, 0x10000, 0))
+    abort();
+  for (uintptr_t base = 0x20000; base < 0x90000; base += 0x10000)
+    if (!find(cache, pinfo, base + 0x10, base))
+      abort();
+
+  // Loading or unloading an object empties the cache.
+  dl_phdr_info loaded = makeInfo(4, 0);
+  if (find(cache, loaded, 0x1000, 0x1000) || find(cache, loaded, 0x20000, 0))
+    abort();
+  cache.add(0x1000, 0x2000, makeSections(0x1000));
+  if (!find(cache, loaded, 0x1000, 0x1000))
+    abort();
+  dl_phdr_info unloaded = makeInfo(4, 1);
+  if (find(cache, unloaded, 0x1000, 0x1000) ||
+      find(cache, unloaded, 0x1000, 0x1000))
+    abort();
+  return 0;
+}
+
+#else
+int main() { return 0; }
+#endif
@@ -82,6 +82,9 @@ public:
   FileSpec GetClangModulesCachePath() const;
   bool SetClangModulesCachePath(llvm::StringRef path);
   bool GetEnableExternalLookup() const;
+  bool GetEnableIndexCache() const;
+  FileSpec GetIndexCachePath() const;
+  bool SetIndexCachePath(llvm::StringRef path);
 }; 
 
 //----------------------------------------------------------------------
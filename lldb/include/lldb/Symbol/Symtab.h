@@ -11,6 +11,7 @@
 #define liblldb_Symtab_h_
 
 #include <mutex>
+#include <set>
 #include <vector>
 
 #include "lldb/Core/RangeMap.h"
@@ -197,10 +198,24 @@ private:
   void SymbolIndicesToSymbolContextList(std::vector<uint32_t> &symbol_indexes,
                                         SymbolContextList &sc_list);
 
-  void RegisterMangledNameEntry(
-      NameToIndexMap::Entry &entry, std::set<const char *> &class_contexts,
-      std::vector<std::pair<NameToIndexMap::Entry, const char *>> &backlog,
-      RichManglingContext &rmc);
+  // The entries that a range of the symbols adds to the name indexes. The
+  // ranges are indexed in parallel, then merged in order.
+  struct NameIndexes {
+    NameToIndexMap name_to_index;
+    NameToIndexMap basename_to_index;
+    NameToIndexMap method_to_index;
+    NameToIndexMap selector_to_index;
+    // The "const char *" in "class_contexts" and backlog::value_type::second
+    // must come from a ConstString::GetCString()
+    std::set<const char *> class_contexts;
+    std::vector<std::pair<NameToIndexMap::Entry, const char *>> backlog;
+  };
+
+  void IndexSymbolNames(size_t begin, size_t end, NameIndexes &indexes);
+
+  void RegisterMangledNameEntry(NameToIndexMap::Entry &entry,
+                                NameIndexes &indexes,
+                                RichManglingContext &rmc);
 
   void RegisterBacklogEntry(const NameToIndexMap::Entry &entry,
                             const char *decl_context,
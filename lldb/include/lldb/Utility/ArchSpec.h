@@ -50,6 +50,12 @@ public:
     eMIPSSubType_mips64r6el,
   };
 
+  enum RISCVSubType {
+    eRISCVSubType_unknown,
+    eRISCVSubType_riscv32,
+    eRISCVSubType_riscv64,
+  };
+
   // Masks for the ases word of an ABI flags structure.
   enum MIPSASE {
     eMIPSAse_dsp = 0x00000001,       // DSP ASE
@@ -94,6 +100,17 @@ public:
     eARM_abi_hard_float = 0x00000400
   };
 
+  // RISC-V specific e_flags
+  enum RISCVeflags {
+    eRISCV_rvc = 0x00000001,              // C extension (compressed)
+    eRISCV_float_abi_soft = 0x00000000,   // soft float
+    eRISCV_float_abi_single = 0x00000002, // hard float / -mabi=*f
+    eRISCV_float_abi_double = 0x00000004, // hard float / -mabi=*d
+    eRISCV_float_abi_quad = 0x00000006,   // hard float / -mabi=*q
+    eRISCV_float_abi_mask = 0x00000006,
+    eRISCV_rve = 0x00000008 // RV32E, 16 integer registers
+  };
+
   enum Core {
     eCore_arm_generic,
     eCore_arm_armv4,
@@ -166,6 +183,9 @@ public:
     eCore_ppc64_generic,
     eCore_ppc64_ppc970_64,
 
+    eCore_riscv32,
+    eCore_riscv64,
+
     eCore_s390x_generic,
 
     eCore_sparc_generic,
@@ -11,6 +11,7 @@
 #define liblldb_Timer_h_
 
 #include "lldb/lldb-defines.h" // for DISALLOW_COPY_AND_ASSIGN
+#include "lldb/lldb-private-enumerations.h"
 #include "llvm/Support/Chrono.h"
 #include <atomic>
 #include <stdint.h> // for uint32_t
@@ -74,6 +75,32 @@ private:
   DISALLOW_COPY_AND_ASSIGN(Timer);
 };
 
+//----------------------------------------------------------------------
+/// @class ScopedStatisticTimer Timer.h "lldb/Utility/Timer.h"
+/// Adds the time spent in its scope to a phase reported by the statistics
+/// command.
+///
+/// The times are collected for the whole process and whether or not
+/// statistics are enabled, as the modules they are spent on are shared by
+/// the targets. They are summed over the threads, but nested timers of a
+/// phase on one thread only count once.
+//----------------------------------------------------------------------
+class ScopedStatisticTimer {
+public:
+  explicit ScopedStatisticTimer(StatisticTimeKind kind);
+
+  ~ScopedStatisticTimer();
+
+  static std::chrono::nanoseconds GetTime(StatisticTimeKind kind);
+
+private:
+  StatisticTimeKind m_kind;
+  bool m_outermost;
+  std::chrono::steady_clock::time_point m_start;
+
+  DISALLOW_COPY_AND_ASSIGN(ScopedStatisticTimer);
+};
+
 } // namespace lldb_private
 
 #endif // liblldb_Timer_h_
@@ -282,6 +282,34 @@ inline std::string GetStatDescription(lldb_private::StatisticKind K) {
    llvm_unreachable("Statistic not registered!");
 }
 
+//----------------------------------------------------------------------
+// The phases of loading modules and their debug information whose time is
+// reported when dumping stats.
+//----------------------------------------------------------------------
+enum StatisticTimeKind {
+  SymbolTableParseTime = 0,
+  SymbolTableIndexTime = 1,
+  DebugInfoIndexTime = 2,
+  TypeCompletionTime = 3,
+  StatisticTimeMax = 4
+};
+
+inline std::string GetStatTimeDescription(lldb_private::StatisticTimeKind K) {
+  switch (K) {
+  case StatisticTimeKind::SymbolTableParseTime:
+    return "Seconds spent parsing symbol tables";
+  case StatisticTimeKind::SymbolTableIndexTime:
+    return "Seconds spent indexing symbol tables";
+  case StatisticTimeKind::DebugInfoIndexTime:
+    return "Seconds spent indexing debug info";
+  case StatisticTimeKind::TypeCompletionTime:
+    return "Seconds spent completing types";
+  case StatisticTimeKind::StatisticTimeMax:
+    return "";
+  }
+  llvm_unreachable("Statistic not registered!");
+}
+
 } // namespace lldb_private
 
 namespace llvm {
@@ -0,0 +1,29 @@
+// Test that the manual DWARF index of a module without accelerator tables is
+// saved to the index cache, and loaded from it by the next session.
+
+// REQUIRES: lld
+
+// RUN: rm -rf %t.cache
+// RUN: %clang %s -g -c -o %t.o --target=x86_64-pc-linux -mllvm -accel-tables=Disable
+// RUN: ld.lld %t.o -o %t
+// RUN: %lldb -b -o "settings set symbols.enable-index-cache true" \
+// RUN:   -o "settings set symbols.index-cache-path %t.cache" \
+// RUN:   -o "log enable dwarf index-cache" -o "target create %t" \
+// RUN:   -o "image lookup -n foo" | FileCheck --check-prefix=FIRST %s
+// RUN: %lldb -b -o "settings set symbols.enable-index-cache true" \
+// RUN:   -o "settings set symbols.index-cache-path %t.cache" \
+// RUN:   -o "log enable dwarf index-cache" -o "target create %t" \
+// RUN:   -o "image lookup -n foo" | FileCheck --check-prefix=SECOND %s
+
+// FIRST: index cache miss: no cache file, {{.*}}llvmcache-index-cache.cpp.tmp-{{[0-9a-f]+}}.dwarf-index
+// FIRST: index cache: saved
+// FIRST: Summary: {{.*}}`foo()
+
+// SECOND-NOT: index cache miss
+// SECOND: index cache hit: loaded {{.*}}llvmcache-index-cache.cpp.tmp-{{[0-9a-f]+}}.dwarf-index
+// SECOND-NOT: index cache: saved
+// SECOND: Summary: {{.*}}`foo()
+
+void foo() {}
+
+int main() { foo(); }
@@ -63,6 +63,7 @@
 #include "lldb/Utility/FileSpec.h"
 #include "lldb/Utility/Log.h"
 #include "lldb/Utility/RegularExpression.h"
+#include "lldb/Utility/Timer.h"
 
 #include "Commands/CommandObjectBreakpoint.h"
 #include "lldb/Interpreter/CommandReturnObject.h"
@@ -197,6 +198,13 @@ SBStructuredData SBTarget::GetStatistics() {
     stats_up->AddIntegerItem(Desc, Entry);
     i += 1;
   }
+  for (i = 0; i < StatisticTimeMax; ++i) {
+    auto kind = static_cast<lldb_private::StatisticTimeKind>(i);
+    stats_up->AddFloatItem(
+        lldb_private::GetStatTimeDescription(kind),
+        std::chrono::duration<double>(ScopedStatisticTimer::GetTime(kind))
+            .count());
+  }
 
   data.m_impl_up->SetObjectSP(std::move(stats_up));
   return data;
@@ -40,6 +40,7 @@
 #include "Plugins/ABI/SysV-mips64/ABISysV_mips64.h"
 #include "Plugins/ABI/SysV-ppc/ABISysV_ppc.h"
 #include "Plugins/ABI/SysV-ppc64/ABISysV_ppc64.h"
+#include "Plugins/ABI/SysV-riscv/ABISysV_riscv.h"
 #include "Plugins/ABI/SysV-s390x/ABISysV_s390x.h"
 #include "Plugins/ABI/SysV-x86_64/ABISysV_x86_64.h"
 #include "Plugins/Architecture/Arm/ArchitectureArm.h"
@@ -52,6 +53,7 @@
 #include "Plugins/DynamicLoader/Windows-DYLD/DynamicLoaderWindowsDYLD.h"
 #include "Plugins/Instruction/ARM64/EmulateInstructionARM64.h"
 #include "Plugins/Instruction/PPC64/EmulateInstructionPPC64.h"
+#include "Plugins/Instruction/RISCV/EmulateInstructionRISCV.h"
 #include "Plugins/InstrumentationRuntime/ASan/ASanRuntime.h"
 #include "Plugins/InstrumentationRuntime/MainThreadChecker/MainThreadCheckerRuntime.h"
 #include "Plugins/InstrumentationRuntime/TSan/TSanRuntime.h"
@@ -325,6 +327,7 @@ void SystemInitializerFull::Initialize() {
   ABISysV_mips::Initialize();
   ABISysV_mips64::Initialize();
   ABISysV_s390x::Initialize();
+  ABISysV_riscv::Initialize();
 
   ArchitectureArm::Initialize();
   ArchitecturePPC64::Initialize();
@@ -349,6 +352,7 @@ void SystemInitializerFull::Initialize() {
   UnwindAssembly_x86::Initialize();
   EmulateInstructionARM64::Initialize();
   EmulateInstructionPPC64::Initialize();
+  EmulateInstructionRISCV::Initialize();
   SymbolFileDWARFDebugMap::Initialize();
   ItaniumABILanguageRuntime::Initialize();
   AppleObjCRuntimeV2::Initialize();
@@ -457,6 +461,7 @@ void SystemInitializerFull::Terminate() {
   ABISysV_mips::Terminate();
   ABISysV_mips64::Terminate();
   ABISysV_s390x::Terminate();
+  ABISysV_riscv::Terminate();
   DisassemblerLLVMC::Terminate();
 
   JITLoaderGDB::Terminate();
@@ -476,6 +481,7 @@ void SystemInitializerFull::Terminate() {
   UnwindAssemblyInstEmulation::Terminate();
   EmulateInstructionARM64::Terminate();
   EmulateInstructionPPC64::Terminate();
+  EmulateInstructionRISCV::Terminate();
   SymbolFileDWARFDebugMap::Terminate();
   ItaniumABILanguageRuntime::Terminate();
   AppleObjCRuntimeV2::Terminate();
@@ -12,6 +12,7 @@
 #include "lldb/Interpreter/CommandInterpreter.h"
 #include "lldb/Interpreter/CommandReturnObject.h"
 #include "lldb/Target/Target.h"
+#include "lldb/Utility/Timer.h"
 
 using namespace lldb;
 using namespace lldb_private;
@@ -87,6 +88,13 @@ protected:
           stat);
       i += 1;
     }
+    for (i = 0; i < StatisticTimeMax; ++i) {
+      auto kind = static_cast<lldb_private::StatisticTimeKind>(i);
+      result.AppendMessageWithFormat(
+          "%s : %.6f\n", lldb_private::GetStatTimeDescription(kind).c_str(),
+          std::chrono::duration<double>(ScopedStatisticTimer::GetTime(kind))
+              .count());
+    }
     result.SetStatus(eReturnStatusSuccessFinishResult);
     return true;
   }
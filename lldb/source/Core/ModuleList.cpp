@@ -32,6 +32,8 @@
 
 #include "llvm/ADT/StringRef.h" // for StringRef
 #include "llvm/Support/FileSystem.h"
+#include "llvm/Support/Path.h"
+#include "llvm/Support/Process.h"
 #include "llvm/Support/Threading.h"
 #include "llvm/Support/raw_ostream.h" // for fs
 #include "clang/Driver/Driver.h"
@@ -74,9 +76,22 @@ static constexpr PropertyDefinition g_properties[] = {
      "the UUID of the executable."},
     {"clang-modules-cache-path", OptionValue::eTypeFileSpec, true, 0, nullptr,
      {},
-     "The path to the clang modules cache directory (-fmodules-cache-path)."}};
-
-enum { ePropertyEnableExternalLookup, ePropertyClangModulesCachePath };
+     "The path to the clang modules cache directory (-fmodules-cache-path)."},
+    {"enable-index-cache", OptionValue::eTypeBoolean, true, false, nullptr,
+     {},
+     "Save the name indexes built from the DWARF of modules without "
+     "accelerator tables, and reuse them in later sessions."},
+    {"index-cache-path", OptionValue::eTypeFileSpec, true, 0, nullptr,
+     {},
+     "The path to the directory holding the saved name indexes. Indexes "
+     "that have not been used for a week are removed."}};
+
+enum {
+  ePropertyEnableExternalLookup,
+  ePropertyClangModulesCachePath,
+  ePropertyEnableIndexCache,
+  ePropertyIndexCachePath
+};
 
 } // namespace
 
@@ -87,6 +102,19 @@ ModuleListProperties::ModuleListProperties() {
   llvm::SmallString<128> path;
   clang::driver::Driver::getDefaultModuleCachePath(path);
   SetClangModulesCachePath(path);
+
+  // The cache belongs to the user, like the other caches in their home
+  // directory. Without one, the cache stays off until a path is set.
+  path.clear();
+  if (llvm::Optional<std::string> xdg_cache_home =
+          llvm::sys::Process::GetEnv("XDG_CACHE_HOME"))
+    path = *xdg_cache_home;
+  if (path.empty() && llvm::sys::path::home_directory(path))
+    llvm::sys::path::append(path, ".cache");
+  if (!path.empty()) {
+    llvm::sys::path::append(path, "lldb", "IndexCache");
+    SetIndexCachePath(path);
+  }
 }
 
 bool ModuleListProperties::GetEnableExternalLookup() const {
@@ -107,6 +135,24 @@ bool ModuleListProperties::SetClangModulesCachePath(llvm::StringRef path) {
       nullptr, ePropertyClangModulesCachePath, path);
 }
 
+bool ModuleListProperties::GetEnableIndexCache() const {
+  const uint32_t idx = ePropertyEnableIndexCache;
+  return m_collection_sp->GetPropertyAtIndexAsBoolean(
+      nullptr, idx, g_properties[idx].default_uint_value != 0);
+}
+
+FileSpec ModuleListProperties::GetIndexCachePath() const {
+  return m_collection_sp
+      ->GetPropertyAtIndexAsOptionValueFileSpec(nullptr, false,
+                                                ePropertyIndexCachePath)
+      ->GetCurrentValue();
+}
+
+bool ModuleListProperties::SetIndexCachePath(llvm::StringRef path) {
+  return m_collection_sp->SetPropertyAtIndexAsString(
+      nullptr, ePropertyIndexCachePath, path);
+}
+
 
 ModuleList::ModuleList()
     : m_modules(), m_modules_mutex(), m_notifier(nullptr) {}
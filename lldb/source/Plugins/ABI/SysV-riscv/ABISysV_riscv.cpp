@@ -0,0 +1,800 @@
+//===-- ABISysV_riscv.cpp ---------------------------------------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "ABISysV_riscv.h"
+
+// C Includes
+// C++ Includes
+// Other libraries and framework includes
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/Triple.h"
+
+// Project includes
+#include "Utility/RISCV_DWARF_Registers.h"
+#include "lldb/Core/Module.h"
+#include "lldb/Core/PluginManager.h"
+#include "lldb/Core/Value.h"
+#include "lldb/Core/ValueObjectConstResult.h"
+#include "lldb/Core/ValueObjectRegister.h"
+#include "lldb/Symbol/UnwindPlan.h"
+#include "lldb/Target/Process.h"
+#include "lldb/Target/RegisterContext.h"
+#include "lldb/Target/StackFrame.h"
+#include "lldb/Target/Target.h"
+#include "lldb/Target/Thread.h"
+#include "lldb/Utility/ConstString.h"
+#include "lldb/Utility/DataBufferHeap.h"
+#include "lldb/Utility/DataExtractor.h"
+#include "lldb/Utility/Log.h"
+#include "lldb/Utility/RegisterValue.h"
+#include "lldb/Utility/Status.h"
+
+#define DECLARE_REGISTER_INFOS_RISCV_STRUCT
+#include "Plugins/Process/Utility/RegisterInfos_riscv.h"
+#undef DECLARE_REGISTER_INFOS_RISCV_STRUCT
+
+using namespace lldb;
+using namespace lldb_private;
+using namespace riscv_dwarf;
+
+// Arguments are passed in a0-a7, and results returned in a0-a1, or in
+// fa0-fa1 for the floating point values the float ABI covers.
+static const uint32_t k_num_argument_registers = 8;
+
+static bool g_register_info_names_constified = false;
+
+static void ConstifyRegisterInfoNames(RegisterInfo *register_infos,
+                                      uint32_t count) {
+  for (uint32_t i = 0; i < count; ++i) {
+    if (register_infos[i].name)
+      register_infos[i].name = ConstString(register_infos[i].name).GetCString();
+    if (register_infos[i].alt_name)
+      register_infos[i].alt_name =
+          ConstString(register_infos[i].alt_name).GetCString();
+  }
+}
+
+const lldb_private::RegisterInfo *
+ABISysV_riscv::GetRegisterInfoArray(uint32_t &count) {
+  // Make the C-string names and alt_names for the register infos into const
+  // C-string values by having the ConstString unique the names in the global
+  // constant C-string pool.
+  if (!g_register_info_names_constified) {
+    g_register_info_names_constified = true;
+    ConstifyRegisterInfoNames(g_register_infos_riscv64,
+                              llvm::array_lengthof(g_register_infos_riscv64));
+    ConstifyRegisterInfoNames(g_register_infos_riscv32,
+                              llvm::array_lengthof(g_register_infos_riscv32));
+  }
+  if (m_is_rv64) {
+    count = llvm::array_lengthof(g_register_infos_riscv64);
+    return g_register_infos_riscv64;
+  }
+  count = llvm::array_lengthof(g_register_infos_riscv32);
+  return g_register_infos_riscv32;
+}
+
+bool ABISysV_riscv::GetPointerReturnRegister(const char *&name) {
+  name = "a0";
+  return true;
+}
+
+size_t ABISysV_riscv::GetRedZoneSize() const { return 0; }
+
+uint32_t ABISysV_riscv::GetFLenBytes() const {
+  switch (m_float_abi) {
+  case ArchSpec::eRISCV_float_abi_single:
+    return 4;
+  case ArchSpec::eRISCV_float_abi_double:
+    return 8;
+  case ArchSpec::eRISCV_float_abi_quad:
+    return 16;
+  default:
+    return 0;
+  }
+}
+
+//------------------------------------------------------------------
+// Static Functions
+//------------------------------------------------------------------
+
+ABISP
+ABISysV_riscv::CreateInstance(lldb::ProcessSP process_sp,
+                              const ArchSpec &arch) {
+  const llvm::Triple::ArchType machine = arch.GetTriple().getArch();
+  if (machine == llvm::Triple::riscv32 || machine == llvm::Triple::riscv64) {
+    return ABISP(
+        new ABISysV_riscv(process_sp, machine == llvm::Triple::riscv64,
+                          arch.GetFlags() & ArchSpec::eRISCV_float_abi_mask));
+  }
+  return ABISP();
+}
+
+bool ABISysV_riscv::PrepareTrivialCall(Thread &thread, addr_t sp,
+                                       addr_t func_addr, addr_t return_addr,
+                                       llvm::ArrayRef<addr_t> args) const {
+  Log *log(lldb_private::GetLogIfAllCategoriesSet(LIBLLDB_LOG_EXPRESSIONS));
+
+  if (log) {
+    StreamString s;
+    s.Printf("ABISysV_riscv::PrepareTrivialCall (tid = 0x%" PRIx64
+             ", sp = 0x%" PRIx64 ", func_addr = 0x%" PRIx64
+             ", return_addr = 0x%" PRIx64,
+             thread.GetID(), (uint64_t)sp, (uint64_t)func_addr,
+             (uint64_t)return_addr);
+
+    for (size_t i = 0; i < args.size(); ++i)
+      s.Printf(", arg%" PRIu64 " = 0x%" PRIx64, static_cast<uint64_t>(i + 1),
+               args[i]);
+    s.PutCString(")");
+    log->PutString(s.GetString());
+  }
+
+  RegisterContext *reg_ctx = thread.GetRegisterContext().get();
+  if (!reg_ctx)
+    return false;
+
+  const RegisterInfo *pc_reg_info =
+      reg_ctx->GetRegisterInfo(eRegisterKindGeneric, LLDB_REGNUM_GENERIC_PC);
+  const RegisterInfo *sp_reg_info =
+      reg_ctx->GetRegisterInfo(eRegisterKindGeneric, LLDB_REGNUM_GENERIC_SP);
+  const RegisterInfo *ra_reg_info =
+      reg_ctx->GetRegisterInfo(eRegisterKindGeneric, LLDB_REGNUM_GENERIC_RA);
+  if (!pc_reg_info || !sp_reg_info || !ra_reg_info)
+    return false;
+  ProcessSP process_sp(thread.GetProcess());
+
+  // Make space for the arguments that do not fit in registers, keeping the
+  // stack pointer 16 byte aligned.
+
+  const uint32_t xlen = GetXLenBytes();
+  sp &= ~(16ull - 1ull);
+  addr_t arg_pos = 0;
+  if (args.size() > k_num_argument_registers) {
+    sp -= xlen * (args.size() - k_num_argument_registers);
+    sp &= ~(16ull - 1ull);
+    arg_pos = sp;
+  }
+
+  // Process arguments
+
+  for (size_t i = 0; i < args.size(); ++i) {
+    if (i < k_num_argument_registers) {
+      const RegisterInfo *reg_info = reg_ctx->GetRegisterInfo(
+          eRegisterKindGeneric, LLDB_REGNUM_GENERIC_ARG1 + i);
+      if (!reg_info)
+        return false;
+      if (log)
+        log->Printf("About to write arg%" PRIu64 " (0x%" PRIx64 ") into %s",
+                    static_cast<uint64_t>(i + 1), args[i], reg_info->name);
+      if (!reg_ctx->WriteRegisterFromUnsigned(reg_info, args[i]))
+        return false;
+    } else {
+      Status error;
+      if (log)
+        log->Printf("About to write arg%" PRIu64 " (0x%" PRIx64 ") onto stack",
+                    static_cast<uint64_t>(i + 1), args[i]);
+      if (!process_sp->WritePointerToMemory(arg_pos, args[i], error))
+        return false;
+      arg_pos += xlen;
+    }
+  }
+
+  // ra is set to the return address
+
+  if (log)
+    log->Printf("Writing RA: 0x%" PRIx64, (uint64_t)return_addr);
+
+  if (!reg_ctx->WriteRegisterFromUnsigned(ra_reg_info, return_addr))
+    return false;
+
+  // sp is set to the actual stack value.
+
+  if (log)
+    log->Printf("Writing SP: 0x%" PRIx64, (uint64_t)sp);
+
+  if (!reg_ctx->WriteRegisterFromUnsigned(sp_reg_info, sp))
+    return false;
+
+  // pc is set to the address of the called function.
+
+  if (log)
+    log->Printf("Writing PC: 0x%" PRIx64, (uint64_t)func_addr);
+
+  if (!reg_ctx->WriteRegisterFromUnsigned(pc_reg_info, func_addr))
+    return false;
+
+  return true;
+}
+
+// Integers of up to twice XLEN bits take one or two argument registers, the
+// low bits first. Once the registers are used up, the rest of an argument
+// goes on the stack.
+static bool ReadIntegerArgument(Scalar &scalar, unsigned int bit_width,
+                                bool is_signed, Thread &thread,
+                                uint32_t *argument_register_ids,
+                                unsigned int &current_argument_register,
+                                addr_t &current_stack_argument,
+                                uint32_t xlen) {
+  if (bit_width > 64 || bit_width > 2 * xlen * 8)
+    return false; // Scalar can't hold large integer arguments
+
+  const unsigned int num_parts = bit_width > xlen * 8 ? 2 : 1;
+  uint64_t raw_value = 0;
+  for (unsigned int part = 0; part < num_parts; ++part) {
+    uint64_t part_value;
+    if (current_argument_register < k_num_argument_registers) {
+      part_value = thread.GetRegisterContext()->ReadRegisterAsUnsigned(
+          argument_register_ids[current_argument_register], 0);
+      current_argument_register++;
+    } else {
+      Status error;
+      part_value = thread.GetProcess()->ReadUnsignedIntegerFromMemory(
+          current_stack_argument, xlen, 0, error);
+      if (error.Fail())
+        return false;
+      current_stack_argument += xlen;
+    }
+    if (xlen == 4)
+      part_value &= UINT32_MAX;
+    raw_value |= part_value << (part * xlen * 8);
+  }
+
+  // Narrow values are extended to XLEN bits according to their type, and
+  // unsigned 32-bit values are sign extended on RV64: keep only the bits of
+  // the value.
+  if (bit_width < 64)
+    raw_value &= (1ull << bit_width) - 1;
+  scalar = raw_value;
+  if (is_signed)
+    scalar.SignExtend(bit_width);
+  return true;
+}
+
+bool ABISysV_riscv::GetArgumentValues(Thread &thread, ValueList &values) const {
+  unsigned int num_values = values.GetSize();
+  unsigned int value_index;
+
+  // Extract the register context so we can read arguments from registers
+
+  RegisterContext *reg_ctx = thread.GetRegisterContext().get();
+
+  if (!reg_ctx)
+    return false;
+
+  // Get the pointer to the first stack argument so we have a place to start
+  // when reading data
+
+  addr_t sp = reg_ctx->GetSP(0);
+
+  if (!sp)
+    return false;
+
+  addr_t current_stack_argument = sp;
+
+  uint32_t argument_register_ids[k_num_argument_registers];
+  for (uint32_t i = 0; i < k_num_argument_registers; ++i) {
+    const RegisterInfo *reg_info = reg_ctx->GetRegisterInfo(
+        eRegisterKindGeneric, LLDB_REGNUM_GENERIC_ARG1 + i);
+    if (!reg_info)
+      return false;
+    argument_register_ids[i] = reg_info->kinds[eRegisterKindLLDB];
+  }
+
+  unsigned int current_argument_register = 0;
+
+  for (value_index = 0; value_index < num_values; ++value_index) {
+    Value *value = values.GetValueAtIndex(value_index);
+
+    if (!value)
+      return false;
+
+    // We currently only support extracting values with Clang QualTypes. Do we
+    // care about others?
+    CompilerType compiler_type = value->GetCompilerType();
+    if (!compiler_type)
+      return false;
+    bool is_signed;
+
+    if (compiler_type.IsIntegerOrEnumerationType(is_signed)) {
+      if (!ReadIntegerArgument(value->GetScalar(),
+                               compiler_type.GetBitSize(&thread), is_signed,
+                               thread, argument_register_ids,
+                               current_argument_register,
+                               current_stack_argument, GetXLenBytes()))
+        return false;
+    } else if (compiler_type.IsPointerType()) {
+      if (!ReadIntegerArgument(value->GetScalar(),
+                               compiler_type.GetBitSize(&thread), false,
+                               thread, argument_register_ids,
+                               current_argument_register,
+                               current_stack_argument, GetXLenBytes()))
+        return false;
+    }
+  }
+
+  return true;
+}
+
+// Copies the first byte_size bytes of a floating point register to dst, in
+// the little endian order of RISC-V. Values narrower than the register are
+// held in its low bits.
+static bool ReadFloatingPointRegister(RegisterContext &reg_ctx,
+                                      uint32_t dwarf_regnum, uint8_t *dst,
+                                      size_t byte_size) {
+  const RegisterInfo *reg_info =
+      reg_ctx.GetRegisterInfo(eRegisterKindDWARF, dwarf_regnum);
+  RegisterValue reg_value;
+  if (!reg_info || !reg_ctx.ReadRegister(reg_info, reg_value))
+    return false;
+  DataExtractor data;
+  if (!reg_value.GetData(data) || data.GetByteSize() < byte_size)
+    return false;
+  return data.CopyByteOrderedData(0, byte_size, dst, byte_size,
+                                  eByteOrderLittle) == byte_size;
+}
+
+// Copies an integer register to dst, see ReadFloatingPointRegister.
+static bool ReadIntegerRegister(RegisterContext &reg_ctx,
+                                uint32_t dwarf_regnum, uint8_t *dst,
+                                size_t byte_size) {
+  const RegisterInfo *reg_info =
+      reg_ctx.GetRegisterInfo(eRegisterKindDWARF, dwarf_regnum);
+  RegisterValue reg_value;
+  if (!reg_info || !reg_ctx.ReadRegister(reg_info, reg_value))
+    return false;
+  bool success = false;
+  const uint64_t raw_value = reg_value.GetAsUInt64(0, &success);
+  if (!success)
+    return false;
+  for (size_t i = 0; i < byte_size; ++i)
+    dst[i] = (raw_value >> (8 * i)) & 0xff;
+  return true;
+}
+
+// Copies a value of up to twice XLEN bytes returned in a0 and a1.
+static bool ReadIntegerReturnRegisters(RegisterContext &reg_ctx, uint32_t xlen,
+                                       uint8_t *dst, size_t byte_size) {
+  if (byte_size > 2 * xlen)
+    return false;
+  if (!ReadIntegerRegister(reg_ctx, dwarf_x10_riscv, dst,
+                           std::min<size_t>(byte_size, xlen)))
+    return false;
+  if (byte_size > xlen &&
+      !ReadIntegerRegister(reg_ctx, dwarf_x11_riscv, dst + xlen,
+                           byte_size - xlen))
+    return false;
+  return true;
+}
+
+// Structures made of one or two floating point members, or of one floating
+// point and one integer member, are passed in floating point registers, and
+// in an integer register for the integer member, when each member fits in
+// its register. Other aggregates follow the integer calling convention.
+ABISysV_riscv::AggregateConvention
+ABISysV_riscv::FlattenForFloatingPointConvention(
+    ExecutionContextScope *exe_scope, const CompilerType &type, uint32_t xlen,
+    uint32_t flen, FlattenedField fields[2], uint32_t &num_fields) {
+  num_fields = 0;
+  if (type.GetTypeClass() == eTypeClassUnion)
+    return AggregateConvention::Integer;
+  uint32_t num_floats = 0;
+  const uint32_t num_members = type.GetNumFields();
+  for (uint32_t idx = 0; idx < num_members; ++idx) {
+    std::string name;
+    uint64_t bit_offset = 0;
+    bool is_bitfield = false;
+    CompilerType field_type = type.GetFieldAtIndex(idx, name, &bit_offset,
+                                                   nullptr, &is_bitfield);
+    if (is_bitfield)
+      return AggregateConvention::Unsupported;
+    const uint64_t byte_size = field_type.GetByteSize(exe_scope);
+    const uint64_t byte_offset = bit_offset / 8;
+
+    uint32_t count = 0;
+    bool is_complex = false;
+    bool is_signed = false;
+    if (field_type.IsFloatingPointType(count, is_complex)) {
+      const uint64_t part_size = is_complex ? byte_size / 2 : byte_size;
+      const uint32_t num_parts = is_complex ? 2 : 1;
+      if (part_size > flen || num_fields + num_parts > 2)
+        return AggregateConvention::Integer;
+      for (uint32_t part = 0; part < num_parts; ++part)
+        fields[num_fields++] = {true, byte_offset + part * part_size,
+                                part_size};
+      num_floats += num_parts;
+    } else if (field_type.IsIntegerOrEnumerationType(is_signed) ||
+               field_type.IsPointerType()) {
+      if (byte_size > xlen || num_fields == 2)
+        return AggregateConvention::Integer;
+      fields[num_fields++] = {false, byte_offset, byte_size};
+    } else {
+      return AggregateConvention::Unsupported;
+    }
+  }
+  return num_floats > 0 ? AggregateConvention::FloatingPoint
+                        : AggregateConvention::Integer;
+}
+
+ValueObjectSP ABISysV_riscv::GetReturnValueObjectSimple(
+    Thread &thread, CompilerType &return_compiler_type) const {
+  ValueObjectSP return_valobj_sp;
+
+  if (!return_compiler_type)
+    return return_valobj_sp;
+
+  RegisterContextSP reg_ctx_sp = thread.GetRegisterContext();
+  if (!reg_ctx_sp)
+    return return_valobj_sp;
+
+  const uint32_t type_flags = return_compiler_type.GetTypeInfo();
+  if (!(type_flags & (eTypeIsScalar | eTypeIsPointer)))
+    return return_valobj_sp;
+
+  const size_t byte_size = return_compiler_type.GetByteSize(&thread);
+  if (byte_size == 0)
+    return return_valobj_sp;
+
+  const uint32_t xlen = GetXLenBytes();
+  const uint32_t flen = GetFLenBytes();
+  DataBufferSP data_sp(new DataBufferHeap(byte_size, 0));
+  uint8_t *bytes = data_sp->GetBytes();
+
+  bool success = false;
+  if ((type_flags & eTypeIsFloat) && (type_flags & eTypeIsComplex)) {
+    // The real and imaginary parts are returned in fa0 and fa1.
+    const size_t part_size = byte_size / 2;
+    if (part_size <= flen)
+      success = ReadFloatingPointRegister(*reg_ctx_sp, dwarf_f10_riscv, bytes,
+                                          part_size) &&
+                ReadFloatingPointRegister(*reg_ctx_sp, dwarf_f11_riscv,
+                                          bytes + part_size, part_size);
+    else
+      success = ReadIntegerReturnRegisters(*reg_ctx_sp, xlen, bytes, byte_size);
+  } else if ((type_flags & eTypeIsFloat) && byte_size <= flen) {
+    success = ReadFloatingPointRegister(*reg_ctx_sp, dwarf_f10_riscv, bytes,
+                                        byte_size);
+  } else {
+    // Integers, pointers, and the floating point values that the float ABI
+    // does not cover are returned in a0 and a1.
+    success = ReadIntegerReturnRegisters(*reg_ctx_sp, xlen, bytes, byte_size);
+  }
+
+  if (success) {
+    DataExtractor data(data_sp, eByteOrderLittle, xlen);
+    return_valobj_sp = ValueObjectConstResult::Create(
+        &thread, return_compiler_type, ConstString(""), data);
+  }
+  return return_valobj_sp;
+}
+
+ValueObjectSP ABISysV_riscv::GetReturnValueObjectImpl(
+    Thread &thread, CompilerType &return_compiler_type) const {
+  ValueObjectSP return_valobj_sp;
+
+  if (!return_compiler_type)
+    return return_valobj_sp;
+
+  return_valobj_sp = GetReturnValueObjectSimple(thread, return_compiler_type);
+  if (return_valobj_sp)
+    return return_valobj_sp;
+
+  RegisterContextSP reg_ctx_sp = thread.GetRegisterContext();
+  if (!reg_ctx_sp)
+    return return_valobj_sp;
+
+  if (!return_compiler_type.IsAggregateType())
+    return return_valobj_sp;
+
+  const size_t byte_size = return_compiler_type.GetByteSize(&thread);
+  if (byte_size == 0)
+    return return_valobj_sp;
+
+  const uint32_t xlen = GetXLenBytes();
+  const uint32_t flen = GetFLenBytes();
+  DataBufferSP data_sp(new DataBufferHeap(byte_size, 0));
+  uint8_t *bytes = data_sp->GetBytes();
+
+  bool success = false;
+  FlattenedField fields[2];
+  uint32_t num_fields = 0;
+  const AggregateConvention convention =
+      flen > 0
+          ? FlattenForFloatingPointConvention(&thread, return_compiler_type,
+                                              xlen, flen, fields, num_fields)
+          : AggregateConvention::Integer;
+  if (convention == AggregateConvention::Unsupported)
+    return return_valobj_sp;
+  if (convention == AggregateConvention::FloatingPoint) {
+    uint32_t next_fpr = dwarf_f10_riscv;
+    uint32_t next_gpr = dwarf_x10_riscv;
+    success = true;
+    for (uint32_t i = 0; i < num_fields && success; ++i) {
+      const FlattenedField &field = fields[i];
+      if (field.byte_offset + field.byte_size > byte_size)
+        success = false;
+      else if (field.is_float)
+        success = ReadFloatingPointRegister(*reg_ctx_sp, next_fpr++,
+                                            bytes + field.byte_offset,
+                                            field.byte_size);
+      else
+        success = ReadIntegerRegister(*reg_ctx_sp, next_gpr++,
+                                      bytes + field.byte_offset,
+                                      field.byte_size);
+    }
+  } else if (byte_size <= 2 * xlen) {
+    success = ReadIntegerReturnRegisters(*reg_ctx_sp, xlen, bytes, byte_size);
+  }
+  // Larger aggregates are returned in memory, at an address the caller
+  // passes in a0 but which the callee does not have to give back, so they
+  // cannot be recovered here.
+
+  if (success) {
+    DataExtractor data(data_sp, eByteOrderLittle, xlen);
+    return_valobj_sp = ValueObjectConstResult::Create(
+        &thread, return_compiler_type, ConstString(""), data);
+  }
+  return return_valobj_sp;
+}
+
+Status ABISysV_riscv::SetReturnValueObject(lldb::StackFrameSP &frame_sp,
+                                           lldb::ValueObjectSP &new_value_sp) {
+  Status error;
+  if (!new_value_sp) {
+    error.SetErrorString("Empty value object for return value.");
+    return error;
+  }
+
+  CompilerType compiler_type = new_value_sp->GetCompilerType();
+  if (!compiler_type) {
+    error.SetErrorString("Null clang type for return value.");
+    return error;
+  }
+
+  Thread *thread = frame_sp->GetThread().get();
+  RegisterContext *reg_ctx = thread->GetRegisterContext().get();
+  if (!reg_ctx) {
+    error.SetErrorString("No register context for return value.");
+    return error;
+  }
+
+  bool is_signed;
+  uint32_t count;
+  bool is_complex;
+
+  const bool is_integer = compiler_type.IsIntegerOrEnumerationType(is_signed);
+  const bool is_float = compiler_type.IsFloatingPointType(count, is_complex);
+  if (!is_integer && !compiler_type.IsPointerType() && !is_float) {
+    // Okay we've got a structure or something that doesn't fit in a simple
+    // register. We should figure out where it really goes, but we don't
+    // support this yet.
+    error.SetErrorString("We only support setting simple integer and float "
+                         "return types at present.");
+    return error;
+  }
+  if (is_complex) {
+    error.SetErrorString(
+        "We don't support returning complex values at present");
+    return error;
+  }
+
+  DataExtractor data;
+  Status data_error;
+  size_t num_bytes = new_value_sp->GetData(data, data_error);
+  if (data_error.Fail()) {
+    error.SetErrorStringWithFormat(
+        "Couldn't convert return value to raw data: %s",
+        data_error.AsCString());
+    return error;
+  }
+
+  const uint32_t xlen = GetXLenBytes();
+  uint8_t buffer[16];
+  if (num_bytes > sizeof(buffer) ||
+      data.CopyByteOrderedData(0, num_bytes, buffer, num_bytes,
+                               eByteOrderLittle) != num_bytes) {
+    error.SetErrorString("We don't support returning values of this size at "
+                         "present.");
+    return error;
+  }
+
+  if (is_float && num_bytes <= GetFLenBytes()) {
+    const RegisterInfo *fa0_info =
+        reg_ctx->GetRegisterInfo(eRegisterKindDWARF, dwarf_f10_riscv);
+    if (!fa0_info || fa0_info->byte_size > sizeof(buffer) ||
+        fa0_info->byte_size < num_bytes) {
+      error.SetErrorString("Couldn't find the floating point return register.");
+      return error;
+    }
+    // Values narrower than the register are NaN-boxed: the bits above them
+    // are all ones.
+    uint8_t reg_bytes[16];
+    memset(reg_bytes, 0xff, sizeof(reg_bytes));
+    memcpy(reg_bytes, buffer, num_bytes);
+    RegisterValue fa0_value;
+    fa0_value.SetBytes(reg_bytes, fa0_info->byte_size, eByteOrderLittle);
+    if (!reg_ctx->WriteRegister(fa0_info, fa0_value))
+      error.SetErrorString("Couldn't write the return value to fa0.");
+    return error;
+  }
+
+  if (num_bytes > 2 * xlen) {
+    error.SetErrorString("We don't support returning values larger than two "
+                         "registers at present.");
+    return error;
+  }
+
+  // Integers narrower than XLEN are extended to it according to their type,
+  // except that unsigned 32-bit integers are sign extended on RV64 too.
+  if (is_integer && num_bytes > 0 && num_bytes < xlen &&
+      (is_signed || num_bytes == 4) && (buffer[num_bytes - 1] & 0x80)) {
+    memset(buffer + num_bytes, 0xff, xlen - num_bytes);
+    num_bytes = xlen;
+  }
+
+  // Integers, pointers and the floating point values that the float ABI does
+  // not cover go in a0 and a1, the low bits first.
+  for (size_t offset = 0, regnum = dwarf_x10_riscv; offset < num_bytes;
+       offset += xlen, ++regnum) {
+    const RegisterInfo *reg_info =
+        reg_ctx->GetRegisterInfo(eRegisterKindDWARF, regnum);
+    uint64_t raw_value = 0;
+    for (size_t i = 0; i < xlen && offset + i < num_bytes; ++i)
+      raw_value |= static_cast<uint64_t>(buffer[offset + i]) << (8 * i);
+    if (!reg_info || !reg_ctx->WriteRegisterFromUnsigned(reg_info, raw_value)) {
+      error.SetErrorString("Couldn't write the return value registers.");
+      return error;
+    }
+  }
+
+  return error;
+}
+
+bool ABISysV_riscv::CreateFunctionEntryUnwindPlan(UnwindPlan &unwind_plan) {
+  unwind_plan.Clear();
+  unwind_plan.SetRegisterKind(eRegisterKindDWARF);
+
+  UnwindPlan::RowSP row(new UnwindPlan::Row);
+
+  // Our Call Frame Address is the stack pointer value
+  row->GetCFAValue().SetIsRegisterPlusOffset(dwarf_x2_riscv, 0);
+
+  // The previous PC is in ra
+  row->SetRegisterLocationToRegister(dwarf_pc_riscv, dwarf_x1_riscv, true);
+
+  // All other registers are the same.
+  unwind_plan.AppendRow(row);
+  unwind_plan.SetSourceName("riscv at-func-entry default");
+  unwind_plan.SetSourcedFromCompiler(eLazyBoolNo);
+  unwind_plan.SetReturnAddressRegister(dwarf_x1_riscv);
+  return true;
+}
+
+bool ABISysV_riscv::CreateDefaultUnwindPlan(UnwindPlan &unwind_plan) {
+  unwind_plan.Clear();
+  unwind_plan.SetRegisterKind(eRegisterKindDWARF);
+
+  // When a frame pointer is used, s0 holds the CFA, and the return address
+  // and the previous s0 are saved just below it.
+  UnwindPlan::RowSP row(new UnwindPlan::Row);
+  const int32_t ptr_size = GetXLenBytes();
+
+  row->GetCFAValue().SetIsRegisterPlusOffset(dwarf_x8_riscv, 0);
+  row->SetOffset(0);
+
+  row->SetRegisterLocationToAtCFAPlusOffset(dwarf_x8_riscv, ptr_size * -2,
+                                            true);
+  row->SetRegisterLocationToAtCFAPlusOffset(dwarf_pc_riscv, ptr_size * -1,
+                                            true);
+
+  unwind_plan.AppendRow(row);
+  unwind_plan.SetSourceName("riscv default unwind plan");
+  unwind_plan.SetSourcedFromCompiler(eLazyBoolNo);
+  unwind_plan.SetUnwindPlanValidAtAllInstructions(eLazyBoolNo);
+  return true;
+}
+
+bool ABISysV_riscv::GetFallbackRegisterLocation(
+    const RegisterInfo *reg_info,
+    UnwindPlan::Row::RegisterLocation &unwind_regloc) {
+  // If a volatile register is being requested, we don't want to forward the
+  // next frame's register contents up the stack -- the register is not
+  // retrievable at this frame.
+  if (RegisterIsVolatile(reg_info)) {
+    unwind_regloc.SetUndefined();
+    return true;
+  }
+
+  return false;
+}
+
+bool ABISysV_riscv::RegisterIsVolatile(const RegisterInfo *reg_info) {
+  return !RegisterIsCalleeSaved(reg_info);
+}
+
+// See "Integer Register Convention" and "Floating-point Register Convention"
+// in the RISC-V ELF psABI.
+bool ABISysV_riscv::RegisterIsCalleeSaved(const RegisterInfo *reg_info) {
+  if (!reg_info)
+    return false;
+
+  // The registers of gdb-remote stubs get their DWARF numbers from our table,
+  // by name, unless the stub gave some of its own.
+  uint32_t regnum = reg_info->kinds[eRegisterKindDWARF];
+  if (regnum == LLDB_INVALID_REGNUM && reg_info->name) {
+    RegisterInfo abi_reg_info;
+    if (GetRegisterInfoByName(ConstString(reg_info->name), abi_reg_info))
+      regnum = abi_reg_info.kinds[eRegisterKindDWARF];
+  }
+
+  switch (regnum) {
+  // Each frame has its own ra and pc, treat them as preserved so that the
+  // unwinder looks for their saved values.
+  case dwarf_x1_riscv: // ra
+  case dwarf_pc_riscv:
+  // sp, and gp and tp which are not allocated by the compilers.
+  case dwarf_x2_riscv:
+  case dwarf_x3_riscv:
+  case dwarf_x4_riscv:
+  // s0-s11
+  case dwarf_x8_riscv:
+  case dwarf_x9_riscv:
+  case dwarf_x18_riscv:
+  case dwarf_x19_riscv:
+  case dwarf_x20_riscv:
+  case dwarf_x21_riscv:
+  case dwarf_x22_riscv:
+  case dwarf_x23_riscv:
+  case dwarf_x24_riscv:
+  case dwarf_x25_riscv:
+  case dwarf_x26_riscv:
+  case dwarf_x27_riscv:
+  // fs0-fs11
+  case dwarf_f8_riscv:
+  case dwarf_f9_riscv:
+  case dwarf_f18_riscv:
+  case dwarf_f19_riscv:
+  case dwarf_f20_riscv:
+  case dwarf_f21_riscv:
+  case dwarf_f22_riscv:
+  case dwarf_f23_riscv:
+  case dwarf_f24_riscv:
+  case dwarf_f25_riscv:
+  case dwarf_f26_riscv:
+  case dwarf_f27_riscv:
+    return true;
+  default:
+    return false;
+  }
+}
+
+void ABISysV_riscv::Initialize() {
+  PluginManager::RegisterPlugin(GetPluginNameStatic(),
+                                "System V ABI for RISC-V targets",
+                                CreateInstance);
+}
+
+void ABISysV_riscv::Terminate() {
+  PluginManager::UnregisterPlugin(CreateInstance);
+}
+
+lldb_private::ConstString ABISysV_riscv::GetPluginNameStatic() {
+  static ConstString g_name("sysv-riscv");
+  return g_name;
+}
+
+//------------------------------------------------------------------
+// PluginInterface protocol
+//------------------------------------------------------------------
+
+lldb_private::ConstString ABISysV_riscv::GetPluginName() {
+  return GetPluginNameStatic();
+}
+
+uint32_t ABISysV_riscv::GetPluginVersion() { return 1; }
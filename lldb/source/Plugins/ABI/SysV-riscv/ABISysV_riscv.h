@@ -0,0 +1,149 @@
+//===-- ABISysV_riscv.h -----------------------------------------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef liblldb_ABISysV_riscv_h_
+#define liblldb_ABISysV_riscv_h_
+
+// C Includes
+// C++ Includes
+// Other libraries and framework includes
+// Project includes
+#include "lldb/Target/ABI.h"
+#include "lldb/lldb-private.h"
+
+class ABISysV_riscv : public lldb_private::ABI {
+public:
+  ~ABISysV_riscv() override = default;
+
+  size_t GetRedZoneSize() const override;
+
+  bool PrepareTrivialCall(lldb_private::Thread &thread, lldb::addr_t sp,
+                          lldb::addr_t functionAddress,
+                          lldb::addr_t returnAddress,
+                          llvm::ArrayRef<lldb::addr_t> args) const override;
+
+  bool GetArgumentValues(lldb_private::Thread &thread,
+                         lldb_private::ValueList &values) const override;
+
+  lldb_private::Status
+  SetReturnValueObject(lldb::StackFrameSP &frame_sp,
+                       lldb::ValueObjectSP &new_value) override;
+
+  lldb::ValueObjectSP
+  GetReturnValueObjectImpl(lldb_private::Thread &thread,
+                           lldb_private::CompilerType &type) const override;
+
+  bool
+  CreateFunctionEntryUnwindPlan(lldb_private::UnwindPlan &unwind_plan) override;
+
+  bool CreateDefaultUnwindPlan(lldb_private::UnwindPlan &unwind_plan) override;
+
+  bool RegisterIsVolatile(const lldb_private::RegisterInfo *reg_info) override;
+
+  bool GetFallbackRegisterLocation(
+      const lldb_private::RegisterInfo *reg_info,
+      lldb_private::UnwindPlan::Row::RegisterLocation &unwind_regloc) override;
+
+  bool CallFrameAddressIsValid(lldb::addr_t cfa) override {
+    // The stack pointer is kept 16 byte aligned at calls, on RV32 and RV64
+    if (cfa & (16ull - 1ull))
+      return false; // Not 16 byte aligned
+    if (cfa == 0)
+      return false; // Zero is not a valid stack address
+    return true;
+  }
+
+  bool CodeAddressIsValid(lldb::addr_t pc) override {
+    // Code addresses must be 2 byte aligned, the C extension mixes 16 and 32
+    // bit instructions
+    if (pc & 1ull)
+      return false;
+    return true;
+  }
+
+  const lldb_private::RegisterInfo *
+  GetRegisterInfoArray(uint32_t &count) override;
+
+  bool GetPointerReturnRegister(const char *&name) override;
+
+  // A member of a structure passed under the floating point calling
+  // convention.
+  struct FlattenedField {
+    bool is_float;
+    uint64_t byte_offset;
+    uint64_t byte_size;
+  };
+
+  // How an aggregate is passed when the floating point registers are used
+  // for arguments.
+  enum class AggregateConvention {
+    Integer,
+    FloatingPoint,
+    // Aggregates with bit-fields, or with members that are aggregates
+    // themselves, may or may not follow the floating point convention, which
+    // this ABI does not work out.
+    Unsupported
+  };
+
+  // Works out how an aggregate of the given type is passed, given the XLEN
+  // and FLEN of the ABI in bytes. For the floating point convention, fields
+  // receives the num_fields members that go in registers.
+  static AggregateConvention FlattenForFloatingPointConvention(
+      lldb_private::ExecutionContextScope *exe_scope,
+      const lldb_private::CompilerType &type, uint32_t xlen, uint32_t flen,
+      FlattenedField fields[2], uint32_t &num_fields);
+
+  //------------------------------------------------------------------
+  // Static Functions
+  //------------------------------------------------------------------
+
+  static void Initialize();
+
+  static void Terminate();
+
+  static lldb::ABISP CreateInstance(lldb::ProcessSP process_sp,
+                                    const lldb_private::ArchSpec &arch);
+
+  static lldb_private::ConstString GetPluginNameStatic();
+
+  //------------------------------------------------------------------
+  // PluginInterface protocol
+  //------------------------------------------------------------------
+
+  lldb_private::ConstString GetPluginName() override;
+
+  uint32_t GetPluginVersion() override;
+
+protected:
+  lldb::ValueObjectSP
+  GetReturnValueObjectSimple(lldb_private::Thread &thread,
+                             lldb_private::CompilerType &ast_type) const;
+
+  bool RegisterIsCalleeSaved(const lldb_private::RegisterInfo *reg_info);
+
+  // The size of the integer registers, 4 on RV32 and 8 on RV64.
+  uint32_t GetXLenBytes() const { return m_is_rv64 ? 8 : 4; }
+
+  // The size of the floating point values passed in floating point
+  // registers: 0 for the soft float ABIs, 4 or 8 for the ones of the F and D
+  // extensions.
+  uint32_t GetFLenBytes() const;
+
+private:
+  ABISysV_riscv(lldb::ProcessSP process_sp, bool is_rv64, uint32_t float_abi)
+      : lldb_private::ABI(process_sp), m_is_rv64(is_rv64),
+        m_float_abi(float_abi) {
+    // Call CreateInstance instead.
+  }
+
+  bool m_is_rv64;
+  uint32_t m_float_abi; // One of the ArchSpec::eRISCV_float_abi_* values
+};
+
+#endif // liblldb_ABISysV_riscv_h_
@@ -236,6 +236,21 @@ public:
             m_opcode.SetOpcode32(data.GetU32(&data_offset), byte_order);
             m_is_valid = true;
           }
+        } else if (machine == llvm::Triple::riscv32 ||
+                   machine == llvm::Triple::riscv64) {
+          // The two low bits of the first 16-bit parcel are 0b11 for 32-bit
+          // instructions, anything else is a compressed instruction.
+          if (data.ValidOffsetForDataOfSize(data_offset, 2)) {
+            uint32_t riscv_opcode = data.GetU16(&data_offset);
+            if ((riscv_opcode & 0x3) != 0x3) {
+              m_opcode.SetOpcode16(riscv_opcode, byte_order);
+              m_is_valid = true;
+            } else if (data.ValidOffsetForDataOfSize(data_offset, 2)) {
+              riscv_opcode |= data.GetU16(&data_offset) << 16;
+              m_opcode.SetOpcode32(riscv_opcode, byte_order);
+              m_is_valid = true;
+            }
+          }
         } else {
           // The opcode isn't evenly sized, so we need to actually use the llvm
           // disassembler to parse it and get the size.
@@ -1201,6 +1216,11 @@ DisassemblerLLVMC::DisassemblerLLVMC(const ArchSpec &arch,
   if (triple.getArch() == llvm::Triple::aarch64)
     features_str += "+v8.2a";
 
+  // Enable the standard extensions of the RV32GC and RV64GC targets.
+  if (triple.getArch() == llvm::Triple::riscv32 ||
+      triple.getArch() == llvm::Triple::riscv64)
+    features_str += "+a,+c,+d,+f,+m";
+
   // We use m_disasm_ap.get() to tell whether we are valid or not, so if this
   // isn't good for some reason, we won't be valid and FindPlugin will fail and
   // we won't get used.
@@ -0,0 +1,569 @@
+//===-- EmulateInstructionRISCV.cpp ------------------------------*- C++-*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "EmulateInstructionRISCV.h"
+
+#include <stdlib.h>
+
+#include "lldb/Core/PluginManager.h"
+#include "lldb/Symbol/UnwindPlan.h"
+#include "lldb/Utility/ArchSpec.h"
+#include "lldb/Utility/ConstString.h"
+
+#include "Plugins/Process/Utility/lldb-riscv-register-enums.h"
+
+#define DECLARE_REGISTER_INFOS_RISCV_STRUCT
+#include "Plugins/Process/Utility/RegisterInfos_riscv.h"
+
+#include "Plugins/Process/Utility/InstructionUtils.h"
+
+using namespace lldb;
+using namespace lldb_private;
+
+EmulateInstructionRISCV::EmulateInstructionRISCV(const ArchSpec &arch)
+    : EmulateInstruction(arch) {}
+
+void EmulateInstructionRISCV::Initialize() {
+  PluginManager::RegisterPlugin(GetPluginNameStatic(),
+                                GetPluginDescriptionStatic(), CreateInstance);
+}
+
+void EmulateInstructionRISCV::Terminate() {
+  PluginManager::UnregisterPlugin(CreateInstance);
+}
+
+ConstString EmulateInstructionRISCV::GetPluginNameStatic() {
+  ConstString g_plugin_name("lldb.emulate-instruction.riscv");
+  return g_plugin_name;
+}
+
+ConstString EmulateInstructionRISCV::GetPluginName() {
+  static ConstString g_plugin_name("EmulateInstructionRISCV");
+  return g_plugin_name;
+}
+
+const char *EmulateInstructionRISCV::GetPluginDescriptionStatic() {
+  return "Emulate instructions for the RISC-V architecture.";
+}
+
+EmulateInstruction *
+EmulateInstructionRISCV::CreateInstance(const ArchSpec &arch,
+                                        InstructionType inst_type) {
+  if (EmulateInstructionRISCV::SupportsEmulatingInstructionsOfTypeStatic(
+          inst_type)) {
+    if (arch.GetTriple().getArch() == llvm::Triple::riscv32 ||
+        arch.GetTriple().getArch() == llvm::Triple::riscv64) {
+      return new EmulateInstructionRISCV(arch);
+    }
+  }
+
+  return nullptr;
+}
+
+bool EmulateInstructionRISCV::SetTargetTriple(const ArchSpec &arch) {
+  if (arch.GetTriple().getArch() == llvm::Triple::riscv32)
+    return true;
+  else if (arch.GetTriple().getArch() == llvm::Triple::riscv64)
+    return true;
+
+  return false;
+}
+
+bool EmulateInstructionRISCV::IsRV64() const {
+  return m_arch.GetTriple().getArch() == llvm::Triple::riscv64;
+}
+
+bool EmulateInstructionRISCV::GetRegisterInfo(RegisterKind reg_kind,
+                                              uint32_t reg_num,
+                                              RegisterInfo &reg_info) {
+  if (reg_kind == eRegisterKindGeneric) {
+    switch (reg_num) {
+    case LLDB_REGNUM_GENERIC_PC:
+      reg_kind = eRegisterKindLLDB;
+      reg_num = gpr_pc_riscv;
+      break;
+    case LLDB_REGNUM_GENERIC_SP:
+      reg_kind = eRegisterKindLLDB;
+      reg_num = gpr_sp_riscv;
+      break;
+    case LLDB_REGNUM_GENERIC_FP:
+      reg_kind = eRegisterKindLLDB;
+      reg_num = gpr_fp_riscv;
+      break;
+    case LLDB_REGNUM_GENERIC_RA:
+      reg_kind = eRegisterKindLLDB;
+      reg_num = gpr_ra_riscv;
+      break;
+
+    default:
+      return false;
+    }
+  }
+
+  if (reg_kind != eRegisterKindLLDB || reg_num >= k_num_registers_riscv)
+    return false;
+  reg_info = IsRV64() ? g_register_infos_riscv64[reg_num]
+                      : g_register_infos_riscv32[reg_num];
+  return true;
+}
+
+bool EmulateInstructionRISCV::ReadInstruction() {
+  bool success = false;
+  m_addr = ReadRegisterUnsigned(eRegisterKindGeneric, LLDB_REGNUM_GENERIC_PC,
+                                LLDB_INVALID_ADDRESS, &success);
+  if (success) {
+    Context ctx;
+    ctx.type = eContextReadOpcode;
+    ctx.SetNoArgs();
+    // The two low bits of the first 16-bit parcel are 0b11 for 32-bit
+    // instructions, anything else is a compressed instruction.
+    uint32_t opcode = ReadMemoryUnsigned(ctx, m_addr, 2, 0, &success);
+    if (success) {
+      if ((opcode & 0x3) != 0x3)
+        m_opcode.SetOpcode16(opcode, GetByteOrder());
+      else
+        m_opcode.SetOpcode32(ReadMemoryUnsigned(ctx, m_addr, 4, 0, &success),
+                             GetByteOrder());
+    }
+  }
+  if (!success)
+    m_addr = LLDB_INVALID_ADDRESS;
+  return success;
+}
+
+bool EmulateInstructionRISCV::CreateFunctionEntryUnwind(
+    UnwindPlan &unwind_plan) {
+  unwind_plan.Clear();
+  unwind_plan.SetRegisterKind(eRegisterKindLLDB);
+
+  UnwindPlan::RowSP row(new UnwindPlan::Row);
+
+  // Our previous Call Frame Address is the stack pointer
+  row->GetCFAValue().SetIsRegisterPlusOffset(gpr_sp_riscv, 0);
+
+  unwind_plan.AppendRow(row);
+  unwind_plan.SetSourceName("EmulateInstructionRISCV");
+  unwind_plan.SetSourcedFromCompiler(eLazyBoolNo);
+  unwind_plan.SetUnwindPlanValidAtAllInstructions(eLazyBoolYes);
+  unwind_plan.SetReturnAddressRegister(gpr_ra_riscv);
+  return true;
+}
+
+EmulateInstructionRISCV::Opcode *
+EmulateInstructionRISCV::GetOpcodeForInstruction(uint32_t opcode) {
+  static EmulateInstructionRISCV::Opcode g_opcodes[] = {
+      {0x0000707f, 0x00000013, &EmulateInstructionRISCV::EmulateADDI,
+       "addi rd, rs1, imm"},
+      {0x0000707f, 0x00002023, &EmulateInstructionRISCV::EmulateSTORE,
+       "sw rs2, imm(rs1)"},
+      {0x0000707f, 0x00003023, &EmulateInstructionRISCV::EmulateSTORE,
+       "sd rs2, imm(rs1)"},
+      {0x0000707f, 0x00002003, &EmulateInstructionRISCV::EmulateLOAD,
+       "lw rd, imm(rs1)"},
+      {0x0000707f, 0x00003003, &EmulateInstructionRISCV::EmulateLOAD,
+       "ld rd, imm(rs1)"},
+      {0x0000707f, 0x00002027, &EmulateInstructionRISCV::EmulateSTORE_FP,
+       "fsw rs2, imm(rs1)"},
+      {0x0000707f, 0x00003027, &EmulateInstructionRISCV::EmulateSTORE_FP,
+       "fsd rs2, imm(rs1)"},
+      {0x0000707f, 0x00002007, &EmulateInstructionRISCV::EmulateLOAD_FP,
+       "flw rd, imm(rs1)"},
+      {0x0000707f, 0x00003007, &EmulateInstructionRISCV::EmulateLOAD_FP,
+       "fld rd, imm(rs1)"}};
+  static const size_t k_num_riscv_opcodes = llvm::array_lengthof(g_opcodes);
+
+  for (size_t i = 0; i < k_num_riscv_opcodes; ++i) {
+    if ((g_opcodes[i].mask & opcode) == g_opcodes[i].value)
+      return &g_opcodes[i];
+  }
+  return nullptr;
+}
+
+EmulateInstructionRISCV::Opcode *
+EmulateInstructionRISCV::GetOpcodeForCompressedInstruction(uint32_t opcode) {
+  // The more specific encodings come first: c.addi16sp is a c.lui of sp.
+  static EmulateInstructionRISCV::Opcode g_opcodes[] = {
+      {0xe003, 0x0000, &EmulateInstructionRISCV::EmulateC_ADDI4SPN,
+       "c.addi4spn rd', sp, imm"},
+      {0xe003, 0x0001, &EmulateInstructionRISCV::EmulateC_ADDI,
+       "c.addi rd, imm"},
+      {0xef83, 0x6101, &EmulateInstructionRISCV::EmulateC_ADDI16SP,
+       "c.addi16sp sp, imm"},
+      {0xf003, 0x8002, &EmulateInstructionRISCV::EmulateC_MV,
+       "c.mv rd, rs2"},
+      {0xe003, 0xc002, &EmulateInstructionRISCV::EmulateC_SWSP,
+       "c.swsp rs2, imm(sp)"},
+      {0xe003, 0xe002, &EmulateInstructionRISCV::EmulateC_SDSP,
+       "c.sdsp/c.fswsp rs2, imm(sp)"},
+      {0xe003, 0xa002, &EmulateInstructionRISCV::EmulateC_FSDSP,
+       "c.fsdsp rs2, imm(sp)"},
+      {0xe003, 0x4002, &EmulateInstructionRISCV::EmulateC_LWSP,
+       "c.lwsp rd, imm(sp)"},
+      {0xe003, 0x6002, &EmulateInstructionRISCV::EmulateC_LDSP,
+       "c.ldsp/c.flwsp rd, imm(sp)"},
+      {0xe003, 0x2002, &EmulateInstructionRISCV::EmulateC_FLDSP,
+       "c.fldsp rd, imm(sp)"}};
+  static const size_t k_num_riscv_opcodes = llvm::array_lengthof(g_opcodes);
+
+  for (size_t i = 0; i < k_num_riscv_opcodes; ++i) {
+    if ((g_opcodes[i].mask & opcode) == g_opcodes[i].value)
+      return &g_opcodes[i];
+  }
+  return nullptr;
+}
+
+bool EmulateInstructionRISCV::EvaluateInstruction(uint32_t evaluate_options) {
+  const uint32_t opcode_size = m_opcode.GetByteSize();
+  Opcode *opcode_data = nullptr;
+  uint32_t opcode = 0;
+  if (opcode_size == 2) {
+    opcode = m_opcode.GetOpcode16();
+    opcode_data = GetOpcodeForCompressedInstruction(opcode);
+  } else if (opcode_size == 4) {
+    opcode = m_opcode.GetOpcode32();
+    opcode_data = GetOpcodeForInstruction(opcode);
+  }
+  if (!opcode_data)
+    return false;
+
+  const bool auto_advance_pc =
+      evaluate_options & eEmulateInstructionOptionAutoAdvancePC;
+
+  bool success = false;
+
+  uint64_t orig_pc_value = 0;
+  if (auto_advance_pc) {
+    orig_pc_value =
+        ReadRegisterUnsigned(eRegisterKindLLDB, gpr_pc_riscv, 0, &success);
+    if (!success)
+      return false;
+  }
+
+  // Call the Emulate... function.
+  success = (this->*opcode_data->callback)(opcode);
+  if (!success)
+    return false;
+
+  if (auto_advance_pc) {
+    uint64_t new_pc_value =
+        ReadRegisterUnsigned(eRegisterKindLLDB, gpr_pc_riscv, 0, &success);
+    if (!success)
+      return false;
+
+    if (new_pc_value == orig_pc_value) {
+      EmulateInstruction::Context context;
+      context.type = eContextAdvancePC;
+      context.SetNoArgs();
+      if (!WriteRegisterUnsigned(context, eRegisterKindLLDB, gpr_pc_riscv,
+                                 orig_pc_value + opcode_size))
+        return false;
+    }
+  }
+  return true;
+}
+
+// The registers whose saves and restores the unwinder cares about: ra and
+// the callee saved s0-s11 and fs0-fs11.
+static bool IsSavedRegister(uint32_t reg) {
+  switch (reg) {
+  case gpr_x1_riscv:
+  case gpr_x8_riscv:
+  case gpr_x9_riscv:
+  case fpr_f8_riscv:
+  case fpr_f9_riscv:
+    return true;
+  default:
+    return (reg >= gpr_x18_riscv && reg <= gpr_x27_riscv) ||
+           (reg >= fpr_f18_riscv && reg <= fpr_f27_riscv);
+  }
+}
+
+bool EmulateInstructionRISCV::EmulateAddImmediate(uint32_t rd, uint32_t rs1,
+                                                  int64_t imm) {
+  // Only track the stack and frame pointers:
+  // 'addi sp, sp, imm' allocates or frees the frame,
+  // 'addi s0, sp, imm' sets up the frame pointer, and
+  // 'addi sp, s0, imm' restores sp from it in an epilogue.
+  Context ctx;
+  if (rd == gpr_sp_riscv && rs1 == gpr_sp_riscv)
+    ctx.type = eContextAdjustStackPointer;
+  else if (rd == gpr_fp_riscv && rs1 == gpr_sp_riscv && !m_fp_is_set)
+    ctx.type = eContextSetFramePointer;
+  else if (rd == gpr_sp_riscv && rs1 == gpr_fp_riscv && m_fp_is_set)
+    ctx.type = eContextRestoreStackPointer;
+  else
+    return false;
+
+  Log *log(GetLogIfAllCategoriesSet(LIBLLDB_LOG_UNWIND));
+  LLDB_LOG(log, "EmulateAddImmediate: {0:X+8}: addi x{1}, x{2}, {3}", m_addr,
+           rd, rs1, imm);
+
+  RegisterInfo rs1_info;
+  if (!GetRegisterInfo(eRegisterKindLLDB, rs1, rs1_info))
+    return false;
+  ctx.SetRegisterPlusOffset(rs1_info, imm);
+
+  bool success;
+  uint64_t rs1_val = ReadRegisterUnsigned(eRegisterKindLLDB, rs1, 0, &success);
+  if (!success)
+    return false;
+  if (!WriteRegisterUnsigned(ctx, eRegisterKindLLDB, rd, rs1_val + imm))
+    return false;
+
+  if (ctx.type == eContextSetFramePointer)
+    m_fp_is_set = true;
+  else if (ctx.type == eContextRestoreStackPointer)
+    m_fp_is_set = false;
+  LLDB_LOG(log, "EmulateAddImmediate: success!");
+  return true;
+}
+
+bool EmulateInstructionRISCV::EmulateStore(uint32_t rs2, uint32_t rs1,
+                                           int64_t imm, uint32_t byte_size) {
+  // Only track the saves of the callee saved registers to the frame.
+  if ((rs1 != gpr_sp_riscv && rs1 != gpr_fp_riscv) || !IsSavedRegister(rs2))
+    return false;
+
+  Log *log(GetLogIfAllCategoriesSet(LIBLLDB_LOG_UNWIND));
+  LLDB_LOG(log, "EmulateStore: {0:X+8}: store of register {1} to {2}({3})",
+           m_addr, rs2, imm, rs1);
+
+  RegisterInfo rs2_info;
+  if (!GetRegisterInfo(eRegisterKindLLDB, rs2, rs2_info))
+    return false;
+  RegisterInfo rs1_info;
+  if (!GetRegisterInfo(eRegisterKindLLDB, rs1, rs1_info))
+    return false;
+
+  bool success;
+  uint64_t rs2_val = ReadRegisterUnsigned(eRegisterKindLLDB, rs2, 0, &success);
+  if (!success)
+    return false;
+  uint64_t rs1_val = ReadRegisterUnsigned(eRegisterKindLLDB, rs1, 0, &success);
+  if (!success)
+    return false;
+
+  Context ctx;
+  ctx.type = eContextPushRegisterOnStack;
+  ctx.SetRegisterToRegisterPlusOffset(rs2_info, rs1_info, imm);
+
+  // RISC-V is little endian.
+  uint8_t buffer[8];
+  for (uint32_t i = 0; i < byte_size; ++i)
+    buffer[i] = (rs2_val >> (8 * i)) & 0xff;
+  if (!WriteMemory(ctx, rs1_val + imm, buffer, byte_size))
+    return false;
+
+  LLDB_LOG(log, "EmulateStore: success!");
+  return true;
+}
+
+bool EmulateInstructionRISCV::EmulateLoad(uint32_t rd, uint32_t rs1,
+                                          int64_t imm, uint32_t byte_size) {
+  // Only track the restores of the callee saved registers from the frame.
+  if ((rs1 != gpr_sp_riscv && rs1 != gpr_fp_riscv) || !IsSavedRegister(rd))
+    return false;
+
+  Log *log(GetLogIfAllCategoriesSet(LIBLLDB_LOG_UNWIND));
+  LLDB_LOG(log, "EmulateLoad: {0:X+8}: load of register {1} from {2}({3})",
+           m_addr, rd, imm, rs1);
+
+  bool success;
+  if (rd == gpr_fp_riscv && m_fp_is_set && rs1 == gpr_sp_riscv) {
+    // The CFA is computed from s0, which is about to be reloaded: compute it
+    // from sp again.
+    RegisterInfo sp_info;
+    if (!GetRegisterInfo(eRegisterKindLLDB, gpr_sp_riscv, sp_info))
+      return false;
+    uint64_t sp =
+        ReadRegisterUnsigned(eRegisterKindLLDB, gpr_sp_riscv, 0, &success);
+    if (!success)
+      return false;
+    Context ctx;
+    ctx.type = eContextRestoreStackPointer;
+    ctx.SetRegisterPlusOffset(sp_info, 0);
+    if (!WriteRegisterUnsigned(ctx, eRegisterKindLLDB, gpr_sp_riscv, sp))
+      return false;
+    m_fp_is_set = false;
+  }
+
+  uint64_t rs1_val = ReadRegisterUnsigned(eRegisterKindLLDB, rs1, 0, &success);
+  if (!success)
+    return false;
+  const addr_t addr = rs1_val + imm;
+
+  Context ctx;
+  ctx.type = eContextPopRegisterOffStack;
+  ctx.SetAddress(addr);
+
+  uint64_t value = ReadMemoryUnsigned(ctx, addr, byte_size, 0, &success);
+  if (!success)
+    return false;
+  if (!WriteRegisterUnsigned(ctx, eRegisterKindLLDB, rd, value))
+    return false;
+
+  LLDB_LOG(log, "EmulateLoad: success!");
+  return true;
+}
+
+bool EmulateInstructionRISCV::EmulateADDI(uint32_t opcode) {
+  uint32_t rd = Bits32(opcode, 11, 7);
+  uint32_t rs1 = Bits32(opcode, 19, 15);
+  int64_t imm = llvm::SignExtend64<12>(Bits32(opcode, 31, 20));
+  return EmulateAddImmediate(gpr_x0_riscv + rd, gpr_x0_riscv + rs1, imm);
+}
+
+// The offset of the S-type stores is split around rs1 and rs2.
+static int64_t StoreOffset(uint32_t opcode) {
+  return llvm::SignExtend64<12>((Bits32(opcode, 31, 25) << 5) |
+                                Bits32(opcode, 11, 7));
+}
+
+bool EmulateInstructionRISCV::EmulateSTORE(uint32_t opcode) {
+  const uint32_t byte_size = Bits32(opcode, 14, 12) == 3 ? 8 : 4;
+  if (byte_size == 8 && !IsRV64())
+    return false;
+  uint32_t rs1 = Bits32(opcode, 19, 15);
+  uint32_t rs2 = Bits32(opcode, 24, 20);
+  return EmulateStore(gpr_x0_riscv + rs2, gpr_x0_riscv + rs1,
+                      StoreOffset(opcode), byte_size);
+}
+
+bool EmulateInstructionRISCV::EmulateLOAD(uint32_t opcode) {
+  const uint32_t byte_size = Bits32(opcode, 14, 12) == 3 ? 8 : 4;
+  if (byte_size == 8 && !IsRV64())
+    return false;
+  uint32_t rd = Bits32(opcode, 11, 7);
+  uint32_t rs1 = Bits32(opcode, 19, 15);
+  int64_t imm = llvm::SignExtend64<12>(Bits32(opcode, 31, 20));
+  return EmulateLoad(gpr_x0_riscv + rd, gpr_x0_riscv + rs1, imm, byte_size);
+}
+
+bool EmulateInstructionRISCV::EmulateSTORE_FP(uint32_t opcode) {
+  const uint32_t byte_size = Bits32(opcode, 14, 12) == 3 ? 8 : 4;
+  uint32_t rs1 = Bits32(opcode, 19, 15);
+  uint32_t rs2 = Bits32(opcode, 24, 20);
+  return EmulateStore(fpr_f0_riscv + rs2, gpr_x0_riscv + rs1,
+                      StoreOffset(opcode), byte_size);
+}
+
+bool EmulateInstructionRISCV::EmulateLOAD_FP(uint32_t opcode) {
+  const uint32_t byte_size = Bits32(opcode, 14, 12) == 3 ? 8 : 4;
+  uint32_t rd = Bits32(opcode, 11, 7);
+  uint32_t rs1 = Bits32(opcode, 19, 15);
+  int64_t imm = llvm::SignExtend64<12>(Bits32(opcode, 31, 20));
+  return EmulateLoad(fpr_f0_riscv + rd, gpr_x0_riscv + rs1, imm, byte_size);
+}
+
+// The compressed instructions scatter the bits of their immediates, see
+// "Compressed Instruction Formats" in the RISC-V ISA manual.
+
+bool EmulateInstructionRISCV::EmulateC_ADDI4SPN(uint32_t opcode) {
+  // nzuimm[5:4|9:6|2|3] in bits 12:5, rd' in bits 4:2 names x8-x15.
+  uint32_t imm = (Bits32(opcode, 12, 11) << 4) | (Bits32(opcode, 10, 7) << 6) |
+                 (Bit32(opcode, 6) << 2) | (Bit32(opcode, 5) << 3);
+  if (imm == 0)
+    return false; // Reserved
+  uint32_t rd = 8 + Bits32(opcode, 4, 2);
+  return EmulateAddImmediate(gpr_x0_riscv + rd, gpr_sp_riscv, imm);
+}
+
+bool EmulateInstructionRISCV::EmulateC_ADDI(uint32_t opcode) {
+  // nzimm[5] in bit 12, nzimm[4:0] in bits 6:2.
+  uint32_t rd = Bits32(opcode, 11, 7);
+  int64_t imm = llvm::SignExtend64<6>((Bit32(opcode, 12) << 5) |
+                                      Bits32(opcode, 6, 2));
+  return EmulateAddImmediate(gpr_x0_riscv + rd, gpr_x0_riscv + rd, imm);
+}
+
+bool EmulateInstructionRISCV::EmulateC_ADDI16SP(uint32_t opcode) {
+  // nzimm[9] in bit 12, nzimm[4|6|8:7|5] in bits 6:2.
+  int64_t imm = llvm::SignExtend64<10>(
+      (Bit32(opcode, 12) << 9) | (Bit32(opcode, 6) << 4) |
+      (Bit32(opcode, 5) << 6) | (Bits32(opcode, 4, 3) << 7) |
+      (Bit32(opcode, 2) << 5));
+  if (imm == 0)
+    return false; // Reserved
+  return EmulateAddImmediate(gpr_sp_riscv, gpr_sp_riscv, imm);
+}
+
+bool EmulateInstructionRISCV::EmulateC_MV(uint32_t opcode) {
+  // rs2 == 0 is c.jr.
+  uint32_t rd = Bits32(opcode, 11, 7);
+  uint32_t rs2 = Bits32(opcode, 6, 2);
+  if (rs2 == 0)
+    return false;
+  return EmulateAddImmediate(gpr_x0_riscv + rd, gpr_x0_riscv + rs2, 0);
+}
+
+// uimm[5:2|7:6] in bits 12:7.
+static uint32_t StoreWordSPOffset(uint32_t opcode) {
+  return (Bits32(opcode, 12, 9) << 2) | (Bits32(opcode, 8, 7) << 6);
+}
+
+// uimm[5:3|8:6] in bits 12:7.
+static uint32_t StoreDoubleWordSPOffset(uint32_t opcode) {
+  return (Bits32(opcode, 12, 10) << 3) | (Bits32(opcode, 9, 7) << 6);
+}
+
+// uimm[5] in bit 12, uimm[4:2|7:6] in bits 6:2.
+static uint32_t LoadWordSPOffset(uint32_t opcode) {
+  return (Bit32(opcode, 12) << 5) | (Bits32(opcode, 6, 4) << 2) |
+         (Bits32(opcode, 3, 2) << 6);
+}
+
+// uimm[5] in bit 12, uimm[4:3|8:6] in bits 6:2.
+static uint32_t LoadDoubleWordSPOffset(uint32_t opcode) {
+  return (Bit32(opcode, 12) << 5) | (Bits32(opcode, 6, 5) << 3) |
+         (Bits32(opcode, 4, 2) << 6);
+}
+
+bool EmulateInstructionRISCV::EmulateC_SWSP(uint32_t opcode) {
+  uint32_t rs2 = Bits32(opcode, 6, 2);
+  return EmulateStore(gpr_x0_riscv + rs2, gpr_sp_riscv,
+                      StoreWordSPOffset(opcode), 4);
+}
+
+bool EmulateInstructionRISCV::EmulateC_SDSP(uint32_t opcode) {
+  // The same encoding is c.fswsp on RV32.
+  uint32_t rs2 = Bits32(opcode, 6, 2);
+  if (!IsRV64())
+    return EmulateStore(fpr_f0_riscv + rs2, gpr_sp_riscv,
+                        StoreWordSPOffset(opcode), 4);
+  return EmulateStore(gpr_x0_riscv + rs2, gpr_sp_riscv,
+                      StoreDoubleWordSPOffset(opcode), 8);
+}
+
+bool EmulateInstructionRISCV::EmulateC_FSDSP(uint32_t opcode) {
+  uint32_t rs2 = Bits32(opcode, 6, 2);
+  return EmulateStore(fpr_f0_riscv + rs2, gpr_sp_riscv,
+                      StoreDoubleWordSPOffset(opcode), 8);
+}
+
+bool EmulateInstructionRISCV::EmulateC_LWSP(uint32_t opcode) {
+  uint32_t rd = Bits32(opcode, 11, 7);
+  return EmulateLoad(gpr_x0_riscv + rd, gpr_sp_riscv,
+                     LoadWordSPOffset(opcode), 4);
+}
+
+bool EmulateInstructionRISCV::EmulateC_LDSP(uint32_t opcode) {
+  // The same encoding is c.flwsp on RV32.
+  uint32_t rd = Bits32(opcode, 11, 7);
+  if (!IsRV64())
+    return EmulateLoad(fpr_f0_riscv + rd, gpr_sp_riscv,
+                       LoadWordSPOffset(opcode), 4);
+  return EmulateLoad(gpr_x0_riscv + rd, gpr_sp_riscv,
+                     LoadDoubleWordSPOffset(opcode), 8);
+}
+
+bool EmulateInstructionRISCV::EmulateC_FLDSP(uint32_t opcode) {
+  uint32_t rd = Bits32(opcode, 11, 7);
+  return EmulateLoad(fpr_f0_riscv + rd, gpr_sp_riscv,
+                     LoadDoubleWordSPOffset(opcode), 8);
+}
@@ -0,0 +1,120 @@
+//===-- EmulateInstructionRISCV.h -------------------------------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef EmulateInstructionRISCV_h_
+#define EmulateInstructionRISCV_h_
+
+// C Includes
+// C++ Includes
+// Other libraries and framework includes
+// Project includes
+#include "lldb/Core/EmulateInstruction.h"
+#include "lldb/Interpreter/OptionValue.h"
+#include "lldb/Utility/Log.h"
+
+namespace lldb_private {
+
+class EmulateInstructionRISCV : public EmulateInstruction {
+public:
+  EmulateInstructionRISCV(const ArchSpec &arch);
+
+  static void Initialize();
+
+  static void Terminate();
+
+  static ConstString GetPluginNameStatic();
+
+  static const char *GetPluginDescriptionStatic();
+
+  static EmulateInstruction *CreateInstance(const ArchSpec &arch,
+                                            InstructionType inst_type);
+
+  static bool
+  SupportsEmulatingInstructionsOfTypeStatic(InstructionType inst_type) {
+    switch (inst_type) {
+    case eInstructionTypeAny:
+    case eInstructionTypePrologueEpilogue:
+      return true;
+
+    case eInstructionTypePCModifying:
+    case eInstructionTypeAll:
+      return false;
+    }
+    return false;
+  }
+
+  ConstString GetPluginName() override;
+
+  uint32_t GetPluginVersion() override { return 1; }
+
+  bool SetTargetTriple(const ArchSpec &arch) override;
+
+  bool SupportsEmulatingInstructionsOfType(InstructionType inst_type) override {
+    return SupportsEmulatingInstructionsOfTypeStatic(inst_type);
+  }
+
+  bool ReadInstruction() override;
+
+  bool EvaluateInstruction(uint32_t evaluate_options) override;
+
+  bool TestEmulation(Stream *out_stream, ArchSpec &arch,
+                     OptionValueDictionary *test_data) override {
+    return false;
+  }
+
+  bool GetRegisterInfo(lldb::RegisterKind reg_kind, uint32_t reg_num,
+                       RegisterInfo &reg_info) override;
+
+  bool CreateFunctionEntryUnwind(UnwindPlan &unwind_plan) override;
+
+private:
+  struct Opcode {
+    uint32_t mask;
+    uint32_t value;
+    bool (EmulateInstructionRISCV::*callback)(uint32_t opcode);
+    const char *name;
+  };
+
+  // Whether s0 holds the frame pointer, set up by the prologue.
+  bool m_fp_is_set = false;
+
+  bool IsRV64() const;
+
+  Opcode *GetOpcodeForInstruction(uint32_t opcode);
+
+  Opcode *GetOpcodeForCompressedInstruction(uint32_t opcode);
+
+  // The operations the instructions below come down to. The registers are
+  // numbered as in lldb-riscv-register-enums.h.
+  bool EmulateAddImmediate(uint32_t rd, uint32_t rs1, int64_t imm);
+  bool EmulateStore(uint32_t rs2, uint32_t rs1, int64_t imm,
+                    uint32_t byte_size);
+  bool EmulateLoad(uint32_t rd, uint32_t rs1, int64_t imm, uint32_t byte_size);
+
+  bool EmulateADDI(uint32_t opcode);
+  bool EmulateSTORE(uint32_t opcode);
+  bool EmulateLOAD(uint32_t opcode);
+  bool EmulateSTORE_FP(uint32_t opcode);
+  bool EmulateLOAD_FP(uint32_t opcode);
+
+  bool EmulateC_ADDI4SPN(uint32_t opcode);
+  bool EmulateC_ADDI(uint32_t opcode);
+  bool EmulateC_ADDI16SP(uint32_t opcode);
+  bool EmulateC_MV(uint32_t opcode);
+  bool EmulateC_SWSP(uint32_t opcode);
+  bool EmulateC_SDSP(uint32_t opcode);
+  bool EmulateC_FSDSP(uint32_t opcode);
+  bool EmulateC_LWSP(uint32_t opcode);
+  bool EmulateC_LDSP(uint32_t opcode);
+  bool EmulateC_FLDSP(uint32_t opcode);
+};
+
+} // namespace lldb_private
+
+#endif // EmulateInstructionRISCV_h_
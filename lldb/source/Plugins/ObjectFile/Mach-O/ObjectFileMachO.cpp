@@ -1309,6 +1309,7 @@ Symtab *ObjectFileMachO::GetSymtab() {
   if (module_sp) {
     std::lock_guard<std::recursive_mutex> guard(module_sp->GetMutex());
     if (m_symtab_ap.get() == NULL) {
+      ScopedStatisticTimer statistic_timer(SymbolTableParseTime);
       m_symtab_ap.reset(new Symtab(this));
       std::lock_guard<std::recursive_mutex> symtab_guard(
           m_symtab_ap->GetMutex());
@@ -0,0 +1,206 @@
+//===-- RegisterInfos_riscv.h -----------------------------------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#ifdef DECLARE_REGISTER_INFOS_RISCV_STRUCT
+
+#include "llvm/ADT/STLExtras.h"
+
+#include "Utility/RISCV_DWARF_Registers.h"
+#include "lldb-riscv-register-enums.h"
+
+// The registers are laid out as in the register sets of the Linux kernel and
+// of the gdb-remote stubs: x0-x31 and pc, then f0-f31 and fcsr. The integer
+// registers have the size of a pointer, the floating point ones are sized for
+// the D extension.
+#define GPR_OFFSET(reg, gpr_size)                                              \
+  ((gpr_##reg##_riscv - k_first_gpr_riscv) * (gpr_size))
+#define FPR_OFFSET(reg, gpr_size)                                              \
+  (k_num_gpr_registers_riscv * (gpr_size) +                                    \
+   (fpr_##reg##_riscv - k_first_fpr_riscv) * 8)
+
+#define DEFINE_GPR(reg, alt, gpr_size, generic)                                \
+  {                                                                            \
+    #reg, alt, gpr_size, GPR_OFFSET(reg, gpr_size), lldb::eEncodingUint,       \
+        lldb::eFormatHex,                                                      \
+        {riscv_dwarf::dwarf_##reg##_riscv, riscv_dwarf::dwarf_##reg##_riscv,   \
+         generic, LLDB_INVALID_REGNUM, gpr_##reg##_riscv },                    \
+         nullptr, nullptr, nullptr, 0                                          \
+  }
+#define DEFINE_FPR(reg, alt, gpr_size)                                         \
+  {                                                                            \
+    #reg, alt, 8, FPR_OFFSET(reg, gpr_size), lldb::eEncodingIEEE754,           \
+        lldb::eFormatFloat,                                                    \
+        {riscv_dwarf::dwarf_##reg##_riscv, riscv_dwarf::dwarf_##reg##_riscv,   \
+         LLDB_INVALID_REGNUM, LLDB_INVALID_REGNUM, fpr_##reg##_riscv },        \
+         nullptr, nullptr, nullptr, 0                                          \
+  }
+#define DEFINE_FCSR(gpr_size)                                                  \
+  {                                                                            \
+    "fcsr", nullptr, 4, FPR_OFFSET(fcsr, gpr_size), lldb::eEncodingUint,       \
+        lldb::eFormatHex,                                                      \
+        {LLDB_INVALID_REGNUM, LLDB_INVALID_REGNUM, LLDB_INVALID_REGNUM,        \
+         LLDB_INVALID_REGNUM, fpr_fcsr_riscv },                                \
+         nullptr, nullptr, nullptr, 0                                          \
+  }
+
+// RegisterKind: EHFrame, DWARF, Generic, Process Plugin, LLDB
+
+static lldb_private::RegisterInfo g_register_infos_riscv64[] = {
+    DEFINE_GPR(x0, "zero", 8, LLDB_INVALID_REGNUM),
+    DEFINE_GPR(x1, "ra", 8, LLDB_REGNUM_GENERIC_RA),
+    DEFINE_GPR(x2, "sp", 8, LLDB_REGNUM_GENERIC_SP),
+    DEFINE_GPR(x3, "gp", 8, LLDB_INVALID_REGNUM),
+    DEFINE_GPR(x4, "tp", 8, LLDB_INVALID_REGNUM),
+    DEFINE_GPR(x5, "t0", 8, LLDB_INVALID_REGNUM),
+    DEFINE_GPR(x6, "t1", 8, LLDB_INVALID_REGNUM),
+    DEFINE_GPR(x7, "t2", 8, LLDB_INVALID_REGNUM),
+    DEFINE_GPR(x8, "fp", 8, LLDB_REGNUM_GENERIC_FP),
+    DEFINE_GPR(x9, "s1", 8, LLDB_INVALID_REGNUM),
+    DEFINE_GPR(x10, "a0", 8, LLDB_REGNUM_GENERIC_ARG1),
+    DEFINE_GPR(x11, "a1", 8, LLDB_REGNUM_GENERIC_ARG2),
+    DEFINE_GPR(x12, "a2", 8, LLDB_REGNUM_GENERIC_ARG3),
+    DEFINE_GPR(x13, "a3", 8, LLDB_REGNUM_GENERIC_ARG4),
+    DEFINE_GPR(x14, "a4", 8, LLDB_REGNUM_GENERIC_ARG5),
+    DEFINE_GPR(x15, "a5", 8, LLDB_REGNUM_GENERIC_ARG6),
+    DEFINE_GPR(x16, "a6", 8, LLDB_REGNUM_GENERIC_ARG7),
+    DEFINE_GPR(x17, "a7", 8, LLDB_REGNUM_GENERIC_ARG8),
+    DEFINE_GPR(x18, "s2", 8, LLDB_INVALID_REGNUM),
+    DEFINE_GPR(x19, "s3", 8, LLDB_INVALID_REGNUM),
+    DEFINE_GPR(x20, "s4", 8, LLDB_INVALID_REGNUM),
+    DEFINE_GPR(x21, "s5", 8, LLDB_INVALID_REGNUM),
+    DEFINE_GPR(x22, "s6", 8, LLDB_INVALID_REGNUM),
+    DEFINE_GPR(x23, "s7", 8, LLDB_INVALID_REGNUM),
+    DEFINE_GPR(x24, "s8", 8, LLDB_INVALID_REGNUM),
+    DEFINE_GPR(x25, "s9", 8, LLDB_INVALID_REGNUM),
+    DEFINE_GPR(x26, "s10", 8, LLDB_INVALID_REGNUM),
+    DEFINE_GPR(x27, "s11", 8, LLDB_INVALID_REGNUM),
+    DEFINE_GPR(x28, "t3", 8, LLDB_INVALID_REGNUM),
+    DEFINE_GPR(x29, "t4", 8, LLDB_INVALID_REGNUM),
+    DEFINE_GPR(x30, "t5", 8, LLDB_INVALID_REGNUM),
+    DEFINE_GPR(x31, "t6", 8, LLDB_INVALID_REGNUM),
+    DEFINE_GPR(pc, nullptr, 8, LLDB_REGNUM_GENERIC_PC),
+    DEFINE_FPR(f0, "ft0", 8),
+    DEFINE_FPR(f1, "ft1", 8),
+    DEFINE_FPR(f2, "ft2", 8),
+    DEFINE_FPR(f3, "ft3", 8),
+    DEFINE_FPR(f4, "ft4", 8),
+    DEFINE_FPR(f5, "ft5", 8),
+    DEFINE_FPR(f6, "ft6", 8),
+    DEFINE_FPR(f7, "ft7", 8),
+    DEFINE_FPR(f8, "fs0", 8),
+    DEFINE_FPR(f9, "fs1", 8),
+    DEFINE_FPR(f10, "fa0", 8),
+    DEFINE_FPR(f11, "fa1", 8),
+    DEFINE_FPR(f12, "fa2", 8),
+    DEFINE_FPR(f13, "fa3", 8),
+    DEFINE_FPR(f14, "fa4", 8),
+    DEFINE_FPR(f15, "fa5", 8),
+    DEFINE_FPR(f16, "fa6", 8),
+    DEFINE_FPR(f17, "fa7", 8),
+    DEFINE_FPR(f18, "fs2", 8),
+    DEFINE_FPR(f19, "fs3", 8),
+    DEFINE_FPR(f20, "fs4", 8),
+    DEFINE_FPR(f21, "fs5", 8),
+    DEFINE_FPR(f22, "fs6", 8),
+    DEFINE_FPR(f23, "fs7", 8),
+    DEFINE_FPR(f24, "fs8", 8),
+    DEFINE_FPR(f25, "fs9", 8),
+    DEFINE_FPR(f26, "fs10", 8),
+    DEFINE_FPR(f27, "fs11", 8),
+    DEFINE_FPR(f28, "ft8", 8),
+    DEFINE_FPR(f29, "ft9", 8),
+    DEFINE_FPR(f30, "ft10", 8),
+    DEFINE_FPR(f31, "ft11", 8),
+    DEFINE_FCSR(8),
+};
+
+static_assert(llvm::array_lengthof(g_register_infos_riscv64) ==
+                  k_num_registers_riscv,
+              "g_register_infos_riscv64 has wrong number of register infos");
+
+static lldb_private::RegisterInfo g_register_infos_riscv32[] = {
+    DEFINE_GPR(x0, "zero", 4, LLDB_INVALID_REGNUM),
+    DEFINE_GPR(x1, "ra", 4, LLDB_REGNUM_GENERIC_RA),
+    DEFINE_GPR(x2, "sp", 4, LLDB_REGNUM_GENERIC_SP),
+    DEFINE_GPR(x3, "gp", 4, LLDB_INVALID_REGNUM),
+    DEFINE_GPR(x4, "tp", 4, LLDB_INVALID_REGNUM),
+    DEFINE_GPR(x5, "t0", 4, LLDB_INVALID_REGNUM),
+    DEFINE_GPR(x6, "t1", 4, LLDB_INVALID_REGNUM),
+    DEFINE_GPR(x7, "t2", 4, LLDB_INVALID_REGNUM),
+    DEFINE_GPR(x8, "fp", 4, LLDB_REGNUM_GENERIC_FP),
+    DEFINE_GPR(x9, "s1", 4, LLDB_INVALID_REGNUM),
+    DEFINE_GPR(x10, "a0", 4, LLDB_REGNUM_GENERIC_ARG1),
+    DEFINE_GPR(x11, "a1", 4, LLDB_REGNUM_GENERIC_ARG2),
+    DEFINE_GPR(x12, "a2", 4, LLDB_REGNUM_GENERIC_ARG3),
+    DEFINE_GPR(x13, "a3", 4, LLDB_REGNUM_GENERIC_ARG4),
+    DEFINE_GPR(x14, "a4", 4, LLDB_REGNUM_GENERIC_ARG5),
+    DEFINE_GPR(x15, "a5", 4, LLDB_REGNUM_GENERIC_ARG6),
+    DEFINE_GPR(x16, "a6", 4, LLDB_REGNUM_GENERIC_ARG7),
+    DEFINE_GPR(x17, "a7", 4, LLDB_REGNUM_GENERIC_ARG8),
+    DEFINE_GPR(x18, "s2", 4, LLDB_INVALID_REGNUM),
+    DEFINE_GPR(x19, "s3", 4, LLDB_INVALID_REGNUM),
+    DEFINE_GPR(x20, "s4", 4, LLDB_INVALID_REGNUM),
+    DEFINE_GPR(x21, "s5", 4, LLDB_INVALID_REGNUM),
+    DEFINE_GPR(x22, "s6", 4, LLDB_INVALID_REGNUM),
+    DEFINE_GPR(x23, "s7", 4, LLDB_INVALID_REGNUM),
+    DEFINE_GPR(x24, "s8", 4, LLDB_INVALID_REGNUM),
+    DEFINE_GPR(x25, "s9", 4, LLDB_INVALID_REGNUM),
+    DEFINE_GPR(x26, "s10", 4, LLDB_INVALID_REGNUM),
+    DEFINE_GPR(x27, "s11", 4, LLDB_INVALID_REGNUM),
+    DEFINE_GPR(x28, "t3", 4, LLDB_INVALID_REGNUM),
+    DEFINE_GPR(x29, "t4", 4, LLDB_INVALID_REGNUM),
+    DEFINE_GPR(x30, "t5", 4, LLDB_INVALID_REGNUM),
+    DEFINE_GPR(x31, "t6", 4, LLDB_INVALID_REGNUM),
+    DEFINE_GPR(pc, nullptr, 4, LLDB_REGNUM_GENERIC_PC),
+    DEFINE_FPR(f0, "ft0", 4),
+    DEFINE_FPR(f1, "ft1", 4),
+    DEFINE_FPR(f2, "ft2", 4),
+    DEFINE_FPR(f3, "ft3", 4),
+    DEFINE_FPR(f4, "ft4", 4),
+    DEFINE_FPR(f5, "ft5", 4),
+    DEFINE_FPR(f6, "ft6", 4),
+    DEFINE_FPR(f7, "ft7", 4),
+    DEFINE_FPR(f8, "fs0", 4),
+    DEFINE_FPR(f9, "fs1", 4),
+    DEFINE_FPR(f10, "fa0", 4),
+    DEFINE_FPR(f11, "fa1", 4),
+    DEFINE_FPR(f12, "fa2", 4),
+    DEFINE_FPR(f13, "fa3", 4),
+    DEFINE_FPR(f14, "fa4", 4),
+    DEFINE_FPR(f15, "fa5", 4),
+    DEFINE_FPR(f16, "fa6", 4),
+    DEFINE_FPR(f17, "fa7", 4),
+    DEFINE_FPR(f18, "fs2", 4),
+    DEFINE_FPR(f19, "fs3", 4),
+    DEFINE_FPR(f20, "fs4", 4),
+    DEFINE_FPR(f21, "fs5", 4),
+    DEFINE_FPR(f22, "fs6", 4),
+    DEFINE_FPR(f23, "fs7", 4),
+    DEFINE_FPR(f24, "fs8", 4),
+    DEFINE_FPR(f25, "fs9", 4),
+    DEFINE_FPR(f26, "fs10", 4),
+    DEFINE_FPR(f27, "fs11", 4),
+    DEFINE_FPR(f28, "ft8", 4),
+    DEFINE_FPR(f29, "ft9", 4),
+    DEFINE_FPR(f30, "ft10", 4),
+    DEFINE_FPR(f31, "ft11", 4),
+    DEFINE_FCSR(4),
+};
+
+static_assert(llvm::array_lengthof(g_register_infos_riscv32) ==
+                  k_num_registers_riscv,
+              "g_register_infos_riscv32 has wrong number of register infos");
+
+#undef GPR_OFFSET
+#undef FPR_OFFSET
+#undef DEFINE_GPR
+#undef DEFINE_FPR
+#undef DEFINE_FCSR
+
+#endif // DECLARE_REGISTER_INFOS_RISCV_STRUCT
@@ -18,6 +18,9 @@ static constexpr Log::Category g_categories[] = {
     {{"comp"},
      {"log insertions of object files into DWARF debug maps"},
      DWARF_LOG_TYPE_COMPLETION},
+    {{"index-cache"},
+     {"log the loading and saving of cached DWARF name indexes"},
+     DWARF_LOG_INDEX_CACHE},
     {{"info"}, {"log the parsing of .debug_info"}, DWARF_LOG_DEBUG_INFO},
     {{"line"}, {"log the parsing of .debug_line"}, DWARF_LOG_DEBUG_LINE},
     {{"lookups"},
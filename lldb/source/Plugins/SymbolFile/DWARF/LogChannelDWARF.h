@@ -24,6 +24,7 @@
 #define DWARF_LOG_LOOKUPS (1u << 6)
 #define DWARF_LOG_TYPE_COMPLETION (1u << 7)
 #define DWARF_LOG_DEBUG_MAP (1u << 8)
+#define DWARF_LOG_INDEX_CACHE (1u << 9)
 #define DWARF_LOG_ALL (UINT32_MAX)
 #define DWARF_LOG_DEFAULT (DWARF_LOG_DEBUG_INFO)
 
@@ -14,14 +14,44 @@
 #include "Plugins/SymbolFile/DWARF/LogChannelDWARF.h"
 #include "Plugins/SymbolFile/DWARF/SymbolFileDWARFDwo.h"
 #include "lldb/Core/Module.h"
+#include "lldb/Core/ModuleList.h"
 #include "lldb/Host/TaskPool.h"
 #include "lldb/Symbol/ObjectFile.h"
+#include "lldb/Utility/DataBufferLLVM.h"
+#include "lldb/Utility/DataExtractor.h"
 #include "lldb/Utility/Stream.h"
 #include "lldb/Utility/Timer.h"
+#include "lldb/Utility/UUID.h"
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/Twine.h"
+#include "llvm/Support/CachePruning.h"
+#include "llvm/Support/EndianStream.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/MD5.h"
+#include "llvm/Support/Path.h"
+#include "llvm/Support/raw_ostream.h"
+#include <atomic>
+#include <chrono>
 
 using namespace lldb_private;
 using namespace lldb;
 
+namespace {
+// The start of the index cache files. The version is to be bumped whenever
+// the indexing or the layout of the files changes.
+const uint32_t g_index_cache_magic = 0x58574444; // "DDWX"
+const uint32_t g_index_cache_version = 1;
+
+std::atomic<uint32_t> g_index_cache_hits;
+std::atomic<uint32_t> g_index_cache_misses;
+
+double MillisecondsSince(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+} // namespace
+
 void ManualDWARFIndex::Index() {
   if (!m_debug_info)
     return;
@@ -31,6 +61,12 @@ void ManualDWARFIndex::Index() {
 
   static Timer::Category func_cat(LLVM_PRETTY_FUNCTION);
   Timer scoped_timer(func_cat, "%p", static_cast<void *>(&debug_info));
+  ScopedStatisticTimer statistic_timer(DebugInfoIndexTime);
+
+  std::string cache_key;
+  std::string cache_path = GetIndexCachePath(cache_key);
+  if (!cache_path.empty() && LoadIndexCache(cache_path, cache_key))
+    return;
 
   std::vector<DWARFUnit *> units_to_index;
   units_to_index.reserve(debug_info.GetNumCompileUnits());
@@ -90,6 +126,237 @@ void ManualDWARFIndex::Index() {
                      [&]() { finalize_fn(&IndexSet::globals); },
                      [&]() { finalize_fn(&IndexSet::types); },
                      [&]() { finalize_fn(&IndexSet::namespaces); });
+
+  if (cache_path.empty())
+    return;
+  // The DWO files are not part of the cache key, they could change on their
+  // own.
+  if (llvm::any_of(units_to_index, [](DWARFUnit *unit) {
+        return unit->GetDwoSymbolFile() != nullptr;
+      })) {
+    Log *log = LogChannelDWARF::GetLogIfAll(DWARF_LOG_INDEX_CACHE);
+    if (log)
+      m_module.LogMessage(log, "index cache: not saving the index of a module "
+                               "with DWO files");
+    return;
+  }
+  SaveIndexCache(cache_path, cache_key);
+}
+
+std::string ManualDWARFIndex::GetIndexCachePath(std::string &key) {
+  ModuleListProperties &properties =
+      ModuleList::GetGlobalModuleListProperties();
+  if (!properties.GetEnableIndexCache())
+    return std::string();
+  FileSpec cache_dir = properties.GetIndexCachePath();
+  if (!cache_dir)
+    return std::string();
+
+  // The module is identified by its UUID when it has one, and by its path
+  // otherwise, the modification times being checked when loading.
+  llvm::raw_string_ostream key_stream(key);
+  const UUID &uuid = m_module.GetUUID();
+  if (uuid.IsValid())
+    key_stream << "uuid:" << uuid.GetAsString();
+  else
+    key_stream << "path:" << m_module.GetFileSpec().GetPath();
+  if (ConstString object_name = m_module.GetObjectName())
+    key_stream << '(' << object_name.GetStringRef() << ")@"
+               << m_module.GetObjectOffset();
+  if (!m_units_to_avoid.empty()) {
+    std::vector<dw_offset_t> units(m_units_to_avoid.begin(),
+                                   m_units_to_avoid.end());
+    llvm::sort(units.begin(), units.end());
+    llvm::MD5 units_hash;
+    units_hash.update(llvm::makeArrayRef(
+        reinterpret_cast<const uint8_t *>(units.data()),
+        units.size() * sizeof(dw_offset_t)));
+    llvm::MD5::MD5Result units_digest;
+    units_hash.final(units_digest);
+    key_stream << " avoiding:" << units_digest.digest();
+  }
+  key_stream.flush();
+
+  llvm::MD5 key_hash;
+  key_hash.update(key);
+  llvm::MD5::MD5Result key_digest;
+  key_hash.final(key_digest);
+  // The prefix is the one of the files that llvm::pruneCache may remove.
+  llvm::SmallString<256> path(cache_dir.GetPath());
+  llvm::sys::path::append(
+      path, llvm::Twine("llvmcache-") +
+                m_module.GetFileSpec().GetFilename().GetStringRef() + "-" +
+                key_digest.digest() + ".dwarf-index");
+  return path.str();
+}
+
+bool ManualDWARFIndex::LoadIndexCache(llvm::StringRef path,
+                                      llvm::StringRef key) {
+  static Timer::Category func_cat(LLVM_PRETTY_FUNCTION);
+  Timer scoped_timer(func_cat, "%s", path.str().c_str());
+  Log *log = LogChannelDWARF::GetLogIfAll(DWARF_LOG_INDEX_CACHE);
+  const auto start = std::chrono::steady_clock::now();
+
+  // The file is mapped rather than read.
+  auto data_sp = DataBufferLLVM::CreateFromPath(path);
+  const char *miss_reason = nullptr;
+  IndexSet set;
+  if (!data_sp) {
+    miss_reason = "no cache file";
+  } else {
+    DataExtractor data(data_sp, eByteOrderLittle, sizeof(uint64_t));
+    lldb::offset_t offset = 0;
+    NameToDIEStringTable strings;
+    if (!data.ValidOffsetForDataOfSize(0, 8) ||
+        data.GetU32(&offset) != g_index_cache_magic ||
+        data.GetU32(&offset) != g_index_cache_version)
+      miss_reason = "unknown cache file format";
+    else if (key != llvm::StringRef(data.GetCStr(&offset)))
+      miss_reason = "cache file of another module";
+    else if (data.GetU64(&offset) !=
+                 uint64_t(m_module.GetModificationTime()
+                              .time_since_epoch()
+                              .count()) ||
+             data.GetU64(&offset) !=
+                 uint64_t(m_module.GetObjectModificationTime()
+                              .time_since_epoch()
+                              .count()))
+      miss_reason = "module modified since cached";
+    else if (!strings.Decode(data, &offset) ||
+             !set.Decode(data, &offset, strings))
+      miss_reason = "truncated cache file";
+  }
+
+  if (miss_reason) {
+    const uint32_t misses = ++g_index_cache_misses;
+    if (log)
+      m_module.LogMessage(log,
+                          "index cache miss: %s, %s (%u hits, %u misses)",
+                          miss_reason, path.str().c_str(),
+                          g_index_cache_hits.load(), misses);
+    return false;
+  }
+
+  m_set = std::move(set);
+  const uint32_t hits = ++g_index_cache_hits;
+  if (log)
+    m_module.LogMessage(
+        log,
+        "index cache hit: loaded %s (%" PRIu64 " bytes) in %.3f ms "
+        "(%u hits, %u misses)",
+        path.str().c_str(), data_sp->GetByteSize(), MillisecondsSince(start),
+        hits, g_index_cache_misses.load());
+  return true;
+}
+
+void ManualDWARFIndex::SaveIndexCache(llvm::StringRef path,
+                                      llvm::StringRef key) {
+  static Timer::Category func_cat(LLVM_PRETTY_FUNCTION);
+  Timer scoped_timer(func_cat, "%s", path.str().c_str());
+  Log *log = LogChannelDWARF::GetLogIfAll(DWARF_LOG_INDEX_CACHE);
+  const auto start = std::chrono::steady_clock::now();
+
+  // The names come first in the file, but are only known once the indexes
+  // are encoded.
+  NameToDIEStringTable strings;
+  llvm::SmallString<0> indexes;
+  llvm::raw_svector_ostream indexes_stream(indexes);
+  m_set.Encode(indexes_stream, strings);
+
+  std::error_code error =
+      llvm::sys::fs::create_directories(llvm::sys::path::parent_path(path));
+  // Other debuggers may be loading or saving the same file: it is written
+  // aside and renamed into place.
+  int fd = -1;
+  llvm::SmallString<256> temp_path;
+  if (!error)
+    error = llvm::sys::fs::createUniqueFile(path + "-%%%%%%.tmp", fd,
+                                            temp_path);
+  if (error) {
+    if (log)
+      m_module.LogMessage(log, "index cache: cannot create %s: %s",
+                          path.str().c_str(), error.message().c_str());
+    return;
+  }
+
+  uint64_t size = 0;
+  {
+    llvm::raw_fd_ostream os(fd, /*shouldClose=*/true);
+    llvm::support::endian::Writer writer(os, llvm::support::little);
+    writer.write<uint32_t>(g_index_cache_magic);
+    writer.write<uint32_t>(g_index_cache_version);
+    os << key << '\0';
+    writer.write<uint64_t>(
+        m_module.GetModificationTime().time_since_epoch().count());
+    writer.write<uint64_t>(
+        m_module.GetObjectModificationTime().time_since_epoch().count());
+    strings.Encode(os);
+    os << indexes;
+    size = os.tell();
+    os.close();
+    if (os.has_error()) {
+      error = os.error();
+      os.clear_error();
+    }
+  }
+  if (!error)
+    error = llvm::sys::fs::rename(temp_path, path);
+  if (error) {
+    llvm::sys::fs::remove(temp_path);
+    if (log)
+      m_module.LogMessage(log, "index cache: cannot write %s: %s",
+                          path.str().c_str(), error.message().c_str());
+    return;
+  }
+
+  if (log)
+    m_module.LogMessage(log,
+                        "index cache: saved %s (%" PRIu64
+                        " bytes, %zu names) in %.3f ms",
+                        path.str().c_str(), size, strings.GetSize(),
+                        MillisecondsSince(start));
+
+  // At most every 20 minutes, remove the files not used for a week, and the
+  // least recently used ones while the cache takes more than 75% of the free
+  // space.
+  llvm::pruneCache(llvm::sys::path::parent_path(path),
+                   llvm::CachePruningPolicy());
+}
+
+void ManualDWARFIndex::IndexSet::Encode(llvm::raw_ostream &os,
+                                        NameToDIEStringTable &strings) const {
+  function_basenames.Encode(os, strings);
+  function_fullnames.Encode(os, strings);
+  function_methods.Encode(os, strings);
+  function_selectors.Encode(os, strings);
+  objc_class_selectors.Encode(os, strings);
+  globals.Encode(os, strings);
+  types.Encode(os, strings);
+  namespaces.Encode(os, strings);
+}
+
+bool ManualDWARFIndex::IndexSet::Decode(const DataExtractor &data,
+                                        lldb::offset_t *offset_ptr,
+                                        const NameToDIEStringTable &strings) {
+  if (!function_basenames.Decode(data, offset_ptr, strings) ||
+      !function_fullnames.Decode(data, offset_ptr, strings) ||
+      !function_methods.Decode(data, offset_ptr, strings) ||
+      !function_selectors.Decode(data, offset_ptr, strings) ||
+      !objc_class_selectors.Decode(data, offset_ptr, strings) ||
+      !globals.Decode(data, offset_ptr, strings) ||
+      !types.Decode(data, offset_ptr, strings) ||
+      !namespaces.Decode(data, offset_ptr, strings))
+    return false;
+
+  TaskPool::RunTasks([&]() { function_basenames.Finalize(); },
+                     [&]() { function_fullnames.Finalize(); },
+                     [&]() { function_methods.Finalize(); },
+                     [&]() { function_selectors.Finalize(); },
+                     [&]() { objc_class_selectors.Finalize(); },
+                     [&]() { globals.Finalize(); },
+                     [&]() { types.Finalize(); },
+                     [&]() { namespaces.Finalize(); });
+  return true;
 }
 
 void ManualDWARFIndex::IndexUnit(DWARFUnit &unit, IndexSet &set) {
@@ -13,6 +13,7 @@
 #include "Plugins/SymbolFile/DWARF/DWARFIndex.h"
 #include "Plugins/SymbolFile/DWARF/NameToDIE.h"
 #include "llvm/ADT/DenseSet.h"
+#include <string>
 
 namespace lldb_private {
 class ManualDWARFIndex : public DWARFIndex {
@@ -54,8 +55,23 @@ private:
     NameToDIE globals;
     NameToDIE types;
     NameToDIE namespaces;
+
+    void Encode(llvm::raw_ostream &os, NameToDIEStringTable &strings) const;
+    /// Decodes and finalizes the indexes.
+    bool Decode(const DataExtractor &data, lldb::offset_t *offset_ptr,
+                const NameToDIEStringTable &strings);
   };
   void Index();
+
+  /// The index cache saves the indexes of modules without accelerator tables
+  /// when the "symbols.enable-index-cache" setting is on, so that later
+  /// sessions need not parse all of their DWARF again. Returns the file
+  /// holding the indexes of this module and sets \a key to the string
+  /// identifying the module in it, or returns an empty string if the index
+  /// is not to be cached.
+  std::string GetIndexCachePath(std::string &key);
+  bool LoadIndexCache(llvm::StringRef path, llvm::StringRef key);
+  void SaveIndexCache(llvm::StringRef path, llvm::StringRef key);
   void IndexUnit(DWARFUnit &unit, IndexSet &set);
 
   static void
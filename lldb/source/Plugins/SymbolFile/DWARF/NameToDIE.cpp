@@ -10,6 +10,7 @@
 #include "NameToDIE.h"
 #include "lldb/Symbol/ObjectFile.h"
 #include "lldb/Utility/ConstString.h"
+#include "lldb/Utility/DataExtractor.h"
 #include "lldb/Utility/RegularExpression.h"
 #include "lldb/Utility/Stream.h"
 #include "lldb/Utility/StreamString.h"
@@ -18,6 +19,9 @@
 #include "DWARFDebugInfoEntry.h"
 #include "SymbolFileDWARF.h"
 
+#include "llvm/Support/EndianStream.h"
+#include "llvm/Support/raw_ostream.h"
+
 using namespace lldb;
 using namespace lldb_private;
 
@@ -79,3 +83,73 @@ void NameToDIE::Append(const NameToDIE &other) {
                  other.m_map.GetValueAtIndexUnchecked(i));
   }
 }
+
+void NameToDIE::Encode(llvm::raw_ostream &os,
+                       NameToDIEStringTable &strings) const {
+  llvm::support::endian::Writer writer(os, llvm::support::little);
+  const uint32_t size = m_map.GetSize();
+  writer.write<uint32_t>(size);
+  for (uint32_t i = 0; i < size; ++i) {
+    const DIERef &die_ref = m_map.GetValueAtIndexUnchecked(i);
+    writer.write<uint32_t>(strings.Add(m_map.GetCStringAtIndexUnchecked(i)));
+    writer.write<uint32_t>(die_ref.cu_offset);
+    writer.write<uint32_t>(die_ref.die_offset);
+  }
+}
+
+bool NameToDIE::Decode(const DataExtractor &data, lldb::offset_t *offset_ptr,
+                       const NameToDIEStringTable &strings) {
+  if (!data.ValidOffsetForDataOfSize(*offset_ptr, 4))
+    return false;
+  const uint32_t size = data.GetU32(offset_ptr);
+  if (!data.ValidOffsetForDataOfSize(*offset_ptr, size * 12ull))
+    return false;
+  m_map.Reserve(m_map.GetSize() + size);
+  for (uint32_t i = 0; i < size; ++i) {
+    ConstString name = strings.Get(data.GetU32(offset_ptr));
+    const dw_offset_t cu_offset = data.GetU32(offset_ptr);
+    const dw_offset_t die_offset = data.GetU32(offset_ptr);
+    if (!name)
+      return false;
+    m_map.Append(name, DIERef(cu_offset, die_offset));
+  }
+  return true;
+}
+
+uint32_t NameToDIEStringTable::Add(ConstString name) {
+  auto insert_result = m_indexes.try_emplace(name.GetCString(), GetSize());
+  if (insert_result.second)
+    m_strings.push_back(name);
+  return insert_result.first->second;
+}
+
+ConstString NameToDIEStringTable::Get(uint32_t index) const {
+  if (index < m_strings.size())
+    return m_strings[index];
+  return ConstString();
+}
+
+void NameToDIEStringTable::Encode(llvm::raw_ostream &os) const {
+  llvm::support::endian::Writer writer(os, llvm::support::little);
+  writer.write<uint32_t>(m_strings.size());
+  for (ConstString name : m_strings)
+    os << name.GetStringRef() << '\0';
+}
+
+bool NameToDIEStringTable::Decode(const DataExtractor &data,
+                                  lldb::offset_t *offset_ptr) {
+  if (!data.ValidOffsetForDataOfSize(*offset_ptr, 4))
+    return false;
+  const uint32_t size = data.GetU32(offset_ptr);
+  // Each name takes at least its terminator.
+  if (!data.ValidOffsetForDataOfSize(*offset_ptr, size))
+    return false;
+  m_strings.reserve(m_strings.size() + size);
+  for (uint32_t i = 0; i < size; ++i) {
+    const char *cstr = data.GetCStr(offset_ptr);
+    if (!cstr)
+      return false;
+    m_strings.push_back(ConstString(cstr));
+  }
+  return true;
+}
@@ -11,14 +11,47 @@
 #define SymbolFileDWARF_NameToDIE_h_
 
 #include <functional>
+#include <vector>
 
 #include "DIERef.h"
 #include "lldb/Core/UniqueCStringMap.h"
 #include "lldb/Core/dwarf.h"
 #include "lldb/lldb-defines.h"
+#include "llvm/ADT/DenseMap.h"
+
+namespace lldb_private {
+class DataExtractor;
+}
+
+namespace llvm {
+class raw_ostream;
+}
 
 class SymbolFileDWARF;
 
+//----------------------------------------------------------------------
+// The names of the NameToDIE indexes of a module, which the index cache
+// stores once and refers to by number.
+//----------------------------------------------------------------------
+class NameToDIEStringTable {
+public:
+  uint32_t Add(lldb_private::ConstString name);
+
+  // Returns an empty string if there is no name with this number.
+  lldb_private::ConstString Get(uint32_t index) const;
+
+  size_t GetSize() const { return m_strings.size(); }
+
+  void Encode(llvm::raw_ostream &os) const;
+
+  bool Decode(const lldb_private::DataExtractor &data,
+              lldb::offset_t *offset_ptr);
+
+protected:
+  llvm::DenseMap<const char *, uint32_t> m_indexes;
+  std::vector<lldb_private::ConstString> m_strings;
+};
+
 class NameToDIE {
 public:
   NameToDIE() : m_map() {}
@@ -47,6 +80,18 @@ public:
                              const DIERef &die_ref)> const
               &callback) const;
 
+  // Writes the entries for the index cache, with the names as their number
+  // in "strings", to which the new ones are added.
+  void Encode(llvm::raw_ostream &os, NameToDIEStringTable &strings) const;
+
+  // Appends the entries written by Encode(). Returns false if the data is
+  // truncated or refers to names missing from "strings". The entries are
+  // not sorted until Finalize() is called, as the order of the names
+  // depends on where they are in memory.
+  bool Decode(const lldb_private::DataExtractor &data,
+              lldb::offset_t *offset_ptr,
+              const NameToDIEStringTable &strings);
+
 protected:
   lldb_private::UniqueCStringMap<DIERef> m_map;
 };
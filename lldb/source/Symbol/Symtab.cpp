@@ -16,6 +16,7 @@
 #include "lldb/Core/RichManglingContext.h"
 #include "lldb/Core/STLUtils.h"
 #include "lldb/Core/Section.h"
+#include "lldb/Host/TaskPool.h"
 #include "lldb/Symbol/ObjectFile.h"
 #include "lldb/Symbol/Symbol.h"
 #include "lldb/Symbol/SymbolContext.h"
@@ -254,12 +255,24 @@ static bool lldb_skip_name(llvm::StringRef mangled,
   llvm_unreachable("unknown scheme!");
 }
 
+// Symbol tables smaller than this are indexed on the calling thread.
+static const size_t g_min_symbols_per_range = 4096;
+
+static void AppendEntries(const Symtab::NameToIndexMap &from,
+                          Symtab::NameToIndexMap &to) {
+  const size_t size = from.GetSize();
+  for (size_t i = 0; i < size; ++i)
+    to.Append(from.GetCStringAtIndexUnchecked(i),
+              from.GetValueAtIndexUnchecked(i));
+}
+
 void Symtab::InitNameIndexes() {
   // Protected function, no need to lock mutex...
   if (!m_name_indexes_computed) {
     m_name_indexes_computed = true;
     static Timer::Category func_cat(LLVM_PRETTY_FUNCTION);
     Timer scoped_timer(func_cat, "%s", LLVM_PRETTY_FUNCTION);
+    ScopedStatisticTimer statistic_timer(SymbolTableIndexTime);
     // Create the name index vector to be able to quickly search by name
     const size_t num_symbols = m_symbols.size();
 #if 1
@@ -282,82 +295,40 @@ void Symtab::InitNameIndexes() {
     m_name_to_index.Reserve(actual_count);
 #endif
 
-    // The "const char *" in "class_contexts" and backlog::value_type::second
-    // must come from a ConstString::GetCString()
-    std::set<const char *> class_contexts;
-    std::vector<std::pair<NameToIndexMap::Entry, const char *>> backlog;
-    backlog.reserve(num_symbols / 2);
-
-    // Instantiation of the demangler is expensive, so better use a single one
-    // for all entries during batch processing.
-    RichManglingContext rmc;
-    NameToIndexMap::Entry entry;
-
-    for (entry.value = 0; entry.value < num_symbols; ++entry.value) {
-      Symbol *symbol = &m_symbols[entry.value];
+    // Demangling takes most of the time for large symbol tables, so ranges of
+    // the symbols are indexed in parallel. Appending their entries in order
+    // gives the indexes that going over all the symbols at once would.
+    const size_t num_ranges = std::min<size_t>(
+        GetHardwareConcurrencyHint(),
+        (num_symbols + g_min_symbols_per_range - 1) / g_min_symbols_per_range);
+    std::vector<NameIndexes> ranges(num_ranges);
+    auto index_range_fn = [this, num_symbols, num_ranges,
+                           &ranges](size_t range_idx) {
+      IndexSymbolNames(num_symbols * range_idx / num_ranges,
+                       num_symbols * (range_idx + 1) / num_ranges,
+                       ranges[range_idx]);
+    };
+    if (num_ranges == 1)
+      index_range_fn(0);
+    else
+      TaskMapOverInt(0, num_ranges, index_range_fn);
 
-      // Don't let trampolines get into the lookup by name map If we ever need
-      // the trampoline symbols to be searchable by name we can remove this and
-      // then possibly add a new bool to any of the Symtab functions that
-      // lookup symbols by name to indicate if they want trampolines.
-      if (symbol->IsTrampoline())
-        continue;
-
-      // If the symbol's name string matched a Mangled::ManglingScheme, it is
-      // stored in the mangled field.
-      Mangled &mangled = symbol->GetMangled();
-      entry.cstring = mangled.GetMangledName();
-      if (entry.cstring) {
-        m_name_to_index.Append(entry);
-
-        if (symbol->ContainsLinkerAnnotations()) {
-          // If the symbol has linker annotations, also add the version without
-          // the annotations.
-          entry.cstring = ConstString(m_objfile->StripLinkerSymbolAnnotations(
-                                        entry.cstring.GetStringRef()));
-          m_name_to_index.Append(entry);
-        }
-
-        const SymbolType type = symbol->GetType();
-        if (type == eSymbolTypeCode || type == eSymbolTypeResolver) {
-          if (mangled.DemangleWithRichManglingInfo(rmc, lldb_skip_name))
-            RegisterMangledNameEntry(entry, class_contexts, backlog, rmc);
-        }
-      }
-
-      // Symbol name strings that didn't match a Mangled::ManglingScheme, are
-      // stored in the demangled field.
-      entry.cstring = mangled.GetDemangledName(symbol->GetLanguage());
-      if (entry.cstring) {
-        m_name_to_index.Append(entry);
-
-        if (symbol->ContainsLinkerAnnotations()) {
-          // If the symbol has linker annotations, also add the version without
-          // the annotations.
-          entry.cstring = ConstString(m_objfile->StripLinkerSymbolAnnotations(
-                                        entry.cstring.GetStringRef()));
-          m_name_to_index.Append(entry);
-        }
-      }
-
-      // If the demangled name turns out to be an ObjC name, and is a category
-      // name, add the version without categories to the index too.
-      ObjCLanguage::MethodName objc_method(entry.cstring.GetStringRef(), true);
-      if (objc_method.IsValid(true)) {
-        entry.cstring = objc_method.GetSelector();
-        m_selector_to_index.Append(entry);
-
-        ConstString objc_method_no_category(
-            objc_method.GetFullNameWithoutCategory(true));
-        if (objc_method_no_category) {
-          entry.cstring = objc_method_no_category;
-          m_name_to_index.Append(entry);
-        }
-      }
+    std::set<const char *> class_contexts;
+    for (const NameIndexes &range : ranges) {
+      AppendEntries(range.name_to_index, m_name_to_index);
+      AppendEntries(range.basename_to_index, m_basename_to_index);
+      AppendEntries(range.method_to_index, m_method_to_index);
+      AppendEntries(range.selector_to_index, m_selector_to_index);
+      class_contexts.insert(range.class_contexts.begin(),
+                            range.class_contexts.end());
     }
 
-    for (const auto &record : backlog) {
-      RegisterBacklogEntry(record.first, record.second, class_contexts);
+    // The classes of the methods in the backlogs are only all known once
+    // every range is indexed.
+    for (const NameIndexes &range : ranges) {
+      for (const auto &record : range.backlog) {
+        RegisterBacklogEntry(record.first, record.second, class_contexts);
+      }
     }
 
     m_name_to_index.Sort();
@@ -371,10 +342,82 @@ void Symtab::InitNameIndexes() {
   }
 }
 
-void Symtab::RegisterMangledNameEntry(
-    NameToIndexMap::Entry &entry, std::set<const char *> &class_contexts,
-    std::vector<std::pair<NameToIndexMap::Entry, const char *>> &backlog,
-    RichManglingContext &rmc) {
+void Symtab::IndexSymbolNames(size_t begin, size_t end,
+                              NameIndexes &indexes) {
+  indexes.backlog.reserve((end - begin) / 2);
+
+  // Instantiation of the demangler is expensive, so better use a single one
+  // for all entries during batch processing.
+  RichManglingContext rmc;
+  NameToIndexMap::Entry entry;
+
+  for (entry.value = begin; entry.value < end; ++entry.value) {
+    Symbol *symbol = &m_symbols[entry.value];
+
+    // Don't let trampolines get into the lookup by name map If we ever need
+    // the trampoline symbols to be searchable by name we can remove this and
+    // then possibly add a new bool to any of the Symtab functions that lookup
+    // symbols by name to indicate if they want trampolines.
+    if (symbol->IsTrampoline())
+      continue;
+
+    // If the symbol's name string matched a Mangled::ManglingScheme, it is
+    // stored in the mangled field.
+    Mangled &mangled = symbol->GetMangled();
+    entry.cstring = mangled.GetMangledName();
+    if (entry.cstring) {
+      indexes.name_to_index.Append(entry);
+
+      if (symbol->ContainsLinkerAnnotations()) {
+        // If the symbol has linker annotations, also add the version without
+        // the annotations.
+        entry.cstring = ConstString(m_objfile->StripLinkerSymbolAnnotations(
+                                      entry.cstring.GetStringRef()));
+        indexes.name_to_index.Append(entry);
+      }
+
+      const SymbolType type = symbol->GetType();
+      if (type == eSymbolTypeCode || type == eSymbolTypeResolver) {
+        if (mangled.DemangleWithRichManglingInfo(rmc, lldb_skip_name))
+          RegisterMangledNameEntry(entry, indexes, rmc);
+      }
+    }
+
+    // Symbol name strings that didn't match a Mangled::ManglingScheme, are
+    // stored in the demangled field.
+    entry.cstring = mangled.GetDemangledName(symbol->GetLanguage());
+    if (entry.cstring) {
+      indexes.name_to_index.Append(entry);
+
+      if (symbol->ContainsLinkerAnnotations()) {
+        // If the symbol has linker annotations, also add the version without
+        // the annotations.
+        entry.cstring = ConstString(m_objfile->StripLinkerSymbolAnnotations(
+                                      entry.cstring.GetStringRef()));
+        indexes.name_to_index.Append(entry);
+      }
+    }
+
+    // If the demangled name turns out to be an ObjC name, and is a category
+    // name, add the version without categories to the index too.
+    ObjCLanguage::MethodName objc_method(entry.cstring.GetStringRef(), true);
+    if (objc_method.IsValid(true)) {
+      entry.cstring = objc_method.GetSelector();
+      indexes.selector_to_index.Append(entry);
+
+      ConstString objc_method_no_category(
+          objc_method.GetFullNameWithoutCategory(true));
+      if (objc_method_no_category) {
+        entry.cstring = objc_method_no_category;
+        indexes.name_to_index.Append(entry);
+      }
+    }
+  }
+}
+
+void Symtab::RegisterMangledNameEntry(NameToIndexMap::Entry &entry,
+                                      NameIndexes &indexes,
+                                      RichManglingContext &rmc) {
   // Only register functions that have a base name.
   rmc.ParseFunctionBaseName();
   llvm::StringRef base_name = rmc.GetBufferRef();
@@ -390,36 +433,36 @@ void Symtab::RegisterMangledNameEntry(
   // Register functions with no context.
   if (decl_context.empty()) {
     // This has to be a basename
-    m_basename_to_index.Append(entry);
+    indexes.basename_to_index.Append(entry);
     // If there is no context (no namespaces or class scopes that come before
     // the function name) then this also could be a fullname.
-    m_name_to_index.Append(entry);
+    indexes.name_to_index.Append(entry);
     return;
   }
 
   // Make sure we have a pool-string pointer and see if we already know the
   // context name.
   const char *decl_context_ccstr = ConstString(decl_context).GetCString();
-  auto it = class_contexts.find(decl_context_ccstr);
+  auto it = indexes.class_contexts.find(decl_context_ccstr);
 
   // Register constructors and destructors. They are methods and create
   // declaration contexts.
   if (rmc.IsCtorOrDtor()) {
-    m_method_to_index.Append(entry);
-    if (it == class_contexts.end())
-      class_contexts.insert(it, decl_context_ccstr);
+    indexes.method_to_index.Append(entry);
+    if (it == indexes.class_contexts.end())
+      indexes.class_contexts.insert(it, decl_context_ccstr);
     return;
   }
 
   // Register regular methods with a known declaration context.
-  if (it != class_contexts.end()) {
-    m_method_to_index.Append(entry);
+  if (it != indexes.class_contexts.end()) {
+    indexes.method_to_index.Append(entry);
     return;
   }
 
   // Regular methods in unknown declaration contexts are put to the backlog. We
   // will revisit them once we processed all remaining symbols.
-  backlog.push_back(std::make_pair(entry, decl_context_ccstr));
+  indexes.backlog.push_back(std::make_pair(entry, decl_context_ccstr));
 }
 
 void Symtab::RegisterBacklogEntry(
@@ -183,6 +183,11 @@ static const CoreDefinition g_core_definitions[] = {
     {eByteOrderBig, 8, 4, 4, llvm::Triple::ppc64,
      ArchSpec::eCore_ppc64_ppc970_64, "ppc970-64"},
 
+    {eByteOrderLittle, 4, 2, 4, llvm::Triple::riscv32,
+     ArchSpec::eCore_riscv32, "riscv32"},
+    {eByteOrderLittle, 8, 2, 4, llvm::Triple::riscv64,
+     ArchSpec::eCore_riscv64, "riscv64"},
+
     {eByteOrderBig, 8, 2, 6, llvm::Triple::systemz,
      ArchSpec::eCore_s390x_generic, "s390x"},
 
@@ -423,6 +428,10 @@ static const ArchDefinitionEntry g_elf_arch_entries[] = {
      0xFFFFFFFFu, 0xFFFFFFFFu}, // ARM64
     {ArchSpec::eCore_s390x_generic, llvm::ELF::EM_S390, LLDB_INVALID_CPUTYPE,
      0xFFFFFFFFu, 0xFFFFFFFFu}, // SystemZ
+    {ArchSpec::eCore_riscv32, llvm::ELF::EM_RISCV,
+     ArchSpec::eRISCVSubType_riscv32, 0xFFFFFFFFu, 0xFFFFFFFFu}, // riscv32
+    {ArchSpec::eCore_riscv64, llvm::ELF::EM_RISCV,
+     ArchSpec::eRISCVSubType_riscv64, 0xFFFFFFFFu, 0xFFFFFFFFu}, // riscv64
     {ArchSpec::eCore_sparc9_generic, llvm::ELF::EM_SPARCV9,
      LLDB_INVALID_CPUTYPE, 0xFFFFFFFFu, 0xFFFFFFFFu}, // SPARC V9
     {ArchSpec::eCore_x86_64_x86_64, llvm::ELF::EM_X86_64, LLDB_INVALID_CPUTYPE,
@@ -813,6 +822,8 @@ bool ArchSpec::CharIsSignedByDefault() const {
     return m_triple.isOSDarwin();
 
   case llvm::Triple::ppc64le:
+  case llvm::Triple::riscv32:
+  case llvm::Triple::riscv64:
   case llvm::Triple::systemz:
   case llvm::Triple::xcore:
   case llvm::Triple::arc:
@@ -0,0 +1,91 @@
+//===-- RISCV_DWARF_Registers.h ---------------------------------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef utility_RISCV_DWARF_Registers_h_
+#define utility_RISCV_DWARF_Registers_h_
+
+#include "lldb/lldb-private.h"
+
+// DWARF register numbers of the RISC-V ELF psABI, shared by RV32 and RV64.
+namespace riscv_dwarf {
+
+enum {
+  dwarf_x0_riscv = 0,
+  dwarf_x1_riscv,
+  dwarf_x2_riscv,
+  dwarf_x3_riscv,
+  dwarf_x4_riscv,
+  dwarf_x5_riscv,
+  dwarf_x6_riscv,
+  dwarf_x7_riscv,
+  dwarf_x8_riscv,
+  dwarf_x9_riscv,
+  dwarf_x10_riscv,
+  dwarf_x11_riscv,
+  dwarf_x12_riscv,
+  dwarf_x13_riscv,
+  dwarf_x14_riscv,
+  dwarf_x15_riscv,
+  dwarf_x16_riscv,
+  dwarf_x17_riscv,
+  dwarf_x18_riscv,
+  dwarf_x19_riscv,
+  dwarf_x20_riscv,
+  dwarf_x21_riscv,
+  dwarf_x22_riscv,
+  dwarf_x23_riscv,
+  dwarf_x24_riscv,
+  dwarf_x25_riscv,
+  dwarf_x26_riscv,
+  dwarf_x27_riscv,
+  dwarf_x28_riscv,
+  dwarf_x29_riscv,
+  dwarf_x30_riscv,
+  dwarf_x31_riscv,
+  dwarf_f0_riscv = 32,
+  dwarf_f1_riscv,
+  dwarf_f2_riscv,
+  dwarf_f3_riscv,
+  dwarf_f4_riscv,
+  dwarf_f5_riscv,
+  dwarf_f6_riscv,
+  dwarf_f7_riscv,
+  dwarf_f8_riscv,
+  dwarf_f9_riscv,
+  dwarf_f10_riscv,
+  dwarf_f11_riscv,
+  dwarf_f12_riscv,
+  dwarf_f13_riscv,
+  dwarf_f14_riscv,
+  dwarf_f15_riscv,
+  dwarf_f16_riscv,
+  dwarf_f17_riscv,
+  dwarf_f18_riscv,
+  dwarf_f19_riscv,
+  dwarf_f20_riscv,
+  dwarf_f21_riscv,
+  dwarf_f22_riscv,
+  dwarf_f23_riscv,
+  dwarf_f24_riscv,
+  dwarf_f25_riscv,
+  dwarf_f26_riscv,
+  dwarf_f27_riscv,
+  dwarf_f28_riscv,
+  dwarf_f29_riscv,
+  dwarf_f30_riscv,
+  dwarf_f31_riscv,
+
+  // The psABI reserves 64 for an alternate frame return column, lldb uses it
+  // for the pc, which has no DWARF number of its own.
+  dwarf_pc_riscv = 64,
+};
+
+} // namespace riscv_dwarf
+
+#endif // utility_RISCV_DWARF_Registers_h_
@@ -130,3 +130,35 @@ void Timer::DumpCategoryTimes(Stream *s) {
   for (const auto &timer : sorted)
     s->Printf("%.9f sec for %s\n", timer.second / 1000000000., timer.first);
 }
+
+static std::atomic<uint64_t> g_statistic_nanos[StatisticTimeMax];
+
+// The phases with a timer on the current thread, one bit each.
+static uint32_t &GetStatisticTimersForCurrentThread() {
+  static thread_local uint32_t g_active_kinds;
+  return g_active_kinds;
+}
+
+ScopedStatisticTimer::ScopedStatisticTimer(StatisticTimeKind kind)
+    : m_kind(kind) {
+  uint32_t &active_kinds = GetStatisticTimersForCurrentThread();
+  m_outermost = (active_kinds & (1u << kind)) == 0;
+  if (m_outermost) {
+    active_kinds |= 1u << kind;
+    m_start = std::chrono::steady_clock::now();
+  }
+}
+
+ScopedStatisticTimer::~ScopedStatisticTimer() {
+  if (!m_outermost)
+    return;
+  g_statistic_nanos[m_kind] += std::chrono::nanoseconds(
+                                   std::chrono::steady_clock::now() - m_start)
+                                   .count();
+  GetStatisticTimersForCurrentThread() &= ~(1u << m_kind);
+}
+
+std::chrono::nanoseconds
+ScopedStatisticTimer::GetTime(StatisticTimeKind kind) {
+  return std::chrono::nanoseconds(g_statistic_nanos[kind].load());
+}
@@ -30,6 +30,7 @@
 #include "Plugins/ABI/SysV-mips64/ABISysV_mips64.h"
 #include "Plugins/ABI/SysV-ppc/ABISysV_ppc.h"
 #include "Plugins/ABI/SysV-ppc64/ABISysV_ppc64.h"
+#include "Plugins/ABI/SysV-riscv/ABISysV_riscv.h"
 #include "Plugins/ABI/SysV-s390x/ABISysV_s390x.h"
 #include "Plugins/ABI/SysV-x86_64/ABISysV_x86_64.h"
 #include "Plugins/Architecture/Arm/ArchitectureArm.h"
@@ -42,6 +43,7 @@
 #include "Plugins/DynamicLoader/Windows-DYLD/DynamicLoaderWindowsDYLD.h"
 #include "Plugins/Instruction/ARM64/EmulateInstructionARM64.h"
 #include "Plugins/Instruction/PPC64/EmulateInstructionPPC64.h"
+#include "Plugins/Instruction/RISCV/EmulateInstructionRISCV.h"
 #include "Plugins/InstrumentationRuntime/ASan/ASanRuntime.h"
 #include "Plugins/InstrumentationRuntime/MainThreadChecker/MainThreadCheckerRuntime.h"
 #include "Plugins/InstrumentationRuntime/TSan/TSanRuntime.h"
@@ -169,6 +171,7 @@ void SystemInitializerTest::Initialize() {
   ABISysV_mips::Initialize();
   ABISysV_mips64::Initialize();
   ABISysV_s390x::Initialize();
+  ABISysV_riscv::Initialize();
 
   ArchitectureArm::Initialize();
   ArchitecturePPC64::Initialize();
@@ -192,6 +195,7 @@ void SystemInitializerTest::Initialize() {
   UnwindAssembly_x86::Initialize();
   EmulateInstructionARM64::Initialize();
   EmulateInstructionPPC64::Initialize();
+  EmulateInstructionRISCV::Initialize();
   SymbolFileDWARFDebugMap::Initialize();
   ItaniumABILanguageRuntime::Initialize();
   AppleObjCRuntimeV2::Initialize();
@@ -278,6 +282,7 @@ void SystemInitializerTest::Terminate() {
   ABISysV_mips::Terminate();
   ABISysV_mips64::Terminate();
   ABISysV_s390x::Terminate();
+  ABISysV_riscv::Terminate();
   DisassemblerLLVMC::Terminate();
 
   JITLoaderGDB::Terminate();
@@ -296,6 +301,7 @@ void SystemInitializerTest::Terminate() {
   UnwindAssemblyInstEmulation::Terminate();
   EmulateInstructionARM64::Terminate();
   EmulateInstructionPPC64::Terminate();
+  EmulateInstructionRISCV::Terminate();
   SymbolFileDWARFDebugMap::Terminate();
   ItaniumABILanguageRuntime::Terminate();
   AppleObjCRuntimeV2::Terminate();
@@ -0,0 +1,589 @@
+//===-- TestABISysV_riscv.cpp -----------------------------------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+
+#include "Plugins/ABI/SysV-riscv/ABISysV_riscv.h"
+#include "Plugins/Platform/gdb-server/PlatformRemoteGDBServer.h"
+
+#include "clang/AST/Type.h"
+
+#include "lldb/Core/Debugger.h"
+#include "lldb/Core/Listener.h"
+#include "lldb/Core/ValueObject.h"
+#include "lldb/Core/ValueObjectConstResult.h"
+#include "lldb/Host/HostInfo.h"
+#include "lldb/Symbol/ClangASTContext.h"
+#include "lldb/Target/Process.h"
+#include "lldb/Target/RegisterContext.h"
+#include "lldb/Target/StackFrame.h"
+#include "lldb/Target/Target.h"
+#include "lldb/Target/Thread.h"
+#include "lldb/Utility/ArchSpec.h"
+#include "lldb/Utility/DataExtractor.h"
+#include "lldb/Utility/Endian.h"
+#include "lldb/Utility/RegisterValue.h"
+
+using namespace lldb;
+using namespace lldb_private;
+
+typedef ABISysV_riscv::AggregateConvention AggregateConvention;
+
+namespace {
+// A process that never runs, it only gives the thread below a target.
+class TestProcess : public Process {
+public:
+  TestProcess(TargetSP target_sp, ListenerSP listener_sp)
+      : Process(target_sp, listener_sp) {}
+
+  bool CanDebug(TargetSP target, bool plugin_specified_by_name) override {
+    return true;
+  }
+  Status DoDestroy() override { return Status(); }
+  void RefreshStateAfterStop() override {}
+  size_t DoReadMemory(addr_t vm_addr, void *buf, size_t size,
+                      Status &error) override {
+    error.SetErrorString("no memory");
+    return 0;
+  }
+  bool UpdateThreadList(ThreadList &old_thread_list,
+                        ThreadList &new_thread_list) override {
+    return false;
+  }
+  ConstString GetPluginName() override { return ConstString("test"); }
+  uint32_t GetPluginVersion() override { return 1; }
+};
+
+// Registers kept in memory, described by the register table of the ABI.
+class TestRegisterContext : public RegisterContext {
+public:
+  TestRegisterContext(Thread &thread, ABI &abi) : RegisterContext(thread, 0) {
+    m_infos = abi.GetRegisterInfoArray(m_count);
+    m_values.resize(m_count);
+    for (uint32_t i = 0; i < m_count; ++i)
+      m_values[i].SetUInt(0, m_infos[i].byte_size);
+  }
+
+  void InvalidateAllRegisters() override {}
+  size_t GetRegisterCount() override { return m_count; }
+  const RegisterInfo *GetRegisterInfoAtIndex(size_t reg) override {
+    return reg < m_count ? &m_infos[reg] : nullptr;
+  }
+  size_t GetRegisterSetCount() override { return 0; }
+  const RegisterSet *GetRegisterSet(size_t reg_set) override { return nullptr; }
+
+  bool ReadRegister(const RegisterInfo *reg_info,
+                    RegisterValue &reg_value) override {
+    const size_t reg = reg_info - m_infos;
+    if (reg >= m_count)
+      return false;
+    reg_value = m_values[reg];
+    return true;
+  }
+
+  bool WriteRegister(const RegisterInfo *reg_info,
+                     const RegisterValue &reg_value) override {
+    const size_t reg = reg_info - m_infos;
+    if (reg >= m_count)
+      return false;
+    m_values[reg] = reg_value;
+    return true;
+  }
+
+  uint32_t ConvertRegisterKindToRegisterNumber(RegisterKind kind,
+                                               uint32_t num) override {
+    for (uint32_t reg = 0; reg < m_count; ++reg)
+      if (m_infos[reg].kinds[kind] == num)
+        return reg;
+    return LLDB_INVALID_REGNUM;
+  }
+
+private:
+  const RegisterInfo *m_infos = nullptr;
+  uint32_t m_count = 0;
+  std::vector<RegisterValue> m_values;
+};
+
+class TestThread : public Thread {
+public:
+  TestThread(Process &process) : Thread(process, 1) {}
+  ~TestThread() override { DestroyThread(); }
+
+  void RefreshStateAfterStop() override {}
+  RegisterContextSP GetRegisterContext() override { return m_reg_context_sp; }
+  RegisterContextSP CreateRegisterContextForFrame(StackFrame *frame) override {
+    return m_reg_context_sp;
+  }
+  bool CalculateStopInfo() override { return false; }
+
+  void SetRegisterContext(const RegisterContextSP &reg_context_sp) {
+    m_reg_context_sp = reg_context_sp;
+  }
+};
+} // namespace
+
+class TestABISysV_riscv : public testing::Test {
+public:
+  static void SetUpTestCase();
+  static void TearDownTestCase();
+
+  void TearDown() override;
+
+protected:
+  // Creates the AST the types of a test are made in.
+  void SetUpAST(const char *triple) {
+    m_ast.reset(new ClangASTContext(triple));
+  }
+
+  // Creates the AST, the ABI, and a thread whose registers are all zero, for
+  // the triple and float ABI, one of the ArchSpec::eRISCV_float_abi_* values.
+  void SetUpABI(const char *triple, uint32_t float_abi);
+
+  CompilerType GetBasicType(BasicType type) {
+    return m_ast->GetBasicType(type);
+  }
+
+  CompilerType CreateStruct(
+      const char *name,
+      const std::initializer_list<std::pair<const char *, CompilerType>>
+          &fields) {
+    return m_ast->CreateStructForIdentifier(ConstString(name), fields);
+  }
+
+  AggregateConvention Flatten(const CompilerType &type, uint32_t xlen,
+                              uint32_t flen) {
+    return ABISysV_riscv::FlattenForFloatingPointConvention(
+        nullptr, type, xlen, flen, m_fields, m_num_fields);
+  }
+
+  void WriteRegister(const char *name, uint64_t value) {
+    RegisterContext &reg_ctx = *m_thread_sp->GetRegisterContext();
+    const RegisterInfo *reg_info = reg_ctx.GetRegisterInfoByName(name);
+    ASSERT_NE(nullptr, reg_info);
+    ASSERT_TRUE(reg_ctx.WriteRegisterFromUnsigned(reg_info, value));
+  }
+
+  uint64_t ReadRegister(const char *name) {
+    RegisterContext &reg_ctx = *m_thread_sp->GetRegisterContext();
+    const RegisterInfo *reg_info = reg_ctx.GetRegisterInfoByName(name);
+    EXPECT_NE(nullptr, reg_info);
+    return reg_info ? reg_ctx.ReadRegisterAsUnsigned(reg_info, 0) : 0;
+  }
+
+  ValueObjectSP GetReturnValue(CompilerType type) {
+    return m_abi_sp->GetReturnValueObject(*m_thread_sp, type, false);
+  }
+
+  // Makes a value of the type from the host bytes, and sets it as the return
+  // value of the thread.
+  Status SetReturnValue(const CompilerType &type, const void *bytes,
+                        size_t size) {
+    DataExtractor data(bytes, size, endian::InlHostByteOrder(),
+                       m_target_sp->GetArchitecture().GetAddressByteSize());
+    ValueObjectSP value_sp = ValueObjectConstResult::Create(
+        m_thread_sp.get(), type, ConstString("value"), data);
+    StackFrameSP frame_sp = std::make_shared<StackFrame>(
+        m_thread_sp, 0, 0, LLDB_INVALID_ADDRESS, false, 0x1000,
+        StackFrame::Kind::Regular, nullptr);
+    return m_abi_sp->SetReturnValueObject(frame_sp, value_sp);
+  }
+
+  std::unique_ptr<ClangASTContext> m_ast;
+  DebuggerSP m_debugger_sp;
+  TargetSP m_target_sp;
+  ProcessSP m_process_sp;
+  std::shared_ptr<TestThread> m_thread_sp;
+  ABISP m_abi_sp;
+  ABISysV_riscv::FlattenedField m_fields[2];
+  uint32_t m_num_fields = 0;
+};
+
+void TestABISysV_riscv::SetUpTestCase() {
+  HostInfo::Initialize();
+  Debugger::Initialize(nullptr);
+  Platform::SetHostPlatform(
+      platform_gdb_server::PlatformRemoteGDBServer::CreateInstance(true,
+                                                                  nullptr));
+}
+
+void TestABISysV_riscv::TearDownTestCase() {
+  Platform::SetHostPlatform(PlatformSP());
+  Debugger::Terminate();
+  HostInfo::Terminate();
+}
+
+void TestABISysV_riscv::SetUpABI(const char *triple, uint32_t float_abi) {
+  SetUpAST(triple);
+
+  ArchSpec arch(triple);
+  arch.SetFlags(float_abi);
+  m_debugger_sp = Debugger::CreateInstance();
+  PlatformSP platform_sp;
+  ASSERT_TRUE(m_debugger_sp->GetTargetList()
+                  .CreateTarget(*m_debugger_sp, "", arch, eLoadDependentsNo,
+                                platform_sp, m_target_sp)
+                  .Success());
+  m_process_sp = std::make_shared<TestProcess>(
+      m_target_sp, Listener::MakeListener("TestABISysV_riscv"));
+  m_abi_sp = ABISysV_riscv::CreateInstance(m_process_sp, arch);
+  ASSERT_TRUE(m_abi_sp);
+  m_thread_sp = std::make_shared<TestThread>(*m_process_sp);
+  m_thread_sp->SetRegisterContext(
+      std::make_shared<TestRegisterContext>(*m_thread_sp, *m_abi_sp));
+}
+
+void TestABISysV_riscv::TearDown() {
+  m_abi_sp.reset();
+  m_thread_sp.reset();
+  m_process_sp.reset();
+  m_target_sp.reset();
+  if (m_debugger_sp)
+    Debugger::Destroy(m_debugger_sp);
+  m_ast.reset();
+}
+
+static uint32_t FloatBits(float value) {
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+static uint64_t DoubleBits(double value) {
+  uint64_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+// A float in a 64-bit floating point register has its upper bits set.
+static uint64_t NaNBoxed(float value) {
+  return 0xffffffff00000000ull | FloatBits(value);
+}
+
+static double GetFloatingPointValue(ValueObject &valobj) {
+  DataExtractor data;
+  Status error;
+  valobj.GetData(data, error);
+  EXPECT_TRUE(error.Success());
+  offset_t offset = 0;
+  return data.GetByteSize() == sizeof(float) ? data.GetFloat(&offset)
+                                             : data.GetDouble(&offset);
+}
+
+static ValueObjectSP GetMember(const ValueObjectSP &valobj_sp,
+                               const char *name) {
+  return valobj_sp ? valobj_sp->GetChildMemberWithName(ConstString(name), true)
+                   : ValueObjectSP();
+}
+
+TEST_F(TestABISysV_riscv, FlattenForFloatingPointConvention) {
+  SetUpAST("riscv64-unknown-linux-gnu");
+  CompilerType int_type = GetBasicType(eBasicTypeInt);
+  CompilerType long_type = GetBasicType(eBasicTypeLong);
+  CompilerType long_long_type = GetBasicType(eBasicTypeLongLong);
+  CompilerType float_type = GetBasicType(eBasicTypeFloat);
+  CompilerType double_type = GetBasicType(eBasicTypeDouble);
+
+  // A floating point and an integer member.
+  CompilerType double_int =
+      CreateStruct("double_int", {{"d", double_type}, {"i", int_type}});
+  EXPECT_EQ(AggregateConvention::FloatingPoint, Flatten(double_int, 8, 8));
+  ASSERT_EQ(2u, m_num_fields);
+  EXPECT_TRUE(m_fields[0].is_float);
+  EXPECT_EQ(0u, m_fields[0].byte_offset);
+  EXPECT_EQ(8u, m_fields[0].byte_size);
+  EXPECT_FALSE(m_fields[1].is_float);
+  EXPECT_EQ(8u, m_fields[1].byte_offset);
+  EXPECT_EQ(4u, m_fields[1].byte_size);
+
+  // The double does not fit in the registers of a single float ABI.
+  EXPECT_EQ(AggregateConvention::Integer, Flatten(double_int, 8, 4));
+
+  // Two floating point members.
+  CompilerType float_float =
+      CreateStruct("float_float", {{"a", float_type}, {"b", float_type}});
+  EXPECT_EQ(AggregateConvention::FloatingPoint, Flatten(float_float, 4, 4));
+  ASSERT_EQ(2u, m_num_fields);
+  EXPECT_TRUE(m_fields[0].is_float);
+  EXPECT_EQ(0u, m_fields[0].byte_offset);
+  EXPECT_EQ(4u, m_fields[0].byte_size);
+  EXPECT_TRUE(m_fields[1].is_float);
+  EXPECT_EQ(4u, m_fields[1].byte_offset);
+  EXPECT_EQ(4u, m_fields[1].byte_size);
+
+  // A complex member counts as two floating point members.
+  CompilerType complex_float = CreateStruct(
+      "complex_float", {{"c", GetBasicType(eBasicTypeFloatComplex)}});
+  EXPECT_EQ(AggregateConvention::FloatingPoint, Flatten(complex_float, 8, 8));
+  ASSERT_EQ(2u, m_num_fields);
+  EXPECT_TRUE(m_fields[1].is_float);
+  EXPECT_EQ(4u, m_fields[1].byte_offset);
+  EXPECT_EQ(4u, m_fields[1].byte_size);
+
+  // Three members are too many.
+  CompilerType float3 = CreateStruct(
+      "float3", {{"a", float_type}, {"b", float_type}, {"c", float_type}});
+  EXPECT_EQ(AggregateConvention::Integer, Flatten(float3, 8, 8));
+
+  // Without any floating point member the integer convention applies.
+  CompilerType long_long =
+      CreateStruct("long_long", {{"a", long_type}, {"b", long_type}});
+  EXPECT_EQ(AggregateConvention::Integer, Flatten(long_long, 8, 8));
+
+  // A long long does not fit in an integer register of RV32.
+  CompilerType float_long_long = CreateStruct(
+      "float_long_long", {{"f", float_type}, {"l", long_long_type}});
+  EXPECT_EQ(AggregateConvention::FloatingPoint,
+            Flatten(float_long_long, 8, 8));
+  EXPECT_EQ(AggregateConvention::Integer, Flatten(float_long_long, 4, 8));
+
+  // Unions always follow the integer convention.
+  CompilerType float_or_int = m_ast->CreateRecordType(
+      nullptr, eAccessPublic, "float_or_int", clang::TTK_Union,
+      eLanguageTypeC);
+  ClangASTContext::StartTagDeclarationDefinition(float_or_int);
+  ClangASTContext::AddFieldToRecordType(float_or_int, "f", float_type,
+                                        eAccessPublic, 0);
+  ClangASTContext::AddFieldToRecordType(float_or_int, "i", int_type,
+                                        eAccessPublic, 0);
+  ClangASTContext::CompleteTagDeclarationDefinition(float_or_int);
+  EXPECT_EQ(AggregateConvention::Integer, Flatten(float_or_int, 8, 8));
+
+  // Nested aggregates and bit-fields are not classified.
+  CompilerType nested = CreateStruct(
+      "nested", {{"inner", float_float}, {"d", double_type}});
+  EXPECT_EQ(AggregateConvention::Unsupported, Flatten(nested, 8, 8));
+
+  CompilerType bit_field = m_ast->CreateRecordType(
+      nullptr, eAccessPublic, "bit_field", clang::TTK_Struct, eLanguageTypeC);
+  ClangASTContext::StartTagDeclarationDefinition(bit_field);
+  ClangASTContext::AddFieldToRecordType(bit_field, "f", float_type,
+                                        eAccessPublic, 0);
+  ClangASTContext::AddFieldToRecordType(bit_field, "i", int_type,
+                                        eAccessPublic, 3);
+  ClangASTContext::CompleteTagDeclarationDefinition(bit_field);
+  EXPECT_EQ(AggregateConvention::Unsupported, Flatten(bit_field, 8, 8));
+}
+
+TEST_F(TestABISysV_riscv, GetReturnValueRV64SoftFloat) {
+  SetUpABI("riscv64-unknown-linux-gnu", ArchSpec::eRISCV_float_abi_soft);
+
+  WriteRegister("a0", 0xfffffffffffffffbull);
+  ValueObjectSP valobj_sp = GetReturnValue(GetBasicType(eBasicTypeInt));
+  ASSERT_TRUE(valobj_sp);
+  EXPECT_EQ(-5, valobj_sp->GetValueAsSigned(0));
+
+  // Floating point values are returned in the integer registers.
+  WriteRegister("a0", DoubleBits(2.5));
+  valobj_sp = GetReturnValue(GetBasicType(eBasicTypeDouble));
+  ASSERT_TRUE(valobj_sp);
+  EXPECT_EQ(2.5, GetFloatingPointValue(*valobj_sp));
+
+  // And so are all small structures, the first member in the low bits.
+  CompilerType float_type = GetBasicType(eBasicTypeFloat);
+  CompilerType float_float =
+      CreateStruct("float_float", {{"a", float_type}, {"b", float_type}});
+  WriteRegister("a0", ((uint64_t)FloatBits(-0.25f) << 32) | FloatBits(1.5f));
+  valobj_sp = GetReturnValue(float_float);
+  ASSERT_TRUE(valobj_sp);
+  ASSERT_TRUE(GetMember(valobj_sp, "a"));
+  ASSERT_TRUE(GetMember(valobj_sp, "b"));
+  EXPECT_EQ(1.5, GetFloatingPointValue(*GetMember(valobj_sp, "a")));
+  EXPECT_EQ(-0.25, GetFloatingPointValue(*GetMember(valobj_sp, "b")));
+
+  CompilerType double_int =
+      CreateStruct("double_int", {{"d", GetBasicType(eBasicTypeDouble)},
+                                  {"i", GetBasicType(eBasicTypeInt)}});
+  WriteRegister("a0", DoubleBits(3.0));
+  WriteRegister("a1", 7);
+  valobj_sp = GetReturnValue(double_int);
+  ASSERT_TRUE(GetMember(valobj_sp, "d"));
+  ASSERT_TRUE(GetMember(valobj_sp, "i"));
+  EXPECT_EQ(3.0, GetFloatingPointValue(*GetMember(valobj_sp, "d")));
+  EXPECT_EQ(7, GetMember(valobj_sp, "i")->GetValueAsSigned(0));
+}
+
+TEST_F(TestABISysV_riscv, GetReturnValueRV64HardFloat) {
+  SetUpABI("riscv64-unknown-linux-gnu", ArchSpec::eRISCV_float_abi_double);
+
+  WriteRegister("fa0", NaNBoxed(1.5f));
+  ValueObjectSP valobj_sp = GetReturnValue(GetBasicType(eBasicTypeFloat));
+  ASSERT_TRUE(valobj_sp);
+  EXPECT_EQ(1.5, GetFloatingPointValue(*valobj_sp));
+
+  WriteRegister("fa0", DoubleBits(2.5));
+  valobj_sp = GetReturnValue(GetBasicType(eBasicTypeDouble));
+  ASSERT_TRUE(valobj_sp);
+  EXPECT_EQ(2.5, GetFloatingPointValue(*valobj_sp));
+
+  // A structure of a floating point and an integer member is split between
+  // fa0 and a0.
+  CompilerType double_int =
+      CreateStruct("double_int", {{"d", GetBasicType(eBasicTypeDouble)},
+                                  {"i", GetBasicType(eBasicTypeInt)}});
+  WriteRegister("fa0", DoubleBits(3.0));
+  WriteRegister("a0", 7);
+  valobj_sp = GetReturnValue(double_int);
+  ASSERT_TRUE(GetMember(valobj_sp, "d"));
+  ASSERT_TRUE(GetMember(valobj_sp, "i"));
+  EXPECT_EQ(3.0, GetFloatingPointValue(*GetMember(valobj_sp, "d")));
+  EXPECT_EQ(7, GetMember(valobj_sp, "i")->GetValueAsSigned(0));
+
+  // Two floating point members go in fa0 and fa1.
+  CompilerType float_type = GetBasicType(eBasicTypeFloat);
+  CompilerType float_float =
+      CreateStruct("float_float", {{"a", float_type}, {"b", float_type}});
+  WriteRegister("fa0", NaNBoxed(1.5f));
+  WriteRegister("fa1", NaNBoxed(-0.25f));
+  valobj_sp = GetReturnValue(float_float);
+  ASSERT_TRUE(GetMember(valobj_sp, "a"));
+  ASSERT_TRUE(GetMember(valobj_sp, "b"));
+  EXPECT_EQ(1.5, GetFloatingPointValue(*GetMember(valobj_sp, "a")));
+  EXPECT_EQ(-0.25, GetFloatingPointValue(*GetMember(valobj_sp, "b")));
+
+  // Integer structures still use a0 and a1.
+  CompilerType long_type = GetBasicType(eBasicTypeLong);
+  CompilerType long_long =
+      CreateStruct("long_long", {{"a", long_type}, {"b", long_type}});
+  WriteRegister("a0", 1);
+  WriteRegister("a1", 2);
+  valobj_sp = GetReturnValue(long_long);
+  ASSERT_TRUE(GetMember(valobj_sp, "a"));
+  ASSERT_TRUE(GetMember(valobj_sp, "b"));
+  EXPECT_EQ(1, GetMember(valobj_sp, "a")->GetValueAsSigned(0));
+  EXPECT_EQ(2, GetMember(valobj_sp, "b")->GetValueAsSigned(0));
+
+  // Where a nested structure goes is not worked out, so no value is made.
+  CompilerType nested =
+      CreateStruct("nested", {{"inner", float_float},
+                              {"d", GetBasicType(eBasicTypeDouble)}});
+  EXPECT_FALSE(GetReturnValue(nested));
+}
+
+TEST_F(TestABISysV_riscv, GetReturnValueRV32) {
+  SetUpABI("riscv32-unknown-linux-gnu", ArchSpec::eRISCV_float_abi_single);
+
+  // Values twice as wide as XLEN take a0 and a1, the low bits first.
+  WriteRegister("a0", 0x89abcdef);
+  WriteRegister("a1", 0x01234567);
+  ValueObjectSP valobj_sp = GetReturnValue(GetBasicType(eBasicTypeLongLong));
+  ASSERT_TRUE(valobj_sp);
+  EXPECT_EQ(0x0123456789abcdefull, valobj_sp->GetValueAsUnsigned(0));
+
+  WriteRegister("fa0", NaNBoxed(1.5f));
+  valobj_sp = GetReturnValue(GetBasicType(eBasicTypeFloat));
+  ASSERT_TRUE(valobj_sp);
+  EXPECT_EQ(1.5, GetFloatingPointValue(*valobj_sp));
+
+  // A double is wider than the registers of the single float ABI.
+  const uint64_t bits = DoubleBits(2.5);
+  WriteRegister("a0", bits & UINT32_MAX);
+  WriteRegister("a1", bits >> 32);
+  valobj_sp = GetReturnValue(GetBasicType(eBasicTypeDouble));
+  ASSERT_TRUE(valobj_sp);
+  EXPECT_EQ(2.5, GetFloatingPointValue(*valobj_sp));
+}
+
+TEST_F(TestABISysV_riscv, GetReturnValueRV32HardDouble) {
+  SetUpABI("riscv32-unknown-linux-gnu", ArchSpec::eRISCV_float_abi_double);
+
+  // Larger than two integer registers, but each member has a register of its
+  // own.
+  CompilerType int_double =
+      CreateStruct("int_double", {{"i", GetBasicType(eBasicTypeInt)},
+                                  {"d", GetBasicType(eBasicTypeDouble)}});
+  WriteRegister("a0", 0xfffffff9);
+  WriteRegister("fa0", DoubleBits(2.5));
+  ValueObjectSP valobj_sp = GetReturnValue(int_double);
+  ASSERT_TRUE(GetMember(valobj_sp, "i"));
+  ASSERT_TRUE(GetMember(valobj_sp, "d"));
+  EXPECT_EQ(-7, GetMember(valobj_sp, "i")->GetValueAsSigned(0));
+  EXPECT_EQ(2.5, GetFloatingPointValue(*GetMember(valobj_sp, "d")));
+}
+
+TEST_F(TestABISysV_riscv, SetReturnValueRV64HardFloat) {
+  SetUpABI("riscv64-unknown-linux-gnu", ArchSpec::eRISCV_float_abi_double);
+
+  // A float is NaN-boxed in the 64-bit fa0.
+  float f = 1.5f;
+  ASSERT_TRUE(
+      SetReturnValue(GetBasicType(eBasicTypeFloat), &f, sizeof(f)).Success());
+  EXPECT_EQ(NaNBoxed(1.5f), ReadRegister("fa0"));
+
+  double d = 2.5;
+  ASSERT_TRUE(
+      SetReturnValue(GetBasicType(eBasicTypeDouble), &d, sizeof(d)).Success());
+  EXPECT_EQ(DoubleBits(2.5), ReadRegister("fa0"));
+
+  // 32-bit integers are sign extended, whether they are signed or not.
+  int32_t i = -5;
+  ASSERT_TRUE(
+      SetReturnValue(GetBasicType(eBasicTypeInt), &i, sizeof(i)).Success());
+  EXPECT_EQ(0xfffffffffffffffbull, ReadRegister("a0"));
+
+  uint32_t u = 0x80000000;
+  ASSERT_TRUE(SetReturnValue(GetBasicType(eBasicTypeUnsignedInt), &u,
+                             sizeof(u))
+                  .Success());
+  EXPECT_EQ(0xffffffff80000000ull, ReadRegister("a0"));
+
+  uint16_t us = 0x8000;
+  ASSERT_TRUE(SetReturnValue(GetBasicType(eBasicTypeUnsignedShort), &us,
+                             sizeof(us))
+                  .Success());
+  EXPECT_EQ(0x8000u, ReadRegister("a0"));
+
+  // Structures can't be set.
+  CompilerType float_type = GetBasicType(eBasicTypeFloat);
+  CompilerType float_float =
+      CreateStruct("float_float", {{"a", float_type}, {"b", float_type}});
+  float ff[2] = {1.5f, -0.25f};
+  EXPECT_TRUE(SetReturnValue(float_float, ff, sizeof(ff)).Fail());
+}
+
+TEST_F(TestABISysV_riscv, SetReturnValueRV64SoftFloat) {
+  SetUpABI("riscv64-unknown-linux-gnu", ArchSpec::eRISCV_float_abi_soft);
+
+  // Floating point values go in the integer registers, without NaN-boxing.
+  float f = 1.5f;
+  ASSERT_TRUE(
+      SetReturnValue(GetBasicType(eBasicTypeFloat), &f, sizeof(f)).Success());
+  EXPECT_EQ(FloatBits(1.5f), ReadRegister("a0"));
+  EXPECT_EQ(0u, ReadRegister("fa0"));
+
+  double d = 2.5;
+  ASSERT_TRUE(
+      SetReturnValue(GetBasicType(eBasicTypeDouble), &d, sizeof(d)).Success());
+  EXPECT_EQ(DoubleBits(2.5), ReadRegister("a0"));
+  EXPECT_EQ(0u, ReadRegister("fa0"));
+}
+
+TEST_F(TestABISysV_riscv, SetReturnValueRV32SingleFloat) {
+  SetUpABI("riscv32-unknown-linux-gnu", ArchSpec::eRISCV_float_abi_single);
+
+  float f = 1.5f;
+  ASSERT_TRUE(
+      SetReturnValue(GetBasicType(eBasicTypeFloat), &f, sizeof(f)).Success());
+  EXPECT_EQ(NaNBoxed(1.5f), ReadRegister("fa0"));
+
+  // A double goes in a0 and a1, the low bits first.
+  double d = 2.5;
+  ASSERT_TRUE(
+      SetReturnValue(GetBasicType(eBasicTypeDouble), &d, sizeof(d)).Success());
+  EXPECT_EQ(DoubleBits(2.5) & UINT32_MAX, ReadRegister("a0"));
+  EXPECT_EQ(DoubleBits(2.5) >> 32, ReadRegister("a1"));
+
+  int64_t ll = -2;
+  ASSERT_TRUE(SetReturnValue(GetBasicType(eBasicTypeLongLong), &ll,
+                             sizeof(ll))
+                  .Success());
+  EXPECT_EQ(0xfffffffeu, ReadRegister("a0"));
+  EXPECT_EQ(0xffffffffu, ReadRegister("a1"));
+}
@@ -0,0 +1,235 @@
+//===-- ProcessGDBRemoteTest.cpp --------------------------------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#include "Plugins/Process/gdb-remote/ProcessGDBRemote.h"
+#include "GDBRemoteTestUtils.h"
+#include "Plugins/ABI/SysV-riscv/ABISysV_riscv.h"
+#include "Plugins/Platform/gdb-server/PlatformRemoteGDBServer.h"
+#include "Utility/RISCV_DWARF_Registers.h"
+#include "lldb/Core/Debugger.h"
+#include "lldb/Core/Listener.h"
+#include "lldb/Host/HostInfo.h"
+#include "lldb/Host/XML.h"
+#include "lldb/Target/Target.h"
+#include "lldb/Utility/ArchSpec.h"
+#include "llvm/ADT/StringExtras.h"
+#include "llvm/Testing/Support/Error.h"
+#include <future>
+
+using namespace lldb_private::process_gdb_remote;
+using namespace lldb_private;
+using namespace lldb;
+using namespace llvm;
+
+namespace {
+
+typedef GDBRemoteCommunication::PacketResult PacketResult;
+
+// A process whose register information can be read without attaching.
+class TestProcess : public ProcessGDBRemote {
+public:
+  TestProcess(TargetSP target_sp, ListenerSP listener_sp)
+      : ProcessGDBRemote(target_sp, listener_sp) {}
+
+  using ProcessGDBRemote::BuildDynamicRegisterInfo;
+
+  const RegisterInfo *GetRegisterInfo(StringRef name) {
+    for (uint32_t i = 0; i < m_register_info.GetNumRegisters(); ++i) {
+      const RegisterInfo *reg_info = m_register_info.GetRegisterInfoAtIndex(i);
+      if (reg_info->name && name == reg_info->name)
+        return reg_info;
+    }
+    return nullptr;
+  }
+};
+
+// The client of a process sends acks until it negotiates no-ack mode, which
+// it does not do here, so the stub has to send them too.
+struct AckingServer : public MockServer {
+  AckingServer() { m_send_acks = true; }
+};
+
+// The registers a riscv64 stub describes, by their psABI names, without DWARF
+// or generic register numbers.
+struct StubRegister {
+  const char *name;
+  unsigned bitsize;
+  const char *set;
+};
+
+const StubRegister g_stub_registers[] = {
+    {"zero", 64, "general"}, {"ra", 64, "general"}, {"sp", 64, "general"},
+    {"fp", 64, "general"},   {"a0", 64, "general"}, {"pc", 64, "general"},
+    {"ft0", 64, "float"},
+};
+
+class ProcessGDBRemoteTest : public GDBRemoteTest {
+public:
+  static void SetUpTestCase() {
+    GDBRemoteTest::SetUpTestCase();
+    HostInfo::Initialize();
+    Debugger::Initialize(nullptr);
+    Platform::SetHostPlatform(
+        platform_gdb_server::PlatformRemoteGDBServer::CreateInstance(true,
+                                                                    nullptr));
+    ABISysV_riscv::Initialize();
+  }
+
+  static void TearDownTestCase() {
+    ABISysV_riscv::Terminate();
+    Platform::SetHostPlatform(PlatformSP());
+    Debugger::Terminate();
+    HostInfo::Terminate();
+    GDBRemoteTest::TearDownTestCase();
+  }
+
+  void SetUp() override {
+    m_debugger_sp = Debugger::CreateInstance();
+    PlatformSP platform_sp;
+    ASSERT_TRUE(m_debugger_sp->GetTargetList()
+                    .CreateTarget(*m_debugger_sp, "",
+                                  ArchSpec("riscv64-unknown-linux-gnu"),
+                                  eLoadDependentsNo, platform_sp, m_target_sp)
+                    .Success());
+    m_process_sp = std::make_shared<TestProcess>(
+        m_target_sp, Listener::MakeListener("ProcessGDBRemoteTest"));
+    ASSERT_THAT_ERROR(Connect(m_process_sp->GetGDBRemote(), m_server),
+                      Succeeded());
+  }
+
+  void TearDown() override {
+    m_process_sp.reset();
+    m_target_sp.reset();
+    Debugger::Destroy(m_debugger_sp);
+  }
+
+protected:
+  // Answers the packets the process sends while it reads the register
+  // information, until it reads past the last register, or has read the
+  // target description.
+  void ServeRegisterInfo(bool target_xml);
+
+  // Checks that the ABI filled in the numbers the stub left out.
+  void CheckRegisterNumbers();
+
+  DebuggerSP m_debugger_sp;
+  TargetSP m_target_sp;
+  std::shared_ptr<TestProcess> m_process_sp;
+  AckingServer m_server;
+};
+
+std::string GetTargetXML() {
+  std::string xml = "<?xml version=\"1.0\"?><target version=\"1.0\">"
+                    "<architecture>riscv:rv64</architecture>"
+                    "<feature name=\"org.gnu.gdb.riscv.cpu\">";
+  for (const StubRegister &reg : g_stub_registers) {
+    if (StringRef(reg.set) == "float")
+      continue;
+    xml += formatv("<reg name=\"{0}\" bitsize=\"{1}\" type=\"int\"/>",
+                   reg.name, reg.bitsize)
+               .str();
+  }
+  xml += "</feature><feature name=\"org.gnu.gdb.riscv.fpu\">";
+  for (const StubRegister &reg : g_stub_registers) {
+    if (StringRef(reg.set) != "float")
+      continue;
+    xml += formatv("<reg name=\"{0}\" bitsize=\"{1}\" type=\"float\"/>",
+                   reg.name, reg.bitsize)
+               .str();
+  }
+  xml += "</feature></target>";
+  return xml;
+}
+
+void ProcessGDBRemoteTest::ServeRegisterInfo(bool target_xml) {
+  StringExtractorGDBRemote request;
+  while (m_server.GetPacket(request) == PacketResult::Success) {
+    StringRef packet = request.GetStringRef();
+    std::string response;
+    bool done = false;
+    unsigned reg_num;
+    if (packet == "qHostInfo") {
+      response = "triple:" + toHex("riscv64-unknown-linux-gnu", true) +
+                 ";ptrsize:8;endian:little;";
+    } else if (packet.startswith("qSupported")) {
+      response = target_xml ? "PacketSize=20000;qXfer:features:read+"
+                            : "PacketSize=20000";
+    } else if (target_xml &&
+               packet.startswith("qXfer:features:read:target.xml:")) {
+      response = "l" + GetTargetXML();
+      done = true;
+    } else if (!target_xml && packet.consume_front("qRegisterInfo") &&
+               !packet.getAsInteger(16, reg_num)) {
+      if (reg_num < array_lengthof(g_stub_registers)) {
+        const StubRegister &reg = g_stub_registers[reg_num];
+        response = formatv("name:{0};bitsize:{1};offset:{2};encoding:{3};"
+                           "format:{4};set:{5};",
+                           reg.name, reg.bitsize, reg_num * 8,
+                           StringRef(reg.set) == "float" ? "ieee754" : "uint",
+                           StringRef(reg.set) == "float" ? "float" : "hex",
+                           reg.set)
+                       .str();
+      } else {
+        response = "E45";
+        done = true;
+      }
+    }
+    // Anything else is not supported by this stub.
+    ASSERT_EQ(PacketResult::Success, m_server.SendPacket(response));
+    if (done)
+      return;
+  }
+  FAIL() << "The register information was not read";
+}
+
+void ProcessGDBRemoteTest::CheckRegisterNumbers() {
+  struct {
+    const char *name;
+    uint32_t dwarf;
+    uint32_t generic;
+  } expected[] = {
+      {"zero", riscv_dwarf::dwarf_x0_riscv, LLDB_INVALID_REGNUM},
+      {"ra", riscv_dwarf::dwarf_x1_riscv, LLDB_REGNUM_GENERIC_RA},
+      {"sp", riscv_dwarf::dwarf_x2_riscv, LLDB_REGNUM_GENERIC_SP},
+      {"fp", riscv_dwarf::dwarf_x8_riscv, LLDB_REGNUM_GENERIC_FP},
+      {"a0", riscv_dwarf::dwarf_x10_riscv, LLDB_REGNUM_GENERIC_ARG1},
+      {"pc", riscv_dwarf::dwarf_pc_riscv, LLDB_REGNUM_GENERIC_PC},
+      {"ft0", riscv_dwarf::dwarf_f0_riscv, LLDB_INVALID_REGNUM},
+  };
+  for (const auto &reg : expected) {
+    SCOPED_TRACE(reg.name);
+    const RegisterInfo *reg_info = m_process_sp->GetRegisterInfo(reg.name);
+    ASSERT_NE(nullptr, reg_info);
+    EXPECT_EQ(reg.dwarf, reg_info->kinds[eRegisterKindDWARF]);
+    EXPECT_EQ(reg.dwarf, reg_info->kinds[eRegisterKindEHFrame]);
+    EXPECT_EQ(reg.generic, reg_info->kinds[eRegisterKindGeneric]);
+  }
+}
+
+} // end anonymous namespace
+
+// "pc" is the name of a register of the ABI, the others are alternate names.
+TEST_F(ProcessGDBRemoteTest, RISCVRegisterInfo) {
+  std::future<void> result = std::async(std::launch::async, [&] {
+    m_process_sp->BuildDynamicRegisterInfo(true);
+  });
+  ServeRegisterInfo(false);
+  result.get();
+  CheckRegisterNumbers();
+}
+
+TEST_F(ProcessGDBRemoteTest, RISCVTargetXML) {
+  if (!XMLDocument::XMLEnabled())
+    return;
+  std::future<void> result = std::async(std::launch::async, [&] {
+    m_process_sp->BuildDynamicRegisterInfo(true);
+  });
+  ServeRegisterInfo(true);
+  result.get();
+  CheckRegisterNumbers();
+}
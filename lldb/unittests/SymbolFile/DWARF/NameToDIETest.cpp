@@ -0,0 +1,89 @@
+//===-- NameToDIETest.cpp ---------------------------------------*- C++ -*-===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "gtest/gtest.h"
+
+#include "Plugins/SymbolFile/DWARF/NameToDIE.h"
+#include "lldb/Utility/DataExtractor.h"
+#include "llvm/Support/raw_ostream.h"
+
+using namespace lldb_private;
+
+TEST(NameToDIETest, EncodeDecode) {
+  NameToDIE foo_index, bar_index;
+  foo_index.Insert(ConstString("foo"), DIERef(0x0, 0x10));
+  foo_index.Insert(ConstString("foo"), DIERef(0x100, 0x110));
+  foo_index.Insert(ConstString("baz"), DIERef(0x0, 0x20));
+  foo_index.Finalize();
+  bar_index.Insert(ConstString("bar"), DIERef(0x100, 0x120));
+  bar_index.Insert(ConstString("baz"), DIERef(0x100, 0x130));
+  bar_index.Finalize();
+
+  NameToDIEStringTable strings;
+  std::string indexes;
+  llvm::raw_string_ostream indexes_stream(indexes);
+  foo_index.Encode(indexes_stream, strings);
+  bar_index.Encode(indexes_stream, strings);
+  EXPECT_EQ(3u, strings.GetSize());
+
+  std::string encoded;
+  llvm::raw_string_ostream encoded_stream(encoded);
+  strings.Encode(encoded_stream);
+  encoded_stream << indexes_stream.str();
+  encoded_stream.flush();
+
+  DataExtractor data(encoded.data(), encoded.size(), lldb::eByteOrderLittle,
+                     sizeof(uint64_t));
+  lldb::offset_t offset = 0;
+  NameToDIEStringTable decoded_strings;
+  NameToDIE decoded_foo_index, decoded_bar_index;
+  ASSERT_TRUE(decoded_strings.Decode(data, &offset));
+  ASSERT_TRUE(decoded_foo_index.Decode(data, &offset, decoded_strings));
+  ASSERT_TRUE(decoded_bar_index.Decode(data, &offset, decoded_strings));
+  EXPECT_EQ(encoded.size(), offset);
+  decoded_foo_index.Finalize();
+  decoded_bar_index.Finalize();
+
+  DIEArray dies;
+  EXPECT_EQ(2u, decoded_foo_index.Find(ConstString("foo"), dies));
+  EXPECT_EQ(1u, decoded_foo_index.Find(ConstString("baz"), dies));
+  EXPECT_EQ(0u, decoded_foo_index.Find(ConstString("bar"), dies));
+  EXPECT_EQ(1u, decoded_bar_index.Find(ConstString("bar"), dies));
+  ASSERT_EQ(4u, dies.size());
+  EXPECT_EQ(0x20u, dies[2].die_offset);
+  EXPECT_EQ(0x100u, dies[3].cu_offset);
+  EXPECT_EQ(0x120u, dies[3].die_offset);
+}
+
+TEST(NameToDIETest, DecodeTruncated) {
+  NameToDIE index;
+  index.Insert(ConstString("foo"), DIERef(0x0, 0x10));
+  index.Finalize();
+
+  NameToDIEStringTable strings;
+  std::string encoded;
+  llvm::raw_string_ostream encoded_stream(encoded);
+  index.Encode(encoded_stream, strings);
+  encoded_stream.flush();
+
+  for (size_t size = 0; size < encoded.size(); ++size) {
+    DataExtractor data(encoded.data(), size, lldb::eByteOrderLittle,
+                       sizeof(uint64_t));
+    lldb::offset_t offset = 0;
+    NameToDIE decoded;
+    EXPECT_FALSE(decoded.Decode(data, &offset, strings));
+  }
+
+  // The names must be in the string table.
+  DataExtractor data(encoded.data(), encoded.size(), lldb::eByteOrderLittle,
+                     sizeof(uint64_t));
+  lldb::offset_t offset = 0;
+  NameToDIE decoded;
+  EXPECT_FALSE(decoded.Decode(data, &offset, NameToDIEStringTable()));
+}
@@ -70,3 +70,22 @@ TEST(TimerTest, CategoryTimes2) {
   EXPECT_LT(0.001, seconds2);
   EXPECT_GT(0.1, seconds2);
 }
+
+TEST(TimerTest, StatisticTimesNested) {
+  auto before = ScopedStatisticTimer::GetTime(TypeCompletionTime);
+  auto other_before = ScopedStatisticTimer::GetTime(DebugInfoIndexTime);
+  {
+    ScopedStatisticTimer t1(TypeCompletionTime);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    // Nested timers of a phase are only counted once.
+    ScopedStatisticTimer t2(TypeCompletionTime);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  double seconds = std::chrono::duration<double>(
+                       ScopedStatisticTimer::GetTime(TypeCompletionTime) -
+                       before)
+                       .count();
+  EXPECT_LT(0.02, seconds);
+  EXPECT_GT(0.2, seconds);
+  EXPECT_EQ(other_before, ScopedStatisticTimer::GetTime(DebugInfoIndexTime));
+}
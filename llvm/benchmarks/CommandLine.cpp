@@ -0,0 +1,42 @@
+#include "benchmark/benchmark.h"
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/Support/CommandLine.h"
+#include "llvm/Support/raw_ostream.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace llvm;
+
+// Model a tool's startup: construct as many options as an LLVM tool links in,
+// then parse a command line. Invocations that pass no flags should not pay
+// for entering every option into the lookup tables.
+static void runStartup(benchmark::State &State, ArrayRef<const char *> Args) {
+  std::vector<std::string> Names;
+  for (int64_t I = 0; I != State.range(0); ++I)
+    Names.push_back("bench-option-" + std::to_string(I));
+
+  for (auto _ : State) {
+    std::vector<std::unique_ptr<cl::opt<bool>>> Options;
+    for (const std::string &Name : Names)
+      Options.push_back(make_unique<cl::opt<bool>>(StringRef(Name), cl::Hidden));
+    cl::ParseCommandLineOptions(Args.size(), Args.data(), StringRef(),
+                                &llvm::nulls());
+    cl::ResetCommandLineParser();
+  }
+  State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+
+static void BM_StartupNoFlags(benchmark::State &State) {
+  const char *Args[] = {"prog", "input.ll"};
+  runStartup(State, Args);
+}
+BENCHMARK(BM_StartupNoFlags)->Arg(1000)->Arg(5000);
+
+static void BM_StartupWithFlag(benchmark::State &State) {
+  const char *Args[] = {"prog", "-bench-option-0", "input.ll"};
+  runStartup(State, Args);
+}
+BENCHMARK(BM_StartupWithFlag)->Arg(1000)->Arg(5000);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,55 @@
+#include "benchmark/benchmark.h"
+#include "llvm/ADT/SmallString.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/FormattedStream.h"
+#include "llvm/Support/Process.h"
+#include "llvm/Support/raw_async_ostream.h"
+#include "llvm/Support/raw_ostream.h"
+
+using namespace llvm;
+
+// Approximate the shape of -S output: many short, column-aligned lines
+// written through a formatted_raw_ostream, as MCAsmStreamer does.
+static void emitAssemblyLike(raw_ostream &OS, int64_t NumLines) {
+  formatted_raw_ostream FOS(OS);
+  for (int64_t I = 0; I != NumLines; ++I) {
+    FOS << "\taddi\ta0, a0, " << I;
+    FOS.PadToColumn(40);
+    FOS << "# line " << I << '\n';
+  }
+}
+
+static void BM_RawFdOstream(benchmark::State &State) {
+  SmallString<64> Path;
+  int FD;
+  if (sys::fs::createTemporaryFile("bench", "s", FD, Path))
+    return State.SkipWithError("cannot create temporary file");
+  for (auto _ : State) {
+    raw_fd_ostream OS(FD, false);
+    OS.seek(0);
+    emitAssemblyLike(OS, State.range(0));
+  }
+  sys::Process::SafelyCloseFileDescriptor(FD);
+  sys::fs::remove(Path);
+  State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+BENCHMARK(BM_RawFdOstream)->Arg(1 << 16)->Arg(1 << 20);
+
+static void BM_RawAsyncOstream(benchmark::State &State) {
+  SmallString<64> Path;
+  int FD;
+  if (sys::fs::createTemporaryFile("bench", "s", FD, Path))
+    return State.SkipWithError("cannot create temporary file");
+  for (auto _ : State) {
+    raw_fd_ostream FOS(FD, false);
+    FOS.seek(0);
+    raw_async_ostream OS(FOS);
+    emitAssemblyLike(OS, State.range(0));
+  }
+  sys::Process::SafelyCloseFileDescriptor(FD);
+  sys::fs::remove(Path);
+  State.SetItemsProcessed(State.iterations() * State.range(0));
+}
+BENCHMARK(BM_RawAsyncOstream)->Arg(1 << 16)->Arg(1 << 20);
+
+BENCHMARK_MAIN();
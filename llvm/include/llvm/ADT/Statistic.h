@@ -52,6 +52,9 @@ public:
   const char *Desc;
   std::atomic<unsigned> Value;
   std::atomic<bool> Initialized;
+  /// The statistic registered before this one. Statistics register on their
+  /// first update by pushing themselves onto a lock-free list.
+  Statistic *NextRegistered;
 
   unsigned getValue() const { return Value.load(std::memory_order_relaxed); }
   const char *getDebugType() const { return DebugType; }
@@ -65,6 +68,7 @@ public:
     Desc = desc;
     Value = 0;
     Initialized = false;
+    NextRegistered = nullptr;
   }
 
   // Allow use of this class as the value itself.
@@ -167,7 +171,8 @@ protected:
 // STATISTIC - A macro to make definition of statistics really simple.  This
 // automatically passes the DEBUG_TYPE of the file into the statistic.
 #define STATISTIC(VARNAME, DESC)                                               \
-  static llvm::Statistic VARNAME = {DEBUG_TYPE, #VARNAME, DESC, {0}, {false}}
+  static llvm::Statistic VARNAME = {                                           \
+      DEBUG_TYPE, #VARNAME, DESC, {0}, {false}, nullptr}
 
 /// Enable the collection and printing of statistics.
 void EnableStatistics(bool PrintOnExit = true);
@@ -25,6 +25,7 @@
 
 namespace llvm {
 
+struct AllocatorStatistics;
 class DiagnosticInfo;
 enum DiagnosticSeverity : char;
 class Function;
@@ -167,6 +168,11 @@ public:
   void enableDebugTypeODRUniquing();
   void disableDebugTypeODRUniquing();
 
+  /// Return the memory used by the bump pointer allocators backing types and
+  /// metadata strings in this context, and the state of the process-wide
+  /// slab cache.
+  AllocatorStatistics getAllocatorStatistics() const;
+
   using InlineAsmDiagHandlerTy = void (*)(const SMDiagnostic&, void *Context,
                                           unsigned LocCookie);
 
@@ -645,6 +645,12 @@ namespace llvm {
 
     void deallocate(void *Ptr) {}
 
+    /// Return the memory used by the general-purpose allocator of this
+    /// context, and the state of the process-wide slab cache.
+    AllocatorStatistics getAllocatorStatistics() const {
+      return Allocator.getStatistics().withSlabCache();
+    }
+
     bool hadError() { return HadError; }
     void reportError(SMLoc L, const Twine &Msg);
     // Unrecoverable error has occurred. Display the best diagnostic we can
@@ -158,6 +158,24 @@ inline StringRef getInstrProfRuntimeHookVarUseFuncName() {
   return "__llvm_profile_runtime_user";
 }
 
+/// Return the name of the variable holding the offset that is added to the
+/// address of every counter when runtime counter relocation is enabled.
+inline StringRef getInstrProfCounterBiasVarName() {
+  return INSTR_PROF_QUOTE(INSTR_PROF_PROFILE_COUNTER_BIAS_VAR);
+}
+
+/// Return the name of the thread local variable holding the offset of the
+/// current thread's copy of the counters when per-thread counters are enabled.
+inline StringRef getInstrProfCounterShardVarName() {
+  return INSTR_PROF_QUOTE(INSTR_PROF_PROFILE_COUNTER_SHARD_VAR);
+}
+
+/// Return the name of the runtime function that allocates the current
+/// thread's copy of the counters and returns its offset.
+inline StringRef getInstrProfCounterShardInitFuncName() {
+  return INSTR_PROF_QUOTE(INSTR_PROF_PROFILE_COUNTER_SHARD_INIT_FUNC);
+}
+
 /// Return the marker used to separate PGO names during serialization.
 inline StringRef getInstrProfNameSeparator() { return "\01"; }
 
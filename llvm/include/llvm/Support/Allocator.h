@@ -8,13 +8,13 @@
 //===----------------------------------------------------------------------===//
 /// \file
 ///
-/// This file defines the MallocAllocator and BumpPtrAllocator interfaces. Both
-/// of these conform to an LLVM "Allocator" concept which consists of an
-/// Allocate method accepting a size and alignment, and a Deallocate accepting
-/// a pointer and size. Further, the LLVM "Allocator" concept has overloads of
-/// Allocate and Deallocate for setting size and alignment based on the final
-/// type. These overloads are typically provided by a base class template \c
-/// AllocatorBase.
+/// This file defines the MallocAllocator, SlabAllocator and BumpPtrAllocator
+/// interfaces, and the process-wide SlabCache. The allocators conform to an
+/// LLVM "Allocator" concept which consists of an Allocate method accepting a
+/// size and alignment, and a Deallocate accepting a pointer and size. Further,
+/// the LLVM "Allocator" concept has overloads of Allocate and Deallocate for
+/// setting size and alignment based on the final type. These overloads are
+/// typically provided by a base class template \c AllocatorBase.
 ///
 //===----------------------------------------------------------------------===//
 
@@ -38,6 +38,8 @@
 
 namespace llvm {
 
+class raw_ostream;
+
 /// CRTP base class providing obvious overloads for the core \c
 /// Allocate() methods of LLVM-style allocators.
 ///
@@ -113,6 +115,112 @@ public:
   void PrintStats() const {}
 };
 
+/// A process-wide cache of the slabs that back bump pointer allocators.
+///
+/// Long-running processes that repeatedly build and throw away large data
+/// structures (ASTs, IR, MC objects) otherwise return every slab to malloc and
+/// fault in fresh memory for the next one. When the cache has a non-zero
+/// capacity, SlabAllocator keeps released slabs here and hands them out again
+/// for requests of the same size. When a released slab does not fit, the least
+/// recently released slabs are freed to make room, so the sizes in use
+/// displace stale ones. The cache is empty and disabled by default.
+///
+/// All members are thread-safe.
+class SlabCache {
+public:
+  struct Statistics {
+    /// Number of slabs and bytes currently held by the cache.
+    size_t CachedSlabs = 0;
+    size_t CachedBytes = 0;
+    /// Slab requests served from the cache, and those that had to allocate.
+    uint64_t Hits = 0;
+    uint64_t Misses = 0;
+    /// Cached slabs freed to make room for more recently released ones.
+    uint64_t Evictions = 0;
+  };
+
+  /// Set the maximum number of bytes the cache may hold. Zero disables caching
+  /// and releases every cached slab.
+  static void setCapacity(size_t Bytes);
+  static size_t getCapacity();
+
+  /// Back slabs of at least the huge page size with transparent huge pages,
+  /// where the host supports them.
+  static void setUseHugePages(bool Enable);
+
+  /// Release every cached slab.
+  static void clear();
+
+  static Statistics getStatistics();
+
+  /// Allocate a slab of \p Size bytes, reusing a cached one if possible.
+  static void *allocate(size_t Size);
+
+  /// Return a slab obtained from allocate() to the cache, or free it if the
+  /// cache is full or disabled.
+  static void deallocate(void *Slab, size_t Size);
+};
+
+/// The default allocator for the slabs of a BumpPtrAllocatorImpl. It behaves
+/// like MallocAllocator unless the process-wide SlabCache has been enabled, in
+/// which case slabs are recycled through it.
+class SlabAllocator : public AllocatorBase<SlabAllocator> {
+public:
+  void Reset() {}
+
+  LLVM_ATTRIBUTE_RETURNS_NONNULL void *Allocate(size_t Size,
+                                                size_t /*Alignment*/) {
+    return SlabCache::allocate(Size);
+  }
+
+  // Pull in base class overloads.
+  using AllocatorBase<SlabAllocator>::Allocate;
+
+  void Deallocate(const void *Ptr, size_t Size) {
+    SlabCache::deallocate(const_cast<void *>(Ptr), Size);
+  }
+
+  // Pull in base class overloads.
+  using AllocatorBase<SlabAllocator>::Deallocate;
+
+  void PrintStats() const {}
+};
+
+/// Memory usage of an allocator that carves client allocations out of larger
+/// slabs.
+struct AllocatorStatistics {
+  /// Number of slabs currently held.
+  size_t NumSlabs = 0;
+  /// Bytes requested by clients.
+  size_t BytesAllocated = 0;
+  /// Bytes obtained for the slabs.
+  size_t TotalMemory = 0;
+
+  /// Bytes lost to alignment, red zones and unused slab tails.
+  size_t getWastedBytes() const {
+    return TotalMemory > BytesAllocated ? TotalMemory - BytesAllocated : 0;
+  }
+
+  /// The process-wide SlabCache, which is shared by all allocators. Only set
+  /// by withSlabCache(), and not summed by operator+=.
+  SlabCache::Statistics CacheStats;
+
+  AllocatorStatistics &operator+=(const AllocatorStatistics &RHS) {
+    NumSlabs += RHS.NumSlabs;
+    BytesAllocated += RHS.BytesAllocated;
+    TotalMemory += RHS.TotalMemory;
+    return *this;
+  }
+
+  /// Record the current statistics of the SlabCache along with these.
+  AllocatorStatistics &withSlabCache() {
+    CacheStats = SlabCache::getStatistics();
+    return *this;
+  }
+
+  void print(raw_ostream &OS) const;
+};
+
 namespace detail {
 
 // We call out to an external function to actually print the message as the
@@ -133,10 +241,10 @@ void printBumpPtrAllocatorStats(unsigned NumSlabs, size_t BytesAllocated,
 /// Note that this also has a threshold for forcing allocations above a certain
 /// size into their own slab.
 ///
-/// The BumpPtrAllocatorImpl template defaults to using a MallocAllocator
-/// object, which wraps malloc, to allocate memory, but it can be changed to
-/// use a custom allocator.
-template <typename AllocatorT = MallocAllocator, size_t SlabSize = 4096,
+/// The BumpPtrAllocatorImpl template defaults to using a SlabAllocator object,
+/// which wraps malloc and the process-wide SlabCache, to allocate memory, but
+/// it can be changed to use a custom allocator.
+template <typename AllocatorT = SlabAllocator, size_t SlabSize = 4096,
           size_t SizeThreshold = SlabSize>
 class BumpPtrAllocatorImpl
     : public AllocatorBase<
@@ -322,6 +430,14 @@ public:
 
   size_t getBytesAllocated() const { return BytesAllocated; }
 
+  AllocatorStatistics getStatistics() const {
+    AllocatorStatistics Stats;
+    Stats.NumSlabs = GetNumSlabs();
+    Stats.BytesAllocated = BytesAllocated;
+    Stats.TotalMemory = getTotalMemory();
+    return Stats;
+  }
+
   void setRedZoneSize(size_t NewSize) {
     RedZoneSize = NewSize;
   }
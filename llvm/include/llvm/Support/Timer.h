@@ -13,7 +13,9 @@
 #include "llvm/ADT/StringMap.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/Support/DataTypes.h"
+#include <atomic>
 #include <cassert>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -74,13 +76,27 @@ public:
 /// when the last timer is destroyed, otherwise it is printed when its
 /// TimerGroup is destroyed.  Timers do not print their information if they are
 /// never started.
+///
+/// A Timer may be started and stopped concurrently from several threads. Each
+/// thread accumulates into its own shard, and the shards are summed when the
+/// timer is reported.  Start and stop calls must be paired on each thread.
 class Timer {
-  TimeRecord Time;          ///< The total time captured.
-  TimeRecord StartTime;     ///< The time startTimer() was last called.
+  /// The timing state of one thread that has used this timer.  It is mostly
+  /// used by the thread that owns it, so its lock is rarely contended; other
+  /// threads take it to sum or clear the shard.
+  struct Shard {
+    mutable std::mutex Lock;
+    uint64_t ThreadID;
+    TimeRecord Time;        ///< The total time captured by this thread.
+    TimeRecord StartTime;   ///< The time startTimer() was last called.
+    bool Running = false;   ///< Is the timer running on this thread?
+    Shard *Next = nullptr;
+  };
+
+  std::atomic<Shard *> Shards{nullptr}; ///< Per-thread state, never shrinks.
   std::string Name;         ///< The name of this time variable.
   std::string Description;  ///< Description of this time variable.
-  bool Running;             ///< Is the timer currently running?
-  bool Triggered;           ///< Has the timer ever been triggered?
+  std::atomic<bool> Triggered{false}; ///< Has the timer ever been triggered?
   TimerGroup *TG = nullptr; ///< The TimerGroup this Timer is in.
 
   Timer **Prev;             ///< Pointer to \p Next of previous timer in group.
@@ -110,15 +126,18 @@ public:
   const std::string &getDescription() const { return Description; }
   bool isInitialized() const { return TG != nullptr; }
 
-  /// Check if the timer is currently running.
-  bool isRunning() const { return Running; }
+  /// Check if the timer is currently running on the calling thread.
+  bool isRunning() const;
 
   /// Check if startTimer() has ever been called on this timer.
-  bool hasTriggered() const { return Triggered; }
+  bool hasTriggered() const {
+    return Triggered.load(std::memory_order_relaxed);
+  }
 
   /// Start the timer running.  Time between calls to startTimer/stopTimer is
   /// counted by the Timer class.  Note that these calls must be correctly
-  /// paired.
+  /// paired.  When the time trace profiler is enabled on the calling thread,
+  /// the interval is also recorded as a section of the trace.
   void startTimer();
 
   /// Stop the timer.
@@ -127,11 +146,18 @@ public:
   /// Clear the timer state.
   void clear();
 
-  /// Return the duration for which this timer has been running.
-  TimeRecord getTotalTime() const { return Time; }
+  /// Return the duration for which this timer has been running, summed over
+  /// all threads.  Time accumulated by other threads is only exact once they
+  /// have stopped the timer.
+  TimeRecord getTotalTime() const;
 
 private:
   friend class TimerGroup;
+
+  /// Return the shard of the calling thread, creating it if needed.
+  Shard &getShard();
+  const Shard *findShard() const;
+  void deleteShards();
 };
 
 /// The TimeRegion class is used as a helper class to call the startTimer() and
@@ -212,7 +238,9 @@ public:
   /// Clear all timers in this group.
   void clear();
 
-  /// This static method prints all timers.
+  /// This static method prints all timers.  With -timers-json they are
+  /// printed as a single JSON object, together with the reports of groups
+  /// destroyed since the last call.
   static void printAll(raw_ostream &OS);
 
   /// Clear out all timers. This is mostly used to disable automatic
@@ -236,6 +264,7 @@ private:
   void removeTimer(Timer &T);
   void prepareToPrintList();
   void PrintQueuedTimers(raw_ostream &OS);
+  const char *printQueuedJSONValues(raw_ostream &OS, const char *delim);
   void printJSONValue(raw_ostream &OS, const PrintRecord &R,
                       const char *suffix, double Value);
 };
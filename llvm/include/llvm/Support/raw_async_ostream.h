@@ -0,0 +1,113 @@
+//===- raw_async_ostream.h - raw_ostream with a background writer -*- C++ -*-=//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+//  This file defines the raw_async_ostream class.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_SUPPORT_RAW_ASYNC_OSTREAM_H
+#define LLVM_SUPPORT_RAW_ASYNC_OSTREAM_H
+
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/StringRef.h"
+#include "llvm/Config/llvm-config.h"
+#include "llvm/Support/raw_ostream.h"
+#include "llvm/Support/thread.h"
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+
+namespace llvm {
+
+/// A raw_pwrite_stream that accumulates output in a set of large buffers and
+/// hands full buffers to a background thread, which writes them to an
+/// underlying raw_fd_ostream. While one buffer is being written the producer
+/// keeps filling another, so formatting and file I/O overlap. When several
+/// buffers are ready at once the writer flushes them with a single vectored
+/// write.
+///
+/// Clients that install their own buffering on top of this stream (such as
+/// formatted_raw_ostream) still get asynchronous writes; their flushed data is
+/// copied into the current buffer.
+///
+/// The underlying stream must not be used directly while this stream is alive.
+/// Its error state is only meaningful after this stream has been destroyed or
+/// drained, at which point all output has reached the file descriptor.
+///
+/// When LLVM is built without thread support the buffers are written
+/// synchronously.
+class raw_async_ostream : public raw_pwrite_stream {
+  raw_fd_ostream &OS;
+  size_t BufferSize;
+  unsigned NumBuffers;
+  std::unique_ptr<char[]> Storage;
+
+  /// Bytes handed to write_impl so far, including the initial position of the
+  /// underlying stream.
+  uint64_t Pos;
+
+  /// Whether the underlying stream was buffered before we took it over.
+  bool RestoreBuffering;
+
+  /// The buffer currently being filled and the number of bytes in it. When
+  /// raw_ostream's own buffer is the unused tail of this buffer, output is
+  /// formatted directly into it without an extra copy.
+  char *CurBuf;
+  size_t CurLen = 0;
+
+  /// Hand the current buffer to the writer and start filling a free one.
+  void submit();
+
+#if LLVM_ENABLE_THREADS
+  std::mutex Lock;
+  std::condition_variable QueueCondition;
+  std::condition_variable CompletionCondition;
+
+  /// Buffers that the producer may fill. Guarded by Lock.
+  SmallVector<char *, 4> FreeBuffers;
+
+  /// Filled buffers waiting for the writer thread. Guarded by Lock.
+  SmallVector<StringRef, 4> PendingChunks;
+
+  /// Set when the writer thread should exit. Guarded by Lock.
+  bool Done = false;
+
+  llvm::thread Writer;
+
+  void writerLoop();
+#endif
+
+  /// See raw_ostream::write_impl.
+  void write_impl(const char *Ptr, size_t Size) override;
+
+  void pwrite_impl(const char *Ptr, size_t Size, uint64_t Offset) override;
+
+  /// Return the current position within the stream, not counting the bytes
+  /// currently in the buffer.
+  uint64_t current_pos() const override { return Pos; }
+
+public:
+  /// Construct a stream writing to \p OS through \p NumBuffers buffers of
+  /// \p BufferSize bytes each. \p OS is flushed and made unbuffered for the
+  /// lifetime of this stream since this stream does its own buffering.
+  explicit raw_async_ostream(raw_fd_ostream &OS,
+                             size_t BufferSize = 1024 * 1024,
+                             unsigned NumBuffers = 2);
+
+  /// Flushes and drains the stream, then stops the writer thread.
+  ~raw_async_ostream() override;
+
+  /// Flush the stream and wait until every byte written so far has been
+  /// written to the underlying stream.
+  void drain();
+};
+
+} // end namespace llvm
+
+#endif // LLVM_SUPPORT_RAW_ASYNC_OSTREAM_H
@@ -14,6 +14,7 @@
 #ifndef LLVM_SUPPORT_RAW_OSTREAM_H
 #define LLVM_SUPPORT_RAW_OSTREAM_H
 
+#include "llvm/ADT/ArrayRef.h"
 #include "llvm/ADT/SmallVector.h"
 #include "llvm/ADT/StringRef.h"
 #include <cassert>
@@ -433,6 +434,11 @@ public:
   /// to the offset specified from the beginning of the file.
   uint64_t seek(uint64_t off);
 
+  /// Flushes the stream and writes each of \p Chunks, in order, directly to the
+  /// file descriptor. Where the platform supports it the chunks are written
+  /// with a single vectored write rather than one write per chunk.
+  void writev(ArrayRef<StringRef> Chunks);
+
   raw_ostream &changeColor(enum Colors colors, bool bold=false,
                            bool bg=false) override;
   raw_ostream &resetColor() override;
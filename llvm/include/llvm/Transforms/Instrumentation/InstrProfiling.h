@@ -64,6 +64,11 @@ private:
   // vector of counter load/store pairs to be register promoted.
   std::vector<LoadStorePair> PromotionCandidates;
 
+  // The offset added to the counter addresses in the function being lowered:
+  // the load of the counter bias if runtime counter relocation is enabled, or
+  // the offset of the current thread's counters if per-thread counters are.
+  Value *CounterBias = nullptr;
+
   // The start value of precise value profile range for memory intrinsic sizes.
   int64_t MemOPSizeRangeStart;
   // The end value of precise value profile range for memory intrinsic sizes.
@@ -81,6 +86,18 @@ private:
   /// Returns true if profile counter update register promotion is enabled.
   bool isCounterPromotionEnabled() const;
 
+  /// Returns true if the counters are accessed through a bias that the
+  /// runtime can set, e.g. to move them into a memory mapped file.
+  bool isRuntimeCounterRelocationEnabled() const;
+
+  /// Returns true if every thread updates its own copy of the counters, which
+  /// the runtime adds up when the profile is written.
+  bool isPerThreadCountersEnabled() const;
+
+  /// Load the offset of the current thread's counters at the start of \p F,
+  /// calling into the runtime to set them up on the thread's first visit.
+  void emitCounterShardOffset(Function *F);
+
   /// Count the number of instrumented value sites for the function.
   void computeNumValueSiteCounts(InstrProfValueProfileInst *Ins);
 
@@ -90,6 +107,9 @@ private:
   /// Replace instrprof_increment with an increment of the appropriate value.
   void lowerIncrement(InstrProfIncrementInst *Inc);
 
+  /// Compute the address of the counter updated by \p Inc.
+  Value *getCounterAddress(InstrProfIncrementInst *Inc);
+
   /// Force emitting of name vars for unused functions.
   void lowerCoverageData(GlobalVariable *CoverageNamesVar);
 
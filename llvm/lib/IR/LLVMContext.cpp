@@ -319,6 +319,12 @@ bool LLVMContext::shouldDiscardValueNames() const {
 
 bool LLVMContext::isODRUniquingDebugTypes() const { return !!pImpl->DITypeMap; }
 
+AllocatorStatistics LLVMContext::getAllocatorStatistics() const {
+  AllocatorStatistics Stats = pImpl->TypeAllocator.getStatistics();
+  Stats += pImpl->MDStringCache.getAllocator().getStatistics();
+  return Stats.withSlabCache();
+}
+
 void LLVMContext::enableDebugTypeODRUniquing() {
   if (pImpl->DITypeMap)
     return;
@@ -7,12 +7,20 @@
 //
 //===----------------------------------------------------------------------===//
 //
-// This file implements the BumpPtrAllocator interface.
+// This file implements the BumpPtrAllocator interface and the SlabCache.
 //
 //===----------------------------------------------------------------------===//
 
 #include "llvm/Support/Allocator.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/Support/ManagedStatic.h"
 #include "llvm/Support/raw_ostream.h"
+#include <atomic>
+#include <mutex>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
 
 namespace llvm {
 
@@ -20,15 +28,27 @@ namespace detail {
 
 void printBumpPtrAllocatorStats(unsigned NumSlabs, size_t BytesAllocated,
                                 size_t TotalMemory) {
-  errs() << "\nNumber of memory regions: " << NumSlabs << '\n'
-         << "Bytes used: " << BytesAllocated << '\n'
-         << "Bytes allocated: " << TotalMemory << '\n'
-         << "Bytes wasted: " << (TotalMemory - BytesAllocated)
-         << " (includes alignment, etc)\n";
+  AllocatorStatistics Stats;
+  Stats.NumSlabs = NumSlabs;
+  Stats.BytesAllocated = BytesAllocated;
+  Stats.TotalMemory = TotalMemory;
+  Stats.print(errs());
 }
 
 } // End namespace detail.
 
+void AllocatorStatistics::print(raw_ostream &OS) const {
+  OS << "\nNumber of memory regions: " << NumSlabs << '\n'
+     << "Bytes used: " << BytesAllocated << '\n'
+     << "Bytes allocated: " << TotalMemory << '\n'
+     << "Bytes wasted: " << getWastedBytes() << " (includes alignment, etc)\n";
+  if (CacheStats.Hits || CacheStats.Misses || CacheStats.CachedSlabs)
+    OS << "Slab cache: " << CacheStats.CachedSlabs << " slabs, "
+       << CacheStats.CachedBytes << " bytes, " << CacheStats.Hits << " hits, "
+       << CacheStats.Misses << " misses, " << CacheStats.Evictions
+       << " evictions\n";
+}
+
 void PrintRecyclerStats(size_t Size,
                         size_t Align,
                         size_t FreeListSize) {
@@ -37,4 +57,146 @@ void PrintRecyclerStats(size_t Size,
          << "Number of elements free for recycling: " << FreeListSize << '\n';
 }
 
+//===----------------------------------------------------------------------===//
+// SlabCache
+//===----------------------------------------------------------------------===//
+
+// These are read on every slab allocation, so keep them out of the cache
+// state; reading them never constructs the ManagedStatic below.
+static std::atomic<size_t> SlabCacheCapacity(0);
+static std::atomic<bool> SlabCacheUseHugePages(false);
+
+/// Transparent huge pages are 2MB on the hosts that support madvise hints.
+static const size_t HugePageSize = 2 * 1024 * 1024;
+
+namespace {
+
+struct SlabCacheState {
+  /// A released slab and when it was released, to evict the oldest first.
+  struct CachedSlab {
+    uint64_t Stamp;
+    void *Slab;
+  };
+
+  std::mutex Lock;
+  /// The cached slabs of each size, oldest first.
+  DenseMap<size_t, SmallVector<CachedSlab, 4>> FreeSlabs;
+  uint64_t NextStamp = 0;
+  SlabCache::Statistics Stats;
+
+  ~SlabCacheState() {
+    // Slabs released after llvm_shutdown go straight back to malloc.
+    SlabCacheCapacity.store(0, std::memory_order_relaxed);
+    releaseAll();
+  }
+
+  void releaseAll() {
+    for (auto &Entry : FreeSlabs)
+      for (const CachedSlab &C : Entry.second)
+        free(C.Slab);
+    FreeSlabs.clear();
+    Stats.CachedSlabs = 0;
+    Stats.CachedBytes = 0;
+  }
+
+  /// Free the least recently released slab of any size.  Slab sizes differ
+  /// between allocators, so this lets the sizes in use displace stale ones.
+  void evictOldest() {
+    auto Oldest = FreeSlabs.end();
+    for (auto I = FreeSlabs.begin(), E = FreeSlabs.end(); I != E; ++I) {
+      if (I->second.empty())
+        continue;
+      if (Oldest == E ||
+          I->second.front().Stamp < Oldest->second.front().Stamp)
+        Oldest = I;
+    }
+    assert(Oldest != FreeSlabs.end() && "Evicting from an empty cache");
+    free(Oldest->second.front().Slab);
+    Oldest->second.erase(Oldest->second.begin());
+    --Stats.CachedSlabs;
+    Stats.CachedBytes -= Oldest->first;
+    ++Stats.Evictions;
+  }
+};
+
+} // end anonymous namespace
+
+static ManagedStatic<SlabCacheState> SlabCacheStorage;
+
+static void *allocateFreshSlab(size_t Size) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  if (Size >= HugePageSize &&
+      SlabCacheUseHugePages.load(std::memory_order_relaxed)) {
+    // Huge pages must be naturally aligned for the kernel to use them.  Only
+    // advise the huge pages that lie entirely within the allocation.
+    void *Slab = nullptr;
+    if (posix_memalign(&Slab, HugePageSize, Size) == 0) {
+      ::madvise(Slab, alignDown(Size, HugePageSize), MADV_HUGEPAGE);
+      return Slab;
+    }
+  }
+#endif
+  return safe_malloc(Size);
+}
+
+void SlabCache::setCapacity(size_t Bytes) {
+  SlabCacheCapacity.store(Bytes, std::memory_order_relaxed);
+  if (Bytes == 0)
+    clear();
+}
+
+size_t SlabCache::getCapacity() {
+  return SlabCacheCapacity.load(std::memory_order_relaxed);
+}
+
+void SlabCache::setUseHugePages(bool Enable) {
+  SlabCacheUseHugePages.store(Enable, std::memory_order_relaxed);
+}
+
+void SlabCache::clear() {
+  SlabCacheState &State = *SlabCacheStorage;
+  std::lock_guard<std::mutex> Guard(State.Lock);
+  State.releaseAll();
+}
+
+SlabCache::Statistics SlabCache::getStatistics() {
+  SlabCacheState &State = *SlabCacheStorage;
+  std::lock_guard<std::mutex> Guard(State.Lock);
+  return State.Stats;
+}
+
+void *SlabCache::allocate(size_t Size) {
+  if (SlabCacheCapacity.load(std::memory_order_relaxed) == 0)
+    return allocateFreshSlab(Size);
+
+  SlabCacheState &State = *SlabCacheStorage;
+  {
+    std::lock_guard<std::mutex> Guard(State.Lock);
+    auto I = State.FreeSlabs.find(Size);
+    if (I != State.FreeSlabs.end() && !I->second.empty()) {
+      ++State.Stats.Hits;
+      --State.Stats.CachedSlabs;
+      State.Stats.CachedBytes -= Size;
+      return I->second.pop_back_val().Slab;
+    }
+    ++State.Stats.Misses;
+  }
+  return allocateFreshSlab(Size);
+}
+
+void SlabCache::deallocate(void *Slab, size_t Size) {
+  size_t Capacity = SlabCacheCapacity.load(std::memory_order_relaxed);
+  if (Size <= Capacity) {
+    SlabCacheState &State = *SlabCacheStorage;
+    std::lock_guard<std::mutex> Guard(State.Lock);
+    while (State.Stats.CachedBytes + Size > Capacity)
+      State.evictOldest();
+    State.FreeSlabs[Size].push_back({State.NextStamp++, Slab});
+    ++State.Stats.CachedSlabs;
+    State.Stats.CachedBytes += Size;
+    return;
+  }
+  free(Slab);
+}
+
 }
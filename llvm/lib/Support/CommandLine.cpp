@@ -187,6 +187,20 @@ public:
   }
 
   void addOption(Option *O) {
+    // Named options that take part in parsing only when they are spelled on
+    // the command line are not entered into the option maps until something
+    // needs to look them up. Tools run thousands of these constructors before
+    // main, and many invocations never parse a flag.
+    if (O->hasArgStr() && !O->isPositional() && !O->isSink() &&
+        !O->isConsumeAfter() && O->getNumOccurrencesFlag() != cl::Required &&
+        O->getNumOccurrencesFlag() != cl::OneOrMore) {
+      PendingOptions.push_back(O);
+      return;
+    }
+    registerOption(O);
+  }
+
+  void registerOption(Option *O) {
     if (O->Subs.empty()) {
       addOption(O, &*TopLevelSubCommand);
     } else {
@@ -225,6 +239,7 @@ public:
   }
 
   void removeOption(Option *O) {
+    registerPendingOptions();
     if (O->Subs.empty())
       removeOption(O, &*TopLevelSubCommand);
     else {
@@ -244,6 +259,8 @@ public:
   }
 
   bool hasOptions() const {
+    if (!PendingOptions.empty())
+      return true;
     for (const auto &S : RegisteredSubCommands) {
       if (hasOptions(*S))
         return true;
@@ -264,6 +281,7 @@ public:
   }
 
   void updateArgStr(Option *O, StringRef NewName) {
+    registerPendingOptions();
     if (O->Subs.empty())
       updateArgStr(O, NewName, &*TopLevelSubCommand);
     else {
@@ -317,6 +335,16 @@ public:
                       RegisteredSubCommands.end());
   }
 
+  /// Enter every option whose registration was deferred by addOption into the
+  /// option maps. This must be called before anything reads the maps.
+  void registerPendingOptions() {
+    if (PendingOptions.empty())
+      return;
+    for (Option *O : PendingOptions)
+      registerOption(O);
+    PendingOptions.clear();
+  }
+
   void reset() {
     ActiveSubCommand = nullptr;
     ProgramName.clear();
@@ -327,6 +355,7 @@ public:
 
     ResetAllOptionOccurrences();
     RegisteredSubCommands.clear();
+    PendingOptions.clear();
 
     TopLevelSubCommand->reset();
     AllSubCommands->reset();
@@ -337,6 +366,9 @@ public:
 private:
   SubCommand *ActiveSubCommand;
 
+  // Options whose registration has been deferred, in construction order.
+  std::vector<Option *> PendingOptions;
+
   Option *LookupOption(SubCommand &Sub, StringRef &Arg, StringRef &Value);
   SubCommand *LookupSubCommand(StringRef Name);
 };
@@ -1069,6 +1101,8 @@ bool cl::ParseCommandLineOptions(int argc, const char *const *argv,
 void CommandLineParser::ResetAllOptionOccurrences() {
   // So that we can parse different command lines multiple times in succession
   // we reset all option values to look like they have never been seen before.
+  for (Option *O : PendingOptions)
+    O->reset();
   for (auto SC : RegisteredSubCommands) {
     for (auto &O : SC->OptionsMap)
       O.second->reset();
@@ -1092,6 +1126,12 @@ bool CommandLineParser::ParseCommandLineOptions(int argc,
   argv = &newArgv[0];
   argc = static_cast<int>(newArgv.size());
 
+  // Deferred options only need to be registered if some argument may name
+  // one. Positional arguments and required options were registered eagerly.
+  if (std::any_of(argv + 1, argv + argc,
+                  [](const char *Arg) { return Arg[0] == '-'; }))
+    registerPendingOptions();
+
   // Copy the program name into ProgName, making sure not to overflow it.
   ProgramName = sys::path::filename(StringRef(argv[0]));
 
@@ -1842,6 +1882,7 @@ public:
   }
 
   void printHelp() {
+    GlobalParser->registerPendingOptions();
     SubCommand *Sub = GlobalParser->getActiveSubCommand();
     auto &OptionsMap = Sub->OptionsMap;
     auto &PositionalOpts = Sub->PositionalOpts;
@@ -2096,6 +2137,8 @@ void CommandLineParser::printOptionValues() {
   if (!PrintOptions && !PrintAllOptions)
     return;
 
+  registerPendingOptions();
+
   SmallVector<std::pair<const char *, Option *>, 128> Opts;
   sortOpts(ActiveSubCommand->OptionsMap, Opts, /*ShowHidden*/ true);
 
@@ -2201,6 +2244,7 @@ void cl::AddExtraVersionPrinter(VersionPrinterTy func) {
 }
 
 StringMap<Option *> &cl::getRegisteredOptions(SubCommand &Sub) {
+  GlobalParser->registerPendingOptions();
   auto &Subs = GlobalParser->RegisteredSubCommands;
   (void)Subs;
   assert(is_contained(Subs, &Sub));
@@ -2213,6 +2257,7 @@ cl::getRegisteredSubcommands() {
 }
 
 void cl::HideUnrelatedOptions(cl::OptionCategory &Category, SubCommand &Sub) {
+  GlobalParser->registerPendingOptions();
   for (auto &I : Sub.OptionsMap) {
     if (I.second->Category != &Category &&
         I.second->Category != &GenericCategory)
@@ -2222,6 +2267,7 @@ void cl::HideUnrelatedOptions(cl::OptionCategory &Category, SubCommand &Sub) {
 
 void cl::HideUnrelatedOptions(ArrayRef<const cl::OptionCategory *> Categories,
                               SubCommand &Sub) {
+  GlobalParser->registerPendingOptions();
   auto CategoriesBegin = Categories.begin();
   auto CategoriesEnd = Categories.end();
   for (auto &I : Sub.OptionsMap) {
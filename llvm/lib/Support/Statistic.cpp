@@ -58,23 +58,22 @@ namespace {
 /// This class is also used to look up statistic values from applications that
 /// use LLVM.
 class StatisticInfo {
+  /// A snapshot of the registered statistics, taken by update().
   std::vector<Statistic*> Stats;
 
   friend void llvm::PrintStatistics();
   friend void llvm::PrintStatistics(raw_ostream &OS);
   friend void llvm::PrintStatisticsJSON(raw_ostream &OS);
 
-  /// Sort statistics by debugtype,name,description.
-  void sort();
 public:
   using const_iterator = std::vector<Statistic *>::const_iterator;
 
   StatisticInfo();
   ~StatisticInfo();
 
-  void addStatistic(Statistic *S) {
-    Stats.push_back(S);
-  }
+  /// Refresh the snapshot from the list of registered statistics and sort it
+  /// by debugtype,name,description. Must be called with StatLock held.
+  void update();
 
   const_iterator begin() const { return Stats.begin(); }
   const_iterator end() const { return Stats.end(); }
@@ -89,30 +88,31 @@ public:
 static ManagedStatic<StatisticInfo> StatInfo;
 static ManagedStatic<sys::SmartMutex<true> > StatLock;
 
+/// The most recently registered statistic. Registration pushes onto this list
+/// without a lock, so threads bumping different statistics for the first time
+/// never wait on each other. The list is only walked, and only cleared, with
+/// StatLock held.
+static std::atomic<Statistic *> RegisteredStats(nullptr);
+
 /// RegisterStatistic - The first time a statistic is bumped, this method is
 /// called.
 void Statistic::RegisterStatistic() {
-  // If stats are enabled, inform StatInfo that this statistic should be
-  // printed.
-  // llvm_shutdown calls destructors while holding the ManagedStatic mutex.
-  // These destructors end up calling PrintStatistics, which takes StatLock.
-  // Since dereferencing StatInfo and StatLock can require taking the
-  // ManagedStatic mutex, doing so with StatLock held would lead to a lock
-  // order inversion. To avoid that, we dereference the ManagedStatics first,
-  // and only take StatLock afterwards.
-  if (!Initialized.load(std::memory_order_relaxed)) {
-    sys::SmartMutex<true> &Lock = *StatLock;
-    StatisticInfo &SI = *StatInfo;
-    sys::SmartScopedLock<true> Writer(Lock);
-    // Check Initialized again after acquiring the lock.
-    if (Initialized.load(std::memory_order_relaxed))
-      return;
-    if (Stats || Enabled)
-      SI.addStatistic(this);
-
-    // Remember we have been registered.
-    Initialized.store(true, std::memory_order_release);
-  }
+  // Make sure StatInfo exists so that its destructor prints the statistics.
+  // This only takes the ManagedStatic mutex the first time it is called.
+  (void)*StatInfo;
+
+  // Exactly one thread gets to register this statistic.
+  if (Initialized.exchange(true, std::memory_order_acq_rel))
+    return;
+
+  // If stats are enabled, add this statistic to the list to be printed.
+  if (!Stats && !Enabled)
+    return;
+  Statistic *Head = RegisteredStats.load(std::memory_order_relaxed);
+  do {
+    NextRegistered = Head;
+  } while (!RegisteredStats.compare_exchange_weak(
+      Head, this, std::memory_order_release, std::memory_order_relaxed));
 }
 
 StatisticInfo::StatisticInfo() {
@@ -135,7 +135,12 @@ bool llvm::AreStatisticsEnabled() {
   return Enabled || Stats;
 }
 
-void StatisticInfo::sort() {
+void StatisticInfo::update() {
+  Stats.clear();
+  for (Statistic *S = RegisteredStats.load(std::memory_order_acquire); S;
+       S = S->NextRegistered)
+    Stats.push_back(S);
+
   std::stable_sort(Stats.begin(), Stats.end(),
                    [](const Statistic *LHS, const Statistic *RHS) {
     if (int Cmp = std::strcmp(LHS->getDebugType(), RHS->getDebugType()))
@@ -151,27 +156,30 @@ void StatisticInfo::sort() {
 void StatisticInfo::reset() {
   sys::SmartScopedLock<true> Writer(*StatLock);
 
-  // Tell each statistic that it isn't registered so it has to register
-  // again. We're holding the lock so it won't be able to do so until we're
-  // finished. Once we've forced it to re-register (after we return), then zero
-  // the value.
-  for (auto *Stat : Stats) {
+  // Detach the registration list. Statistics that register from now on start
+  // a new list. Any pending updates from other threads will safely take effect
+  // after we return. That might not be what the user wants if they're
+  // measuring a compilation but it's their responsibility to prevent concurrent
+  // compilations to make a single compilation measurable.
+  Statistic *Stat = RegisteredStats.exchange(nullptr, std::memory_order_acquire);
+  while (Stat) {
+    // Read the link first; once Initialized is cleared another thread may
+    // register the statistic again and overwrite it.
+    Statistic *Next = Stat->NextRegistered;
     // Value updates to a statistic that complete before this statement in the
     // iteration for that statistic will be lost as intended.
-    Stat->Initialized = false;
     Stat->Value = 0;
+    // Tell the statistic that it isn't registered so it has to register again.
+    Stat->Initialized = false;
+    Stat = Next;
   }
-
-  // Clear the registration list and release the lock once we're done. Any
-  // pending updates from other threads will safely take effect after we return.
-  // That might not be what the user wants if they're measuring a compilation
-  // but it's their responsibility to prevent concurrent compilations to make
-  // a single compilation measurable.
   Stats.clear();
 }
 
 void llvm::PrintStatistics(raw_ostream &OS) {
   StatisticInfo &Stats = *StatInfo;
+  sys::SmartScopedLock<true> Reader(*StatLock);
+  Stats.update();
 
   // Figure out how long the biggest Value and Name fields are.
   unsigned MaxDebugTypeLen = 0, MaxValLen = 0;
@@ -182,8 +190,6 @@ void llvm::PrintStatistics(raw_ostream &OS) {
                          (unsigned)std::strlen(Stats.Stats[i]->getDebugType()));
   }
 
-  Stats.sort();
-
   // Print out the statistics header...
   OS << "===" << std::string(73, '-') << "===\n"
      << "                          ... Statistics Collected ...\n"
@@ -204,7 +210,7 @@ void llvm::PrintStatisticsJSON(raw_ostream &OS) {
   sys::SmartScopedLock<true> Reader(*StatLock);
   StatisticInfo &Stats = *StatInfo;
 
-  Stats.sort();
+  Stats.update();
 
   // Print all of the statistics.
   OS << "{\n";
@@ -229,10 +235,9 @@ void llvm::PrintStatisticsJSON(raw_ostream &OS) {
 void llvm::PrintStatistics() {
 #if LLVM_ENABLE_STATS
   sys::SmartScopedLock<true> Reader(*StatLock);
-  StatisticInfo &Stats = *StatInfo;
 
   // Statistics not enabled?
-  if (Stats.Stats.empty()) return;
+  if (!RegisteredStats.load(std::memory_order_acquire)) return;
 
   // Get the stream to write to.
   std::unique_ptr<raw_ostream> OutStream = CreateInfoOutputFile();
@@ -258,6 +263,7 @@ const std::vector<std::pair<StringRef, unsigned>> llvm::GetStatistics() {
   sys::SmartScopedLock<true> Reader(*StatLock);
   std::vector<std::pair<StringRef, unsigned>> ReturnStats;
 
+  StatInfo->update();
   for (const auto &Stat : StatInfo->statistics())
     ReturnStats.emplace_back(Stat->getName(), Stat->getValue());
   return ReturnStats;
@@ -20,6 +20,8 @@
 #include "llvm/Support/ManagedStatic.h"
 #include "llvm/Support/Mutex.h"
 #include "llvm/Support/Process.h"
+#include "llvm/Support/Threading.h"
+#include "llvm/Support/TimeProfiler.h"
 #include "llvm/Support/YAMLTraits.h"
 #include "llvm/Support/raw_ostream.h"
 #include <limits>
@@ -50,6 +52,10 @@ namespace {
   InfoOutputFilename("info-output-file", cl::value_desc("filename"),
                      cl::desc("File to append -stats and -timer output to"),
                    cl::Hidden, cl::location(getLibSupportInfoOutputFilename()));
+
+  static cl::opt<bool>
+  TimersAsJSON("timers-json", cl::desc("Display timer reports as json data"),
+               cl::Hidden);
 }
 
 std::unique_ptr<raw_fd_ostream> llvm::CreateInfoOutputFile() {
@@ -84,6 +90,14 @@ struct CreateDefaultTimerGroup {
 static ManagedStatic<TimerGroup, CreateDefaultTimerGroup> DefaultTimerGroup;
 static TimerGroup *getDefaultTimerGroup() { return &*DefaultTimerGroup; }
 
+/// get_threadid() may be a system call, so remember it for each thread.
+static uint64_t getCurrentThreadID() {
+  static LLVM_THREAD_LOCAL uint64_t ThreadID = 0;
+  if (!ThreadID)
+    ThreadID = get_threadid();
+  return ThreadID;
+}
+
 //===----------------------------------------------------------------------===//
 // Timer Implementation
 //===----------------------------------------------------------------------===//
@@ -96,14 +110,67 @@ void Timer::init(StringRef Name, StringRef Description, TimerGroup &tg) {
   assert(!TG && "Timer already initialized");
   this->Name.assign(Name.begin(), Name.end());
   this->Description.assign(Description.begin(), Description.end());
-  Running = Triggered = false;
+  Triggered = false;
   TG = &tg;
   TG->addTimer(*this);
 }
 
 Timer::~Timer() {
-  if (!TG) return;  // Never initialized, or already cleared.
-  TG->removeTimer(*this);
+  if (TG)
+    TG->removeTimer(*this);
+  deleteShards();
+}
+
+Timer::Shard &Timer::getShard() {
+  uint64_t ThreadID = getCurrentThreadID();
+  Shard *Head = Shards.load(std::memory_order_acquire);
+  for (Shard *S = Head; S; S = S->Next)
+    if (S->ThreadID == ThreadID)
+      return *S;
+
+  // Only this thread can add a shard for itself, so losing the race below
+  // just means some other thread got in first.
+  Shard *S = new Shard();
+  S->ThreadID = ThreadID;
+  S->Next = Head;
+  while (!Shards.compare_exchange_weak(S->Next, S, std::memory_order_release,
+                                       std::memory_order_acquire)) {
+  }
+  return *S;
+}
+
+const Timer::Shard *Timer::findShard() const {
+  uint64_t ThreadID = getCurrentThreadID();
+  for (Shard *S = Shards.load(std::memory_order_acquire); S; S = S->Next)
+    if (S->ThreadID == ThreadID)
+      return S;
+  return nullptr;
+}
+
+void Timer::deleteShards() {
+  Shard *S = Shards.exchange(nullptr, std::memory_order_acquire);
+  while (S) {
+    Shard *Next = S->Next;
+    delete S;
+    S = Next;
+  }
+}
+
+bool Timer::isRunning() const {
+  const Shard *S = findShard();
+  if (!S)
+    return false;
+  std::lock_guard<std::mutex> L(S->Lock);
+  return S->Running;
+}
+
+TimeRecord Timer::getTotalTime() const {
+  TimeRecord Total;
+  for (Shard *S = Shards.load(std::memory_order_acquire); S; S = S->Next) {
+    std::lock_guard<std::mutex> L(S->Lock);
+    Total += S->Time;
+  }
+  return Total;
 }
 
 static inline size_t getMemUsage() {
@@ -132,21 +199,41 @@ TimeRecord TimeRecord::getCurrentTime(bool Start) {
 }
 
 void Timer::startTimer() {
-  assert(!Running && "Cannot start a running timer");
-  Running = Triggered = true;
-  StartTime = TimeRecord::getCurrentTime(true);
+  Shard &S = getShard();
+  if (!Triggered.load(std::memory_order_relaxed))
+    Triggered.store(true, std::memory_order_relaxed);
+  TimeRecord Now = TimeRecord::getCurrentTime(true);
+  {
+    std::lock_guard<std::mutex> L(S.Lock);
+    assert(!S.Running && "Cannot start a running timer");
+    S.Running = true;
+    S.StartTime = Now;
+  }
+  if (timeTraceProfilerEnabled())
+    timeTraceProfilerBegin(Description, StringRef(TG->Name));
 }
 
 void Timer::stopTimer() {
-  assert(Running && "Cannot stop a paused timer");
-  Running = false;
-  Time += TimeRecord::getCurrentTime(false);
-  Time -= StartTime;
+  Shard &S = getShard();
+  TimeRecord Elapsed = TimeRecord::getCurrentTime(false);
+  {
+    std::lock_guard<std::mutex> L(S.Lock);
+    assert(S.Running && "Cannot stop a paused timer");
+    S.Running = false;
+    Elapsed -= S.StartTime;
+    S.Time += Elapsed;
+  }
+  if (timeTraceProfilerEnabled())
+    timeTraceProfilerEnd();
 }
 
 void Timer::clear() {
-  Running = Triggered = false;
-  Time = StartTime = TimeRecord();
+  Triggered = false;
+  for (Shard *S = Shards.load(std::memory_order_acquire); S; S = S->Next) {
+    std::lock_guard<std::mutex> L(S->Lock);
+    S->Running = false;
+    S->Time = S->StartTime = TimeRecord();
+  }
 }
 
 static void printVal(double Val, double Total, raw_ostream &OS) {
@@ -224,6 +311,31 @@ NamedRegionTimer::NamedRegionTimer(StringRef Name, StringRef Description,
 /// ctor/dtor and is protected by the TimerLock lock.
 static TimerGroup *TimerGroupList = nullptr;
 
+/// Set once llvm_shutdown has printed the pending JSON reports; groups
+/// destroyed after that print their own object.
+static bool PendingJSONFlushed = false;
+
+namespace {
+/// With -timers-json, the reports of groups destroyed before the end are
+/// held here, so that they are printed as one JSON object by the next
+/// printAll() or at llvm_shutdown instead of as an object each.
+class PendingJSONReports {
+public:
+  /// The comma separated key/value pairs, protected by the TimerLock lock.
+  std::string Values;
+
+  ~PendingJSONReports() {
+    PendingJSONFlushed = true;
+    if (Values.empty())
+      return;
+    std::unique_ptr<raw_ostream> OutStream = CreateInfoOutputFile();
+    *OutStream << "{\n" << Values << "\n}\n";
+  }
+};
+} // end anonymous namespace
+
+static ManagedStatic<PendingJSONReports> PendingJSON;
+
 TimerGroup::TimerGroup(StringRef Name, StringRef Description)
   : Name(Name.begin(), Name.end()),
     Description(Description.begin(), Description.end()) {
@@ -264,7 +376,7 @@ void TimerGroup::removeTimer(Timer &T) {
 
   // If the timer was started, move its data to TimersToPrint.
   if (T.hasTriggered())
-    TimersToPrint.emplace_back(T.Time, T.Name, T.Description);
+    TimersToPrint.emplace_back(T.getTotalTime(), T.Name, T.Description);
 
   T.TG = nullptr;
 
@@ -278,6 +390,13 @@ void TimerGroup::removeTimer(Timer &T) {
   if (FirstTimer || TimersToPrint.empty())
     return;
 
+  if (TimersAsJSON && !PendingJSONFlushed) {
+    std::string &Values = PendingJSON->Values;
+    raw_string_ostream OS(Values);
+    printQueuedJSONValues(OS, Values.empty() ? "" : ",\n");
+    return;
+  }
+
   std::unique_ptr<raw_ostream> OutStream = CreateInfoOutputFile();
   PrintQueuedTimers(*OutStream);
 }
@@ -294,6 +413,14 @@ void TimerGroup::addTimer(Timer &T) {
 }
 
 void TimerGroup::PrintQueuedTimers(raw_ostream &OS) {
+  if (TimersAsJSON) {
+    OS << "{\n";
+    printQueuedJSONValues(OS, "");
+    OS << "\n}\n";
+    OS.flush();
+    return;
+  }
+
   // Sort the timers in descending order by amount of time taken.
   llvm::sort(TimersToPrint);
 
@@ -350,7 +477,7 @@ void TimerGroup::prepareToPrintList() {
     if (WasRunning)
       T->stopTimer();
 
-    TimersToPrint.emplace_back(T->Time, T->Name, T->Description);
+    TimersToPrint.emplace_back(T->getTotalTime(), T->Name, T->Description);
 
     if (WasRunning)
       T->startTimer();
@@ -376,6 +503,28 @@ void TimerGroup::clear() {
 void TimerGroup::printAll(raw_ostream &OS) {
   sys::SmartScopedLock<true> L(*TimerLock);
 
+  if (TimersAsJSON) {
+    std::string Groups;
+    raw_string_ostream GroupsOS(Groups);
+    const char *Delim = "";
+    for (TimerGroup *TG = TimerGroupList; TG; TG = TG->Next) {
+      TG->prepareToPrintList();
+      Delim = TG->printQueuedJSONValues(GroupsOS, Delim);
+    }
+    GroupsOS.flush();
+
+    std::string &Values = PendingJSON->Values;
+    if (Groups.empty() && Values.empty())
+      return;
+    OS << "{\n" << Groups;
+    if (!Groups.empty() && !Values.empty())
+      OS << ",\n";
+    OS << Values << "\n}\n";
+    OS.flush();
+    Values.clear();
+    return;
+  }
+
   for (TimerGroup *TG = TimerGroupList; TG; TG = TG->Next)
     TG->print(OS);
 }
@@ -401,6 +550,11 @@ const char *TimerGroup::printJSONValues(raw_ostream &OS, const char *delim) {
   sys::SmartScopedLock<true> L(*TimerLock);
 
   prepareToPrintList();
+  return printQueuedJSONValues(OS, delim);
+}
+
+const char *TimerGroup::printQueuedJSONValues(raw_ostream &OS,
+                                              const char *delim) {
   for (const PrintRecord &R : TimersToPrint) {
     OS << delim;
     delim = ",\n";
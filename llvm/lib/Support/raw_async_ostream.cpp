@@ -0,0 +1,158 @@
+//===- raw_async_ostream.cpp - raw_ostream with a background writer -------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// This implements a raw_ostream that overlaps output formatting with file I/O
+// by handing full buffers to a background writer thread.
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/Support/raw_async_ostream.h"
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+using namespace llvm;
+
+raw_async_ostream::raw_async_ostream(raw_fd_ostream &OS, size_t BufferSize,
+                                     unsigned NumBuffers)
+    : OS(OS), BufferSize(BufferSize), NumBuffers(NumBuffers),
+      Storage(new char[BufferSize * NumBuffers]), Pos(0),
+      RestoreBuffering(OS.GetBufferSize() != 0), CurBuf(Storage.get()) {
+  assert(BufferSize != 0 && "buffers must hold at least one byte");
+  assert(NumBuffers >= 2 && "at least two buffers are needed to overlap I/O");
+
+  // This stream does the buffering; anything that reaches the underlying
+  // stream should go straight to its file descriptor.
+  OS.SetUnbuffered();
+  Pos = OS.tell();
+
+  SetBuffer(CurBuf, BufferSize);
+
+#if LLVM_ENABLE_THREADS
+  for (unsigned I = 1; I != NumBuffers; ++I)
+    FreeBuffers.push_back(Storage.get() + I * BufferSize);
+  Writer = llvm::thread([this] { writerLoop(); });
+#endif
+}
+
+raw_async_ostream::~raw_async_ostream() {
+  drain();
+
+#if LLVM_ENABLE_THREADS
+  {
+    std::lock_guard<std::mutex> Guard(Lock);
+    Done = true;
+  }
+  QueueCondition.notify_one();
+  Writer.join();
+#endif
+
+  if (RestoreBuffering)
+    OS.SetBuffered();
+}
+
+#if LLVM_ENABLE_THREADS
+void raw_async_ostream::writerLoop() {
+  SmallVector<StringRef, 4> Chunks;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> Guard(Lock);
+      QueueCondition.wait(Guard, [&] { return Done || !PendingChunks.empty(); });
+      // Exit condition. Everything queued before Done was set has already
+      // been written since the destructor drains first.
+      if (PendingChunks.empty())
+        return;
+      Chunks.swap(PendingChunks);
+    }
+
+    // Write every buffer that became ready while the previous write was in
+    // flight with a single system call.
+    OS.writev(Chunks);
+
+    {
+      std::lock_guard<std::mutex> Guard(Lock);
+      for (StringRef Chunk : Chunks)
+        FreeBuffers.push_back(const_cast<char *>(Chunk.data()));
+    }
+    Chunks.clear();
+    CompletionCondition.notify_all();
+  }
+}
+#endif
+
+void raw_async_ostream::submit() {
+  assert(CurLen && "submitting an empty buffer");
+#if LLVM_ENABLE_THREADS
+  std::unique_lock<std::mutex> Guard(Lock);
+  PendingChunks.push_back(StringRef(CurBuf, CurLen));
+  QueueCondition.notify_one();
+
+  // This only blocks when the writer has fallen behind by every buffer we
+  // have.
+  CompletionCondition.wait(Guard, [&] { return !FreeBuffers.empty(); });
+  CurBuf = FreeBuffers.pop_back_val();
+#else
+  OS.write(CurBuf, CurLen);
+#endif
+  CurLen = 0;
+}
+
+void raw_async_ostream::write_impl(const char *Ptr, size_t Size) {
+  Pos += Size;
+
+  // raw_ostream hands us either the tail of CurBuf that it was filling in
+  // place, or memory we do not own: a large write that bypassed the buffer,
+  // or the buffer of a stream layered on top of us.
+  bool InPlace = getBufferStart() == CurBuf + CurLen;
+  if (InPlace && Ptr == CurBuf + CurLen) {
+    CurLen += Size;
+  } else {
+    while (Size) {
+      size_t Bytes = std::min(Size, BufferSize - CurLen);
+      memcpy(CurBuf + CurLen, Ptr, Bytes);
+      CurLen += Bytes;
+      Ptr += Bytes;
+      Size -= Bytes;
+      if (CurLen == BufferSize)
+        submit();
+    }
+  }
+
+  if (CurLen == BufferSize)
+    submit();
+
+  // Keep raw_ostream filling the unused tail of the current buffer.
+  if (InPlace)
+    SetBuffer(CurBuf + CurLen, BufferSize - CurLen);
+}
+
+void raw_async_ostream::pwrite_impl(const char *Ptr, size_t Size,
+                                    uint64_t Offset) {
+  // The bytes being patched may still be in our buffer or in flight, so wait
+  // until all of them have reached the file.
+  drain();
+  OS.pwrite(Ptr, Size, Offset);
+}
+
+void raw_async_ostream::drain() {
+  flush();
+  if (CurLen) {
+    bool InPlace = getBufferStart() == CurBuf + CurLen;
+    submit();
+    if (InPlace)
+      SetBuffer(CurBuf, BufferSize);
+  }
+
+#if LLVM_ENABLE_THREADS
+  // Every buffer except the one we are filling has come back from the writer.
+  std::unique_lock<std::mutex> Guard(Lock);
+  CompletionCondition.wait(
+      Guard, [&] { return FreeBuffers.size() == NumBuffers - 1; });
+#endif
+}
@@ -42,6 +42,11 @@
 # include <unistd.h>
 #endif
 
+#if defined(LLVM_ON_UNIX)
+#include <climits>
+#include <sys/uio.h>
+#endif
+
 #if defined(__CYGWIN__)
 #include <io.h>
 #endif
@@ -746,6 +751,64 @@ uint64_t raw_fd_ostream::seek(uint64_t off) {
   return pos;
 }
 
+void raw_fd_ostream::writev(ArrayRef<StringRef> Chunks) {
+  assert(FD >= 0 && "File already closed.");
+  flush();
+
+#if defined(LLVM_ON_UNIX)
+  SmallVector<struct iovec, 8> IOVs;
+  for (StringRef Chunk : Chunks) {
+    if (Chunk.empty())
+      continue;
+    struct iovec IOV;
+    IOV.iov_base = const_cast<char *>(Chunk.data());
+    IOV.iov_len = Chunk.size();
+    IOVs.push_back(IOV);
+  }
+
+#ifdef IOV_MAX
+  const size_t MaxIOVs = IOV_MAX;
+#else
+  const size_t MaxIOVs = 16;
+#endif
+
+  size_t I = 0;
+  while (I != IOVs.size()) {
+    size_t Count = std::min(IOVs.size() - I, MaxIOVs);
+    ssize_t ret = ::writev(FD, &IOVs[I], Count);
+
+    if (ret < 0) {
+      // Retry recoverable errors, as write_impl does.
+      if (errno == EINTR || errno == EAGAIN
+#ifdef EWOULDBLOCK
+          || errno == EWOULDBLOCK
+#endif
+          )
+        continue;
+
+      error_detected(std::error_code(errno, std::generic_category()));
+      return;
+    }
+
+    pos += ret;
+
+    // The write may have stopped part way through the vector. Skip the chunks
+    // that were written completely and trim the one that was not.
+    size_t Written = ret;
+    while (I != IOVs.size() && Written >= IOVs[I].iov_len)
+      Written -= IOVs[I++].iov_len;
+    if (Written) {
+      IOVs[I].iov_base = static_cast<char *>(IOVs[I].iov_base) + Written;
+      IOVs[I].iov_len -= Written;
+    }
+  }
+#else
+  for (StringRef Chunk : Chunks)
+    if (!Chunk.empty())
+      write_impl(Chunk.data(), Chunk.size());
+#endif
+}
+
 void raw_fd_ostream::pwrite_impl(const char *Ptr, size_t Size,
                                  uint64_t Offset) {
   uint64_t Pos = tell();
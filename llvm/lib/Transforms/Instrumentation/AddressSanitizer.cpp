@@ -15,6 +15,7 @@
 
 #include "llvm/ADT/ArrayRef.h"
 #include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/DenseSet.h"
 #include "llvm/ADT/DepthFirstIterator.h"
 #include "llvm/ADT/SmallPtrSet.h"
 #include "llvm/ADT/SmallVector.h"
@@ -23,7 +24,11 @@
 #include "llvm/ADT/StringRef.h"
 #include "llvm/ADT/Triple.h"
 #include "llvm/ADT/Twine.h"
+#include "llvm/Analysis/LoopInfo.h"
 #include "llvm/Analysis/MemoryBuiltins.h"
+#include "llvm/Analysis/ScalarEvolution.h"
+#include "llvm/Analysis/ScalarEvolutionExpander.h"
+#include "llvm/Analysis/ScalarEvolutionExpressions.h"
 #include "llvm/Analysis/TargetLibraryInfo.h"
 #include "llvm/Transforms/Utils/Local.h"
 #include "llvm/Analysis/ValueTracking.h"
@@ -333,6 +338,12 @@ static cl::opt<bool> ClOptStack(
     "asan-opt-stack", cl::desc("Don't instrument scalar stack variables"),
     cl::Hidden, cl::init(false));
 
+static cl::opt<bool> ClOptLoops(
+    "asan-opt-loops",
+    cl::desc("Check the range accessed by affine accesses in simple loops "
+             "once, before the loop"),
+    cl::Hidden, cl::init(false));
+
 static cl::opt<bool> ClDynamicAllocaStack(
     "asan-stack-dynamic-alloca",
     cl::desc("Use dynamic alloca to represent stack variables"), cl::Hidden,
@@ -385,6 +396,9 @@ STATISTIC(NumOptimizedAccessesToGlobalVar,
           "Number of optimized accesses to global vars");
 STATISTIC(NumOptimizedAccessesToStackVar,
           "Number of optimized accesses to stack vars");
+STATISTIC(NumOptimizedAccessesInLoops,
+          "Number of accesses checked before their loop");
+STATISTIC(NumLoopRangeChecks, "Number of range checks inserted before loops");
 
 namespace {
 
@@ -616,6 +630,11 @@ struct AddressSanitizer : public FunctionPass {
 
   void getAnalysisUsage(AnalysisUsage &AU) const override {
     AU.addRequired<DominatorTreeWrapperPass>();
+    // Only needed to check the accesses in loops as ranges.
+    if (ClOpt && ClOptLoops) {
+      AU.addRequired<LoopInfoWrapperPass>();
+      AU.addRequired<ScalarEvolutionWrapperPass>();
+    }
     AU.addRequired<TargetLibraryInfoWrapperPass>();
   }
 
@@ -660,6 +679,10 @@ struct AddressSanitizer : public FunctionPass {
                                  bool IsWrite, size_t AccessSizeIndex,
                                  Value *SizeArgument, uint32_t Exp);
   void instrumentMemIntrinsic(MemIntrinsic *MI);
+  bool canCheckAccessesBeforeLoop(Loop *L);
+  int checkLoopAccessesAsRanges(ObjectSizeOffsetVisitor &ObjSizeVis,
+                                SmallVectorImpl<Instruction *> &ToInstrument,
+                                const DataLayout &DL);
   Value *memToShadow(Value *Shadow, IRBuilder<> &IRB);
   bool runOnFunction(Function &F) override;
   bool maybeInsertAsanInitAtFunctionEntry(Function &F);
@@ -705,6 +728,8 @@ private:
   Type *IntptrTy;
   ShadowMapping Mapping;
   DominatorTree *DT;
+  LoopInfo *LI;
+  ScalarEvolution *SE;
   Function *AsanHandleNoReturnFunc;
   Function *AsanPtrCmpFunction, *AsanPtrSubFunction;
   Constant *AsanShadowGlobal;
@@ -1066,6 +1091,8 @@ INITIALIZE_PASS_BEGIN(
     "AddressSanitizer: detects use-after-free and out-of-bounds bugs.", false,
     false)
 INITIALIZE_PASS_DEPENDENCY(DominatorTreeWrapperPass)
+INITIALIZE_PASS_DEPENDENCY(LoopInfoWrapperPass)
+INITIALIZE_PASS_DEPENDENCY(ScalarEvolutionWrapperPass)
 INITIALIZE_PASS_DEPENDENCY(TargetLibraryInfoWrapperPass)
 INITIALIZE_PASS_END(
     AddressSanitizer, "asan",
@@ -2499,6 +2526,12 @@ bool AddressSanitizer::runOnFunction(Function &F) {
 
   initializeCallbacks(*F.getParent());
   DT = &getAnalysis<DominatorTreeWrapperPass>().getDomTree();
+  LI = nullptr;
+  SE = nullptr;
+  if (ClOpt && ClOptLoops) {
+    LI = &getAnalysis<LoopInfoWrapperPass>().getLoopInfo();
+    SE = &getAnalysis<ScalarEvolutionWrapperPass>().getSE();
+  }
 
   FunctionStateRAII CleanupObj(this);
 
@@ -2568,16 +2601,20 @@ bool AddressSanitizer::runOnFunction(Function &F) {
     }
   }
 
-  bool UseCalls =
-      (ClInstrumentationWithCallsThreshold >= 0 &&
-       ToInstrument.size() > (unsigned)ClInstrumentationWithCallsThreshold);
   const DataLayout &DL = F.getParent()->getDataLayout();
   ObjectSizeOpts ObjSizeOpts;
   ObjSizeOpts.RoundToAlign = true;
   ObjectSizeOffsetVisitor ObjSizeVis(DL, TLI, F.getContext(), ObjSizeOpts);
 
-  // Instrument.
   int NumInstrumented = 0;
+  if (ClOpt && ClOptLoops)
+    NumInstrumented += checkLoopAccessesAsRanges(ObjSizeVis, ToInstrument, DL);
+
+  bool UseCalls =
+      (ClInstrumentationWithCallsThreshold >= 0 &&
+       ToInstrument.size() > (unsigned)ClInstrumentationWithCallsThreshold);
+
+  // Instrument.
   for (auto Inst : ToInstrument) {
     if (ClDebugMin < 0 || ClDebugMax < 0 ||
         (NumInstrumented >= ClDebugMin && NumInstrumented <= ClDebugMax)) {
@@ -2614,6 +2651,121 @@ bool AddressSanitizer::runOnFunction(Function &F) {
   return FunctionModified;
 }
 
+// Returns true if every access in the body of L that dominates its latch is
+// executed on every iteration, for as many iterations as the backedge-taken
+// count says. This is the case for innermost loops that are only left from the
+// latch and that do not contain calls, which could also free or poison the
+// memory being accessed (e.g. lifetime markers).
+bool AddressSanitizer::canCheckAccessesBeforeLoop(Loop *L) {
+  if (!L->empty() || !L->getLoopPreheader() || !L->getLoopLatch() ||
+      L->getExitingBlock() != L->getLoopLatch())
+    return false;
+  for (BasicBlock *BB : L->blocks())
+    for (Instruction &I : *BB)
+      if ((isa<CallInst>(I) || isa<InvokeInst>(I)) &&
+          !isa<DbgInfoIntrinsic>(I))
+        return false;
+  return !isa<SCEVCouldNotCompute>(SE->getBackedgeTakenCount(L));
+}
+
+// Replaces the checks of loads and stores in simple loops by a single check,
+// before the loop, of the whole range they access over all its iterations.
+// This applies to accesses whose address is invariant in the loop or advances
+// by at most the access size per iteration, so that the range holds no byte
+// the loop does not access. The checked accesses are removed from ToInstrument
+// and the number of range checks inserted is returned.
+//
+// An error is reported before entering the loop rather than at the first bad
+// access, with the size of the whole range.
+int AddressSanitizer::checkLoopAccessesAsRanges(
+    ObjectSizeOffsetVisitor &ObjSizeVis,
+    SmallVectorImpl<Instruction *> &ToInstrument, const DataLayout &DL) {
+  DenseMap<Loop *, bool> CheckableLoops;
+  // The ranges already checked before each loop, indexed by IsWrite. A check
+  // before one loop does not cover another loop, even over the same range,
+  // as it need not dominate it.
+  DenseSet<std::pair<Loop *, std::pair<const SCEV *, const SCEV *>>>
+      CheckedRanges[2];
+  SCEVExpander Expander(*SE, DL, "asan");
+  uint32_t Exp = ClForceExperiment;
+  int NumRangeChecks = 0;
+
+  auto TryCheckBeforeLoop = [&](Instruction *I) {
+    if (!isa<LoadInst>(I) && !isa<StoreInst>(I))
+      return false;
+    bool IsWrite;
+    unsigned Alignment;
+    uint64_t TypeSize;
+    Value *Addr = isInterestingMemoryAccess(I, &IsWrite, &TypeSize, &Alignment);
+    // Leave the accesses that instrumentMop can prove safe to it.
+    if (!Addr || TypeSize % 8 != 0 || isSafeAccess(ObjSizeVis, Addr, TypeSize))
+      return false;
+    Loop *L = LI->getLoopFor(I->getParent());
+    if (!L || !DT->dominates(I->getParent(), L->getLoopLatch()))
+      return false;
+    auto It = CheckableLoops.find(L);
+    if (It == CheckableLoops.end())
+      It = CheckableLoops.insert({L, canCheckAccessesBeforeLoop(L)}).first;
+    if (!It->second)
+      return false;
+
+    uint64_t AccessSize = TypeSize / 8;
+    const SCEV *AddrSCEV = SE->getSCEV(Addr);
+    const SCEV *Begin, *Size;
+    if (SE->isLoopInvariant(AddrSCEV, L)) {
+      Begin = AddrSCEV;
+      Size = SE->getConstant(IntptrTy, AccessSize);
+    } else {
+      auto *AR = dyn_cast<SCEVAddRecExpr>(AddrSCEV);
+      if (!AR || AR->getLoop() != L || !AR->isAffine())
+        return false;
+      auto *Step = dyn_cast<SCEVConstant>(AR->getStepRecurrence(*SE));
+      if (!Step)
+        return false;
+      int64_t StepSize = Step->getAPInt().getSExtValue();
+      uint64_t AbsStepSize = StepSize < 0 ? -(uint64_t)StepSize : StepSize;
+      if (AbsStepSize == 0 || AbsStepSize > AccessSize)
+        return false;
+      const SCEV *BTC =
+          SE->getTruncateOrZeroExtend(SE->getBackedgeTakenCount(L), IntptrTy);
+      Begin = StepSize > 0 ? AR->getStart() : AR->evaluateAtIteration(BTC, *SE);
+      Size = SE->getAddExpr(
+          SE->getMulExpr(BTC, SE->getConstant(IntptrTy, AbsStepSize)),
+          SE->getConstant(IntptrTy, AccessSize));
+    }
+
+    Instruction *InsertBefore = L->getLoopPreheader()->getTerminator();
+    if (!isSafeToExpandAt(Begin, InsertBefore, *SE) ||
+        !isSafeToExpandAt(Size, InsertBefore, *SE))
+      return false;
+    NumOptimizedAccessesInLoops++;
+    if (!CheckedRanges[IsWrite].insert({L, {Begin, Size}}).second)
+      return true;
+
+    Value *BeginVal = Expander.expandCodeFor(Begin, IntptrTy, InsertBefore);
+    Value *SizeVal = Expander.expandCodeFor(Size, IntptrTy, InsertBefore);
+    IRBuilder<> IRB(InsertBefore);
+    CallInst *Call;
+    if (Exp == 0)
+      Call = IRB.CreateCall(AsanMemoryAccessCallbackSized[IsWrite][0],
+                            {BeginVal, SizeVal});
+    else
+      Call = IRB.CreateCall(
+          AsanMemoryAccessCallbackSized[IsWrite][1],
+          {BeginVal, SizeVal, ConstantInt::get(IRB.getInt32Ty(), Exp)});
+    Call->setDebugLoc(I->getDebugLoc());
+    NumLoopRangeChecks++;
+    NumRangeChecks++;
+    return true;
+  };
+
+  ToInstrument.erase(
+      std::remove_if(ToInstrument.begin(), ToInstrument.end(),
+                     TryCheckBeforeLoop),
+      ToInstrument.end());
+  return NumRangeChecks;
+}
+
 // Workaround for bug 11395: we don't want to instrument stack in functions
 // with large assembly blobs (32-bit only), otherwise reg alloc may crash.
 // FIXME: remove once the bug 11395 is fixed.
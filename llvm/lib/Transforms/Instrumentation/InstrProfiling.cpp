@@ -34,6 +34,7 @@
 #include "llvm/IR/Instruction.h"
 #include "llvm/IR/Instructions.h"
 #include "llvm/IR/IntrinsicInst.h"
+#include "llvm/IR/MDBuilder.h"
 #include "llvm/IR/Module.h"
 #include "llvm/IR/Type.h"
 #include "llvm/Pass.h"
@@ -141,6 +142,19 @@ cl::opt<bool> IterativeCounterPromotion(
     cl::ZeroOrMore, "iterative-counter-promotion", cl::init(true),
     cl::desc("Allow counter promotion across the whole loop nest."));
 
+cl::opt<bool> RuntimeCounterRelocation(
+    "runtime-counter-relocation", cl::ZeroOrMore,
+    cl::desc("Access the profile counters through a bias set by the runtime "
+             "(needed for the continuous profile mode)"),
+    cl::init(false));
+
+cl::opt<bool> PerThreadCounters(
+    "instrprof-per-thread-counters", cl::ZeroOrMore,
+    cl::desc("Make every thread update its own copy of the profile counters "
+             "without atomics; the runtime adds them up when writing the "
+             "profile"),
+    cl::init(false));
+
 class InstrProfilingLegacyPass : public ModulePass {
   InstrProfiling InstrProf;
 
@@ -160,7 +174,9 @@ public:
   }
 
   void getAnalysisUsage(AnalysisUsage &AU) const override {
-    AU.setPreservesCFG();
+    // Per-thread counters split the entry blocks.
+    if (!PerThreadCounters)
+      AU.setPreservesCFG();
     AU.addRequired<TargetLibraryInfoWrapperPass>();
   }
 };
@@ -197,6 +213,16 @@ public:
       Value *LiveInValue = SSA.GetValueInMiddleOfBlock(ExitBlock);
       Value *Addr = cast<StoreInst>(Store)->getPointerOperand();
       IRBuilder<> Builder(InsertPos);
+      if (auto *AddrInst = dyn_cast<IntToPtrInst>(Addr)) {
+        // With runtime counter relocation or per-thread counters the address
+        // is computed in the loop (see InstrProfiling::getCounterAddress),
+        // which need not dominate the exit block. Recompute it here from the
+        // offset.
+        auto *BiasAdd = cast<BinaryOperator>(AddrInst->getOperand(0));
+        assert(BiasAdd->getOpcode() == Instruction::Add);
+        Value *NewBiasAdd = Builder.Insert(BiasAdd->clone());
+        Addr = Builder.CreateIntToPtr(NewBiasAdd, AddrInst->getType());
+      }
       if (AtomicCounterUpdatePromoted)
         // automic update currently can only be promoted across the current
         // loop, not the whole loop nest.
@@ -376,9 +402,21 @@ static InstrProfIncrementInst *castToIncrementInst(Instruction *Instr) {
   return dyn_cast<InstrProfIncrementInst>(Instr);
 }
 
+static bool containsIncrementInst(Function &F) {
+  for (BasicBlock &BB : F)
+    for (Instruction &I : BB)
+      if (castToIncrementInst(&I))
+        return true;
+  return false;
+}
+
 bool InstrProfiling::lowerIntrinsics(Function *F) {
   bool MadeChange = false;
   PromotionCandidates.clear();
+  CounterBias = nullptr;
+  // This changes the CFG, so do it before walking the blocks.
+  if (isPerThreadCountersEnabled() && containsIncrementInst(*F))
+    emitCounterShardOffset(F);
   for (BasicBlock &BB : *F) {
     for (auto I = BB.begin(), E = BB.end(); I != E;) {
       auto Instr = I++;
@@ -407,6 +445,15 @@ bool InstrProfiling::isCounterPromotionEnabled() const {
   return Options.DoCounterPromotion;
 }
 
+bool InstrProfiling::isRuntimeCounterRelocationEnabled() const {
+  return RuntimeCounterRelocation;
+}
+
+bool InstrProfiling::isPerThreadCountersEnabled() const {
+  // Rejected on Windows, see run().
+  return PerThreadCounters && !TT.isOSWindows();
+}
+
 void InstrProfiling::promoteCounterLoadStores(Function *F) {
   if (!isCounterPromotionEnabled())
     return;
@@ -463,6 +510,11 @@ bool InstrProfiling::run(Module &M, const TargetLibraryInfo &TLI) {
                               MemOPSizeRangeLast);
   TT = Triple(M.getTargetTriple());
 
+  // The runtime has no per-thread counters on Windows.
+  if (PerThreadCounters && TT.isOSWindows())
+    M.getContext().emitError(
+        "-instrprof-per-thread-counters is not supported on Windows");
+
   // Emit the runtime hook even if no counters are present.
   bool MadeChange = emitRuntimeHook();
 
@@ -596,14 +648,91 @@ void InstrProfiling::lowerValueProfileInst(InstrProfValueProfileInst *Ind) {
   Ind->eraseFromParent();
 }
 
-void InstrProfiling::lowerIncrement(InstrProfIncrementInst *Inc) {
+Value *InstrProfiling::getCounterAddress(InstrProfIncrementInst *Inc) {
   GlobalVariable *Counters = getOrCreateRegionCounters(Inc);
 
   IRBuilder<> Builder(Inc);
   uint64_t Index = Inc->getIndex()->getZExtValue();
   Value *Addr = Builder.CreateConstInBoundsGEP2_64(Counters, 0, Index);
+  if (!isRuntimeCounterRelocationEnabled() && !isPerThreadCountersEnabled())
+    return Addr;
+
+  // Load the bias once per function, in the entry block. With per-thread
+  // counters, the offset of the thread's counters has been loaded already.
+  // The runtime declares the bias as an intptr_t.
+  Type *IntPtrTy = M->getDataLayout().getIntPtrType(M->getContext());
+  if (!CounterBias) {
+    GlobalVariable *Bias =
+        M->getGlobalVariable(getInstrProfCounterBiasVarName());
+    if (!Bias) {
+      // The runtime only has a weak reference to the bias, so it is defined
+      // (as zero) by every instrumented object, and the runtime sets it once
+      // the counters have been mapped.
+      Bias = new GlobalVariable(*M, IntPtrTy, false,
+                                GlobalValue::LinkOnceODRLinkage,
+                                Constant::getNullValue(IntPtrTy),
+                                getInstrProfCounterBiasVarName());
+      Bias->setVisibility(GlobalValue::HiddenVisibility);
+      if (TT.supportsCOMDAT())
+        Bias->setComdat(M->getOrInsertComdat(Bias->getName()));
+    }
+    BasicBlock &Entry = Inc->getFunction()->getEntryBlock();
+    IRBuilder<> EntryBuilder(&Entry, Entry.getFirstInsertionPt());
+    CounterBias = EntryBuilder.CreateLoad(Bias, "pgocount.bias");
+  }
+  Value *Add = Builder.CreateAdd(Builder.CreatePtrToInt(Addr, IntPtrTy),
+                                 CounterBias);
+  return Builder.CreateIntToPtr(Add, Addr->getType());
+}
+
+void InstrProfiling::emitCounterShardOffset(Function *F) {
+  LLVMContext &Ctx = M->getContext();
+  // The offset is an intptr_t in the runtime, like the counter bias.
+  Type *IntPtrTy = M->getDataLayout().getIntPtrType(Ctx);
+  GlobalVariable *Shard =
+      M->getGlobalVariable(getInstrProfCounterShardVarName());
+  if (!Shard) {
+    // Defined by the runtime.
+    Shard = new GlobalVariable(*M, IntPtrTy, false,
+                               GlobalValue::ExternalLinkage, nullptr,
+                               getInstrProfCounterShardVarName(), nullptr,
+                               GlobalValue::GeneralDynamicTLSModel);
+    Shard->setVisibility(GlobalValue::HiddenVisibility);
+  }
+
+  // Keep the static allocas in the entry block.
+  BasicBlock &Entry = F->getEntryBlock();
+  BasicBlock::iterator IP = Entry.getFirstInsertionPt();
+  while (isa<AllocaInst>(IP))
+    ++IP;
+  Instruction *SplitBefore = &*IP;
+
+  // The offset is 0 until the thread's counters have been allocated.
+  IRBuilder<> Builder(SplitBefore);
+  LoadInst *Offset = Builder.CreateLoad(Shard, "pgocount.shard");
+  Value *IsUnset = Builder.CreateICmpEQ(Offset, ConstantInt::get(IntPtrTy, 0));
+  TerminatorInst *Then = SplitBlockAndInsertIfThen(
+      IsUnset, SplitBefore, false,
+      MDBuilder(Ctx).createBranchWeights(1, (1U << 20) - 1));
+  Constant *InitFn =
+      M->getOrInsertFunction(getInstrProfCounterShardInitFuncName(),
+                             FunctionType::get(IntPtrTy, false));
+  Value *NewOffset = IRBuilder<>(Then).CreateCall(InitFn);
+
+  Builder.SetInsertPoint(SplitBefore);
+  PHINode *PN = Builder.CreatePHI(IntPtrTy, 2, "pgocount.shard.offset");
+  PN->addIncoming(Offset, Offset->getParent());
+  PN->addIncoming(NewOffset, Then->getParent());
+  CounterBias = PN;
+}
+
+void InstrProfiling::lowerIncrement(InstrProfIncrementInst *Inc) {
+  IRBuilder<> Builder(Inc);
+  Value *Addr = getCounterAddress(Inc);
 
-  if (Options.Atomic || AtomicCounterUpdateAll) {
+  // The counters of a thread are not shared, so atomics are not needed.
+  if ((Options.Atomic && !isPerThreadCountersEnabled()) ||
+      AtomicCounterUpdateAll) {
     Builder.CreateAtomicRMW(AtomicRMWInst::Add, Addr, Inc->getStep(),
                             AtomicOrdering::Monotonic);
   } else {
@@ -0,0 +1,169 @@
+; Test that -asan-opt-loops checks the accesses of simple loops once, as
+; ranges, before the loop.
+; RUN: opt < %s -asan -asan-module -asan-opt-loops -S | FileCheck %s
+; RUN: opt < %s -asan -asan-module -S | FileCheck -check-prefix=NOOPT %s
+
+target datalayout = "e-p:64:64:64-i1:8:8-i8:8:8-i16:16:16-i32:32:32-i64:64:64-f32:32:32-f64:64:64-v64:64:64-v128:128:128-a0:0:64-s0:64:64-f80:128:128-n8:16:32:64-S128"
+target triple = "x86_64-unknown-linux-gnu"
+
+; The stores to p[i] are checked with one range check of p[0..n), the loads
+; of the invariant *q with one check of 4 bytes.
+define void @fill(i32* %p, i32* %q, i64 %n) sanitize_address {
+; CHECK-LABEL: define void @fill
+; CHECK: entry:
+; CHECK-DAG: [[Q:%[^ ]*]] = ptrtoint i32* %q to i64
+; CHECK-DAG: call void @__asan_loadN(i64 [[Q]], i64 4)
+; CHECK-DAG: [[P:%[^ ]*]] = ptrtoint i32* %p to i64
+; CHECK-DAG: call void @__asan_storeN(i64 [[P]], i64 {{%.*}})
+; CHECK: br label %loop
+; CHECK: loop:
+; CHECK-NOT: call void @__asan_
+; CHECK: exit:
+
+; NOOPT-LABEL: define void @fill
+; NOOPT-NOT: call void @__asan_loadN
+; NOOPT-NOT: call void @__asan_storeN
+; NOOPT: loop:
+; NOOPT: call void @__asan_report_load4
+; NOOPT: call void @__asan_report_store4
+; NOOPT: exit:
+entry:
+  br label %loop
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %loop ]
+  %v = load i32, i32* %q
+  %gep = getelementptr inbounds i32, i32* %p, i64 %i
+  store i32 %v, i32* %gep
+  %i.next = add nuw nsw i64 %i, 1
+  %done = icmp eq i64 %i.next, %n
+  br i1 %done, label %exit, label %loop
+
+exit:
+  ret void
+}
+
+; Accesses to the same range are checked once.
+define i32 @sum(i32* %p, i64 %n) sanitize_address {
+; CHECK-LABEL: define i32 @sum
+; CHECK: entry:
+; CHECK: call void @__asan_loadN
+; CHECK-NOT: call void @__asan_loadN
+; CHECK: loop:
+; CHECK-NOT: call void @__asan_
+; CHECK: exit:
+entry:
+  br label %loop
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %cont ]
+  %s = phi i32 [ 0, %entry ], [ %s.next, %cont ]
+  %gep = getelementptr inbounds i32, i32* %p, i64 %i
+  %a = load i32, i32* %gep
+  br label %cont
+
+cont:
+  %b = load i32, i32* %gep
+  %ab = add i32 %a, %b
+  %s.next = add i32 %s, %ab
+  %i.next = add nuw nsw i64 %i, 1
+  %done = icmp eq i64 %i.next, %n
+  br i1 %done, label %exit, label %loop
+
+exit:
+  ret i32 %s.next
+}
+
+; Sibling loops over the same range each get their own check, as the check
+; before one loop does not dominate the other.
+define void @siblings(i32* %p, i64 %n, i1 %c) sanitize_address {
+; CHECK-LABEL: define void @siblings
+; CHECK: then:
+; CHECK: call void @__asan_storeN
+; CHECK-NEXT: br label %loop1
+; CHECK: loop1:
+; CHECK-NOT: call void @__asan_
+; CHECK: else:
+; CHECK: call void @__asan_storeN
+; CHECK-NEXT: br label %loop2
+; CHECK: loop2:
+; CHECK-NOT: call void @__asan_
+; CHECK: exit:
+entry:
+  br i1 %c, label %then, label %else
+
+then:
+  br label %loop1
+
+loop1:
+  %i = phi i64 [ 0, %then ], [ %i.next, %loop1 ]
+  %gep1 = getelementptr inbounds i32, i32* %p, i64 %i
+  store i32 0, i32* %gep1
+  %i.next = add nuw nsw i64 %i, 1
+  %done1 = icmp eq i64 %i.next, %n
+  br i1 %done1, label %exit, label %loop1
+
+else:
+  br label %loop2
+
+loop2:
+  %j = phi i64 [ 0, %else ], [ %j.next, %loop2 ]
+  %gep2 = getelementptr inbounds i32, i32* %p, i64 %j
+  store i32 1, i32* %gep2
+  %j.next = add nuw nsw i64 %j, 1
+  %done2 = icmp eq i64 %j.next, %n
+  br i1 %done2, label %exit, label %loop2
+
+exit:
+  ret void
+}
+
+; A stride larger than the access size leaves bytes between the accesses
+; that the loop does not touch, so the accesses are checked in the loop.
+define void @strided(i32* %p, i64 %n) sanitize_address {
+; CHECK-LABEL: define void @strided
+; CHECK-NOT: call void @__asan_storeN
+; CHECK: loop:
+; CHECK: call void @__asan_report_store4
+; CHECK: exit:
+entry:
+  br label %loop
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %loop ]
+  %j = shl nuw nsw i64 %i, 1
+  %gep = getelementptr inbounds i32, i32* %p, i64 %j
+  store i32 0, i32* %gep
+  %i.next = add nuw nsw i64 %i, 1
+  %done = icmp eq i64 %i.next, %n
+  br i1 %done, label %exit, label %loop
+
+exit:
+  ret void
+}
+
+; Calls in the loop could free or poison the memory, so the accesses are
+; checked in the loop.
+define void @with_call(i32* %p, i64 %n) sanitize_address {
+; CHECK-LABEL: define void @with_call
+; CHECK-NOT: call void @__asan_storeN
+; CHECK: loop:
+; CHECK: call void @__asan_report_store4
+; CHECK: exit:
+entry:
+  br label %loop
+
+loop:
+  %i = phi i64 [ 0, %entry ], [ %i.next, %loop ]
+  %gep = getelementptr inbounds i32, i32* %p, i64 %i
+  store i32 0, i32* %gep
+  call void @g()
+  %i.next = add nuw nsw i64 %i, 1
+  %done = icmp eq i64 %i.next, %n
+  br i1 %done, label %exit, label %loop
+
+exit:
+  ret void
+}
+
+declare void @g()
@@ -0,0 +1,55 @@
+; RUN: opt < %s -S -instrprof -instrprof-per-thread-counters | FileCheck %s
+; RUN: opt < %s -S -instrprof -instrprof-per-thread-counters -data-layout=p:32:32 | FileCheck -check-prefix=PTR32 %s
+; RUN: not opt < %s -S -instrprof -instrprof-per-thread-counters -mtriple=x86_64-pc-windows-msvc 2>&1 | FileCheck -check-prefix=WIN %s
+
+target triple = "x86_64-unknown-linux-gnu"
+
+@__profn_foo = hidden constant [3 x i8] c"foo"
+
+; CHECK: @__llvm_profile_counter_shard = external hidden thread_local global i64
+; PTR32: @__llvm_profile_counter_shard = external hidden thread_local global i32
+; WIN: error: -instrprof-per-thread-counters is not supported on Windows
+
+; The offset of the thread's counters is loaded once, after the allocas, and
+; initialized on the first call on the thread.
+; CHECK-LABEL: define void @foo
+; CHECK-NEXT: entry:
+; CHECK-NEXT: %x = alloca i32
+; CHECK-NEXT: %pgocount.shard = load i64, i64* @__llvm_profile_counter_shard
+; CHECK-NEXT: [[UNSET:%.*]] = icmp eq i64 %pgocount.shard, 0
+; CHECK-NEXT: br i1 [[UNSET]], label %[[INIT:.*]], label %[[CONT:.*]], !prof
+; CHECK: [[INIT]]:
+; CHECK-NEXT: [[NEW:%.*]] = call i64 @__llvm_profile_init_counter_shard()
+; CHECK-NEXT: br label %[[CONT]]
+; CHECK: [[CONT]]:
+; CHECK-NEXT: %pgocount.shard.offset = phi i64 [ %pgocount.shard, %entry ], [ [[NEW]], %[[INIT]] ]
+; The increments are not atomic.
+; CHECK-NEXT: [[ADD:%.*]] = add i64 ptrtoint ({{.*}}@__profc_foo{{.*}} to i64), %pgocount.shard.offset
+; CHECK-NEXT: [[ADDR:%.*]] = inttoptr i64 [[ADD]] to i64*
+; CHECK-NEXT: %pgocount = load i64, i64* [[ADDR]]
+; CHECK-NEXT: [[INC:%.*]] = add i64 %pgocount, 1
+; CHECK-NEXT: store i64 [[INC]], i64* [[ADDR]]
+; CHECK-NOT: atomicrmw
+
+; PTR32-LABEL: define void @foo
+; PTR32: %pgocount.shard = load i32, i32* @__llvm_profile_counter_shard
+; PTR32: call i32 @__llvm_profile_init_counter_shard()
+; PTR32: %pgocount.shard.offset = phi i32
+; PTR32-NEXT: add i32 ptrtoint ({{.*}}@__profc_foo{{.*}} to i32), %pgocount.shard.offset
+define void @foo() {
+entry:
+  %x = alloca i32
+  call void @llvm.instrprof.increment(i8* getelementptr inbounds ([3 x i8], [3 x i8]* @__profn_foo, i32 0, i32 0), i64 0, i32 1, i32 0)
+  ret void
+}
+
+; Functions without counters do not touch the offset.
+; CHECK-LABEL: define void @bar
+; CHECK-NOT: @__llvm_profile_counter_shard
+; CHECK: ret void
+define void @bar() {
+entry:
+  ret void
+}
+
+declare void @llvm.instrprof.increment(i8*, i64, i32, i32)
@@ -0,0 +1,35 @@
+; RUN: opt < %s -S -instrprof | FileCheck %s
+; RUN: opt < %s -S -instrprof -runtime-counter-relocation | FileCheck -check-prefix=RELOC %s
+; RUN: opt < %s -S -instrprof -runtime-counter-relocation -data-layout=p:32:32 | FileCheck -check-prefix=RELOC32 %s
+
+target triple = "x86_64-unknown-linux-gnu"
+
+@__profn_foo = hidden constant [3 x i8] c"foo"
+; CHECK-NOT: @__llvm_profile_counter_bias
+; RELOC: @__llvm_profile_counter_bias = linkonce_odr hidden global i64 0, comdat
+; RELOC32: @__llvm_profile_counter_bias = linkonce_odr hidden global i32 0, comdat
+
+; CHECK-LABEL: define void @foo
+; CHECK-NEXT: %pgocount = load i64, i64* getelementptr inbounds ([1 x i64], [1 x i64]* @__profc_foo, i64 0, i64 0)
+; CHECK-NEXT: [[INC:%.*]] = add i64 %pgocount, 1
+; CHECK-NEXT: store i64 [[INC]], i64* getelementptr inbounds ([1 x i64], [1 x i64]* @__profc_foo, i64 0, i64 0)
+
+; RELOC-LABEL: define void @foo
+; RELOC-NEXT: %pgocount.bias = load i64, i64* @__llvm_profile_counter_bias
+; RELOC-NEXT: [[ADD:%.*]] = add i64 ptrtoint ({{.*}}@__profc_foo{{.*}} to i64), %pgocount.bias
+; RELOC-NEXT: [[ADDR:%.*]] = inttoptr i64 [[ADD]] to i64*
+; RELOC-NEXT: %pgocount = load i64, i64* [[ADDR]]
+; RELOC-NEXT: [[INC:%.*]] = add i64 %pgocount, 1
+; RELOC-NEXT: store i64 [[INC]], i64* [[ADDR]]
+
+; RELOC32-LABEL: define void @foo
+; RELOC32-NEXT: %pgocount.bias = load i32, i32* @__llvm_profile_counter_bias
+; RELOC32-NEXT: [[ADD:%.*]] = add i32 ptrtoint ({{.*}}@__profc_foo{{.*}} to i32), %pgocount.bias
+; RELOC32-NEXT: [[ADDR:%.*]] = inttoptr i32 [[ADD]] to i64*
+; RELOC32-NEXT: %pgocount = load i64, i64* [[ADDR]]
+define void @foo() {
+  call void @llvm.instrprof.increment(i8* getelementptr inbounds ([3 x i8], [3 x i8]* @__profn_foo, i32 0, i32 0), i64 0, i32 1, i32 0)
+  ret void
+}
+
+declare void @llvm.instrprof.increment(i8*, i64, i32, i32)
@@ -49,6 +49,7 @@
 #include "llvm/Support/TargetSelect.h"
 #include "llvm/Support/ToolOutputFile.h"
 #include "llvm/Support/WithColor.h"
+#include "llvm/Support/raw_async_ostream.h"
 #include "llvm/Target/TargetMachine.h"
 #include "llvm/Transforms/Utils/Cloning.h"
 #include <memory>
@@ -126,6 +127,12 @@ static cl::opt<bool>
                           "manager and verify the result is the same."),
                  cl::init(false));
 
+static cl::opt<bool>
+    AsyncOutput("async-output", cl::Hidden,
+                cl::desc("Write the output file from a background thread "
+                         "while code generation continues."),
+                cl::init(false));
+
 static cl::opt<bool> DiscardValueNames(
     "discard-value-names",
     cl::desc("Discard names from Value (other than GlobalValue)."),
@@ -483,6 +490,13 @@ static int compileModule(char **argv, LLVMContext &Context) {
     }
   }
 
+  // Write the output file from a background thread while code generation
+  // continues. This must outlive the pass manager since the asm printer only
+  // flushes its output when it is destroyed.
+  std::unique_ptr<raw_async_ostream> AsyncOut;
+  if (AsyncOutput)
+    AsyncOut = make_unique<raw_async_ostream>(Out->os());
+
   // Build up all of the passes that we want to do to the module.
   legacy::PassManager PM;
 
@@ -521,6 +535,9 @@ static int compileModule(char **argv, LLVMContext &Context) {
 
   {
     raw_pwrite_stream *OS = &Out->os();
+    if (AsyncOut)
+      OS = AsyncOut.get();
+    raw_pwrite_stream &FileOS = *OS;
 
     // Manually do the buffering rather than using buffer_ostream,
     // so we can memcmp the contents in CompileTwice mode
@@ -611,14 +628,14 @@ static int compileModule(char **argv, LLVMContext &Context) {
                "Writing the result of the second run to the specified output\n"
                "To generate the one-run comparison binary, just run without\n"
                "the compile-twice option\n";
-        Out->os() << Buffer;
+        FileOS << Buffer;
         Out->keep();
         return 1;
       }
     }
 
     if (BOS) {
-      Out->os() << Buffer;
+      FileOS << Buffer;
     }
   }
 
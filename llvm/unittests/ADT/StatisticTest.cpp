@@ -10,6 +10,8 @@
 #include "llvm/ADT/Statistic.h"
 #include "llvm/Support/raw_ostream.h"
 #include "gtest/gtest.h"
+#include <thread>
+#include <vector>
 using namespace llvm;
 
 using OptionalStatistic = Optional<std::pair<StringRef, unsigned>>;
@@ -18,6 +20,7 @@ namespace {
 #define DEBUG_TYPE "unittest"
 STATISTIC(Counter, "Counts things");
 STATISTIC(Counter2, "Counts other things");
+STATISTIC(Counter3, "Counts things on several threads");
 
 #if LLVM_ENABLE_STATS
 static void
@@ -157,4 +160,28 @@ TEST(StatisticTest, API) {
 #endif
 }
 
+#if LLVM_ENABLE_STATS && LLVM_ENABLE_THREADS
+TEST(StatisticTest, Threads) {
+  EnableStatistics();
+  ResetStatistics();
+
+  // All threads race to register the statistic on their first update.
+  std::vector<std::thread> Threads;
+  for (unsigned I = 0; I != 4; ++I)
+    Threads.emplace_back([] {
+      for (unsigned J = 0; J != 1000; ++J)
+        ++Counter3;
+    });
+  for (std::thread &T : Threads)
+    T.join();
+
+  EXPECT_EQ(Counter3, 4000u);
+  const auto Range = GetStatistics();
+  ASSERT_EQ(Range.begin() + 1, Range.end());
+  EXPECT_EQ(Range.begin()->first, "Counter3");
+  EXPECT_EQ(Range.begin()->second, 4000u);
+  ResetStatistics();
+}
+#endif
+
 } // end anonymous namespace
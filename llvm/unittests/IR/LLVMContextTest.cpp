@@ -0,0 +1,45 @@
+//===- llvm/unittest/IR/LLVMContextTest.cpp - LLVMContext tests -----------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/IR/LLVMContext.h"
+#include "llvm/IR/DerivedTypes.h"
+#include "llvm/IR/Metadata.h"
+#include "llvm/Support/Allocator.h"
+#include "gtest/gtest.h"
+using namespace llvm;
+
+namespace {
+
+TEST(LLVMContextTest, AllocatorStatistics) {
+  LLVMContext Context;
+  AllocatorStatistics Before = Context.getAllocatorStatistics();
+
+  // Types are allocated from the context.
+  StructType::create(Context, "a");
+  AllocatorStatistics After = Context.getAllocatorStatistics();
+  EXPECT_EQ(Before.BytesAllocated + sizeof(StructType), After.BytesAllocated);
+  EXPECT_LE(1u, After.NumSlabs);
+  EXPECT_LE(After.BytesAllocated, After.TotalMemory);
+
+  // So are metadata strings, but only the first time they are seen.
+  Before = After;
+  MDString::get(Context, "string");
+  After = Context.getAllocatorStatistics();
+  size_t Size = sizeof(StringMapEntry<MDString>) + strlen("string") + 1;
+  EXPECT_EQ(Before.BytesAllocated + Size, After.BytesAllocated);
+  EXPECT_LE(Before.NumSlabs + 1, After.NumSlabs);
+
+  Before = After;
+  MDString::get(Context, "string");
+  After = Context.getAllocatorStatistics();
+  EXPECT_EQ(Before.BytesAllocated, After.BytesAllocated);
+  EXPECT_EQ(Before.NumSlabs, After.NumSlabs);
+}
+
+} // end anonymous namespace
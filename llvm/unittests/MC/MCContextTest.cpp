@@ -0,0 +1,61 @@
+//===- llvm/unittest/MC/MCContextTest.cpp - MCContext tests ---------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/MC/MCContext.h"
+#include "llvm/Support/Allocator.h"
+#include "gtest/gtest.h"
+
+using namespace llvm;
+
+namespace {
+
+TEST(MCContextTest, AllocatorStatistics) {
+  MCContext Ctx(nullptr, nullptr, nullptr);
+  AllocatorStatistics Before = Ctx.getAllocatorStatistics();
+  EXPECT_EQ(0u, Before.NumSlabs);
+  EXPECT_EQ(0u, Before.BytesAllocated);
+
+  Ctx.allocate(100);
+  Ctx.allocate(28);
+  AllocatorStatistics After = Ctx.getAllocatorStatistics();
+  EXPECT_EQ(1u, After.NumSlabs);
+  EXPECT_EQ(128u, After.BytesAllocated);
+  EXPECT_LE(128u, After.TotalMemory);
+
+  // Larger than a slab: it gets a slab of its own.
+  Ctx.allocate(10000);
+  After = Ctx.getAllocatorStatistics();
+  EXPECT_EQ(2u, After.NumSlabs);
+  EXPECT_EQ(10128u, After.BytesAllocated);
+  EXPECT_LE(10128u, After.TotalMemory);
+}
+
+TEST(MCContextTest, AllocatorStatisticsSlabCache) {
+  SlabCache::setCapacity(1024 * 1024);
+  {
+    MCContext Ctx(nullptr, nullptr, nullptr);
+    Ctx.allocate(100);
+  }
+  // The slab of the destroyed context went to the cache.
+  MCContext Ctx(nullptr, nullptr, nullptr);
+  AllocatorStatistics Stats = Ctx.getAllocatorStatistics();
+  EXPECT_EQ(0u, Stats.NumSlabs);
+  EXPECT_LE(1u, Stats.CacheStats.CachedSlabs);
+  EXPECT_LE(4096u, Stats.CacheStats.CachedBytes);
+
+  // And is reused by the next allocation.
+  uint64_t Hits = Stats.CacheStats.Hits;
+  Ctx.allocate(100);
+  Stats = Ctx.getAllocatorStatistics();
+  EXPECT_EQ(1u, Stats.NumSlabs);
+  EXPECT_EQ(Hits + 1, Stats.CacheStats.Hits);
+  SlabCache::setCapacity(0);
+}
+
+} // end anonymous namespace
@@ -80,6 +80,89 @@ TEST(AllocatorTest, TestReset) {
   EXPECT_EQ(2U, Alloc.GetNumSlabs());
 }
 
+// Check that the statistics track slabs and bytes as allocations are made.
+TEST(AllocatorTest, TestStatistics) {
+  BumpPtrAllocator Alloc;
+  AllocatorStatistics Stats = Alloc.getStatistics();
+  EXPECT_EQ(0u, Stats.NumSlabs);
+  EXPECT_EQ(0u, Stats.TotalMemory);
+
+  Alloc.Allocate(3000, 1);
+  Alloc.Allocate(3000, 1);
+  Stats = Alloc.getStatistics();
+  EXPECT_EQ(2u, Stats.NumSlabs);
+  EXPECT_EQ(6000u, Stats.BytesAllocated);
+  EXPECT_EQ(Alloc.getTotalMemory(), Stats.TotalMemory);
+  EXPECT_EQ(Stats.TotalMemory - 6000, Stats.getWastedBytes());
+
+  AllocatorStatistics Sum;
+  Sum += Stats;
+  Sum += Stats;
+  EXPECT_EQ(4u, Sum.NumSlabs);
+  EXPECT_EQ(12000u, Sum.BytesAllocated);
+}
+
+// Check that slabs released by one allocator are reused by the next one once
+// the slab cache is enabled.
+TEST(AllocatorTest, TestSlabCache) {
+  SlabCache::setCapacity(1024 * 1024);
+  SlabCache::Statistics Before = SlabCache::getStatistics();
+  void *FirstSlab;
+  {
+    BumpPtrAllocator Alloc;
+    FirstSlab = Alloc.Allocate(1, 1);
+    Alloc.Allocate(5000, 1);
+  }
+  SlabCache::Statistics Released = SlabCache::getStatistics();
+  EXPECT_EQ(Before.CachedSlabs + 2, Released.CachedSlabs);
+  {
+    BumpPtrAllocator Alloc;
+    // The most recently released slab of the default size is handed out again.
+    EXPECT_EQ(FirstSlab, Alloc.Allocate(1, 1));
+  }
+  SlabCache::Statistics After = SlabCache::getStatistics();
+  EXPECT_EQ(Released.Hits + 1, After.Hits);
+
+  SlabCache::setCapacity(0);
+  EXPECT_EQ(0u, SlabCache::getStatistics().CachedSlabs);
+  EXPECT_EQ(0u, SlabCache::getStatistics().CachedBytes);
+}
+
+// Check that the slab cache never grows beyond its capacity.
+TEST(AllocatorTest, TestSlabCacheCapacity) {
+  SlabCache::setCapacity(4096);
+  {
+    BumpPtrAllocator Alloc;
+    Alloc.Allocate(3000, 1);
+    Alloc.Allocate(3000, 1);
+    Alloc.Allocate(3000, 1);
+  }
+  EXPECT_GE(4096u, SlabCache::getStatistics().CachedBytes);
+  SlabCache::setCapacity(0);
+}
+
+// Check that a released slab of a new size displaces the oldest cached slabs.
+TEST(AllocatorTest, TestSlabCacheEviction) {
+  SlabCache::setCapacity(8192);
+  {
+    BumpPtrAllocator Alloc;
+    Alloc.Allocate(3000, 1);
+    Alloc.Allocate(3000, 1);
+  }
+  SlabCache::Statistics Before = SlabCache::getStatistics();
+  EXPECT_EQ(2u, Before.CachedSlabs);
+  {
+    // Larger than the size threshold, so it gets a slab of its own.
+    BumpPtrAllocator Alloc;
+    Alloc.Allocate(6000, 1);
+  }
+  SlabCache::Statistics After = SlabCache::getStatistics();
+  EXPECT_EQ(Before.Evictions + 2, After.Evictions);
+  EXPECT_EQ(1u, After.CachedSlabs);
+  EXPECT_GE(8192u, After.CachedBytes);
+  SlabCache::setCapacity(0);
+}
+
 // Test some allocations at varying alignments.
 TEST(AllocatorTest, TestAlignment) {
   BumpPtrAllocator Alloc;
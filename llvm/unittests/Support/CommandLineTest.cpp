@@ -482,6 +482,31 @@ TEST(CommandLineTest, ReparseCommandLineOptions) {
   EXPECT_TRUE(TopLevelOpt);
 }
 
+TEST(CommandLineTest, DeferredRegistration) {
+  cl::ResetCommandLineParser();
+
+  StackOption<bool> Deferred("deferred-option", cl::init(false));
+  StackOption<std::string> Input(cl::Positional, cl::desc("<input>"));
+
+  // Positional arguments alone do not need the named options.
+  const char *args1[] = {"prog", "input.ll"};
+  EXPECT_TRUE(
+      cl::ParseCommandLineOptions(2, args1, StringRef(), &llvm::nulls()));
+  EXPECT_EQ("input.ll", Input);
+  EXPECT_FALSE(Deferred);
+
+  // Naming the option registers it on demand.
+  cl::ResetAllOptionOccurrences();
+  const char *args2[] = {"prog", "-deferred-option"};
+  EXPECT_TRUE(
+      cl::ParseCommandLineOptions(2, args2, StringRef(), &llvm::nulls()));
+  EXPECT_TRUE(Deferred);
+
+  // Options constructed after a parse are still visible to lookups.
+  StackOption<bool> Late("late-option", cl::init(false));
+  EXPECT_EQ(1u, cl::getRegisteredOptions().count("late-option"));
+}
+
 TEST(CommandLineTest, RemoveFromRegularSubCommand) {
   cl::ResetCommandLineParser();
 
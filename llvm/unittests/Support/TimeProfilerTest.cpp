@@ -0,0 +1,85 @@
+//===- unittests/TimeProfilerTest.cpp - Time trace profiler tests ---------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/Support/TimeProfiler.h"
+#include "llvm/Support/CommandLine.h"
+#include "llvm/Support/JSON.h"
+#include "gtest/gtest.h"
+
+using namespace llvm;
+
+namespace {
+
+// Record every section regardless of how long it takes.
+void setZeroGranularity() {
+  StringMap<cl::Option *> &Map = cl::getRegisteredOptions();
+  ASSERT_TRUE(Map.count("time-trace-granularity"));
+  auto *Granularity =
+      static_cast<cl::opt<unsigned> *>(Map["time-trace-granularity"]);
+  *Granularity = 0;
+}
+
+std::string writeTrace() {
+  std::string Trace;
+  raw_string_ostream OS(Trace);
+  timeTraceProfilerWrite(OS);
+  return OS.str();
+}
+
+TEST(TimeProfiler, Disabled) {
+  EXPECT_FALSE(timeTraceProfilerEnabled());
+  // Scopes are no-ops while the profiler is not initialized.
+  TimeTraceScope Scope("Outer", StringRef("detail"));
+  timeTraceProfilerBegin("Manual", StringRef(""));
+  timeTraceProfilerEnd();
+}
+
+TEST(TimeProfiler, Events) {
+  setZeroGranularity();
+  timeTraceProfilerInitialize();
+  EXPECT_TRUE(timeTraceProfilerEnabled());
+  {
+    TimeTraceScope Outer("Outer", StringRef("first \"quoted\" detail"));
+    TimeTraceScope Inner("Inner", [] { return std::string("lazy detail"); });
+    // Nested sections with the same name only count once towards the total.
+    TimeTraceScope NestedOuter("Outer", StringRef(""));
+  }
+  std::string Trace = writeTrace();
+  timeTraceProfilerCleanup();
+  EXPECT_FALSE(timeTraceProfilerEnabled());
+
+  auto Parsed = json::parse(Trace);
+  ASSERT_TRUE(bool(Parsed)) << toString(Parsed.takeError());
+  const json::Array *Events = Parsed->getAsObject()->getArray("traceEvents");
+  ASSERT_TRUE(Events);
+
+  unsigned NumOuter = 0, NumInner = 0;
+  Optional<int64_t> OuterTotalCount;
+  for (const json::Value &V : *Events) {
+    const json::Object *E = V.getAsObject();
+    ASSERT_TRUE(E);
+    Optional<StringRef> Name = E->getString("name");
+    ASSERT_TRUE(Name.hasValue());
+    const json::Object *Args = E->getObject("args");
+    if (*Name == "Outer") {
+      ++NumOuter;
+    } else if (*Name == "Inner") {
+      ++NumInner;
+      EXPECT_EQ(StringRef("lazy detail"), *Args->getString("detail"));
+    } else if (*Name == "Total Outer") {
+      OuterTotalCount = Args->getInteger("count");
+    }
+  }
+  EXPECT_EQ(2u, NumOuter);
+  EXPECT_EQ(1u, NumInner);
+  ASSERT_TRUE(OuterTotalCount.hasValue());
+  EXPECT_EQ(1, *OuterTotalCount);
+}
+
+} // end anonymous namespace
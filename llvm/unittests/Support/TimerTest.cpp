@@ -8,7 +8,14 @@
 //===----------------------------------------------------------------------===//
 
 #include "llvm/Support/Timer.h"
+#include "llvm/Config/llvm-config.h"
+#include "llvm/Support/CommandLine.h"
+#include "llvm/Support/JSON.h"
+#include "llvm/Support/TimeProfiler.h"
+#include "llvm/Support/raw_ostream.h"
 #include "gtest/gtest.h"
+#include <thread>
+#include <vector>
 
 #if _WIN32
 #include <windows.h>
@@ -62,4 +69,77 @@ TEST(Timer, CheckIfTriggered) {
   EXPECT_FALSE(T1.hasTriggered());
 }
 
+#if LLVM_ENABLE_THREADS
+TEST(Timer, ConcurrentThreads) {
+  Timer T1("T1", "T1");
+
+  // Every thread runs the timer at the same time; each pairs its own calls.
+  std::vector<std::thread> Threads;
+  for (unsigned I = 0; I != 4; ++I)
+    Threads.emplace_back([&T1] {
+      for (unsigned J = 0; J != 100; ++J) {
+        T1.startTimer();
+        EXPECT_TRUE(T1.isRunning());
+        if (J == 0)
+          SleepMS();
+        T1.stopTimer();
+        EXPECT_FALSE(T1.isRunning());
+      }
+    });
+  for (std::thread &T : Threads)
+    T.join();
+
+  EXPECT_TRUE(T1.hasTriggered());
+  EXPECT_FALSE(T1.isRunning());
+  // Each thread slept for at least a millisecond while the timer was running.
+  EXPECT_GE(T1.getTotalTime().getWallTime(), 0.004);
+}
+#endif
+
+TEST(Timer, TimeTraceProfiler) {
+  // Record the interval however short it is.
+  StringMap<cl::Option *> &Map = cl::getRegisteredOptions();
+  ASSERT_TRUE(Map.count("time-trace-granularity"));
+  *static_cast<cl::opt<unsigned> *>(Map["time-trace-granularity"]) = 0;
+
+  timeTraceProfilerInitialize();
+  TimerGroup TG("tracegroup", "Trace Group");
+  Timer T1("T1", "traced timer", TG);
+  T1.startTimer();
+  T1.stopTimer();
+  T1.clear();
+#if LLVM_ENABLE_THREADS
+  // Only the thread that initialized the profiler records sections.
+  Timer T2("T2", "untraced timer", TG);
+  std::thread([&] {
+    T2.startTimer();
+    T2.stopTimer();
+  }).join();
+  T2.clear();
+#endif
+
+  std::string Trace;
+  raw_string_ostream OS(Trace);
+  timeTraceProfilerWrite(OS);
+  timeTraceProfilerCleanup();
+  OS.flush();
+
+  auto Parsed = json::parse(Trace);
+  ASSERT_TRUE(bool(Parsed)) << toString(Parsed.takeError());
+  const json::Array *Events = Parsed->getAsObject()->getArray("traceEvents");
+  ASSERT_TRUE(Events);
+  bool Found = false;
+  for (const json::Value &E : *Events) {
+    const json::Object *Event = E.getAsObject();
+    EXPECT_NE(StringRef("untraced timer"), *Event->getString("name"));
+    if (Event->getString("name") != StringRef("traced timer"))
+      continue;
+    Found = true;
+    EXPECT_EQ(StringRef("X"), *Event->getString("ph"));
+    EXPECT_EQ(StringRef("tracegroup"),
+              *Event->getObject("args")->getString("detail"));
+  }
+  EXPECT_TRUE(Found);
+}
+
 } // end anon namespace
@@ -0,0 +1,135 @@
+//===- raw_async_ostream_test.cpp - raw_async_ostream tests ---------------===//
+//
+//                     The LLVM Compiler Infrastructure
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/Support/raw_async_ostream.h"
+#include "llvm/ADT/SmallString.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/FileUtilities.h"
+#include "llvm/Support/FormattedStream.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "gtest/gtest.h"
+
+#include <string>
+
+using namespace llvm;
+
+namespace {
+
+class raw_async_ostreamTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    ASSERT_FALSE(sys::fs::createTemporaryFile("async", "txt", FD, Path));
+  }
+
+  void TearDown() override { sys::fs::remove(Path); }
+
+  std::string readBack() {
+    auto Buf = MemoryBuffer::getFile(Path);
+    EXPECT_TRUE(bool(Buf));
+    return Buf ? (*Buf)->getBuffer().str() : std::string();
+  }
+
+  int FD;
+  SmallString<64> Path;
+};
+
+TEST_F(raw_async_ostreamTest, SmallBuffers) {
+  std::string Expected;
+  {
+    raw_fd_ostream FOS(FD, true);
+    // Tiny buffers force many hand-offs to the writer thread.
+    raw_async_ostream OS(FOS, 7, 3);
+    for (unsigned I = 0; I != 1000; ++I) {
+      OS << I << ' ';
+      Expected += std::to_string(I) + ' ';
+    }
+    EXPECT_EQ(Expected.size(), OS.tell());
+  }
+  EXPECT_EQ(Expected, readBack());
+}
+
+TEST_F(raw_async_ostreamTest, LargeWrites) {
+  std::string Big(10000, 'x');
+  std::string Expected;
+  {
+    raw_fd_ostream FOS(FD, true);
+    raw_async_ostream OS(FOS, 64);
+    for (unsigned I = 0; I != 10; ++I) {
+      OS << "ab";
+      OS << Big;
+      Expected += "ab" + Big;
+    }
+  }
+  EXPECT_EQ(Expected, readBack());
+}
+
+TEST_F(raw_async_ostreamTest, Formatted) {
+  std::string Expected;
+  {
+    raw_fd_ostream FOS(FD, true);
+    raw_async_ostream OS(FOS, 32);
+    OS << "start\n";
+    Expected += "start\n";
+    {
+      // formatted_raw_ostream makes the stream it wraps unbuffered and later
+      // gives it an internal buffer of its own.
+      formatted_raw_ostream FOut(OS);
+      for (unsigned I = 0; I != 100; ++I) {
+        FOut << I;
+        FOut.PadToColumn(8);
+        FOut << "x\n";
+        Expected += std::to_string(I);
+        Expected += std::string(8 - std::to_string(I).size(), ' ') + "x\n";
+      }
+    }
+    OS << "end";
+    Expected += "end";
+  }
+  EXPECT_EQ(Expected, readBack());
+}
+
+TEST_F(raw_async_ostreamTest, PWrite) {
+  {
+    raw_fd_ostream FOS(FD, true);
+    raw_async_ostream OS(FOS, 16);
+    OS << "0123456789abcdefghij";
+    OS.pwrite("XY", 2, 3);
+    OS << "tail";
+    OS.pwrite("Z", 1, 19);
+  }
+  EXPECT_EQ("012XY56789abcdefghiZtail", readBack());
+}
+
+TEST_F(raw_async_ostreamTest, Drain) {
+  raw_fd_ostream FOS(FD, true);
+  raw_async_ostream OS(FOS, 4);
+  OS << "hello, world";
+  OS.drain();
+  EXPECT_EQ("hello, world", readBack());
+  OS << "!";
+}
+
+TEST(raw_fd_ostreamTest, WriteV) {
+  int FD;
+  SmallString<64> Path;
+  ASSERT_FALSE(sys::fs::createTemporaryFile("writev", "txt", FD, Path));
+  FileRemover Cleanup(Path);
+  {
+    raw_fd_ostream OS(FD, true);
+    OS << "head ";
+    StringRef Chunks[] = {"one ", "", "two ", "three"};
+    OS.writev(Chunks);
+    EXPECT_EQ(18u, OS.tell());
+  }
+  auto Buf = MemoryBuffer::getFile(Path);
+  ASSERT_TRUE(bool(Buf));
+  EXPECT_EQ("head one two three", (*Buf)->getBuffer());
+}
+
+} // end anonymous namespace